@@ -52,6 +52,7 @@
 #include "cs_sles_default.h"
 #include "cs_sles.h"
 #include "cs_sles_it.h"
+#include "cs_sles_ldlt.h"
 #include "cs_sles_pc.h"
 
 // Avoid extra warnings by not including this by default...
@@ -134,6 +134,12 @@ struct _cs_grid_t {
 
   const struct _cs_grid_t  *parent; /* Pointer to parent (finer) grid */
 
+  /* Optional groups of rows defining the next coarsening (shared) */
+
+  cs_lnum_t          n_row_groups;   /* Number of row groups */
+  const cs_lnum_t   *row_group_idx;  /* Index of rows for each group */
+  const cs_lnum_t   *row_group_ids;  /* Row ids for each group */
+
   /* Connectivity information */
 
   cs_lnum_t           n_faces;      /* Local number of faces */
@@ -251,6 +257,13 @@ cs_real_t _penalization_threshold = 1e4;
 
 cs_real_t _dd_threshold_pw = 5;
 
+/* Threshold for the strength of connection based aggregation at the
+   finest level: row j is strongly connected to row i if
+   |a_ij| >= theta.sqrt(|a_ii.a_jj|). This threshold is halved at each
+   coarser level, as the coarse operators are denser. */
+
+cs_real_t _soc_threshold = 0.08;
+
 /* Names for coarsening options */
 
 const char *cs_grid_coarsening_type_name[]
@@ -258,7 +271,8 @@ const char *cs_grid_coarsening_type_name[]
      N_("SPD, diag/extra-diag ratio based"),
      N_("SPD, max extra-diag ratio based"),
      N_("SPD, (multiple) pairwise aggregation"),
-     N_("convection + diffusion")};
+     N_("convection + diffusion"),
+     N_("SPD, strength of connection based")};
 
 /* Select tuning options */
 
@@ -382,6 +396,10 @@ _create_grid(void)
   g->parent = NULL;
   g->conv_diff = false;
 
+  g->n_row_groups = 0;
+  g->row_group_idx = NULL;
+  g->row_group_ids = NULL;
+
   g->relaxation = 0;
 
   g->face_cell = NULL;
@@ -3287,6 +3305,421 @@ _automatic_aggregation_mx_msr(const cs_grid_t  *f,
   BFT_FREE(penalize);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute the strength of connection between two rows.
+ *
+ * parameters:
+ *   x_val    <-- extra-diagonal coefficient a_ij
+ *   d_sqrt_i <-- square root of |a_ii|
+ *   d_sqrt_j <-- square root of |a_jj|
+ *
+ * returns:
+ *   |a_ij| / sqrt(|a_ii.a_jj|)
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_soc_strength(cs_real_t  x_val,
+              cs_real_t  d_sqrt_i,
+              cs_real_t  d_sqrt_j)
+{
+  const cs_real_t  den = d_sqrt_i*d_sqrt_j;
+
+  if (den > 0)
+    return fabs(x_val)/den;
+  else
+    return (fabs(x_val) > 0) ? HUGE_VAL : 0.;
+}
+
+/*----------------------------------------------------------------------------
+ * Move the (at most) n_max strongest candidates at the beginning of the
+ * list of candidates.
+ *
+ * parameters:
+ *   n_max    <-- max. number of candidates to keep
+ *   n        <-- number of candidates
+ *   ids      <-> ids of the candidates
+ *   s        <-> strength of connection of the candidates
+ *
+ * returns:
+ *   number of candidates kept
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_soc_select(cs_lnum_t   n_max,
+            cs_lnum_t   n,
+            cs_lnum_t   ids[],
+            cs_real_t   s[])
+{
+  if (n <= n_max)
+    return n;
+
+  for (cs_lnum_t i = 0; i < n_max; i++) {
+    cs_lnum_t k = i;
+    for (cs_lnum_t j = i+1; j < n; j++)
+      if (s[j] > s[k])
+        k = j;
+    if (k != i) {
+      cs_lnum_t  t_id = ids[i];
+      cs_real_t  t_s = s[i];
+      ids[i] = ids[k]; s[i] = s[k];
+      ids[k] = t_id; s[k] = t_s;
+    }
+  }
+
+  return n_max;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a coarse grid level from the previous level using an aggregation
+ * based on the strength of connection between rows, with a matrix in
+ * MSR format.
+ *
+ * Row j is strongly connected to row i if |a_ij| >= theta.sqrt(|a_ii.a_jj|),
+ * so that positive extra-diagonal coefficients, which are common with
+ * CDO vertex-based or face-based schemes, are also taken into account
+ * (contrary to the SPD_MX variant). Aggregates are built in 3 phases:
+ *   1) a row whose strong neighbors are all free forms an aggregate with
+ *      its strongest neighbors;
+ *   2) a remaining row joins the aggregate to which it is the most strongly
+ *      connected;
+ *   3) remaining rows are aggregated with their free strong neighbors.
+ *
+ * parameters:
+ *   f                   <-- Fine grid structure
+ *   max_aggregation     <-- Max fine rows per coarse row
+ *   verbosity           <-- Verbosity level
+ *   f_c_row             --> Fine row -> coarse row connectivity
+ *----------------------------------------------------------------------------*/
+
+static void
+_automatic_aggregation_soc_msr(const cs_grid_t  *f,
+                               cs_lnum_t         max_aggregation,
+                               int               verbosity,
+                               cs_lnum_t        *f_c_row)
+{
+  const cs_lnum_t f_n_rows = f->n_rows;
+
+  cs_lnum_t c_n_rows = 0;
+  cs_lnum_t n_aggr_rows[3] = {0, 0, 0};
+
+  cs_lnum_t *c_aggr_count = NULL, *s_ids = NULL;
+  bool *penalize = NULL;
+  cs_real_t *d_sqrt = NULL, *s_val = NULL;
+
+  /* Algorithm parameters */
+  const cs_real_t theta = _soc_threshold * pow(0.5, f->level);
+  const cs_real_t p_test = (f->level == 0) ? 1. : -1;
+  const cs_lnum_t _max_aggregation = CS_MAX(max_aggregation, 2);
+
+  if (verbosity > 3)
+    bft_printf("\n     %s: theta: %5.3e; max_aggregation: %d;"
+               " pena_thd: %5.3e, p_test: %g\n",
+               __func__, theta, (int)_max_aggregation,
+               _penalization_threshold, p_test);
+
+  /* Access matrix MSR vectors */
+
+  const cs_lnum_t  *row_index, *col_id;
+  const cs_real_t  *d_val, *x_val;
+  cs_real_t *_d_val = NULL, *_x_val = NULL;
+
+  cs_matrix_get_msr_arrays(f->matrix,
+                           &row_index,
+                           &col_id,
+                           &d_val,
+                           &x_val);
+
+  const cs_lnum_t *db_size = f->db_size;
+  const cs_lnum_t *eb_size = f->eb_size;
+
+  if (db_size[0] > 1) {
+    BFT_MALLOC(_d_val, f_n_rows, cs_real_t);
+    _reduce_block(f_n_rows, db_size, d_val, _d_val);
+    d_val = _d_val;
+  }
+
+  if (eb_size[0] > 1) {
+    cs_lnum_t f_n_enz = row_index[f_n_rows];
+    BFT_MALLOC(_x_val, f_n_enz, cs_real_t);
+    _reduce_block(f_n_enz, eb_size, x_val, _x_val);
+    x_val = _x_val;
+  }
+
+  /* Allocate working arrays */
+
+  BFT_MALLOC(c_aggr_count, f_n_rows, cs_lnum_t);
+  BFT_MALLOC(d_sqrt, f_n_rows, cs_real_t);
+  BFT_MALLOC(penalize, f_n_rows, bool);
+
+  cs_lnum_t n_max_cols = 0;
+
+# pragma omp parallel for reduction(max:n_max_cols) \
+  if (f_n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+    c_aggr_count[ii] = 0;
+    d_sqrt[ii] = sqrt(fabs(d_val[ii]));
+
+    cs_real_t  sum = 0.0;
+    for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++)
+      sum += fabs(x_val[jj]);
+
+    /* Check if the line seems penalized or not. */
+    penalize[ii] = (d_val[ii]*p_test > _penalization_threshold * sum);
+
+    n_max_cols = CS_MAX(n_max_cols, row_index[ii+1] - row_index[ii]);
+
+  }
+
+  BFT_MALLOC(s_ids, n_max_cols, cs_lnum_t);
+  BFT_MALLOC(s_val, n_max_cols, cs_real_t);
+
+  /* Phase 1: rows whose strong neighborhood is free become roots of new
+     aggregates */
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+    if (penalize[ii] || f_c_row[ii] > -1)
+      continue;
+
+    bool is_free = true;
+    cs_lnum_t n_s = 0;
+
+    for (cs_lnum_t jidx = row_index[ii]; jidx < row_index[ii+1]; jidx++) {
+
+      cs_lnum_t jj = col_id[jidx];
+
+      /* Exclude rows on parallel or periodic boundary, so as not to */
+      /* coarsen the grid across those boundaries. */
+
+      if (jj >= f_n_rows || penalize[jj])
+        continue;
+
+      cs_real_t s = _soc_strength(x_val[jidx], d_sqrt[ii], d_sqrt[jj]);
+      if (s >= theta) {
+        if (f_c_row[jj] > -1) {
+          is_free = false;
+          break;
+        }
+        s_ids[n_s] = jj;
+        s_val[n_s] = s;
+        n_s++;
+      }
+
+    }
+
+    if (!is_free || n_s == 0)
+      continue;
+
+    n_s = _soc_select(_max_aggregation - 1, n_s, s_ids, s_val);
+
+    f_c_row[ii] = c_n_rows;
+    for (cs_lnum_t k = 0; k < n_s; k++)
+      f_c_row[s_ids[k]] = c_n_rows;
+    c_aggr_count[c_n_rows] = n_s + 1;
+    n_aggr_rows[0] += n_s + 1;
+    c_n_rows++;
+
+  }
+
+  /* Phase 2: remaining rows join the aggregate of their strongest
+     neighbor if possible */
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+    if (penalize[ii] || f_c_row[ii] > -1)
+      continue;
+
+    cs_lnum_t c_best = -1;
+    cs_real_t s_best = theta;
+
+    for (cs_lnum_t jidx = row_index[ii]; jidx < row_index[ii+1]; jidx++) {
+
+      cs_lnum_t jj = col_id[jidx];
+
+      if (jj >= f_n_rows || penalize[jj] || f_c_row[jj] < 0)
+        continue;
+      if (c_aggr_count[f_c_row[jj]] >= _max_aggregation)
+        continue;
+
+      cs_real_t s = _soc_strength(x_val[jidx], d_sqrt[ii], d_sqrt[jj]);
+      if (s >= s_best) {
+        s_best = s;
+        c_best = f_c_row[jj];
+      }
+
+    }
+
+    if (c_best > -1) {
+      f_c_row[ii] = c_best;
+      c_aggr_count[c_best] += 1;
+      n_aggr_rows[1] += 1;
+    }
+
+  }
+
+  /* Phase 3: remaining rows are aggregated with their free strong
+     neighbors (or form their own aggregate) */
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+    if (penalize[ii] || f_c_row[ii] > -1)
+      continue;
+
+    cs_lnum_t n_s = 0;
+
+    for (cs_lnum_t jidx = row_index[ii]; jidx < row_index[ii+1]; jidx++) {
+
+      cs_lnum_t jj = col_id[jidx];
+
+      if (jj >= f_n_rows || penalize[jj] || f_c_row[jj] > -1)
+        continue;
+
+      cs_real_t s = _soc_strength(x_val[jidx], d_sqrt[ii], d_sqrt[jj]);
+      if (s >= theta) {
+        s_ids[n_s] = jj;
+        s_val[n_s] = s;
+        n_s++;
+      }
+
+    }
+
+    n_s = _soc_select(_max_aggregation - 1, n_s, s_ids, s_val);
+
+    f_c_row[ii] = c_n_rows;
+    for (cs_lnum_t k = 0; k < n_s; k++)
+      f_c_row[s_ids[k]] = c_n_rows;
+    c_aggr_count[c_n_rows] = n_s + 1;
+    n_aggr_rows[2] += n_s + 1;
+    c_n_rows++;
+
+  }
+
+  if (verbosity > 3)
+    bft_printf("     %s: rows aggregated by phase: %ld %ld %ld;"
+               " coarse rows: %ld\n",
+               __func__, (long)n_aggr_rows[0], (long)n_aggr_rows[1],
+               (long)n_aggr_rows[2], (long)c_n_rows);
+
+  /* Free working arrays */
+
+  BFT_FREE(_d_val);
+  BFT_FREE(_x_val);
+  BFT_FREE(c_aggr_count);
+  BFT_FREE(d_sqrt);
+  BFT_FREE(penalize);
+  BFT_FREE(s_ids);
+  BFT_FREE(s_val);
+}
+
+/*----------------------------------------------------------------------------
+ * Build a coarse grid level from the previous level using the groups of
+ * rows attached to the fine grid (for instance the faces of each cell
+ * for CDO face-based schemes).
+ *
+ * Each group defines a coarse row with its rows not yet aggregated.
+ * Rows belonging to no group form their own coarse row, and penalized
+ * rows (with a matrix in MSR format) are excluded, as for the SPD_MX
+ * variant.
+ *
+ * parameters:
+ *   f                   <-- Fine grid structure
+ *   verbosity           <-- Verbosity level
+ *   f_c_row             --> Fine row -> coarse row connectivity
+ *----------------------------------------------------------------------------*/
+
+static void
+_aggregation_row_groups(const cs_grid_t  *f,
+                        int               verbosity,
+                        cs_lnum_t        *f_c_row)
+{
+  const cs_lnum_t f_n_rows = f->n_rows;
+
+  cs_lnum_t c_n_rows = 0, n_single = 0;
+  bool *penalize = NULL;
+
+  BFT_MALLOC(penalize, f_n_rows, bool);
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++)
+    penalize[ii] = false;
+
+  if (cs_matrix_get_type(f->matrix) == CS_MATRIX_MSR) {
+
+    const cs_real_t p_test = (f->level == 0) ? 1. : -1;
+    const cs_lnum_t *db_size = f->db_size;
+    const cs_lnum_t *eb_size = f->eb_size;
+
+    const cs_lnum_t  *row_index, *col_id;
+    const cs_real_t  *d_val, *x_val;
+
+    cs_matrix_get_msr_arrays(f->matrix,
+                             &row_index,
+                             &col_id,
+                             &d_val,
+                             &x_val);
+
+#   pragma omp parallel for if (f_n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+      cs_real_t  d = 0.0, sum = 0.0;
+      for (cs_lnum_t k = 0; k < db_size[0]; k++)
+        d += d_val[ii*db_size[3] + db_size[2]*k + k];
+      d /= db_size[0];
+
+      for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++) {
+        cs_real_t  x = 0.0;
+        for (cs_lnum_t k = 0; k < eb_size[0]; k++)
+          x += x_val[jj*eb_size[3] + eb_size[2]*k + k];
+        sum += fabs(x) / eb_size[0];
+      }
+
+      if (d*p_test > _penalization_threshold * sum)
+        penalize[ii] = true;
+
+    }
+
+  }
+
+  /* Aggregate rows group by group */
+
+  for (cs_lnum_t g_id = 0; g_id < f->n_row_groups; g_id++) {
+
+    cs_lnum_t n_new = 0;
+
+    for (cs_lnum_t k = f->row_group_idx[g_id];
+         k < f->row_group_idx[g_id+1];
+         k++) {
+      cs_lnum_t ii = f->row_group_ids[k];
+      if (ii < f_n_rows && !penalize[ii] && f_c_row[ii] < 0) {
+        f_c_row[ii] = c_n_rows;
+        n_new++;
+      }
+    }
+
+    if (n_new > 0)
+      c_n_rows++;
+
+  }
+
+  /* Remaining rows form their own aggregate */
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+    if (!penalize[ii] && f_c_row[ii] < 0) {
+      f_c_row[ii] = c_n_rows;
+      c_n_rows++;
+      n_single++;
+    }
+  }
+
+  if (verbosity > 3)
+    bft_printf("\n     %s: n_groups: %ld; coarse rows: %ld"
+               " (including %ld single rows)\n",
+               __func__, (long)f->n_row_groups, (long)c_n_rows,
+               (long)n_single);
+
+  BFT_FREE(penalize);
+}
+
 /*----------------------------------------------------------------------------
  * Build a coarse grid level from the previous level using
  * an automatic criterion, using the face to cells adjacency.
@@ -5473,6 +5906,36 @@ cs_grid_get_matrix(const cs_grid_t  *g)
   return m;
 }
 
+/*----------------------------------------------------------------------------
+ * Define groups of rows to be aggregated when coarsening a grid.
+ *
+ * Each group defines (at most) one coarse row; rows belonging to several
+ * groups are assigned to the first one. Rows not belonging to any group
+ * form their own coarse row. This allows a geometric first coarsening
+ * step, for instance merging the face-based unknowns of a cell.
+ *
+ * Arrays are shared and must remain available while the grid is used.
+ *
+ * parameters:
+ *   g             <-> Grid structure
+ *   n_groups      <-- number of row groups
+ *   group_idx     <-- index of rows in each group (size: n_groups + 1)
+ *   group_ids     <-- row ids of each group (local ids)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_row_groups(cs_grid_t        *g,
+                       cs_lnum_t         n_groups,
+                       const cs_lnum_t   group_idx[],
+                       const cs_lnum_t   group_ids[])
+{
+  assert(g != NULL);
+
+  g->n_row_groups = n_groups;
+  g->row_group_idx = group_idx;
+  g->row_group_ids = group_ids;
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -5617,9 +6080,18 @@ cs_grid_coarsen(const cs_grid_t  *f,
       coarsening_type = CS_GRID_COARSENING_SPD_MX;
   }
 
+  else if (coarsening_type == CS_GRID_COARSENING_SPD_SOC) {
+    /* closest altenative */
+    if (fine_matrix_type != CS_MATRIX_MSR)
+      coarsening_type = CS_GRID_COARSENING_SPD_MX;
+  }
+
   /* Determine fine->coarse cell connectivity (aggregation) */
 
-  if (   coarsening_type == CS_GRID_COARSENING_SPD_DX
+  if (f->row_group_idx != NULL)
+    _aggregation_row_groups(f, verbosity, c->coarse_row);
+
+  else if (   coarsening_type == CS_GRID_COARSENING_SPD_DX
       || coarsening_type == CS_GRID_COARSENING_CONV_DIFF_DX) {
     if (f->face_cell != NULL)
       _automatic_aggregation_fc(f,
@@ -5647,6 +6119,10 @@ cs_grid_coarsen(const cs_grid_t  *f,
                 _(cs_matrix_type_name[fine_matrix_type]));
     }
   }
+  else if (coarsening_type == CS_GRID_COARSENING_SPD_SOC) {
+    _automatic_aggregation_soc_msr(f, aggregation_limit, verbosity,
+                                   c->coarse_row);
+  }
   else if (coarsening_type == CS_GRID_COARSENING_SPD_PW) {
     switch (fine_matrix_type) {
     case CS_MATRIX_MSR:
@@ -57,8 +57,10 @@ typedef enum {
   CS_GRID_COARSENING_SPD_DX,         /*!< SPD, diag/extradiag ratio based */
   CS_GRID_COARSENING_SPD_MX,         /*!< SPD, max extradiag ratio based */
   CS_GRID_COARSENING_SPD_PW,         /*!< SPD, pairwise aggregation */
-  CS_GRID_COARSENING_CONV_DIFF_DX    /*!< convection+diffusion,
+  CS_GRID_COARSENING_CONV_DIFF_DX,   /*!< convection+diffusion,
                                           diag/extradiag ratio based */
+  CS_GRID_COARSENING_SPD_SOC         /*!< SPD, strength of connection based
+                                          (suited to CDO systems) */
 
 } cs_grid_coarsening_t;
 
@@ -254,6 +256,29 @@ cs_grid_get_n_g_rows(const cs_grid_t  *g);
 const cs_matrix_t *
 cs_grid_get_matrix(const cs_grid_t  *g);
 
+/*----------------------------------------------------------------------------
+ * Define groups of rows to be aggregated when coarsening a grid.
+ *
+ * Each group defines (at most) one coarse row; rows belonging to several
+ * groups are assigned to the first one. Rows not belonging to any group
+ * form their own coarse row. This allows a geometric first coarsening
+ * step, for instance merging the face-based unknowns of a cell.
+ *
+ * Arrays are shared and must remain available while the grid is used.
+ *
+ * parameters:
+ *   g             <-> Grid structure
+ *   n_groups      <-- number of row groups
+ *   group_idx     <-- index of rows in each group (size: n_groups + 1)
+ *   group_ids     <-- row ids of each group (local ids)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_row_groups(cs_grid_t        *g,
+                       cs_lnum_t         n_groups,
+                       const cs_lnum_t   group_idx[],
+                       const cs_lnum_t   group_ids[]);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
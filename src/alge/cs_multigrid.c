@@ -64,6 +64,7 @@
 #include "cs_post.h"
 #include "cs_sles.h"
 #include "cs_sles_it.h"
+#include "cs_sles_ldlt.h"
 #include "cs_sles_pc.h"
 #include "cs_timer.h"
 #include "cs_time_plot.h"
@@ -270,6 +271,9 @@ struct _cs_multigrid_t {
   int        n_levels_max;       /* Maximum number of grid levels */
   cs_gnum_t  n_g_rows_min;       /* Global number of rows on coarse grids
                                     under which no coarsening occurs */
+  cs_gnum_t  n_g_rows_direct;    /* Global number of rows of the coarsest
+                                    grid under which it is solved with a
+                                    sparse direct solver (0: never) */
 
   int        post_row_max;       /* If > 0, activates postprocessing of
                                     coarsening, projecting coarse cell
@@ -299,6 +303,16 @@ struct _cs_multigrid_t {
                                     base grid */
   char      *post_name;          /* Name for postprocessing */
 
+  /* Optional groups of rows defining the first coarsening
+     (system-specific, so not copied with the settings) */
+
+  cs_lnum_t  n_group_rows;       /* Number of rows of the systems to which
+                                    row groups apply */
+  cs_lnum_t  n_row_groups;       /* Number of groups of rows defining
+                                    the first coarsening, or 0 */
+  cs_lnum_t *row_group_idx;      /* Index of rows in each group, or NULL */
+  cs_lnum_t *row_group_ids;      /* Row ids of each group, or NULL */
+
   /* Options and maintained state (statistics) */
 
   cs_multigrid_level_info_t  *lv_info;      /* Info for each level */
@@ -475,6 +489,16 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                 mg->n_levels_max, (unsigned long long)(mg->n_g_rows_min),
                 mg->p0p1_relax, mg->info.n_max_cycles);
 
+  if (mg->row_group_idx != NULL)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("    First coarsening by row groups:  %ld groups\n"),
+                  (long)(mg->n_row_groups));
+
+  if (mg->n_g_rows_direct > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("    Direct coarse solve under:       %llu rows\n"),
+                  (unsigned long long)(mg->n_g_rows_direct));
+
 #if defined(HAVE_MPI)
   if (cs_glob_n_ranks > 1)
     cs_log_printf(CS_LOG_SETUP,
@@ -1590,6 +1614,7 @@ _multigrid_create_k_cycle_bottom(cs_multigrid_t  *parent)
   mg->coarsening_type = CS_GRID_COARSENING_DEFAULT; /* Not used here */
   mg->n_levels_max = 2;
   mg->n_g_rows_min = 1;
+  mg->n_g_rows_direct = 0;
 
   mg->pc_precision = 0.0;
   mg->pc_r_norm = 0.0;
@@ -1698,6 +1723,86 @@ _multigrid_setup_sles_work_arrays(cs_multigrid_t  *mg,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Create the coarsest level solver of a multigrid hierarchy.
+ *
+ * A sparse direct solver, gathering the coarsest system on the first rank
+ * of the grid's communicator, is used for small enough scalar systems if
+ * allowed (the system is then assumed to be symmetric); an iterative solver
+ * is used otherwise.
+ *
+ * parameters:
+ *   mg       <-- pointer to multigrid solver info and context
+ *   g        <-- coarsest grid
+ *   mg_sles  <-> associated multigrid solver
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_create_coarse_sles(const cs_multigrid_t  *mg,
+                              const cs_grid_t       *g,
+                              cs_mg_sles_t          *mg_sles)
+{
+  bool  use_direct = false;
+
+  if (mg->n_g_rows_direct > 0 && mg->lv_mg[2] == NULL) {
+
+    cs_lnum_t  db_size[4] = {1, 1, 1, 1};
+    cs_gnum_t  n_g_rows = 0;
+
+    cs_grid_get_info(g, NULL, NULL, db_size, NULL, NULL,
+                     NULL, NULL, NULL, &n_g_rows);
+
+#if defined(HAVE_MPI)
+    if (mg->caller_comm != MPI_COMM_NULL && cs_glob_n_ranks > 1) {
+      cs_gnum_t  _n_g_rows = n_g_rows;
+      MPI_Allreduce(&_n_g_rows, &n_g_rows, 1, CS_MPI_GNUM, MPI_MAX,
+                    mg->caller_comm);
+    }
+#endif
+
+    if (db_size[0] == 1 && n_g_rows <= mg->n_g_rows_direct)
+      use_direct = true;
+
+  }
+
+  if (use_direct) {
+
+    mg_sles->context = cs_sles_ldlt_create(-1);
+    mg_sles->setup_func = cs_sles_ldlt_setup;
+    mg_sles->solve_func = cs_sles_ldlt_solve;
+    mg_sles->destroy_func = cs_sles_ldlt_destroy;
+
+#if defined(HAVE_MPI)
+    cs_sles_ldlt_set_mpi_comm(mg_sles->context, cs_grid_get_comm(g));
+#endif
+
+    return;
+  }
+
+  mg_sles->context
+    = cs_sles_it_create(mg->info.type[2],
+                        mg->info.poly_degree[2],
+                        mg->info.n_max_iter[2],
+                        false); /* stats not updated here */
+  mg_sles->setup_func = cs_sles_it_setup;
+  mg_sles->solve_func = cs_sles_it_solve;
+  mg_sles->destroy_func = cs_sles_it_destroy;
+
+  if (mg->lv_mg[2] != NULL) {
+    cs_sles_pc_t *pc = _pc_create_from_mg_sub(mg->lv_mg[2]);
+    cs_sles_it_transfer_pc(mg_sles->context, &pc);
+  }
+
+#if defined(HAVE_MPI)
+  {
+    cs_sles_it_t  *context = mg_sles->context;
+    cs_sles_it_set_mpi_reduce_comm(context,
+                                   cs_grid_get_comm(g),
+                                   mg->comm);
+  }
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Setup multigrid sparse linear equation solvers on existing hierarchy.
  *
@@ -1801,28 +1906,7 @@ _multigrid_setup_sles_k_cycle_bottom(cs_multigrid_t  *mg,
   mg_lv_info = mg->lv_info + 1;
 
   mg_sles = &(mgd->sles_hierarchy[2]);
-  mg_sles->context
-    = cs_sles_it_create(mg->info.type[2],
-                        mg->info.poly_degree[2],
-                        mg->info.n_max_iter[2],
-                        false); /* stats not updated here */
-  mg_sles->setup_func = cs_sles_it_setup;
-  mg_sles->solve_func = cs_sles_it_solve;
-  mg_sles->destroy_func = cs_sles_it_destroy;
-
-  if (mg->lv_mg[2] != NULL) {
-    cs_sles_pc_t *pc = _pc_create_from_mg_sub(mg->lv_mg[2]);
-    cs_sles_it_transfer_pc(mg_sles->context, &pc);
-  }
-
-#if defined(HAVE_MPI)
-  {
-    cs_sles_it_t  *context = mg_sles->context;
-    cs_sles_it_set_mpi_reduce_comm(context,
-                                   cs_grid_get_comm(mgd->grid_hierarchy[1]),
-                                   mg->comm);
-  }
-#endif
+  _multigrid_create_coarse_sles(mg, g, mg_sles);
 
   snprintf(_name, l-1, "%s:coarse:%d", name, i);
   _name[l-1] = '\0';
@@ -1980,28 +2064,7 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
     mg_lv_info = mg->lv_info + i;
 
     cs_mg_sles_t  *mg_sles = &(mgd->sles_hierarchy[i*2]);
-    mg_sles->context
-      = cs_sles_it_create(mg->info.type[2],
-                          mg->info.poly_degree[2],
-                          mg->info.n_max_iter[2],
-                          false); /* stats not updated here */
-    mg_sles->setup_func = cs_sles_it_setup;
-    mg_sles->solve_func = cs_sles_it_solve;
-    mg_sles->destroy_func = cs_sles_it_destroy;
-
-    if (mg->lv_mg[2] != NULL) {
-      cs_sles_pc_t *pc = _pc_create_from_mg_sub(mg->lv_mg[2]);
-      cs_sles_it_transfer_pc(mg_sles->context, &pc);
-    }
-
-#if defined(HAVE_MPI)
-    {
-      cs_sles_it_t  *context = mg_sles->context;
-      cs_sles_it_set_mpi_reduce_comm(context,
-                                     cs_grid_get_comm(mgd->grid_hierarchy[i]),
-                                     mg->comm);
-    }
-#endif
+    _multigrid_create_coarse_sles(mg, g, mg_sles);
 
     snprintf(_name, l-1, "%s:coarse:%d", name, i);
     _name[l-1] = '\0';
@@ -3807,12 +3870,18 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
   mg->coarsening_type = CS_GRID_COARSENING_DEFAULT;
   mg->n_levels_max = 25;
   mg->n_g_rows_min = 30;
+  mg->n_g_rows_direct = 0;
 
   mg->post_row_max = 0;
 
   mg->p0p1_relax = 0.;
   mg->k_cycle_threshold = 0;
 
+  mg->n_group_rows = 0;
+  mg->n_row_groups = 0;
+  mg->row_group_idx = NULL;
+  mg->row_group_ids = NULL;
+
   _multigrid_info_init(&(mg->info));
   for (int i = 0; i < 3; i++)
     mg->lv_mg[i] = NULL;
@@ -3920,6 +3989,9 @@ cs_multigrid_destroy(void  **context)
 
   BFT_FREE(mg->post_name);
 
+  BFT_FREE(mg->row_group_idx);
+  BFT_FREE(mg->row_group_ids);
+
   if (mg->cycle_plot != NULL)
     cs_time_plot_finalize(&(mg->cycle_plot));
 
@@ -4027,6 +4099,82 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
   mg->p0p1_relax = p0p1_relax;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define groups of rows aggregated by the first coarsening.
+ *
+ * This allows a geometric first coarsening for systems whose unknowns
+ * are grouped in a natural manner (for instance the faces of a cell for
+ * CDO face-based schemes). Following coarsenings use the selected
+ * coarsening type. Groups are only applied to systems with the given
+ * number of rows. Arrays are copied.
+ *
+ * \param[in, out]  mg          pointer to multigrid info and context
+ * \param[in]       n_rows      number of rows of the related systems
+ * \param[in]       n_groups    number of row groups (0 to unset)
+ * \param[in]       group_idx   index of rows in each group
+ *                              (size: n_groups + 1)
+ * \param[in]       group_ids   row ids of each group
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_row_groups(cs_multigrid_t   *mg,
+                            cs_lnum_t         n_rows,
+                            cs_lnum_t         n_groups,
+                            const cs_lnum_t   group_idx[],
+                            const cs_lnum_t   group_ids[])
+{
+  if (mg == NULL)
+    return;
+
+  BFT_FREE(mg->row_group_idx);
+  BFT_FREE(mg->row_group_ids);
+
+  mg->n_group_rows = n_rows;
+  mg->n_row_groups = 0;
+
+  if (n_groups < 1 || group_idx == NULL)
+    return;
+
+  const cs_lnum_t  n_ids = group_idx[n_groups];
+
+  mg->n_row_groups = n_groups;
+  BFT_MALLOC(mg->row_group_idx, n_groups + 1, cs_lnum_t);
+  BFT_MALLOC(mg->row_group_ids, n_ids, cs_lnum_t);
+
+  memcpy(mg->row_group_idx, group_idx, (n_groups + 1)*sizeof(cs_lnum_t));
+  memcpy(mg->row_group_ids, group_ids, n_ids*sizeof(cs_lnum_t));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve the coarsest level with a sparse direct solver when it is
+ *        small enough.
+ *
+ * The coarsest system is gathered on the first rank of the coarsest grid's
+ * communicator, and factorized once per setup (see \ref cs_sles_ldlt_setup).
+ * The factorization does not use pivoting, so this should only be set
+ * for symmetric systems (an error is raised at setup otherwise). Systems
+ * with block rows keep using the iterative coarse solver.
+ *
+ * \param[in, out]  mg              pointer to multigrid info and context
+ * \param[in]       n_g_rows_max    maximum global number of rows of the
+ *                                  coarsest grid for a direct solve
+ *                                  (0 to deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_direct_solver(cs_multigrid_t  *mg,
+                                      cs_gnum_t        n_g_rows_max)
+{
+  if (mg == NULL)
+    return;
+
+  mg->n_g_rows_direct = n_g_rows_max;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set multigrid parameters for associated iterative solvers.
@@ -4223,6 +4371,12 @@ cs_multigrid_setup_conv_diff(void               *context,
                                  a_conv,
                                  a_diff);
 
+  if (mg->row_group_idx != NULL && cs_grid_get_n_rows(f) == mg->n_group_rows)
+    cs_grid_set_row_groups(f,
+                           mg->n_row_groups,
+                           mg->row_group_idx,
+                           mg->row_group_ids);
+
   cs_multigrid_level_info_t *mg_lv_info = mg->lv_info;
 
   cs_timer_t t1 = cs_timer_time();
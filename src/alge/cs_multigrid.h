@@ -193,6 +193,50 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
                                     double           p0p1_relax,
                                     int              postprocess_block_size);
 
+/*----------------------------------------------------------------------------
+ * Define groups of rows aggregated by the first coarsening.
+ *
+ * This allows a geometric first coarsening for systems whose unknowns
+ * are grouped in a natural manner (for instance the faces of a cell for
+ * CDO face-based schemes). Following coarsenings use the selected
+ * coarsening type. Groups are only applied to systems with the given
+ * number of rows. Arrays are copied.
+ *
+ * parameters:
+ *   mg        <-> pointer to multigrid info and context
+ *   n_rows    <-- number of rows of the related systems
+ *   n_groups  <-- number of row groups (0 to unset)
+ *   group_idx <-- index of rows in each group (size: n_groups + 1)
+ *   group_ids <-- row ids of each group
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_row_groups(cs_multigrid_t   *mg,
+                            cs_lnum_t         n_rows,
+                            cs_lnum_t         n_groups,
+                            const cs_lnum_t   group_idx[],
+                            const cs_lnum_t   group_ids[]);
+
+/*----------------------------------------------------------------------------
+ * Solve the coarsest level with a sparse direct solver when it is
+ * small enough.
+ *
+ * The coarsest system is gathered on the first rank of the coarsest grid's
+ * communicator, and factorized once per setup. The factorization does not
+ * use pivoting, so this should only be set for symmetric systems (an error
+ * is raised at setup otherwise). Systems with block rows keep using the
+ * iterative coarse solver.
+ *
+ * parameters:
+ *   mg            <-> pointer to multigrid info and context
+ *   n_g_rows_max  <-- maximum global number of rows of the coarsest grid
+ *                     for a direct solve (0 to deactivate)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_direct_solver(cs_multigrid_t  *mg,
+                                      cs_gnum_t        n_g_rows_max);
+
 /*----------------------------------------------------------------------------
  * Set multigrid parameters for associated iterative solvers.
  *
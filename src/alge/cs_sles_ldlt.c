@@ -0,0 +1,1550 @@
+/*============================================================================
+ * Sparse Linear Equation Solver using a built-in sparse LDL^T factorization
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_log.h"
+#include "cs_halo.h"
+#include "cs_matrix.h"
+#include "cs_renumber.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_sles.h"
+#include "cs_sles_ldlt.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_sles_ldlt.c
+
+  \brief Built-in sparse direct solver for small to medium size symmetric
+  linear systems.
+
+  \page sles_ldlt Built-in sparse direct solver.
+
+  The matrix rows are gathered on the first rank of the solver's
+  communicator (all ranks by default, or the ranks of a coarse grid when
+  used as the coarsest level solver of a multigrid). The adjacency graph of
+  the matrix is then reordered using a nested dissection algorithm
+  (see \ref cs_renumber_fill_reducing_order) and the permuted matrix is
+  factorized as \f$ L D L^T \f$ using an up-looking algorithm, without
+  pivoting. The matrix is thus expected to be symmetric, and is usually
+  symmetric positive (semi-)definite.
+
+  Null pivots, which appear for singular systems (such as pure Neumann
+  problems), are replaced by zero in the inverse of \f$ D \f$, so that a
+  particular solution is obtained for compatible right-hand sides.
+
+  The factorization is done once at setup and reused for all solves until
+  the solver is freed. If the residual of the direct solution does not
+  reach the requested precision (ill-conditioned systems, for instance with
+  a penalized enforcement of boundary conditions), a few steps of iterative
+  refinement are applied.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Local Structure Definitions
+ *============================================================================*/
+
+/* Factorization (only non-empty on the root rank) */
+/*-------------------------------------------------*/
+
+typedef struct _cs_sles_ldlt_setup_t {
+
+  cs_lnum_t            n_rows;          /* Number of local rows */
+  cs_lnum_t            n_g_rows;        /* Number of rows of the gathered
+                                           system (0 if not root) */
+
+  int                 *row_count;       /* Number of rows per rank of the
+                                           communicator (root only) */
+  int                 *row_shift;       /* Shift of rows per rank of the
+                                           communicator (root only) */
+
+  cs_lnum_t           *new_to_old;      /* Fill-reducing ordering */
+
+  cs_lnum_t           *l_idx;           /* Column index of strict lower
+                                           part of L */
+  cs_lnum_t           *l_ids;           /* Row ids of strict lower part
+                                           of L */
+  cs_real_t           *l_val;           /* Values of strict lower part
+                                           of L */
+  cs_real_t           *d_inv;           /* Inverse of D (0 for null
+                                           pivots) */
+
+  cs_real_t           *b;               /* Gathered right-hand side */
+  cs_real_t           *x;               /* Permuted work array */
+
+} cs_sles_ldlt_setup_t;
+
+struct _cs_sles_ldlt_t {
+
+  /* Performance data */
+
+  int                  n_setups;           /* Number of times system setup */
+  int                  n_solves;           /* Number of times system solved */
+  int                  n_refinements;      /* Number of iterative
+                                              refinement steps */
+
+  cs_lnum_t            n_g_rows_max;       /* Maximum size of factorized
+                                              system */
+  cs_lnum_t            n_l_entries_max;    /* Maximum number of entries of
+                                              the factor */
+  cs_lnum_t            n_null_pivots;      /* Number of null pivots at
+                                              last setup */
+
+  cs_timer_counter_t   t_setup;            /* Total setup (factorization) */
+  cs_timer_counter_t   t_solve;            /* Total time used */
+
+  /* Additional setup options */
+
+  int                  verbosity;
+
+#if defined(HAVE_MPI)
+  MPI_Comm             comm;               /* MPI communicator for solve */
+#endif
+
+  /* Setup data context */
+
+  cs_sles_ldlt_setup_t  *setup_data;
+
+};
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/* Relative threshold under which a pivot is considered null */
+
+static const double  _pivot_threshold = 1e-10;
+
+/* Maximum number of iterative refinement steps per solve */
+
+static const int  _n_max_refinements = 2;
+
+/* Relative threshold above which the matrix is considered non-symmetric */
+
+static const double  _symmetry_threshold = 1e-10;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Extract the diagonal and the strict lower part (based on global row
+ * numbers) of local matrix rows.
+ *
+ * parameters:
+ *   a        <-- pointer to matrix structure
+ *   g_ids    <-- global ids of rows and columns (including ghosts)
+ *   diag     --> diagonal values (size: n_rows)
+ *   l_count  --> number of strict lower entries per row (size: n_rows)
+ *   l_col    --> global column ids of strict lower entries
+ *   l_val    --> values of strict lower entries
+ *
+ * returns:
+ *   number of strict lower entries
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_extract_lower(const cs_matrix_t   *a,
+               const cs_gnum_t      g_ids[],
+               cs_real_t          **diag,
+               cs_lnum_t          **l_count,
+               cs_gnum_t          **l_col,
+               cs_real_t          **l_val)
+{
+  const cs_lnum_t  n_rows = cs_matrix_get_n_rows(a);
+  const cs_matrix_type_t  m_type = cs_matrix_get_type(a);
+
+  cs_real_t  *_diag = NULL, *_l_val = NULL;
+  cs_lnum_t  *_l_count = NULL;
+  cs_gnum_t  *_l_col = NULL;
+
+  BFT_MALLOC(_diag, n_rows, cs_real_t);
+  BFT_MALLOC(_l_count, n_rows, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    _diag[i] = 0.;
+    _l_count[i] = 0;
+  }
+
+  cs_lnum_t  n_l = 0;
+
+  if (m_type == CS_MATRIX_MSR || m_type == CS_MATRIX_CSR) {
+
+    const cs_lnum_t  *row_idx, *col_ids;
+    const cs_real_t  *d_val = NULL, *x_val = NULL;
+
+    if (m_type == CS_MATRIX_MSR)
+      cs_matrix_get_msr_arrays(a, &row_idx, &col_ids, &d_val, &x_val);
+    else
+      cs_matrix_get_csr_arrays(a, &row_idx, &col_ids, &x_val);
+
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      for (cs_lnum_t k = row_idx[i]; k < row_idx[i+1]; k++) {
+        if (g_ids[col_ids[k]] < g_ids[i])
+          _l_count[i] += 1;
+      }
+      n_l += _l_count[i];
+    }
+
+    BFT_MALLOC(_l_col, n_l, cs_gnum_t);
+    BFT_MALLOC(_l_val, n_l, cs_real_t);
+
+    n_l = 0;
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      if (d_val != NULL)
+        _diag[i] = d_val[i];
+      for (cs_lnum_t k = row_idx[i]; k < row_idx[i+1]; k++) {
+        cs_gnum_t  g_col = g_ids[col_ids[k]];
+        if (g_col < g_ids[i]) {
+          _l_col[n_l] = g_col;
+          _l_val[n_l] = x_val[k];
+          n_l++;
+        }
+        else if (col_ids[k] == i)
+          _diag[i] += x_val[k];
+      }
+    }
+
+  }
+  else if (m_type == CS_MATRIX_NATIVE) {
+
+    bool  symmetric = false;
+    cs_lnum_t  n_edges = 0;
+    const cs_lnum_2_t  *edges;
+    const cs_real_t  *d_val, *x_val;
+
+    cs_matrix_get_native_arrays(a,
+                                &symmetric, &n_edges, &edges, &d_val, &x_val);
+
+    const cs_lnum_t  x_stride = (symmetric) ? 1 : 2;
+
+    for (cs_lnum_t e = 0; e < n_edges; e++) {
+      cs_lnum_t  i = edges[e][0], j = edges[e][1];
+      if (g_ids[j] < g_ids[i]) {
+        if (i < n_rows) _l_count[i] += 1;
+      }
+      else if (j < n_rows)
+        _l_count[j] += 1;
+    }
+
+    cs_lnum_t  *l_shift = NULL;
+    BFT_MALLOC(l_shift, n_rows, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      _diag[i] = d_val[i];
+      l_shift[i] = n_l;
+      n_l += _l_count[i];
+    }
+
+    BFT_MALLOC(_l_col, n_l, cs_gnum_t);
+    BFT_MALLOC(_l_val, n_l, cs_real_t);
+
+    /* For a non-symmetric storage, x_val[2e] is the (i, j) coefficient
+       and x_val[2e+1] the (j, i) one */
+
+    for (cs_lnum_t e = 0; e < n_edges; e++) {
+      cs_lnum_t  i = edges[e][0], j = edges[e][1];
+      if (g_ids[j] < g_ids[i]) {
+        if (i < n_rows) {
+          _l_col[l_shift[i]] = g_ids[j];
+          _l_val[l_shift[i]] = x_val[e*x_stride];
+          l_shift[i] += 1;
+        }
+      }
+      else if (j < n_rows) {
+        _l_col[l_shift[j]] = g_ids[i];
+        _l_val[l_shift[j]] = x_val[e*x_stride + x_stride - 1];
+        l_shift[j] += 1;
+      }
+    }
+
+    BFT_FREE(l_shift);
+
+  }
+  else
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: matrix type %s not handled."),
+              __func__, _(cs_matrix_type_name[m_type]));
+
+  *diag = _diag;
+  *l_count = _l_count;
+  *l_col = _l_col;
+  *l_val = _l_val;
+
+  return n_l;
+}
+
+/*----------------------------------------------------------------------------
+ * Extract the transposed strict upper part (based on global row numbers)
+ * of local matrix rows, so as to check the matrix symmetry.
+ *
+ * An entry (i, j) with global ids g_i < g_j is returned as row g_j and
+ * column g_i, to be compared with the matching strict lower entry.
+ *
+ * parameters:
+ *   a        <-- pointer to matrix structure
+ *   g_ids    <-- global ids of rows and columns (including ghosts)
+ *   u_row    --> global row ids of transposed entries
+ *   u_col    --> global column ids of transposed entries
+ *   u_val    --> values of transposed entries
+ *
+ * returns:
+ *   number of strict upper entries
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_extract_upper_t(const cs_matrix_t   *a,
+                 const cs_gnum_t      g_ids[],
+                 cs_gnum_t          **u_row,
+                 cs_gnum_t          **u_col,
+                 cs_real_t          **u_val)
+{
+  const cs_lnum_t  n_rows = cs_matrix_get_n_rows(a);
+  const cs_matrix_type_t  m_type = cs_matrix_get_type(a);
+
+  cs_gnum_t  *_u_row = NULL, *_u_col = NULL;
+  cs_real_t  *_u_val = NULL;
+
+  cs_lnum_t  n_u = 0;
+
+  if (m_type == CS_MATRIX_MSR || m_type == CS_MATRIX_CSR) {
+
+    const cs_lnum_t  *row_idx, *col_ids;
+    const cs_real_t  *d_val = NULL, *x_val = NULL;
+
+    if (m_type == CS_MATRIX_MSR)
+      cs_matrix_get_msr_arrays(a, &row_idx, &col_ids, &d_val, &x_val);
+    else
+      cs_matrix_get_csr_arrays(a, &row_idx, &col_ids, &x_val);
+
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      for (cs_lnum_t k = row_idx[i]; k < row_idx[i+1]; k++) {
+        if (g_ids[col_ids[k]] > g_ids[i])
+          n_u++;
+      }
+    }
+
+    BFT_MALLOC(_u_row, n_u, cs_gnum_t);
+    BFT_MALLOC(_u_col, n_u, cs_gnum_t);
+    BFT_MALLOC(_u_val, n_u, cs_real_t);
+
+    n_u = 0;
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      for (cs_lnum_t k = row_idx[i]; k < row_idx[i+1]; k++) {
+        cs_gnum_t  g_col = g_ids[col_ids[k]];
+        if (g_col > g_ids[i]) {
+          _u_row[n_u] = g_col;
+          _u_col[n_u] = g_ids[i];
+          _u_val[n_u] = x_val[k];
+          n_u++;
+        }
+      }
+    }
+
+  }
+  else if (m_type == CS_MATRIX_NATIVE) {
+
+    bool  symmetric = false;
+    cs_lnum_t  n_edges = 0;
+    const cs_lnum_2_t  *edges;
+    const cs_real_t  *d_val, *x_val;
+
+    cs_matrix_get_native_arrays(a,
+                                &symmetric, &n_edges, &edges, &d_val, &x_val);
+
+    const cs_lnum_t  x_stride = (symmetric) ? 1 : 2;
+
+    for (cs_lnum_t e = 0; e < n_edges; e++) {
+      cs_lnum_t  i = edges[e][0], j = edges[e][1];
+      if (g_ids[j] < g_ids[i]) {
+        if (j < n_rows) n_u++;
+      }
+      else if (i < n_rows)
+        n_u++;
+    }
+
+    BFT_MALLOC(_u_row, n_u, cs_gnum_t);
+    BFT_MALLOC(_u_col, n_u, cs_gnum_t);
+    BFT_MALLOC(_u_val, n_u, cs_real_t);
+
+    /* The (j, i) coefficient is the upper one of row j if g_j < g_i,
+       and the (i, j) coefficient is the upper one of row i otherwise */
+
+    n_u = 0;
+    for (cs_lnum_t e = 0; e < n_edges; e++) {
+      cs_lnum_t  i = edges[e][0], j = edges[e][1];
+      if (g_ids[j] < g_ids[i]) {
+        if (j < n_rows) {
+          _u_row[n_u] = g_ids[i];
+          _u_col[n_u] = g_ids[j];
+          _u_val[n_u] = x_val[e*x_stride + x_stride - 1];
+          n_u++;
+        }
+      }
+      else if (i < n_rows) {
+        _u_row[n_u] = g_ids[j];
+        _u_col[n_u] = g_ids[i];
+        _u_val[n_u] = x_val[e*x_stride];
+        n_u++;
+      }
+    }
+
+  }
+
+  *u_row = _u_row;
+  *u_col = _u_col;
+  *u_val = _u_val;
+
+  return n_u;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the asymmetry of a gathered matrix given by its strict lower
+ * part and its transposed strict upper part.
+ *
+ * parameters:
+ *   n        <-- number of rows
+ *   a_idx    <-- strict lower part row index
+ *   a_col    <-- strict lower part column ids
+ *   a_val    <-- strict lower part values
+ *   n_u      <-- number of transposed strict upper entries
+ *   u_row    <-- row ids of transposed strict upper entries
+ *   u_col    <-- column ids of transposed strict upper entries
+ *   u_val    <-- values of transposed strict upper entries
+ *
+ * returns:
+ *   max. difference between matching entries relative to the max.
+ *   absolute value of extra-diagonal entries
+ *----------------------------------------------------------------------------*/
+
+static double
+_asymmetry(cs_lnum_t          n,
+           const cs_lnum_t    a_idx[],
+           const cs_lnum_t    a_col[],
+           const cs_real_t    a_val[],
+           cs_lnum_t          n_u,
+           const cs_gnum_t    u_row[],
+           const cs_gnum_t    u_col[],
+           const cs_real_t    u_val[])
+{
+  cs_lnum_t  *u_idx = NULL, *u_ids = NULL, *mark = NULL;
+  cs_real_t  *w = NULL;
+
+  BFT_MALLOC(u_idx, n + 1, cs_lnum_t);
+  BFT_MALLOC(u_ids, n_u, cs_lnum_t);
+  BFT_MALLOC(mark, n, cs_lnum_t);
+  BFT_MALLOC(w, n, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n + 1; i++)
+    u_idx[i] = 0;
+  for (cs_lnum_t k = 0; k < n_u; k++)
+    u_idx[u_row[k] + 1] += 1;
+  for (cs_lnum_t i = 0; i < n; i++)
+    u_idx[i+1] += u_idx[i];
+  for (cs_lnum_t k = 0; k < n_u; k++)
+    u_ids[u_idx[u_row[k]]++] = k;
+  for (cs_lnum_t i = n; i > 0; i--)
+    u_idx[i] = u_idx[i-1];
+  u_idx[0] = 0;
+
+  for (cs_lnum_t i = 0; i < n; i++)
+    mark[i] = -1;
+
+  double  max_a = 0., max_d = 0.;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+
+    /* Accumulate a_ij - a_ji for the columns of row i */
+
+    for (cs_lnum_t k = a_idx[i]; k < a_idx[i+1]; k++) {
+      cs_lnum_t  j = a_col[k];
+      if (mark[j] != i) {
+        mark[j] = i;
+        w[j] = 0.;
+      }
+      w[j] += a_val[k];
+      max_a = CS_MAX(max_a, fabs(a_val[k]));
+    }
+
+    for (cs_lnum_t l = u_idx[i]; l < u_idx[i+1]; l++) {
+      cs_lnum_t  k = u_ids[l];
+      cs_lnum_t  j = u_col[k];
+      if (mark[j] != i) {
+        mark[j] = i;
+        w[j] = 0.;
+      }
+      w[j] -= u_val[k];
+      max_a = CS_MAX(max_a, fabs(u_val[k]));
+    }
+
+    for (cs_lnum_t k = a_idx[i]; k < a_idx[i+1]; k++)
+      max_d = CS_MAX(max_d, fabs(w[a_col[k]]));
+    for (cs_lnum_t l = u_idx[i]; l < u_idx[i+1]; l++)
+      max_d = CS_MAX(max_d, fabs(w[u_col[u_ids[l]]]));
+
+  }
+
+  BFT_FREE(w);
+  BFT_FREE(mark);
+  BFT_FREE(u_ids);
+  BFT_FREE(u_idx);
+
+  return (max_a > 0.) ? max_d/max_a : 0.;
+}
+
+/*----------------------------------------------------------------------------
+ * Reorder and factorize a gathered symmetric matrix as L.D.L^T.
+ *
+ * The matrix is given by its diagonal and its strict lower part, by rows.
+ *
+ * parameters:
+ *   sd       <-> pointer to setup data
+ *   a_diag   <-- diagonal values
+ *   a_idx    <-- strict lower part row index
+ *   a_col    <-- strict lower part column ids
+ *   a_val    <-- strict lower part values
+ *
+ * returns:
+ *   number of null pivots
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_factorize(cs_sles_ldlt_setup_t  *sd,
+           const cs_real_t        a_diag[],
+           const cs_lnum_t        a_idx[],
+           const cs_lnum_t        a_col[],
+           const cs_real_t        a_val[])
+{
+  const cs_lnum_t  n = sd->n_g_rows;
+  const cs_lnum_t  n_a = a_idx[n];
+
+  cs_lnum_t  n_null_pivots = 0;
+
+  /* Fill-reducing ordering based on the symmetric adjacency graph */
+
+  cs_lnum_t  *g_idx = NULL, *g_nbr = NULL, *old_to_new = NULL;
+
+  BFT_MALLOC(sd->new_to_old, n, cs_lnum_t);
+  BFT_MALLOC(old_to_new, n, cs_lnum_t);
+  BFT_MALLOC(g_idx, n + 1, cs_lnum_t);
+  BFT_MALLOC(g_nbr, 2*n_a, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n + 1; i++)
+    g_idx[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    for (cs_lnum_t k = a_idx[i]; k < a_idx[i+1]; k++) {
+      g_idx[i+1] += 1;
+      g_idx[a_col[k]+1] += 1;
+    }
+  }
+  for (cs_lnum_t i = 0; i < n; i++) {
+    g_idx[i+1] += g_idx[i];
+    old_to_new[i] = g_idx[i];  /* used as shift */
+  }
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    for (cs_lnum_t k = a_idx[i]; k < a_idx[i+1]; k++) {
+      cs_lnum_t  j = a_col[k];
+      g_nbr[old_to_new[i]++] = j;
+      g_nbr[old_to_new[j]++] = i;
+    }
+  }
+
+  cs_renumber_fill_reducing_order(n, g_idx, g_nbr, sd->new_to_old);
+
+  BFT_FREE(g_nbr);
+
+  for (cs_lnum_t i = 0; i < n; i++)
+    old_to_new[sd->new_to_old[i]] = i;
+
+  /* Strict upper part of the permuted matrix, by columns (reusing the
+     graph index array for the column index) */
+
+  cs_lnum_t  *c_idx = g_idx, *c_ids = NULL;
+  cs_real_t  *c_val = NULL;
+
+  BFT_MALLOC(c_ids, n_a, cs_lnum_t);
+  BFT_MALLOC(c_val, n_a, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n + 1; i++)
+    c_idx[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    for (cs_lnum_t k = a_idx[i]; k < a_idx[i+1]; k++) {
+      cs_lnum_t  pi = old_to_new[i], pj = old_to_new[a_col[k]];
+      c_idx[CS_MAX(pi, pj) + 1] += 1;
+    }
+  }
+  for (cs_lnum_t i = 0; i < n; i++)
+    c_idx[i+1] += c_idx[i];
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    for (cs_lnum_t k = a_idx[i]; k < a_idx[i+1]; k++) {
+      cs_lnum_t  pi = old_to_new[i], pj = old_to_new[a_col[k]];
+      cs_lnum_t  col = CS_MAX(pi, pj);
+      cs_lnum_t  s = c_idx[col];
+      c_ids[s] = CS_MIN(pi, pj);
+      c_val[s] = a_val[k];
+      c_idx[col] += 1;
+    }
+  }
+  for (cs_lnum_t i = n; i > 0; i--)
+    c_idx[i] = c_idx[i-1];
+  c_idx[0] = 0;
+
+  /* Symbolic factorization: elimination tree and column counts */
+
+  cs_lnum_t  *parent = NULL, *flag = NULL, *l_nz = NULL, *pattern = NULL;
+  BFT_MALLOC(parent, n, cs_lnum_t);
+  BFT_MALLOC(flag, n, cs_lnum_t);
+  BFT_MALLOC(l_nz, n, cs_lnum_t);
+  BFT_MALLOC(pattern, n, cs_lnum_t);
+
+  for (cs_lnum_t k = 0; k < n; k++) {
+    parent[k] = -1;
+    flag[k] = k;
+    l_nz[k] = 0;
+    for (cs_lnum_t p = c_idx[k]; p < c_idx[k+1]; p++) {
+      for (cs_lnum_t i = c_ids[p]; flag[i] != k; i = parent[i]) {
+        if (parent[i] == -1)
+          parent[i] = k;
+        l_nz[i] += 1;
+        flag[i] = k;
+      }
+    }
+  }
+
+  BFT_MALLOC(sd->l_idx, n + 1, cs_lnum_t);
+  sd->l_idx[0] = 0;
+  for (cs_lnum_t k = 0; k < n; k++)
+    sd->l_idx[k+1] = sd->l_idx[k] + l_nz[k];
+
+  BFT_MALLOC(sd->l_ids, sd->l_idx[n], cs_lnum_t);
+  BFT_MALLOC(sd->l_val, sd->l_idx[n], cs_real_t);
+  BFT_MALLOC(sd->d_inv, n, cs_real_t);
+
+  /* Numeric factorization (up-looking, row by row of L) */
+
+  cs_real_t  *y = NULL;
+  BFT_MALLOC(y, n, cs_real_t);
+
+  for (cs_lnum_t k = 0; k < n; k++) {
+
+    cs_lnum_t  top = n;
+    const cs_real_t  a_kk = a_diag[sd->new_to_old[k]];
+
+    y[k] = 0.;
+    flag[k] = k;
+    l_nz[k] = 0;
+
+    /* Nonzero pattern of row k of L (reach in the elimination tree) */
+
+    for (cs_lnum_t p = c_idx[k]; p < c_idx[k+1]; p++) {
+      cs_lnum_t  i = c_ids[p], len = 0;
+      y[i] += c_val[p];
+      for (; flag[i] != k; i = parent[i]) {
+        pattern[len++] = i;
+        flag[i] = k;
+      }
+      while (len > 0)
+        pattern[--top] = pattern[--len];
+    }
+
+    cs_real_t  d = a_kk + y[k];
+    y[k] = 0.;
+
+    /* Sparse triangular solve for row k of L */
+
+    for (; top < n; top++) {
+      cs_lnum_t  i = pattern[top];
+      cs_real_t  y_i = y[i];
+      y[i] = 0.;
+      cs_lnum_t  p_e = sd->l_idx[i] + l_nz[i];
+      for (cs_lnum_t p = sd->l_idx[i]; p < p_e; p++)
+        y[sd->l_ids[p]] -= sd->l_val[p] * y_i;
+      cs_real_t  l_ki = y_i * sd->d_inv[i];
+      d -= l_ki * y_i;
+      sd->l_ids[p_e] = k;
+      sd->l_val[p_e] = l_ki;
+      l_nz[i] += 1;
+    }
+
+    if (!(fabs(d) > _pivot_threshold * fabs(a_kk))) {
+      sd->d_inv[k] = 0.;
+      n_null_pivots += 1;
+    }
+    else
+      sd->d_inv[k] = 1. / d;
+
+  }
+
+  BFT_FREE(y);
+  BFT_FREE(pattern);
+  BFT_FREE(l_nz);
+  BFT_FREE(flag);
+  BFT_FREE(parent);
+  BFT_FREE(c_val);
+  BFT_FREE(c_ids);
+  BFT_FREE(g_idx);
+  BFT_FREE(old_to_new);
+
+  return n_null_pivots;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve the gathered system using the factorization.
+ *
+ * parameters:
+ *   sd  <-> pointer to setup data (sd->b holds the right-hand side on input
+ *           and the solution on output)
+ *----------------------------------------------------------------------------*/
+
+static void
+_factor_solve(cs_sles_ldlt_setup_t  *sd)
+{
+  const cs_lnum_t  n = sd->n_g_rows;
+  const cs_lnum_t  *l_idx = sd->l_idx, *l_ids = sd->l_ids;
+  const cs_real_t  *l_val = sd->l_val;
+
+  cs_real_t  *x = sd->x;
+
+  for (cs_lnum_t k = 0; k < n; k++)
+    x[k] = sd->b[sd->new_to_old[k]];
+
+  /* L.y = b */
+
+  for (cs_lnum_t j = 0; j < n; j++) {
+    const cs_real_t  x_j = x[j];
+    for (cs_lnum_t p = l_idx[j]; p < l_idx[j+1]; p++)
+      x[l_ids[p]] -= l_val[p] * x_j;
+  }
+
+  /* D.z = y */
+
+  for (cs_lnum_t j = 0; j < n; j++)
+    x[j] *= sd->d_inv[j];
+
+  /* L^T.x = z */
+
+  for (cs_lnum_t j = n - 1; j > -1; j--) {
+    cs_real_t  x_j = x[j];
+    for (cs_lnum_t p = l_idx[j]; p < l_idx[j+1]; p++)
+      x_j -= l_val[p] * x[l_ids[p]];
+    x[j] = x_j;
+  }
+
+  for (cs_lnum_t k = 0; k < n; k++)
+    sd->b[sd->new_to_old[k]] = x[k];
+}
+
+/*----------------------------------------------------------------------------
+ * Gather a right-hand side on the root rank, solve using the factorization,
+ * and scatter the solution.
+ *
+ * parameters:
+ *   c    <-> pointer to solver context
+ *   rhs  <-- local right-hand side
+ *   vx   --> local solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_gather_solve_scatter(cs_sles_ldlt_t   *c,
+                      const cs_real_t   rhs[],
+                      cs_real_t         vx[])
+{
+  cs_sles_ldlt_setup_t  *sd = c->setup_data;
+
+  const cs_lnum_t  n_rows = sd->n_rows;
+
+  int  n_ranks = 1, rank_id = 0;
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    MPI_Comm_size(c->comm, &n_ranks);
+    MPI_Comm_rank(c->comm, &rank_id);
+  }
+#endif
+
+  if (n_ranks == 1)
+    memcpy(sd->b, rhs, n_rows*sizeof(cs_real_t));
+
+#if defined(HAVE_MPI)
+  else
+    MPI_Gatherv(rhs, n_rows, CS_MPI_REAL,
+                sd->b, sd->row_count, sd->row_shift, CS_MPI_REAL,
+                0, c->comm);
+#endif
+
+  if (rank_id == 0)
+    _factor_solve(sd);
+
+  if (n_ranks == 1)
+    memcpy(vx, sd->b, n_rows*sizeof(cs_real_t));
+
+#if defined(HAVE_MPI)
+  else
+    MPI_Scatterv(sd->b, sd->row_count, sd->row_shift, CS_MPI_REAL,
+                 vx, n_rows, CS_MPI_REAL,
+                 0, c->comm);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the residual r = b - A.x and its norm.
+ *
+ * parameters:
+ *   c              <-- pointer to solver context
+ *   a              <-- matrix
+ *   rotation_mode  <-- halo update option for rotational periodicity
+ *   rhs            <-- right-hand side
+ *   vx             <-> solution (halo is synchronized)
+ *   r              --> residual (size: n_cols_ext)
+ *
+ * returns:
+ *   Euclidean norm of the residual
+ *----------------------------------------------------------------------------*/
+
+static double
+_residual(const cs_sles_ldlt_t  *c,
+          const cs_matrix_t     *a,
+          cs_halo_rotation_t     rotation_mode,
+          const cs_real_t        rhs[],
+          cs_real_t              vx[],
+          cs_real_t              r[])
+{
+  const cs_lnum_t  n_rows = c->setup_data->n_rows;
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, r);
+
+  double  s = 0.;
+
+# pragma omp parallel for reduction(+:s) if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    r[i] = rhs[i] - r[i];
+    s += r[i]*r[i];
+  }
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    double  _s = s;
+    MPI_Allreduce(&_s, &s, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+  }
+#endif
+
+  return sqrt(s);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define and associate a sparse LDL^T direct linear system solver
+ *        for a given field or equation name.
+ *
+ * If this system did not previously exist, it is added to the list of
+ * "known" systems. Otherwise, its definition is replaced by the one
+ * defined here.
+ *
+ * This is a utility function: if finer control is needed, see
+ * \ref cs_sles_define and \ref cs_sles_ldlt_create.
+ *
+ * Note that this function returns a pointer directly to the direct solver
+ * management structure. This may be used to set further options.
+ * If needed, \ref cs_sles_find may be used to obtain a pointer to the matching
+ * \ref cs_sles_t container.
+ *
+ * \param[in]  f_id       associated field id, or < 0
+ * \param[in]  name       associated name if f_id < 0, or NULL
+ * \param[in]  verbosity  level of verbosity
+ *
+ * \return  pointer to newly created direct solver info object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_ldlt_t *
+cs_sles_ldlt_define(int          f_id,
+                    const char  *name,
+                    int          verbosity)
+{
+  cs_sles_ldlt_t  *c = cs_sles_ldlt_create(verbosity);
+
+  cs_sles_define(f_id,
+                 name,
+                 c,
+                 "cs_sles_ldlt_t",
+                 cs_sles_ldlt_setup,
+                 cs_sles_ldlt_solve,
+                 cs_sles_ldlt_free,
+                 cs_sles_ldlt_log,
+                 cs_sles_ldlt_copy,
+                 cs_sles_ldlt_destroy);
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create sparse LDL^T linear system solver info and context.
+ *
+ * \param[in]  verbosity  level of verbosity
+ *
+ * \return  pointer to associated linear system object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_ldlt_t *
+cs_sles_ldlt_create(int  verbosity)
+{
+  cs_sles_ldlt_t  *c = NULL;
+
+  BFT_MALLOC(c, 1, cs_sles_ldlt_t);
+  c->n_setups = 0;
+  c->n_solves = 0;
+  c->n_refinements = 0;
+
+  c->n_g_rows_max = 0;
+  c->n_l_entries_max = 0;
+  c->n_null_pivots = 0;
+
+  CS_TIMER_COUNTER_INIT(c->t_setup);
+  CS_TIMER_COUNTER_INIT(c->t_solve);
+
+  /* Options */
+
+  c->verbosity = verbosity;
+
+#if defined(HAVE_MPI)
+  c->comm = cs_glob_mpi_comm;
+  if (cs_glob_n_ranks < 2)
+    c->comm = MPI_COMM_NULL;
+#endif
+
+  /* Setup data */
+
+  c->setup_data = NULL;
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create sparse LDL^T linear system solver info and context based on
+ *        existing info and context.
+ *
+ * \param[in]  context  pointer to reference info and context
+ *                      (actual type: cs_sles_ldlt_t  *)
+ *
+ * \return  pointer to newly created solver info object.
+ *          (actual type: cs_sles_ldlt_t  *)
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_sles_ldlt_copy(const void   *context)
+{
+  cs_sles_ldlt_t  *d = NULL;
+
+  if (context != NULL) {
+    const cs_sles_ldlt_t *c = context;
+    d = cs_sles_ldlt_create(c->verbosity);
+#if defined(HAVE_MPI)
+    d->comm = c->comm;
+#endif
+  }
+
+  return d;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free sparse LDL^T linear equation solver setup context.
+ *
+ * This function frees the factorization, but does not free the whole
+ * context, as info used for logging (especially performance data) is
+ * maintained.
+ *
+ * \param[in, out]  context  pointer to direct solver info and context
+ *                           (actual type: cs_sles_ldlt_t  *)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_ldlt_free(void  *context)
+{
+  cs_timer_t t0;
+  t0 = cs_timer_time();
+
+  cs_sles_ldlt_t  *c  = context;
+  cs_sles_ldlt_setup_t *sd = c->setup_data;
+
+  if (sd != NULL) {
+
+    BFT_FREE(sd->row_count);
+    BFT_FREE(sd->row_shift);
+    BFT_FREE(sd->new_to_old);
+    BFT_FREE(sd->l_idx);
+    BFT_FREE(sd->l_ids);
+    BFT_FREE(sd->l_val);
+    BFT_FREE(sd->d_inv);
+    BFT_FREE(sd->b);
+    BFT_FREE(sd->x);
+
+    BFT_FREE(c->setup_data);
+
+  }
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(c->t_setup), &t0, &t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy sparse LDL^T linear system solver info and context.
+ *
+ * \param[in, out]  context  pointer to direct solver info and context
+ *                           (actual type: cs_sles_ldlt_t  **)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_ldlt_destroy(void   **context)
+{
+  cs_sles_ldlt_t *c = (cs_sles_ldlt_t *)(*context);
+  if (c != NULL) {
+
+    /* Free structure */
+    cs_sles_ldlt_free(c);
+    BFT_FREE(c);
+    *context = c;
+
+  } /* c != NULL */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Setup sparse LDL^T linear equation solver.
+ *
+ * The matrix is gathered on the first rank of the associated communicator,
+ * reordered to reduce fill-in, and factorized. The factorization is kept
+ * for all following solves until \ref cs_sles_ldlt_free is called.
+ * An error is raised if the matrix is not symmetric.
+ *
+ * \param[in, out]  context    pointer to direct solver info and context
+ *                             (actual type: cs_sles_ldlt_t  *)
+ * \param[in]       name       pointer to system name
+ * \param[in]       a          associated matrix
+ * \param[in]       verbosity  associated verbosity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_ldlt_setup(void               *context,
+                   const char         *name,
+                   const cs_matrix_t  *a,
+                   int                 verbosity)
+{
+  cs_timer_t t0;
+  t0 = cs_timer_time();
+
+  cs_sles_ldlt_t  *c = context;
+
+  if (c->setup_data != NULL)
+    cs_sles_ldlt_free(c);
+
+  int _verbosity = c->verbosity;
+  if (_verbosity < 0)
+    _verbosity = verbosity;
+
+  /* Sanity checks */
+
+  if (cs_matrix_get_diag_block_size(a)[0] > 1 ||
+      cs_matrix_get_extra_diag_block_size(a)[0] > 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _(" %s: Invalid matrix structure for system \"%s\".\n"
+                " No block is handled by the sparse LDL^T solver.\n"),
+              __func__, name);
+
+  cs_sles_ldlt_setup_t  *sd = NULL;
+  BFT_MALLOC(sd, 1, cs_sles_ldlt_setup_t);
+  c->setup_data = sd;
+
+  sd->n_rows = cs_matrix_get_n_rows(a);
+  sd->n_g_rows = 0;
+  sd->row_count = NULL;
+  sd->row_shift = NULL;
+  sd->new_to_old = NULL;
+  sd->l_idx = NULL;
+  sd->l_ids = NULL;
+  sd->l_val = NULL;
+  sd->d_inv = NULL;
+  sd->b = NULL;
+  sd->x = NULL;
+
+  const cs_halo_t  *halo = cs_matrix_get_halo(a);
+  const cs_lnum_t  n_rows = sd->n_rows;
+  const cs_lnum_t  n_cols_ext = cs_matrix_get_n_columns(a);
+
+  /* Global row and column numbering on the solver communicator */
+
+  int  n_ranks = 1, rank_id = 0;
+  cs_gnum_t  g_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    MPI_Comm_size(c->comm, &n_ranks);
+    MPI_Comm_rank(c->comm, &rank_id);
+  }
+  if (n_ranks > 1) {
+    cs_gnum_t  _n_rows = n_rows;
+    MPI_Exscan(&_n_rows, &g_shift, 1, CS_MPI_GNUM, MPI_SUM, c->comm);
+    if (rank_id == 0)
+      g_shift = 0;
+  }
+#endif
+
+  cs_gnum_t  *g_ids = NULL;
+  BFT_MALLOC(g_ids, n_cols_ext, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    g_ids[i] = g_shift + i;
+
+  if (halo != NULL)
+    cs_halo_sync_untyped(halo, CS_HALO_STANDARD, sizeof(cs_gnum_t), g_ids);
+
+  /* Local diagonal and strict lower part */
+
+  cs_real_t  *diag = NULL, *l_val = NULL;
+  cs_lnum_t  *l_count = NULL;
+  cs_gnum_t  *l_col = NULL;
+
+  cs_lnum_t  n_l = _extract_lower(a, g_ids, &diag, &l_count, &l_col, &l_val);
+
+  /* Transposed strict upper part, to check symmetry */
+
+  cs_gnum_t  *u_row = NULL, *u_col = NULL;
+  cs_real_t  *u_val = NULL;
+
+  cs_lnum_t  n_u = _extract_upper_t(a, g_ids, &u_row, &u_col, &u_val);
+
+  BFT_FREE(g_ids);
+
+  /* Gather the system on the root rank */
+
+  cs_real_t  *a_diag = diag, *a_val = l_val, *a_u_val = u_val;
+  cs_lnum_t  *a_count = l_count;
+  cs_gnum_t  *a_g_col = l_col, *a_u_row = u_row, *a_u_col = u_col;
+  cs_lnum_t  n_g_u = n_u;
+
+#if defined(HAVE_MPI)
+
+  if (n_ranks > 1) {
+
+    int  counts[3] = {n_rows, n_l, n_u};
+    int  *n_counts = NULL, *l_counts = NULL, *l_shift = NULL;
+    int  *u_counts = NULL, *u_shift = NULL;
+
+    if (rank_id == 0) {
+      BFT_MALLOC(sd->row_count, n_ranks, int);
+      BFT_MALLOC(sd->row_shift, n_ranks, int);
+      BFT_MALLOC(n_counts, n_ranks*3, int);
+      BFT_MALLOC(l_counts, n_ranks, int);
+      BFT_MALLOC(l_shift, n_ranks, int);
+      BFT_MALLOC(u_counts, n_ranks, int);
+      BFT_MALLOC(u_shift, n_ranks, int);
+    }
+
+    MPI_Gather(counts, 3, MPI_INT, n_counts, 3, MPI_INT, 0, c->comm);
+
+    cs_lnum_t  n_g_l = 0;
+    n_g_u = 0;
+
+    a_diag = NULL; a_count = NULL; a_g_col = NULL; a_val = NULL;
+    a_u_row = NULL; a_u_col = NULL; a_u_val = NULL;
+
+    if (rank_id == 0) {
+      for (int r = 0; r < n_ranks; r++) {
+        sd->row_count[r] = n_counts[r*3];
+        sd->row_shift[r] = sd->n_g_rows;
+        l_counts[r] = n_counts[r*3 + 1];
+        l_shift[r] = n_g_l;
+        u_counts[r] = n_counts[r*3 + 2];
+        u_shift[r] = n_g_u;
+        sd->n_g_rows += n_counts[r*3];
+        n_g_l += n_counts[r*3 + 1];
+        n_g_u += n_counts[r*3 + 2];
+      }
+      BFT_MALLOC(a_diag, sd->n_g_rows, cs_real_t);
+      BFT_MALLOC(a_count, sd->n_g_rows, cs_lnum_t);
+      BFT_MALLOC(a_g_col, n_g_l, cs_gnum_t);
+      BFT_MALLOC(a_val, n_g_l, cs_real_t);
+      BFT_MALLOC(a_u_row, n_g_u, cs_gnum_t);
+      BFT_MALLOC(a_u_col, n_g_u, cs_gnum_t);
+      BFT_MALLOC(a_u_val, n_g_u, cs_real_t);
+    }
+
+    MPI_Gatherv(diag, n_rows, CS_MPI_REAL,
+                a_diag, sd->row_count, sd->row_shift, CS_MPI_REAL,
+                0, c->comm);
+    MPI_Gatherv(l_count, n_rows, CS_MPI_LNUM,
+                a_count, sd->row_count, sd->row_shift, CS_MPI_LNUM,
+                0, c->comm);
+    MPI_Gatherv(l_col, n_l, CS_MPI_GNUM,
+                a_g_col, l_counts, l_shift, CS_MPI_GNUM,
+                0, c->comm);
+    MPI_Gatherv(l_val, n_l, CS_MPI_REAL,
+                a_val, l_counts, l_shift, CS_MPI_REAL,
+                0, c->comm);
+    MPI_Gatherv(u_row, n_u, CS_MPI_GNUM,
+                a_u_row, u_counts, u_shift, CS_MPI_GNUM,
+                0, c->comm);
+    MPI_Gatherv(u_col, n_u, CS_MPI_GNUM,
+                a_u_col, u_counts, u_shift, CS_MPI_GNUM,
+                0, c->comm);
+    MPI_Gatherv(u_val, n_u, CS_MPI_REAL,
+                a_u_val, u_counts, u_shift, CS_MPI_REAL,
+                0, c->comm);
+
+    BFT_FREE(u_shift);
+    BFT_FREE(u_counts);
+    BFT_FREE(l_shift);
+    BFT_FREE(l_counts);
+    BFT_FREE(n_counts);
+
+    BFT_FREE(diag);
+    BFT_FREE(l_count);
+    BFT_FREE(l_col);
+    BFT_FREE(l_val);
+    BFT_FREE(u_row);
+    BFT_FREE(u_col);
+    BFT_FREE(u_val);
+
+  }
+
+#else
+
+  CS_UNUSED(n_l);
+
+#endif /* defined(HAVE_MPI) */
+
+  if (n_ranks == 1)
+    sd->n_g_rows = n_rows;
+
+  /* Factorize on the root rank */
+
+  c->n_null_pivots = 0;
+
+  if (rank_id == 0) {
+
+    const cs_lnum_t  n = sd->n_g_rows;
+
+    cs_lnum_t  *a_idx = NULL, *a_col = NULL;
+    BFT_MALLOC(a_idx, n + 1, cs_lnum_t);
+
+    a_idx[0] = 0;
+    for (cs_lnum_t i = 0; i < n; i++)
+      a_idx[i+1] = a_idx[i] + a_count[i];
+
+    BFT_MALLOC(a_col, a_idx[n], cs_lnum_t);
+    for (cs_lnum_t k = 0; k < a_idx[n]; k++)
+      a_col[k] = a_g_col[k];
+
+    /* Only the lower part is factorized, so a non-symmetric matrix
+       would silently be replaced by another one */
+
+    double  asym = _asymmetry(n, a_idx, a_col, a_val,
+                              n_g_u, a_u_row, a_u_col, a_u_val);
+
+    if (asym > _symmetry_threshold)
+      bft_error(__FILE__, __LINE__, 0,
+                _(" %s: the matrix of system \"%s\" is not symmetric\n"
+                  " (relative difference between a_ij and a_ji: %g).\n"
+                  " The sparse LDL^T solver only handles symmetric matrices."),
+                __func__, name, asym);
+
+    c->n_null_pivots = _factorize(sd, a_diag, a_idx, a_col, a_val);
+
+    BFT_FREE(a_col);
+    BFT_FREE(a_idx);
+
+    BFT_MALLOC(sd->b, n, cs_real_t);
+    BFT_MALLOC(sd->x, n, cs_real_t);
+
+    c->n_g_rows_max = CS_MAX(c->n_g_rows_max, n);
+    c->n_l_entries_max = CS_MAX(c->n_l_entries_max, sd->l_idx[n]);
+
+    if (_verbosity > 1)
+      bft_printf(_("  %s [%s]:\n"
+                   "    n_rows: %ld; n_entries(L): %ld; n_null_pivots: %ld\n"),
+                 "Sparse LDL^T", name,
+                 (long)n, (long)(sd->l_idx[n]), (long)(c->n_null_pivots));
+
+  }
+
+  BFT_FREE(a_diag);
+  BFT_FREE(a_count);
+  BFT_FREE(a_g_col);
+  BFT_FREE(a_val);
+  BFT_FREE(a_u_row);
+  BFT_FREE(a_u_col);
+  BFT_FREE(a_u_val);
+
+  /* Update return values */
+
+  c->n_setups += 1;
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(c->t_setup), &t0, &t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call sparse LDL^T linear equation solver.
+ *
+ * \param[in, out]  context        pointer to direct solver info and context
+ *                                 (actual type: cs_sles_ldlt_t  *)
+ * \param[in]       name           pointer to system name
+ * \param[in]       a              matrix
+ * \param[in]       verbosity      associated verbosity
+ * \param[in]       rotation_mode  halo update option for rotational periodicity
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residue normalization
+ * \param[out]      n_iter         number of "equivalent" iterations
+ * \param[out]      residue        residue
+ * \param[in]       rhs            right hand side
+ * \param[in, out]  vx             system solution
+ * \param[in]       aux_size       number of elements in aux_vectors (in bytes)
+ * \param           aux_vectors    optional working area
+ *                                 (internal allocation if NULL)
+ *
+ * \return  convergence state (CS_SLES_MAX_ITERATION if the precision is
+ *          not reached after iterative refinement)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_ldlt_solve(void                *context,
+                   const char          *name,
+                   const cs_matrix_t   *a,
+                   int                  verbosity,
+                   cs_halo_rotation_t   rotation_mode,
+                   double               precision,
+                   double               r_norm,
+                   int                 *n_iter,
+                   double              *residue,
+                   const cs_real_t     *rhs,
+                   cs_real_t           *vx,
+                   size_t               aux_size,
+                   void                *aux_vectors)
+{
+  cs_timer_t t0;
+  t0 = cs_timer_time();
+
+  cs_sles_ldlt_t  *c = context;
+  cs_sles_ldlt_setup_t  *sd = c->setup_data;
+
+  if (sd == NULL) {
+    cs_sles_ldlt_setup(c, name, a, verbosity);
+    sd = c->setup_data;
+  }
+
+  const cs_lnum_t  n_rows = sd->n_rows;
+  const cs_lnum_t  n_cols_ext = cs_matrix_get_n_columns(a);
+
+  /* Work arrays for the residual and the correction */
+
+  cs_real_t  *r = NULL, *dx = NULL, *_aux_vectors = NULL;
+
+  if (   aux_vectors != NULL
+      && aux_size/sizeof(cs_real_t) >= (size_t)(2*n_cols_ext))
+    r = aux_vectors;
+  else {
+    BFT_MALLOC(_aux_vectors, 2*n_cols_ext, cs_real_t);
+    r = _aux_vectors;
+  }
+  dx = r + n_cols_ext;
+
+  /* Direct solve */
+
+  _gather_solve_scatter(c, rhs, vx);
+
+  double  _residue = _residual(c, a, rotation_mode, rhs, vx, r);
+
+  /* Iterative refinement if the requested precision is not reached
+     (ill-conditioned systems) */
+
+  int  n_refine = 0;
+
+  while (_residue > precision*r_norm && n_refine < _n_max_refinements) {
+
+    _gather_solve_scatter(c, r, dx);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      vx[i] += dx[i];
+
+    _residue = _residual(c, a, rotation_mode, rhs, vx, r);
+    n_refine++;
+
+  }
+
+  BFT_FREE(_aux_vectors);
+
+  cs_sles_convergence_state_t  cvg = CS_SLES_CONVERGED;
+  if (_residue > precision*r_norm)
+    cvg = CS_SLES_MAX_ITERATION;
+
+  *n_iter = 1 + n_refine;
+  *residue = _residue;
+
+  c->n_solves += 1;
+  c->n_refinements += n_refine;
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log sparse linear equation solver info.
+ *
+ * \param[in]  context   pointer to direct solver info and context
+ *                       (actual type: cs_sles_ldlt_t  *)
+ * \param[in]  log_type  log type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_ldlt_log(const void  *context,
+                 cs_log_t     log_type)
+{
+  const cs_sles_ldlt_t  *c = context;
+
+  if (log_type == CS_LOG_SETUP) {
+
+    cs_log_printf(log_type,
+                  "  Solver type:                       sparse LDL^T\n"
+                  "    Ordering:                          nested dissection\n");
+
+  }
+  else if (log_type == CS_LOG_PERFORMANCE) {
+
+    cs_log_printf(log_type,
+                  _("\n"
+                    "  Solver type:                   sparse LDL^T\n"
+                    "  Number of setups:              %12d\n"
+                    "  Number of solves:              %12d\n"
+                    "  Number of refinement steps:    %12d\n"
+                    "  Max. factorized rows:          %12ld\n"
+                    "  Max. entries in factor:        %12ld\n"
+                    "  Null pivots (last setup):      %12ld\n"
+                    "  Total setup time:              %12.3f\n"
+                    "  Total solution time:           %12.3f\n"),
+                  c->n_setups, c->n_solves, c->n_refinements,
+                  (long)(c->n_g_rows_max), (long)(c->n_l_entries_max),
+                  (long)(c->n_null_pivots),
+                  c->t_setup.wall_nsec*1e-9, c->t_solve.wall_nsec*1e-9);
+
+  }
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set MPI communicator on which the system is gathered and solved.
+ *
+ * The system is gathered and factorized on the first rank of this
+ * communicator. Ranks with a NULL communicator only handle their local
+ * rows (usually none, when grids have been merged).
+ *
+ * \param[in, out]  context  pointer to direct solver info and context
+ * \param[in]       comm     MPI communicator for solving
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_ldlt_set_mpi_comm(cs_sles_ldlt_t  *context,
+                          MPI_Comm         comm)
+{
+  cs_sles_ldlt_t  *c = context;
+
+  c->comm = comm;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,263 @@
+#ifndef __CS_SLES_LDLT_H__
+#define __CS_SLES_LDLT_H__
+
+/*============================================================================
+ * Sparse Linear Equation Solver using a built-in sparse LDL^T factorization
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_halo_perio.h"
+#include "cs_matrix.h"
+#include "cs_sles.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*!
+  \file cs_sles_ldlt.h
+
+  \brief Built-in sparse direct solver (LDL^T factorization) for small
+         to medium size symmetric linear systems
+*/
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Direct linear solver context (opaque) */
+
+typedef struct _cs_sles_ldlt_t  cs_sles_ldlt_t;
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define and associate a sparse LDL^T direct linear system solver
+ *        for a given field or equation name.
+ *
+ * If this system did not previously exist, it is added to the list of
+ * "known" systems. Otherwise, its definition is replaced by the one
+ * defined here.
+ *
+ * This is a utility function: if finer control is needed, see
+ * \ref cs_sles_define and \ref cs_sles_ldlt_create.
+ *
+ * Note that this function returns a pointer directly to the direct solver
+ * management structure. This may be used to set further options.
+ * If needed, \ref cs_sles_find may be used to obtain a pointer to the matching
+ * \ref cs_sles_t container.
+ *
+ * \param[in]  f_id       associated field id, or < 0
+ * \param[in]  name       associated name if f_id < 0, or NULL
+ * \param[in]  verbosity  level of verbosity
+ *
+ * \return  pointer to newly created direct solver info object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_ldlt_t *
+cs_sles_ldlt_define(int          f_id,
+                    const char  *name,
+                    int          verbosity);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create sparse LDL^T linear system solver info and context.
+ *
+ * \param[in]  verbosity  level of verbosity
+ *
+ * \return  pointer to associated linear system object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_ldlt_t *
+cs_sles_ldlt_create(int  verbosity);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create sparse LDL^T linear system solver info and context based on
+ *        existing info and context.
+ *
+ * \param[in]  context  pointer to reference info and context
+ *                      (actual type: cs_sles_ldlt_t  *)
+ *
+ * \return  pointer to newly created solver info object.
+ *          (actual type: cs_sles_ldlt_t  *)
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_sles_ldlt_copy(const void   *context);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free sparse LDL^T linear equation solver setup context.
+ *
+ * This function frees the factorization, but does not free the whole
+ * context, as info used for logging (especially performance data) is
+ * maintained.
+ *
+ * \param[in, out]  context  pointer to direct solver info and context
+ *                           (actual type: cs_sles_ldlt_t  *)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_ldlt_free(void  *context);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy sparse LDL^T linear system solver info and context.
+ *
+ * \param[in, out]  context  pointer to direct solver info and context
+ *                           (actual type: cs_sles_ldlt_t  **)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_ldlt_destroy(void   **context);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Setup sparse LDL^T linear equation solver.
+ *
+ * The matrix is gathered on the first rank of the associated communicator,
+ * reordered to reduce fill-in, and factorized. The factorization is kept
+ * for all following solves until \ref cs_sles_ldlt_free is called.
+ * An error is raised if the matrix is not symmetric.
+ *
+ * \param[in, out]  context    pointer to direct solver info and context
+ *                             (actual type: cs_sles_ldlt_t  *)
+ * \param[in]       name       pointer to system name
+ * \param[in]       a          associated matrix
+ * \param[in]       verbosity  associated verbosity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_ldlt_setup(void               *context,
+                   const char         *name,
+                   const cs_matrix_t  *a,
+                   int                 verbosity);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call sparse LDL^T linear equation solver.
+ *
+ * \param[in, out]  context        pointer to direct solver info and context
+ *                                 (actual type: cs_sles_ldlt_t  *)
+ * \param[in]       name           pointer to system name
+ * \param[in]       a              matrix
+ * \param[in]       verbosity      associated verbosity
+ * \param[in]       rotation_mode  halo update option for rotational periodicity
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residue normalization
+ * \param[out]      n_iter         number of "equivalent" iterations
+ * \param[out]      residue        residue
+ * \param[in]       rhs            right hand side
+ * \param[in, out]  vx             system solution
+ * \param[in]       aux_size       number of elements in aux_vectors (in bytes)
+ * \param           aux_vectors    optional working area
+ *                                 (internal allocation if NULL)
+ *
+ * \return  convergence state (CS_SLES_MAX_ITERATION if the precision is
+ *          not reached after iterative refinement)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_ldlt_solve(void                *context,
+                   const char          *name,
+                   const cs_matrix_t   *a,
+                   int                  verbosity,
+                   cs_halo_rotation_t   rotation_mode,
+                   double               precision,
+                   double               r_norm,
+                   int                 *n_iter,
+                   double              *residue,
+                   const cs_real_t     *rhs,
+                   cs_real_t           *vx,
+                   size_t               aux_size,
+                   void                *aux_vectors);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log sparse linear equation solver info.
+ *
+ * \param[in]  context   pointer to direct solver info and context
+ *                       (actual type: cs_sles_ldlt_t  *)
+ * \param[in]  log_type  log type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_ldlt_log(const void  *context,
+                 cs_log_t     log_type);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set MPI communicator on which the system is gathered and solved.
+ *
+ * The system is gathered and factorized on the first rank of this
+ * communicator. Ranks with a NULL communicator only handle their local
+ * rows (usually none, when grids have been merged).
+ *
+ * \param[in, out]  context  pointer to direct solver info and context
+ * \param[in]       comm     MPI communicator for solving
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_ldlt_set_mpi_comm(cs_sles_ldlt_t  *context,
+                          MPI_Comm         comm);
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_SLES_LDLT_H__ */
@@ -175,6 +175,14 @@ BEGIN_C_DECLS
 /* MPI tag for file operations */
 #define CS_FILE_MPI_TAG  (int)('C'+'S'+'_'+'F'+'I'+'L'+'E')
 
+/* Non-blocking collective MPI-IO requires MPI 3.1 */
+
+#if defined(HAVE_MPI_IO)
+#  if (MPI_VERSION > 3) || (MPI_VERSION == 3 && MPI_SUBVERSION > 0)
+#    define CS_FILE_MPI_IWRITE_ALL
+#  endif
+#endif
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -200,6 +208,12 @@ struct _cs_file_t {
   MPI_File           fh;           /* MPI file handle */
   MPI_Info           info;         /* MPI file info */
   MPI_Offset         offset;       /* MPI file offset */
+  bool               async;        /* Use non-blocking writes if possible */
+  int                n_async;      /* Number of pending write requests */
+  int                n_async_max;  /* Size of pending request arrays */
+  MPI_Request       *async_req;    /* Pending write requests */
+  void             **async_buf;    /* Buffers associated with pending
+                                      write requests (owned) */
 #else
   cs_file_off_t      offset;       /* File offset */
 #endif
@@ -1205,6 +1219,126 @@ _mpi_io_error_message
               "Error type: %s"), file_name, buffer);
 }
 
+/*----------------------------------------------------------------------------
+ * Register a pending non-blocking write request for a file.
+ *
+ * The file descriptor takes ownership of the associated buffer, which
+ * is freed once the request is completed.
+ *
+ * parameters:
+ *   f       <-> pointer to file handler
+ *   request <-- associated MPI request
+ *   buf     <-- associated (allocated) buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_mpi_file_add_async(cs_file_t    *f,
+                    MPI_Request   request,
+                    void         *buf)
+{
+  if (f->n_async >= f->n_async_max) {
+    f->n_async_max = CS_MAX(f->n_async_max*2, 4);
+    BFT_REALLOC(f->async_req, f->n_async_max, MPI_Request);
+    BFT_REALLOC(f->async_buf, f->n_async_max, void *);
+  }
+
+  f->async_req[f->n_async] = request;
+  f->async_buf[f->n_async] = buf;
+  f->n_async += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Complete pending non-blocking writes for a file.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_mpi_file_complete_async(cs_file_t  *f)
+{
+  if (f->n_async > 0) {
+
+    int errcode = MPI_Waitall(f->n_async, f->async_req, MPI_STATUSES_IGNORE);
+
+    if (errcode != MPI_SUCCESS)
+      _mpi_io_error_message(f->name, errcode);
+
+    for (int i = 0; i < f->n_async; i++)
+      BFT_FREE(f->async_buf[i]);
+
+    f->n_async = 0;
+
+  }
+
+  f->n_async_max = 0;
+  BFT_FREE(f->async_req);
+  BFT_FREE(f->async_buf);
+}
+
+/*----------------------------------------------------------------------------
+ * Write data at a given offset using MPI IO with a non-blocking call.
+ *
+ * The data is copied to an internal buffer, so the caller's buffer may be
+ * reused or freed as soon as this function returns. If collective
+ * non-blocking writes are not available, a blocking call is used.
+ *
+ * parameters:
+ *   f          <-> pointer to file handler
+ *   disp       <-- write offset
+ *   buf        <-- pointer to data
+ *   count      <-- number of elements of type ent_type
+ *   ent_type   <-- MPI datatype of elements
+ *   n_bytes    <-- size of data in bytes
+ *   collective <-- true for a collective write
+ *
+ * returns:
+ *   MPI_SUCCESS in case of success, MPI error code in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_mpi_file_iwrite_at(cs_file_t     *f,
+                    MPI_Offset     disp,
+                    const void    *buf,
+                    int            count,
+                    MPI_Datatype   ent_type,
+                    size_t         n_bytes,
+                    bool           collective)
+{
+  int errcode = MPI_SUCCESS;
+  MPI_Request request;
+
+  unsigned char *copybuf = NULL;
+
+#if !defined(CS_FILE_MPI_IWRITE_ALL)
+  if (collective) {
+    MPI_Status status;
+    return MPI_File_write_at_all(f->fh, disp, (void *)buf, count, ent_type,
+                                 &status);
+  }
+#endif
+
+  BFT_MALLOC(copybuf, n_bytes, unsigned char);
+  if (n_bytes > 0)
+    memcpy(copybuf, buf, n_bytes);
+
+#if defined(CS_FILE_MPI_IWRITE_ALL)
+  if (collective)
+    errcode = MPI_File_iwrite_at_all(f->fh, disp, copybuf, count, ent_type,
+                                     &request);
+  else
+#endif
+    errcode = MPI_File_iwrite_at(f->fh, disp, copybuf, count, ent_type,
+                                 &request);
+
+  if (errcode == MPI_SUCCESS)
+    _mpi_file_add_async(f, request, copybuf);
+  else
+    BFT_FREE(copybuf);
+
+  return errcode;
+}
+
 /*----------------------------------------------------------------------------
  * Open a file using MPI IO.
  *
@@ -1325,7 +1459,9 @@ _mpi_file_close(cs_file_t  *f)
   if (f->fh == MPI_FILE_NULL)
     return 0;
 
-  /* Close file */
+  /* Complete pending writes and close file */
+
+  _mpi_file_complete_async(f);
 
   retval = MPI_File_close(&(f->fh));
 
@@ -1577,6 +1713,7 @@ _mpi_file_write_block_noncoll(cs_file_t  *f,
   if (gcount > 0) {
 
     int errcode, count;
+    bool status_is_set = true;
     MPI_Status status;
     MPI_Offset disp = f->offset + ((global_num_start - 1) * size);
     MPI_Datatype ent_type = MPI_BYTE;
@@ -1593,8 +1730,16 @@ _mpi_file_write_block_noncoll(cs_file_t  *f,
 
     if (errcode == MPI_SUCCESS) {
 
-      if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
-        errcode = MPI_File_write_at(f->fh, disp, buf, count, ent_type, &status);
+      if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS) {
+        if (f->async) {
+          errcode = _mpi_file_iwrite_at(f, disp, buf, count, ent_type,
+                                        gcount, false);
+          status_is_set = false;
+        }
+        else
+          errcode = MPI_File_write_at(f->fh, disp, buf, count, ent_type,
+                                      &status);
+      }
 
       else {
         errcode = MPI_File_seek(f->fh, disp, MPI_SEEK_SET);
@@ -1607,7 +1752,7 @@ _mpi_file_write_block_noncoll(cs_file_t  *f,
     if (errcode != MPI_SUCCESS)
       _mpi_io_error_message(f->name, errcode);
 
-    if (count > 0)
+    if (count > 0 && status_is_set)
       MPI_Get_count(&status, ent_type, &count);
 
     if (ent_type != MPI_BYTE) {
@@ -1651,13 +1796,25 @@ _mpi_file_write_block_eo(cs_file_t  *f,
   else
     count = gcount;
 
-  errcode = MPI_File_write_at_all(f->fh, disp, buf, count, ent_type, &status);
+  if (f->async) {
+    errcode = _mpi_file_iwrite_at(f, disp, buf, count, ent_type,
+                                  gcount, true);
+    if (errcode != MPI_SUCCESS)
+      _mpi_io_error_message(f->name, errcode);
+  }
 
-  if (errcode != MPI_SUCCESS)
-    _mpi_io_error_message(f->name, errcode);
+  else {
 
-  if (count > 0)
-    MPI_Get_count(&status, ent_type, &count);
+    errcode = MPI_File_write_at_all(f->fh, disp, buf, count, ent_type,
+                                    &status);
+
+    if (errcode != MPI_SUCCESS)
+      _mpi_io_error_message(f->name, errcode);
+
+    if (count > 0)
+      MPI_Get_count(&status, ent_type, &count);
+
+  }
 
   if (ent_type != MPI_BYTE) {
     MPI_Type_free(&ent_type);
@@ -1833,6 +1990,11 @@ cs_file_open(const char        *name,
 #if defined(HAVE_MPI_IO)
   f->fh = MPI_FILE_NULL;
   f->info = hints;
+  f->async = false;
+  f->n_async = 0;
+  f->n_async_max = 0;
+  f->async_req = NULL;
+  f->async_buf = NULL;
 #endif
 #endif
 
@@ -2111,6 +2273,70 @@ cs_file_set_swap_endian(cs_file_t  *f,
   f->swap_endian = swap;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set a file's non-blocking write behavior.
+ *
+ * When active, block and global writes using MPI-IO with explicit offsets
+ * are started using non-blocking calls, working on an internal copy of the
+ * data, so that the calling rank may proceed with computations while the
+ * data is written. All pending writes are completed when the file is
+ * closed by cs_file_free().
+ *
+ * This setting has no effect for other access methods or in read mode,
+ * and since some writes may be collective, it must be set identically on
+ * all ranks of the file's communicator.
+ *
+ * \param[in, out]  f      cs_file_t descriptor
+ * \param[in]       async  true if non-blocking writes should be used
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async(cs_file_t  *f,
+                  bool        async)
+{
+  assert(f != NULL);
+
+#if defined(HAVE_MPI_IO)
+  if (   f->method > CS_FILE_STDIO_PARALLEL
+      && f->mode != CS_FILE_MODE_READ
+      && _mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
+    f->async = async;
+  else
+    f->async = false;
+#else
+  CS_UNUSED(f);
+  CS_UNUSED(async);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether non-blocking writes are active for a file.
+ *
+ * \param[in]  f  cs_file_t descriptor
+ *
+ * \return true if non-blocking writes are used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_get_async(const cs_file_t  *f)
+{
+  assert(f != NULL);
+
+  bool retval = false;
+
+#if defined(HAVE_MPI_IO)
+  retval = f->async;
+#else
+  CS_UNUSED(f);
+#endif
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read global data from a file, distributing it to all processes
@@ -2269,7 +2495,17 @@ cs_file_write_global(cs_file_t   *f,
     int errcode = MPI_SUCCESS, count = 0;
 
     if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS) {
-      if (f->rank == 0) {
+      if (f->rank == 0 && f->async) {
+        errcode = _mpi_file_iwrite_at(f,
+                                      f->offset,
+                                      copybuf,
+                                      size*ni,
+                                      MPI_BYTE,
+                                      size*ni,
+                                      false);
+        count = size*ni;
+      }
+      else if (f->rank == 0) {
         errcode = MPI_File_write_at(f->fh,
                                     f->offset,
                                     copybuf,
@@ -270,6 +270,41 @@ void
 cs_file_set_swap_endian(cs_file_t  *f,
                         int         swap);
 
+/*----------------------------------------------------------------------------
+ * Set a file's non-blocking write behavior.
+ *
+ * When active, block and global writes using MPI-IO with explicit offsets
+ * are started using non-blocking calls, working on an internal copy of the
+ * data, so that the calling rank may proceed with computations while the
+ * data is written. All pending writes are completed when the file is
+ * closed by cs_file_free().
+ *
+ * This setting has no effect for other access methods or in read mode,
+ * and since some writes may be collective, it must be set identically on
+ * all ranks of the file's communicator.
+ *
+ * parameters:
+ *   f     <-> cs_file_t descriptor
+ *   async <-- true if non-blocking writes should be used
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async(cs_file_t  *f,
+                  bool        async);
+
+/*----------------------------------------------------------------------------
+ * Indicate whether non-blocking writes are active for a file.
+ *
+ * parameters:
+ *   f <-- cs_file_t descriptor
+ *
+ * returns:
+ *   true if non-blocking writes are used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_file_get_async(const cs_file_t  *f);
+
 /*----------------------------------------------------------------------------
  * Read global data from a file, distributing it to all processes
  * associated with that file.
@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -40,6 +41,10 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
 #undef HAVE_STDINT_H
 #if defined(__STDC_VERSION__)
 #  if (__STDC_VERSION__ >= 199901L)
@@ -163,6 +168,17 @@ struct _cs_io_t {
   void               *data;           /* Pointer to data in section header
                                          (if embedded; NULL otherwise) */
 
+  size_t              z_n_chunks;     /* Number of compressed chunks in
+                                         section body, or 0 */
+  size_t              z_chunks_size;  /* Allocated size of z_chunks */
+  cs_file_off_t      *z_chunks;       /* Value start and compressed size
+                                         for each chunk of section body */
+
+  /* Compression settings (write mode) */
+
+  int                 z_level;        /* Compression level for distributed
+                                         data sections (0 if none) */
+
   /* Other flags */
 
   long                echo;           /* Data echo level (verbosity) */
@@ -180,6 +196,19 @@ struct _cs_io_t {
 
 #define CS_IO_MPI_TAG     'C'+'S'+'_'+'I'+'O'
 
+/* Sections whose body is smaller than this size (in bytes) are never
+   compressed, as compression overhead would exceed the gain */
+
+#define CS_IO_Z_MIN_SIZE  4096
+
+#if defined(HAVE_MPI)
+#  if defined(SIZEOF_LONG_LONG)
+#    define CS_IO_MPI_OFFSET  MPI_LONG_LONG
+#  else
+#    define CS_IO_MPI_OFFSET  MPI_LONG
+#  endif
+#endif
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -200,6 +229,15 @@ static int _cs_io_map_size_max[2] = {0, 0};
 static cs_map_name_to_id_t  *_cs_io_map[2] = {NULL, NULL};
 static cs_io_log_t  *_cs_io_log[2] = {NULL, NULL};
 
+#if defined(HAVE_MPI)
+
+/* Maximum number of bytes exchanged by a rank in a single MPI call
+   (counts and displacements are ints) */
+
+static cs_file_off_t  _max_exchange_size = INT_MAX;
+
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -365,6 +403,210 @@ _convert_from_offset(unsigned char         buf[],
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Set the compressed chunks description of the current section.
+ *
+ * parameters:
+ *   cs_io    <-> kernel IO structure
+ *   n_chunks <-- number of compressed chunks
+ *   chunks   <-- value start and compressed size for each chunk
+ *----------------------------------------------------------------------------*/
+
+static void
+_z_set_chunks(cs_io_t              *cs_io,
+              size_t                n_chunks,
+              const cs_file_off_t   chunks[])
+{
+  if (n_chunks*2 > cs_io->z_chunks_size) {
+    cs_io->z_chunks_size = n_chunks*2;
+    BFT_REALLOC(cs_io->z_chunks, cs_io->z_chunks_size, cs_file_off_t);
+  }
+
+  if (n_chunks > 0)
+    memcpy(cs_io->z_chunks, chunks, n_chunks*2*sizeof(cs_file_off_t));
+
+  cs_io->z_n_chunks = n_chunks;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the size of the current section's body in the file.
+ *
+ * parameters:
+ *   cs_io <-- kernel IO structure
+ *
+ * returns:
+ *   size of section body in bytes
+ *----------------------------------------------------------------------------*/
+
+static cs_file_off_t
+_body_size(const cs_io_t  *cs_io)
+{
+  cs_file_off_t retval = 0;
+
+  if (cs_io->z_n_chunks > 0) {
+    for (size_t i = 0; i < cs_io->z_n_chunks; i++)
+      retval += cs_io->z_chunks[i*2 + 1];
+  }
+  else
+    retval = cs_io->n_vals * cs_io->type_size;
+
+  return retval;
+}
+
+#if defined(HAVE_ZLIB)
+
+/*----------------------------------------------------------------------------
+ * Compress a block of values.
+ *
+ * Bytes are first shuffled so that bytes of same significance for all
+ * values are contiguous (which greatly improves compression of
+ * floating-point data, whose sign and exponent bytes vary slowly), and
+ * converted to the file's byte order if needed.
+ *
+ * The returned buffer is allocated by this function, and should be freed
+ * by the caller.
+ *
+ * parameters:
+ *   elts      <-- values to compress
+ *   type_size <-- size of each value in bytes
+ *   n_vals    <-- number of values
+ *   swap      <-- true if values must be converted to the opposite endianness
+ *   level     <-- compression level
+ *   z_size    --> compressed size in bytes
+ *
+ * returns:
+ *   pointer to compressed data buffer
+ *----------------------------------------------------------------------------*/
+
+static unsigned char *
+_z_compress(const void  *elts,
+            size_t       type_size,
+            size_t       n_vals,
+            bool         swap,
+            int          level,
+            size_t      *z_size)
+{
+  size_t size = n_vals * type_size;
+  unsigned char *s_buf = NULL, *z_buf = NULL;
+  const unsigned char *src = elts;
+
+  BFT_MALLOC(s_buf, size, unsigned char);
+
+  if (swap && type_size > 1) {
+    for (size_t i = 0; i < n_vals; i++) {
+      for (size_t b = 0; b < type_size; b++)
+        s_buf[b*n_vals + i] = src[i*type_size + (type_size - 1 - b)];
+    }
+  }
+  else {
+    for (size_t i = 0; i < n_vals; i++) {
+      for (size_t b = 0; b < type_size; b++)
+        s_buf[b*n_vals + i] = src[i*type_size + b];
+    }
+  }
+
+  uLongf z_len = compressBound(size);
+
+  BFT_MALLOC(z_buf, z_len, unsigned char);
+
+  int retval = compress2(z_buf, &z_len, s_buf, size, level);
+
+  if (retval != Z_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error compressing %llu bytes (zlib error code %d)."),
+              (unsigned long long)size, retval);
+
+  BFT_FREE(s_buf);
+
+  *z_size = z_len;
+
+  return z_buf;
+}
+
+/*----------------------------------------------------------------------------
+ * Uncompress a block of values compressed by _z_compress().
+ *
+ * parameters:
+ *   z_buf     <-- compressed data
+ *   z_size    <-- compressed size in bytes
+ *   type_size <-- size of each value in bytes
+ *   n_vals    <-- number of values
+ *   swap      <-- true if values must be converted to the opposite endianness
+ *   elts      --> uncompressed values
+ *----------------------------------------------------------------------------*/
+
+static void
+_z_uncompress(const unsigned char  *z_buf,
+              size_t                z_size,
+              size_t                type_size,
+              size_t                n_vals,
+              bool                  swap,
+              void                 *elts)
+{
+  size_t size = n_vals * type_size;
+  unsigned char *s_buf = NULL;
+  unsigned char *dest = elts;
+
+  BFT_MALLOC(s_buf, size, unsigned char);
+
+  uLongf s_len = size;
+
+  int retval = uncompress(s_buf, &s_len, z_buf, z_size);
+
+  if (retval != Z_OK || s_len != size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error uncompressing %llu bytes (zlib error code %d)."),
+              (unsigned long long)z_size, retval);
+
+  if (swap && type_size > 1) {
+    for (size_t i = 0; i < n_vals; i++) {
+      for (size_t b = 0; b < type_size; b++)
+        dest[i*type_size + (type_size - 1 - b)] = s_buf[b*n_vals + i];
+    }
+  }
+  else {
+    for (size_t i = 0; i < n_vals; i++) {
+      for (size_t b = 0; b < type_size; b++)
+        dest[i*type_size + b] = s_buf[b*n_vals + i];
+    }
+  }
+
+  BFT_FREE(s_buf);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the id of the first compressed chunk whose first value is
+ * greater or equal to a given value id.
+ *
+ * parameters:
+ *   n_chunks <-- number of compressed chunks
+ *   chunks   <-- value start and compressed size for each chunk
+ *   val_id   <-- value id
+ *
+ * returns:
+ *   id of chunk, or n_chunks if not found
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_z_chunk_lower_bound(size_t                n_chunks,
+                     const cs_file_off_t   chunks[],
+                     cs_file_off_t         val_id)
+{
+  size_t start_id = 0, end_id = n_chunks;
+
+  while (start_id < end_id) {
+    size_t mid_id = start_id + (end_id - start_id)/2;
+    if (chunks[mid_id*2] < val_id)
+      start_id = mid_id + 1;
+    else
+      end_id = mid_id;
+  }
+
+  return start_id;
+}
+
+#endif /* defined(HAVE_ZLIB) */
+
 /*----------------------------------------------------------------------------
  * Return an empty kernel IO file structure.
  *
@@ -410,6 +652,12 @@ _cs_io_create(cs_io_mode_t   mode,
   cs_io->type_name = NULL;
   cs_io->data = NULL;
 
+  cs_io->z_n_chunks = 0;
+  cs_io->z_chunks_size = 0;
+  cs_io->z_chunks = NULL;
+
+  cs_io->z_level = 0;
+
   /* Verbosity and logging */
 
   cs_io->echo = echo;
@@ -523,6 +771,9 @@ _update_index_and_shift(cs_io_t             *inp,
     new_data_size
       = idx->data_size + (  inp->n_vals
                           * cs_datatype_size[header->type_read]);
+  else if (inp->z_n_chunks > 0)
+    new_data_size
+      = idx->data_size + (inp->z_n_chunks*2 + 1)*sizeof(cs_file_off_t);
 
   if (new_names_size > idx->max_names_size) {
     if (idx->max_names_size == 0)
@@ -558,7 +809,7 @@ _update_index_and_shift(cs_io_t             *inp,
 
   if (inp->data == NULL) {
     cs_file_off_t offset = cs_file_tell(inp->f);
-    cs_file_off_t data_shift = inp->n_vals * inp->type_size;
+    cs_file_off_t data_shift = _body_size(inp);
     if (inp->body_align > 0) {
       size_t ba = inp->body_align;
       idx->offset[id] = offset + (ba - (offset % ba)) % ba;
@@ -566,6 +817,20 @@ _update_index_and_shift(cs_io_t             *inp,
     else
       idx->offset[id] = offset;
     cs_file_seek(inp->f, idx->offset[id] + data_shift, CS_FILE_SEEK_SET);
+
+    /* For compressed sections, store chunk sizes as "embedded" data,
+       (compressed sections are distinguished from embedded sections
+       by a positive offset) */
+
+    if (inp->z_n_chunks > 0) {
+      cs_file_off_t n_chunks = inp->z_n_chunks;
+      idx->h_vals[id*7 + 5] = idx->data_size + 1;
+      memcpy(idx->data + idx->data_size, &n_chunks, sizeof(cs_file_off_t));
+      memcpy(idx->data + idx->data_size + sizeof(cs_file_off_t),
+             inp->z_chunks,
+             inp->z_n_chunks*2*sizeof(cs_file_off_t));
+      idx->data_size = new_data_size;
+    }
   }
   else {
     idx->h_vals[id*7 + 5] = idx->data_size + 1;
@@ -1260,6 +1525,356 @@ _cs_io_convert_read(void           *buffer,
   }
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Exchange bytes between all ranks of a communicator.
+ *
+ * When all counts and displacements fit in an int on all ranks, a single
+ * MPI_Alltoallv is used. Otherwise, bytes are exchanged in several passes
+ * through intermediate buffers, each rank exchanging at most
+ * _max_exchange_size bytes per pass.
+ *
+ * parameters:
+ *   send_buf   <-- send buffer
+ *   send_count <-- number of bytes sent to each rank
+ *   send_shift <-- position of bytes sent to each rank in send_buf
+ *   recv_buf   --> receive buffer
+ *   recv_count <-- number of bytes received from each rank
+ *   recv_shift <-- position of bytes received from each rank in recv_buf
+ *   comm       <-- associated MPI communicator
+ *----------------------------------------------------------------------------*/
+
+static void
+_alltoallv_bytes(const unsigned char  *send_buf,
+                 const cs_file_off_t   send_count[],
+                 const cs_file_off_t   send_shift[],
+                 unsigned char        *recv_buf,
+                 const cs_file_off_t   recv_count[],
+                 const cs_file_off_t   recv_shift[],
+                 MPI_Comm              comm)
+{
+  int i, n_ranks;
+  MPI_Comm_size(comm, &n_ranks);
+
+  /* Check if a single exchange is possible */
+
+  int direct = 1;
+
+  for (i = 0; i < n_ranks; i++) {
+    if (   send_count[i] + send_shift[i] > _max_exchange_size
+        || recv_count[i] + recv_shift[i] > _max_exchange_size)
+      direct = 0;
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE, &direct, 1, MPI_INT, MPI_MIN, comm);
+
+  int *s_count, *s_shift, *r_count, *r_shift;
+
+  BFT_MALLOC(s_count, n_ranks, int);
+  BFT_MALLOC(s_shift, n_ranks, int);
+  BFT_MALLOC(r_count, n_ranks, int);
+  BFT_MALLOC(r_shift, n_ranks, int);
+
+  if (direct) {
+
+    for (i = 0; i < n_ranks; i++) {
+      s_count[i] = send_count[i];
+      s_shift[i] = send_shift[i];
+      r_count[i] = recv_count[i];
+      r_shift[i] = recv_shift[i];
+    }
+
+    MPI_Alltoallv(send_buf, s_count, s_shift, MPI_BYTE,
+                  recv_buf, r_count, r_shift, MPI_BYTE,
+                  comm);
+
+  }
+
+  else {
+
+    /* Exchange at most p_size bytes with each rank per pass */
+
+    const cs_file_off_t p_size = CS_MAX(_max_exchange_size / n_ranks, 1);
+
+    cs_file_off_t n_passes = 0;
+    for (i = 0; i < n_ranks; i++) {
+      cs_file_off_t count = CS_MAX(send_count[i], recv_count[i]);
+      n_passes = CS_MAX(n_passes, (count + p_size - 1) / p_size);
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, &n_passes, 1, CS_IO_MPI_OFFSET, MPI_MAX, comm);
+
+    unsigned char *s_buf, *r_buf;
+    BFT_MALLOC(s_buf, p_size*n_ranks, unsigned char);
+    BFT_MALLOC(r_buf, p_size*n_ranks, unsigned char);
+
+    for (cs_file_off_t pass = 0; pass < n_passes; pass++) {
+
+      const cs_file_off_t p_start = pass*p_size;
+
+      int s_size = 0, r_size = 0;
+
+      for (i = 0; i < n_ranks; i++) {
+
+        cs_file_off_t s_n = CS_MIN(send_count[i] - p_start, p_size);
+        s_count[i] = CS_MAX(s_n, 0);
+        s_shift[i] = s_size;
+        if (s_count[i] > 0)
+          memcpy(s_buf + s_size,
+                 send_buf + send_shift[i] + p_start,
+                 s_count[i]);
+        s_size += s_count[i];
+
+        cs_file_off_t r_n = CS_MIN(recv_count[i] - p_start, p_size);
+        r_count[i] = CS_MAX(r_n, 0);
+        r_shift[i] = r_size;
+        r_size += r_count[i];
+
+      }
+
+      MPI_Alltoallv(s_buf, s_count, s_shift, MPI_BYTE,
+                    r_buf, r_count, r_shift, MPI_BYTE,
+                    comm);
+
+      for (i = 0; i < n_ranks; i++) {
+        if (r_count[i] > 0)
+          memcpy(recv_buf + recv_shift[i] + p_start,
+                 r_buf + r_shift[i],
+                 r_count[i]);
+      }
+
+    }
+
+    BFT_FREE(r_buf);
+    BFT_FREE(s_buf);
+
+  }
+
+  BFT_FREE(r_shift);
+  BFT_FREE(r_count);
+  BFT_FREE(s_shift);
+  BFT_FREE(s_count);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Read a compressed section body.
+ *
+ * In block mode, each compressed chunk is read and uncompressed by the
+ * rank whose block contains the chunk's first value, and values are then
+ * exchanged so that each rank obtains its own block, independently of
+ * the distribution used when writing.
+ *
+ * parameters:
+ *   inp              <-> input kernel IO structure
+ *   buf              --> buffer for read values (in file datatype)
+ *   type_size        <-- size of each value in bytes
+ *   stride           <-- number of values per location element
+ *   global_num_start <-- global number of first block item, or 0
+ *                        for global read
+ *   global_num_end   <-- global number of past-the end block item, or 0
+ *                        for global read
+ *
+ * returns:
+ *   number of bytes read from file
+ *----------------------------------------------------------------------------*/
+
+static cs_file_off_t
+_read_compressed(cs_io_t     *inp,
+                 void        *buf,
+                 size_t       type_size,
+                 size_t       stride,
+                 cs_gnum_t    global_num_start,
+                 cs_gnum_t    global_num_end)
+{
+  cs_file_off_t retval = 0;
+
+#if defined(HAVE_ZLIB)
+
+  size_t c_id;
+  unsigned char *z_buf = NULL;
+
+  const size_t n_chunks = inp->z_n_chunks;
+  const cs_file_off_t *chunks = inp->z_chunks;
+  const bool swap = (cs_file_get_swap_endian(inp->f) == 1) ? true : false;
+
+  /* Byte index of chunks in file */
+
+  cs_file_off_t *b_idx = NULL;
+  BFT_MALLOC(b_idx, n_chunks + 1, cs_file_off_t);
+
+  b_idx[0] = 0;
+  for (c_id = 0; c_id < n_chunks; c_id++)
+    b_idx[c_id+1] = b_idx[c_id] + chunks[c_id*2 + 1];
+
+#define _CHUNK_END(c) ((c) + 1 < n_chunks ? chunks[((c) + 1)*2] : inp->n_vals)
+
+  /* Global mode: all ranks uncompress all values */
+
+  if (global_num_start == 0 || global_num_end == 0) {
+
+    BFT_MALLOC(z_buf, b_idx[n_chunks], unsigned char);
+
+    cs_file_read_global(inp->f, z_buf, 1, b_idx[n_chunks]);
+
+    for (c_id = 0; c_id < n_chunks; c_id++)
+      _z_uncompress(z_buf + b_idx[c_id],
+                    chunks[c_id*2 + 1],
+                    type_size,
+                    _CHUNK_END(c_id) - chunks[c_id*2],
+                    swap,
+                    (unsigned char *)buf + chunks[c_id*2]*type_size);
+
+    retval = b_idx[n_chunks];
+  }
+
+  /* Block mode */
+
+  else {
+
+    int rank_id = 0, n_ranks = 1;
+
+#if defined(HAVE_MPI)
+    if (inp->comm != MPI_COMM_NULL) {
+      MPI_Comm_rank(inp->comm, &rank_id);
+      MPI_Comm_size(inp->comm, &n_ranks);
+    }
+#endif
+
+    cs_file_off_t l_range[2] = {(global_num_start - 1)*stride,
+                                (global_num_end - 1)*stride};
+    cs_file_off_t *v_range = NULL;
+    size_t *c_range = NULL;
+
+    BFT_MALLOC(v_range, n_ranks*2, cs_file_off_t);
+    BFT_MALLOC(c_range, n_ranks*2, size_t);
+
+#if defined(HAVE_MPI)
+    if (n_ranks > 1)
+      MPI_Allgather(l_range, 2, CS_IO_MPI_OFFSET,
+                    v_range, 2, CS_IO_MPI_OFFSET, inp->comm);
+#endif
+    if (n_ranks == 1) {
+      v_range[0] = l_range[0];
+      v_range[1] = l_range[1];
+    }
+
+    /* Chunks read by each rank are those starting in its block */
+
+    for (int i = 0; i < n_ranks; i++) {
+      c_range[i*2] = _z_chunk_lower_bound(n_chunks, chunks, v_range[i*2]);
+      if (v_range[i*2+1] > v_range[i*2])
+        c_range[i*2+1] = _z_chunk_lower_bound(n_chunks, chunks,
+                                              v_range[i*2+1]);
+      else
+        c_range[i*2+1] = c_range[i*2];
+    }
+
+    const size_t c_s = c_range[rank_id*2], c_e = c_range[rank_id*2+1];
+    const cs_file_off_t h_s = (c_e > c_s) ? chunks[c_s*2] : l_range[0];
+    const cs_file_off_t h_e = (c_e > c_s) ? _CHUNK_END(c_e - 1) : l_range[0];
+
+    unsigned char *h_buf = NULL;
+
+    BFT_MALLOC(z_buf, b_idx[c_e] - b_idx[c_s], unsigned char);
+    BFT_MALLOC(h_buf, (h_e - h_s)*type_size, unsigned char);
+
+    cs_file_read_block(inp->f,
+                       z_buf,
+                       1,
+                       1,
+                       b_idx[c_s] + 1,
+                       b_idx[c_e] + 1);
+
+    for (c_id = c_s; c_id < c_e; c_id++)
+      _z_uncompress(z_buf + b_idx[c_id] - b_idx[c_s],
+                    chunks[c_id*2 + 1],
+                    type_size,
+                    _CHUNK_END(c_id) - chunks[c_id*2],
+                    swap,
+                    h_buf + (chunks[c_id*2] - h_s)*type_size);
+
+    retval = b_idx[c_e] - b_idx[c_s];
+
+    /* Redistribute uncompressed values to requesting ranks */
+
+    if (n_ranks == 1)
+      memcpy(buf,
+             h_buf + (l_range[0] - h_s)*type_size,
+             (l_range[1] - l_range[0])*type_size);
+
+#if defined(HAVE_MPI)
+
+    else {
+
+      cs_file_off_t *send_count, *send_shift, *recv_count, *recv_shift;
+
+      BFT_MALLOC(send_count, n_ranks, cs_file_off_t);
+      BFT_MALLOC(send_shift, n_ranks, cs_file_off_t);
+      BFT_MALLOC(recv_count, n_ranks, cs_file_off_t);
+      BFT_MALLOC(recv_shift, n_ranks, cs_file_off_t);
+
+      for (int i = 0; i < n_ranks; i++) {
+
+        cs_file_off_t s_s = CS_MAX(h_s, v_range[i*2]);
+        cs_file_off_t s_e = CS_MIN(h_e, v_range[i*2+1]);
+        send_count[i] = (s_e > s_s) ? (s_e - s_s)*type_size : 0;
+        send_shift[i] = (s_e > s_s) ? (s_s - h_s)*type_size : 0;
+
+        size_t o_c_s = c_range[i*2], o_c_e = c_range[i*2+1];
+        cs_file_off_t r_s = l_range[0], r_e = l_range[0];
+        if (o_c_e > o_c_s) {
+          r_s = CS_MAX(chunks[o_c_s*2], l_range[0]);
+          r_e = CS_MIN(_CHUNK_END(o_c_e - 1), l_range[1]);
+        }
+        recv_count[i] = (r_e > r_s) ? (r_e - r_s)*type_size : 0;
+        recv_shift[i] = (r_e > r_s) ? (r_s - l_range[0])*type_size : 0;
+
+      }
+
+      _alltoallv_bytes(h_buf, send_count, send_shift,
+                       buf, recv_count, recv_shift,
+                       inp->comm);
+
+      BFT_FREE(recv_shift);
+      BFT_FREE(recv_count);
+      BFT_FREE(send_shift);
+      BFT_FREE(send_count);
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    BFT_FREE(h_buf);
+    BFT_FREE(c_range);
+    BFT_FREE(v_range);
+  }
+
+#undef _CHUNK_END
+
+  BFT_FREE(z_buf);
+  BFT_FREE(b_idx);
+
+#else
+
+  CS_UNUSED(buf);
+  CS_UNUSED(type_size);
+  CS_UNUSED(stride);
+  CS_UNUSED(global_num_start);
+  CS_UNUSED(global_num_end);
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("Error reading file: \"%s\".\n"
+              "Section \"%s\" is compressed, but Zlib support\n"
+              "is not available in this build."),
+            cs_file_get_name(inp->f), inp->sec_name);
+
+#endif /* defined(HAVE_ZLIB) */
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Read a section body.
  *
@@ -1371,7 +1986,20 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
 
     /* Read local or global values */
 
-    if (global_num_start > 0 && global_num_end > 0) {
+    if (inp->z_n_chunks > 0) {
+      cs_file_off_t z_size = _read_compressed(inp,
+                                              _buf,
+                                              type_size,
+                                              stride,
+                                              global_num_start,
+                                              global_num_end);
+      if (log != NULL) {
+        int t_id = (global_num_start > 0 && global_num_end > 0) ? 1 : 0;
+        log->data_size[t_id] += z_size;
+      }
+    }
+
+    else if (global_num_start > 0 && global_num_end > 0) {
       cs_file_read_block(inp->f,
                          _buf,
                          type_size,
@@ -1573,6 +2201,9 @@ _write_padding(size_t    align,
  *   n_location_vals  <-- number of values per location
  *   elt_type         <-- element type
  *   elts             <-- pointer to element data, if it may be embedded
+ *   z_n_chunks       <-- number of compressed chunks, or 0
+ *   z_chunks         <-- value start and compressed size for each chunk
+ *                        if compressed, or NULL
  *   outp             --> output kernel IO structure
  *
  * returns:
@@ -1580,14 +2211,16 @@ _write_padding(size_t    align,
  *----------------------------------------------------------------------------*/
 
 static bool
-_write_header(const char     *sec_name,
-              cs_gnum_t       n_vals,
-              size_t          location_id,
-              size_t          index_id,
-              size_t          n_location_vals,
-              cs_datatype_t   elt_type,
-              const void     *elts,
-              cs_io_t        *outp)
+_write_header(const char           *sec_name,
+              cs_gnum_t             n_vals,
+              size_t                location_id,
+              size_t                index_id,
+              size_t                n_location_vals,
+              cs_datatype_t         elt_type,
+              const void           *elts,
+              size_t                z_n_chunks,
+              const cs_file_off_t   z_chunks[],
+              cs_io_t              *outp)
 {
   cs_file_off_t header_vals[6];
 
@@ -1638,6 +2271,11 @@ _write_header(const char     *sec_name,
     embed = true;
   }
 
+  /* Compressed chunks description is always embedded */
+
+  else if (z_n_chunks > 0)
+    header_vals[0] += (z_n_chunks*2 + 1) * 8;
+
   /* Ensure buffer is big enough for data */
 
   if (header_vals[0] > (cs_file_off_t)(outp->buffer_size)) {
@@ -1704,6 +2342,8 @@ _write_header(const char     *sec_name,
 
   if (embed == true)
     outp->type_name[7] = 'e';
+  else if (z_n_chunks > 0)
+    outp->type_name[7] = 'z';
 
   /* Section name */
 
@@ -1721,6 +2361,19 @@ _write_header(const char     *sec_name,
       _swap_endian(data, cs_datatype_size[elt_type], n_vals);
   }
 
+  else if (z_n_chunks > 0) {
+
+    cs_file_off_t _n_chunks = z_n_chunks;
+    unsigned char *data =   (unsigned char *)(outp->buffer)
+                          + (56 + name_size + name_pad_size);
+
+    _convert_from_offset(data, &_n_chunks, 1);
+    _convert_from_offset(data + 8, z_chunks, z_n_chunks*2);
+
+    if (cs_file_get_swap_endian(outp->f) == 1)
+      _swap_endian(data, 8, z_n_chunks*2 + 1);
+  }
+
   /* Now write header data */
 
   write_size = CS_MAX((cs_file_off_t)(outp->header_size), header_vals[0]);
@@ -1747,6 +2400,166 @@ _write_header(const char     *sec_name,
   return embed;
 }
 
+/*----------------------------------------------------------------------------
+ * Write a compressed section, each associated process providing a
+ * contiguous part of the section's body.
+ *
+ * Each process compresses its own part, which forms a chunk of the
+ * section body; the value start and compressed size of each chunk are
+ * stored in the section header.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_vals         <-- number of global values
+ *   val_start        <-- id of first local value (0 to n-1 numbering)
+ *   val_end          <-- id of past-the end local value
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   elts             <-- pointer to element data
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_compressed(const char     *sec_name,
+                  cs_gnum_t       n_g_vals,
+                  cs_file_off_t   val_start,
+                  cs_file_off_t   val_end,
+                  size_t          location_id,
+                  size_t          index_id,
+                  size_t          n_location_vals,
+                  cs_datatype_t   elt_type,
+                  const void     *elts,
+                  cs_io_t        *outp)
+{
+#if defined(HAVE_ZLIB)
+
+  double t_start = 0.;
+  size_t n_written = 0;
+  size_t z_size = 0;
+  unsigned char *z_buf = NULL;
+  cs_io_log_t  *log = NULL;
+
+  int rank_id = 0, n_ranks = 1;
+
+  const size_t type_size = cs_datatype_size[elt_type];
+  const bool swap = (cs_file_get_swap_endian(outp->f) == 1) ? true : false;
+
+#if defined(HAVE_MPI)
+  if (outp->comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(outp->comm, &rank_id);
+    MPI_Comm_size(outp->comm, &n_ranks);
+  }
+#endif
+
+  if (outp->log_id > -1) {
+    log = _cs_io_log[outp->mode] + outp->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  if (val_end > val_start)
+    z_buf = _z_compress(elts,
+                        type_size,
+                        val_end - val_start,
+                        swap,
+                        outp->z_level,
+                        &z_size);
+
+  /* Gather chunk descriptions */
+
+  cs_file_off_t l_chunk[2] = {val_start, z_size};
+  cs_file_off_t *chunks = NULL;
+
+  BFT_MALLOC(chunks, n_ranks*2, cs_file_off_t);
+
+#if defined(HAVE_MPI)
+  if (n_ranks > 1)
+    MPI_Allgather(l_chunk, 2, CS_IO_MPI_OFFSET,
+                  chunks, 2, CS_IO_MPI_OFFSET, outp->comm);
+#endif
+  if (n_ranks == 1) {
+    chunks[0] = l_chunk[0];
+    chunks[1] = l_chunk[1];
+  }
+
+  /* Keep only non-empty chunks, and compute local byte offset */
+
+  size_t n_chunks = 0;
+  cs_file_off_t b_start = 0, b_end = 0;
+
+  for (int i = 0; i < n_ranks; i++) {
+    if (i == rank_id)
+      b_start = b_end;
+    if (chunks[i*2 + 1] > 0) {
+      chunks[n_chunks*2] = chunks[i*2];
+      chunks[n_chunks*2 + 1] = chunks[i*2 + 1];
+      b_end += chunks[i*2 + 1];
+      n_chunks++;
+    }
+  }
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[1] += t_end - t_start;
+  }
+
+  _write_header(sec_name,
+                n_g_vals,
+                location_id,
+                index_id,
+                n_location_vals,
+                elt_type,
+                NULL,
+                n_chunks,
+                chunks,
+                outp);
+
+  BFT_FREE(chunks);
+
+  if (log != NULL)
+    t_start = cs_timer_wtime();
+
+  _write_padding(outp->body_align, outp);
+
+  n_written = cs_file_write_block_buffer(outp->f,
+                                         z_buf,
+                                         1,
+                                         1,
+                                         b_start + 1,
+                                         b_start + z_size + 1);
+
+  if (z_size != n_written)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing %llu bytes to file \"%s\"."),
+              (unsigned long long)z_size, cs_file_get_name(outp->f));
+
+  BFT_FREE(z_buf);
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[1] += t_end - t_start;
+    log->data_size[1] += n_written;
+  }
+
+#else
+
+  CS_UNUSED(sec_name);
+  CS_UNUSED(n_g_vals);
+  CS_UNUSED(val_start);
+  CS_UNUSED(val_end);
+  CS_UNUSED(location_id);
+  CS_UNUSED(index_id);
+  CS_UNUSED(n_location_vals);
+  CS_UNUSED(elt_type);
+  CS_UNUSED(elts);
+  CS_UNUSED(outp);
+
+  assert(0); /* compression level always 0 without Zlib */
+
+#endif /* defined(HAVE_ZLIB) */
+}
+
 /*----------------------------------------------------------------------------
  * Dump a kernel IO file handle's metadata.
  *
@@ -1773,7 +2586,7 @@ _dump_index(const cs_io_sec_index_t  *idx)
     const char *name = idx->names + h_vals[4];
 
     if (h_vals[5] > 0)
-      embed = 'y';
+      embed = (idx->offset[ii] < 0) ? 'y' : 'z';
 
     bft_printf(_(" %40s %10llu %2u %2u %2u %6s %c %2u %ld\n"),
                name, (unsigned long long)(h_vals[0]),
@@ -1978,6 +2791,8 @@ cs_io_finalize(cs_io_t **cs_io)
   _cs_io->buffer_size = 0;
   BFT_FREE(_cs_io->buffer);
 
+  BFT_FREE(_cs_io->z_chunks);
+
   BFT_FREE(*cs_io);
 }
 
@@ -2204,6 +3019,33 @@ cs_io_read_header(cs_io_t             *inp,
   if (header_vals[1] > 0 && inp->type_name[7] == 'e')
     inp->data = inp->buffer + 56 + header_vals[5];
 
+  /* Compressed chunks description if present */
+
+  inp->z_n_chunks = 0;
+
+  if (header_vals[1] > 0 && inp->type_name[7] == 'z') {
+
+    cs_file_off_t n_chunks = 0;
+    unsigned char *z_data = inp->buffer + 56 + header_vals[5];
+
+    if (cs_file_get_swap_endian(inp->f) == 1)
+      _swap_endian(z_data, 8, 1);
+
+    _convert_to_offset(z_data, &n_chunks, 1);
+
+    if (cs_file_get_swap_endian(inp->f) == 1)
+      _swap_endian(z_data + 8, 8, n_chunks*2);
+
+    if ((size_t)(n_chunks*2) > inp->z_chunks_size) {
+      inp->z_chunks_size = n_chunks*2;
+      BFT_REALLOC(inp->z_chunks, inp->z_chunks_size, cs_file_off_t);
+    }
+
+    _convert_to_offset(z_data + 8, inp->z_chunks, n_chunks*2);
+
+    inp->z_n_chunks = n_chunks;
+  }
+
   inp->type_size = 0;
 
   /* Return immediately if we have an end-of file marker */
@@ -2367,6 +3209,8 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   inp->sec_name = (char *)(inp->buffer + 56);
   inp->type_name = NULL; /* should not be needed now that datatype is known */
 
+  inp->z_n_chunks = 0;
+
   /* Non-embedded values */
 
   if (inp->index->h_vals[7*id + 5] == 0) {
@@ -2374,6 +3218,19 @@ cs_io_set_indexed_position(cs_io_t             *inp,
     retval = cs_file_seek(inp->f, offset, CS_FILE_SEEK_SET);
   }
 
+  /* Compressed values */
+
+  else if (inp->index->offset[id] >= 0) {
+    cs_file_off_t n_chunks = 0;
+    size_t data_id = inp->index->h_vals[7*id + 5] - 1;
+    unsigned char *_data = inp->index->data + data_id;
+    memcpy(&n_chunks, _data, sizeof(cs_file_off_t));
+    _z_set_chunks(inp,
+                  n_chunks,
+                  (const cs_file_off_t *)(_data + sizeof(cs_file_off_t)));
+    retval = cs_file_seek(inp->f, inp->index->offset[id], CS_FILE_SEEK_SET);
+  }
+
   /* Embedded values */
 
   else {
@@ -2796,6 +3653,36 @@ cs_io_write_global(const char     *sec_name,
   if (outp->echo >= CS_IO_ECHO_HEADERS)
     _echo_header(sec_name, n_vals, elt_type);
 
+  /* Compress data associated with a mesh location if required
+     (data is then considered as a single block on the root rank) */
+
+  if (   outp->z_level > 0 && location_id > 0
+      && n_vals*cs_datatype_size[elt_type] >= CS_IO_Z_MIN_SIZE) {
+
+    int rank_id = 0;
+
+#if defined(HAVE_MPI)
+    if (outp->comm != MPI_COMM_NULL)
+      MPI_Comm_rank(outp->comm, &rank_id);
+#endif
+
+    _write_compressed(sec_name,
+                      n_vals,
+                      (rank_id == 0) ? 0 : n_vals,
+                      n_vals,
+                      location_id,
+                      index_id,
+                      n_location_vals,
+                      elt_type,
+                      elts,
+                      outp);
+
+    if (outp->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(outp->echo, n_vals, 1, n_vals + 1, elt_type, elts);
+
+    return;
+  }
+
   embed = _write_header(sec_name,
                         n_vals,
                         location_id,
@@ -2803,6 +3690,8 @@ cs_io_write_global(const char     *sec_name,
                         n_location_vals,
                         elt_type,
                         elts,
+                        0,
+                        NULL,
                         outp);
 
   if (n_vals > 0 && embed == false) {
@@ -2897,6 +3786,29 @@ cs_io_write_block(const char     *sec_name,
     n_vals *= n_location_vals;
   }
 
+  if (   outp->z_level > 0
+      && n_g_vals*cs_datatype_size[elt_type] >= CS_IO_Z_MIN_SIZE) {
+
+    _write_compressed(sec_name,
+                      n_g_vals,
+                      (global_num_start - 1)*stride,
+                      (global_num_end - 1)*stride,
+                      location_id,
+                      index_id,
+                      n_location_vals,
+                      elt_type,
+                      elts,
+                      outp);
+
+    if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(outp->echo, n_g_vals,
+                 (global_num_start-1)*stride + 1,
+                 (global_num_end -1)*stride + 1,
+                 elt_type, elts);
+
+    return;
+  }
+
   _write_header(sec_name,
                 n_g_vals,
                 location_id,
@@ -2904,6 +3816,8 @@ cs_io_write_block(const char     *sec_name,
                 n_location_vals,
                 elt_type,
                 NULL,
+                0,
+                NULL,
                 outp);
 
   if (outp->log_id > -1) {
@@ -2998,6 +3912,29 @@ cs_io_write_block_buffer(const char     *sec_name,
     n_vals *= n_location_vals;
   }
 
+  if (   outp->z_level > 0
+      && n_g_vals*cs_datatype_size[elt_type] >= CS_IO_Z_MIN_SIZE) {
+
+    _write_compressed(sec_name,
+                      n_g_vals,
+                      (global_num_start - 1)*stride,
+                      (global_num_end - 1)*stride,
+                      location_id,
+                      index_id,
+                      n_location_vals,
+                      elt_type,
+                      elts,
+                      outp);
+
+    if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(outp->echo, n_g_vals,
+                 (global_num_start-1)*stride + 1,
+                 (global_num_end -1)*stride + 1,
+                 elt_type, elts);
+
+    return;
+  }
+
   _write_header(sec_name,
                 n_g_vals,
                 location_id,
@@ -3005,6 +3942,8 @@ cs_io_write_block_buffer(const char     *sec_name,
                 n_location_vals,
                 elt_type,
                 NULL,
+                0,
+                NULL,
                 outp);
 
   if (outp->log_id > -1) {
@@ -3078,7 +4017,10 @@ cs_io_skip(const cs_io_sec_header_t  *header,
       cs_file_off_t offset = cs_file_tell(pp_io->f);
       size_t ba = pp_io->body_align;
       offset += (ba - (offset % ba)) % ba;
-      offset += n_vals*type_size;
+      if (pp_io->z_n_chunks > 0)
+        offset += _body_size(pp_io);
+      else
+        offset += n_vals*type_size;
       cs_file_seek(pp_io->f, offset, CS_FILE_SEEK_SET);
     }
 
@@ -3130,6 +4072,52 @@ cs_io_set_offset(cs_io_t         *inp,
                 CS_FILE_SEEK_SET);
 }
 
+/*----------------------------------------------------------------------------
+ * Set the compression level for sections written to a kernel IO file.
+ *
+ * When compression is active, the body of each section associated with a
+ * mesh location (or written by blocks) is byte-shuffled and compressed
+ * separately on each writing rank, using Zlib's deflate method. The value
+ * start and compressed size of each resulting chunk are stored in the
+ * section header, so sections may still be read by blocks in parallel,
+ * independently of the distribution used for writing. Small sections are
+ * never compressed.
+ *
+ * If Zlib support is not available, compression is ignored.
+ *
+ * parameters:
+ *   outp  <-> output kernel IO structure
+ *   level <-- compression level (0: none, 1: fastest, 9: best)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_compression(cs_io_t  *outp,
+                      int       level)
+{
+  assert(outp != NULL);
+
+  if (outp->mode != CS_IO_MODE_WRITE)
+    return;
+
+#if defined(HAVE_ZLIB)
+
+  outp->z_level = CS_MIN(CS_MAX(level, 0), 9);
+
+#else
+
+  outp->z_level = 0;
+
+  if (level > 0) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Compression requested for file \"%s\",\n"
+                 "but Zlib support is not available in this build;\n"
+                 "data will be written uncompressed.\n"),
+               cs_file_get_name(outp->f));
+  }
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Initialize performance logging for cs_io_t structures.
  *----------------------------------------------------------------------------*/
@@ -600,6 +600,28 @@ void
 cs_io_set_offset(cs_io_t        *inp,
                  cs_file_off_t   offset);
 
+/*----------------------------------------------------------------------------
+ * Set the compression level for sections written to a kernel IO file.
+ *
+ * When compression is active, the body of each section associated with a
+ * mesh location (or written by blocks) is byte-shuffled and compressed
+ * separately on each writing rank, using Zlib's deflate method. The value
+ * start and compressed size of each resulting chunk are stored in the
+ * section header, so sections may still be read by blocks in parallel,
+ * independently of the distribution used for writing. Small sections are
+ * never compressed.
+ *
+ * If Zlib support is not available, compression is ignored.
+ *
+ * parameters:
+ *   outp  <-> output kernel IO structure
+ *   level <-- compression level (0: none, 1: fastest, 9: best)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_compression(cs_io_t  *outp,
+                      int       level);
+
 /*----------------------------------------------------------------------------
  * Initialize performance logging for cs_io_t structures.
  *----------------------------------------------------------------------------*/
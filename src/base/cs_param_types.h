@@ -616,6 +616,10 @@ typedef enum {
  * \var CS_PARAM_ITSOL_MUMPS_LDLT
  * MUMPS direct solver (LDLT factorization also known as Cholesky factorization)
  *
+ * \var CS_PARAM_ITSOL_SPARSE_LDLT
+ * Built-in sparse direct solver (LDLT factorization after a nested dissection
+ * ordering). Useful for small to medium size symmetric systems.
+ *
  * \var CS_PARAM_ITSOL_SYM_GAUSS_SEIDEL
  * Symmetric Gauss-Seidel
  *
@@ -640,6 +644,7 @@ typedef enum {
   CS_PARAM_ITSOL_MINRES,           /*!< Only with PETsc */
   CS_PARAM_ITSOL_MUMPS,            /*!< Only with PETsc */
   CS_PARAM_ITSOL_MUMPS_LDLT,       /*!< Only with PETsc */
+  CS_PARAM_ITSOL_SPARSE_LDLT,      /*!< Only with Code_Saturne */
   CS_PARAM_ITSOL_SYM_GAUSS_SEIDEL,
 
   CS_PARAM_N_ITSOL_TYPES
@@ -393,7 +393,8 @@ static cs_equation_param_t _equation_param_default
                   .n_max_iter = 0,
                   .eps = 0},
 
-   .omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_CRITICAL
+   .omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_CRITICAL,
+   .matrix_free = false
   };
 
 /* Space discretisation options structure and associated pointer */
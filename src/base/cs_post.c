@@ -31,6 +31,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <math.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -57,6 +58,7 @@
 #include "cs_mesh.h"
 #include "cs_mesh_connect.h"
 #include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_prototypes.h"
 #include "cs_selector.h"
@@ -317,6 +319,17 @@ typedef struct {
   cs_lnum_t               n_i_faces;     /* N. associated interior faces */
   cs_lnum_t               n_b_faces;     /* N. associated boundary faces */
 
+  int                     coarsening;    /* Target number of cells per
+                                            coarse cell for a coarsened
+                                            volume mesh, or 0 */
+  cs_lnum_t               n_f_cells;     /* N. associated (fine) cells of
+                                            coarsened volume mesh */
+  cs_lnum_t               n_c_cells;     /* N. local coarse cells */
+  cs_lnum_t              *f_cell_ids;    /* Associated (fine) cell ids */
+  cs_lnum_t              *c_cell_id;    /* Coarse cell id of each main mesh
+                                            cell (-1 if not associated) */
+  cs_real_t              *c_cell_vol;    /* Coarse cell volumes */
+
   double                  density;       /* Particles density in case
                                             of particle mesh */
 
@@ -1113,6 +1126,308 @@ _update_mesh_writer_associations(cs_post_mesh_t  *post_mesh)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Free coarse cell info associated with a coarsened post-processing mesh.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to post-processing mesh
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_coarse_cells(cs_post_mesh_t  *post_mesh)
+{
+  post_mesh->n_f_cells = 0;
+  post_mesh->n_c_cells = 0;
+
+  BFT_FREE(post_mesh->f_cell_ids);
+  BFT_FREE(post_mesh->c_cell_id);
+  BFT_FREE(post_mesh->c_cell_vol);
+}
+
+/*----------------------------------------------------------------------------
+ * Find root of a cell in a union-find forest, with path halving.
+ *
+ * parameters:
+ *   root <-> parent of each element
+ *   i    <-- element id
+ *
+ * returns:
+ *   root element id
+ *----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_coarse_root(cs_lnum_t  root[],
+             cs_lnum_t  i)
+{
+  while (root[i] != i) {
+    root[i] = root[root[i]];
+    i = root[i];
+  }
+  return i;
+}
+
+/*----------------------------------------------------------------------------
+ * Agglomerate selected cells into local coarse cells.
+ *
+ * Cells are binned on a regular lattice whose step is based on the mean
+ * selected cell volume and on the target coarsening, and connected cells
+ * of a same bin (on the local rank) form a coarse cell.
+ *
+ * parameters:
+ *   coarsening <-- target number of cells per coarse cell
+ *   n_cells    <-- number of selected cells
+ *   cell_list  <-- list of selected cells (1 to n), or NULL for all
+ *   c_cell_id  --> coarse cell id of each cell, or -1 (size: n_cells)
+ *
+ * returns:
+ *   number of local coarse cells
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_coarsen_cells(int              coarsening,
+               cs_lnum_t        n_cells,
+               const cs_lnum_t  cell_list[],
+               cs_lnum_t        c_cell_id[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_m_cells = m->n_cells;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+  const cs_real_t *cell_vol = cs_glob_mesh_quantities->cell_vol;
+
+  /* Mark selected cells */
+
+  for (cs_lnum_t i = 0; i < n_m_cells; i++)
+    c_cell_id[i] = (cell_list == NULL) ? 0 : -1;
+
+  if (cell_list != NULL) {
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      c_cell_id[cell_list[i] - 1] = 0;
+  }
+
+  /* Lattice step and extents */
+
+  double sum[2] = {0., 0.};
+  cs_real_t extents[6] = {HUGE_VAL, HUGE_VAL, HUGE_VAL,
+                          -HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+  for (cs_lnum_t i = 0; i < n_m_cells; i++) {
+    if (c_cell_id[i] < 0)
+      continue;
+    sum[0] += cell_vol[i];
+    sum[1] += 1.;
+    for (int k = 0; k < 3; k++) {
+      extents[k] = CS_MIN(extents[k], cell_cen[i][k]);
+      extents[k+3] = CS_MAX(extents[k+3], cell_cen[i][k]);
+    }
+  }
+
+  cs_parall_sum(2, CS_DOUBLE, sum);
+  cs_parall_min(3, CS_REAL_TYPE, extents);
+  cs_parall_max(3, CS_REAL_TYPE, extents + 3);
+
+  if (sum[1] < 1.)
+    return 0;
+
+  const double h = cbrt(coarsening * sum[0] / sum[1]);
+
+  cs_gnum_t n_l[3];
+  for (int k = 0; k < 3; k++)
+    n_l[k] = (cs_gnum_t)((extents[k+3] - extents[k]) / h) + 1;
+
+  /* Bin of each selected cell */
+
+  cs_gnum_t *bin = NULL;
+  cs_lnum_t *root = NULL;
+
+  BFT_MALLOC(bin, n_m_cells, cs_gnum_t);
+  BFT_MALLOC(root, n_m_cells, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_m_cells; i++) {
+    root[i] = i;
+    if (c_cell_id[i] < 0)
+      continue;
+    cs_gnum_t b[3];
+    for (int k = 0; k < 3; k++) {
+      b[k] = (cs_gnum_t)((cell_cen[i][k] - extents[k]) / h);
+      if (b[k] >= n_l[k])
+        b[k] = n_l[k] - 1;
+    }
+    bin[i] = b[0] + n_l[0]*(b[1] + n_l[1]*b[2]);
+  }
+
+  /* Merge face-adjacent cells of a same bin; the root of each
+     coarse cell is its lowest cell id */
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    cs_lnum_t c_id0 = m->i_face_cells[f_id][0];
+    cs_lnum_t c_id1 = m->i_face_cells[f_id][1];
+    if (c_id0 >= n_m_cells || c_id1 >= n_m_cells)
+      continue;
+    if (c_cell_id[c_id0] < 0 || c_cell_id[c_id1] < 0)
+      continue;
+    if (bin[c_id0] != bin[c_id1])
+      continue;
+    cs_lnum_t r0 = _coarse_root(root, c_id0);
+    cs_lnum_t r1 = _coarse_root(root, c_id1);
+    if (r0 < r1)
+      root[r1] = r0;
+    else if (r1 < r0)
+      root[r0] = r1;
+  }
+
+  /* Number coarse cells */
+
+  cs_lnum_t n_c_cells = 0;
+
+  for (cs_lnum_t i = 0; i < n_m_cells; i++) {
+    if (c_cell_id[i] < 0)
+      continue;
+    cs_lnum_t r = _coarse_root(root, i);
+    if (r == i)
+      c_cell_id[i] = n_c_cells++;
+    else
+      c_cell_id[i] = c_cell_id[r];
+  }
+
+  BFT_FREE(root);
+  BFT_FREE(bin);
+
+  return n_c_cells;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a coarsened volume post-processing mesh.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to partially initialized post-processing mesh
+ *   n_cells   <-- number of associated cells
+ *   cell_list <-- list of associated cells (1 to n), or NULL for all
+ *
+ * returns:
+ *   pointer to exportable mesh
+ *----------------------------------------------------------------------------*/
+
+static fvm_nodal_t *
+_define_coarse_export_mesh(cs_post_mesh_t   *post_mesh,
+                           cs_lnum_t         n_cells,
+                           const cs_lnum_t   cell_list[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_real_t *cell_vol = cs_glob_mesh_quantities->cell_vol;
+
+  _free_coarse_cells(post_mesh);
+
+  if (n_cells >= m->n_cells)
+    cell_list = NULL;
+
+  BFT_MALLOC(post_mesh->c_cell_id, m->n_cells, cs_lnum_t);
+
+  post_mesh->n_c_cells = _coarsen_cells(post_mesh->coarsening,
+                                        n_cells,
+                                        cell_list,
+                                        post_mesh->c_cell_id);
+
+  /* Associated (fine) cells and coarse volumes */
+
+  BFT_MALLOC(post_mesh->f_cell_ids, m->n_cells, cs_lnum_t);
+  BFT_MALLOC(post_mesh->c_cell_vol, post_mesh->n_c_cells, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < post_mesh->n_c_cells; i++)
+    post_mesh->c_cell_vol[i] = 0.;
+
+  cs_lnum_t n_f_cells = 0;
+  for (cs_lnum_t i = 0; i < m->n_cells; i++) {
+    cs_lnum_t c_id = post_mesh->c_cell_id[i];
+    if (c_id > -1) {
+      post_mesh->f_cell_ids[n_f_cells++] = i;
+      post_mesh->c_cell_vol[c_id] += cell_vol[i];
+    }
+  }
+
+  post_mesh->n_f_cells = n_f_cells;
+  BFT_REALLOC(post_mesh->f_cell_ids, n_f_cells, cs_lnum_t);
+
+  return cs_mesh_connect_coarse_cells_to_nodal(m,
+                                               post_mesh->name,
+                                               post_mesh->n_c_cells,
+                                               post_mesh->c_cell_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute volume-weighted averages of cell values on the coarse cells of
+ * a coarsened post-processing mesh.
+ *
+ * parameters:
+ *   post_mesh  <-- pointer to coarsened post-processing mesh
+ *   var_dim    <-- variable dimension
+ *   interlace  <-- true if values are interlaced
+ *   use_parent <-- true if values are defined on the main mesh cells,
+ *                  false if defined on the associated (fine) cells
+ *   datatype   <-- values data type
+ *   cel_vals   <-- cell values
+ *
+ * returns:
+ *   newly allocated array of interlaced coarse cell values
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_coarse_cell_values(const cs_post_mesh_t  *post_mesh,
+                    int                    var_dim,
+                    bool                   interlace,
+                    bool                   use_parent,
+                    cs_datatype_t          datatype,
+                    const void            *cel_vals)
+{
+  const cs_lnum_t n_c_cells = post_mesh->n_c_cells;
+  const cs_lnum_t n_f_cells = post_mesh->n_f_cells;
+  const cs_real_t *cell_vol = cs_glob_mesh_quantities->cell_vol;
+
+  const size_t n_vals = (use_parent) ?
+    (size_t)(cs_glob_mesh->n_cells_with_ghosts) : (size_t)n_f_cells;
+  const size_t e_stride = (interlace) ? (size_t)var_dim : 1;
+  const size_t c_stride = (interlace) ? 1 : n_vals;
+
+  cs_real_t *c_vals = NULL;
+  BFT_MALLOC(c_vals, n_c_cells*var_dim, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_c_cells*var_dim; i++)
+    c_vals[i] = 0.;
+
+  for (cs_lnum_t j = 0; j < n_f_cells; j++) {
+
+    const cs_lnum_t f_id = post_mesh->f_cell_ids[j];
+    const cs_lnum_t c_id = post_mesh->c_cell_id[f_id];
+    const size_t e_id = (use_parent) ? (size_t)f_id : (size_t)j;
+    const cs_real_t w = cell_vol[f_id] / post_mesh->c_cell_vol[c_id];
+
+    for (int k = 0; k < var_dim; k++) {
+      const size_t v_id = e_id*e_stride + k*c_stride;
+      double v = 0.;
+      switch (datatype) {
+      case CS_FLOAT:
+        v = ((const float *)cel_vals)[v_id];
+        break;
+      case CS_DOUBLE:
+        v = ((const double *)cel_vals)[v_id];
+        break;
+      case CS_INT32:
+        v = ((const int32_t *)cel_vals)[v_id];
+        break;
+      case CS_INT64:
+        v = ((const int64_t *)cel_vals)[v_id];
+        break;
+      default:
+        assert(0);
+      }
+      c_vals[c_id*var_dim + k] += w*v;
+    }
+
+  }
+
+  return c_vals;
+}
+
 /*----------------------------------------------------------------------------
  * Add or select a post-processing mesh, do basic initialization, and return
  * a pointer to the associated structure.
@@ -1164,6 +1479,8 @@ _predefine_mesh(int        mesh_id,
       if (post_mesh->_exp_mesh != NULL)
         post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
 
+      _free_coarse_cells(post_mesh);
+
       break;
 
     }
@@ -1219,6 +1536,13 @@ _predefine_mesh(int        mesh_id,
   post_mesh->n_i_faces = 0;
   post_mesh->n_b_faces = 0;
 
+  post_mesh->coarsening = 0;
+  post_mesh->n_f_cells = 0;
+  post_mesh->n_c_cells = 0;
+  post_mesh->f_cell_ids = NULL;
+  post_mesh->c_cell_id = NULL;
+  post_mesh->c_cell_vol = NULL;
+
   post_mesh->density = 1.;
 
   post_mesh->exp_mesh = NULL;
@@ -1274,6 +1598,8 @@ _free_mesh(int _mesh_id)
   if (post_mesh->_exp_mesh != NULL)
     post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
 
+  _free_coarse_cells(post_mesh);
+
   BFT_FREE(post_mesh->writer_id);
   post_mesh->n_writers = 0;
 
@@ -1369,7 +1695,10 @@ _define_export_mesh(cs_post_mesh_t  *post_mesh,
 
   if (post_mesh->ent_flag[0] == 1) {
 
-    if (n_cells >= cs_glob_mesh->n_cells)
+    if (post_mesh->coarsening > 1)
+      exp_mesh = _define_coarse_export_mesh(post_mesh, n_cells, cell_list);
+
+    else if (n_cells >= cs_glob_mesh->n_cells)
       exp_mesh = cs_mesh_connect_cells_to_nodal(cs_glob_mesh,
                                                 post_mesh->name,
                                                 post_mesh->add_groups,
@@ -3751,6 +4080,10 @@ _check_non_transient(const cs_post_writer_t  *writer,
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b async to use non-blocking writes (for binary \c \b EnSight with
+ *         MPI-IO), so that ranks return as soon as their data is handed
+ *         to the I/O ranks (defined by the file block rank step); pending
+ *         writes are completed at the writer's next output.
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -4678,7 +5011,9 @@ cs_post_mesh_get_n_cells(int  mesh_id)
 
   const cs_post_mesh_t  *mesh = _cs_post_meshes + _cs_post_mesh_id(mesh_id);
 
-  if (mesh->exp_mesh != NULL)
+  if (mesh->exp_mesh != NULL && mesh->coarsening > 1)
+    retval = mesh->n_f_cells;
+  else if (mesh->exp_mesh != NULL)
     retval = fvm_nodal_get_n_entities(mesh->exp_mesh, 3);
   else
     bft_error(__FILE__, __LINE__, 0,
@@ -4707,7 +5042,11 @@ cs_post_mesh_get_cell_ids(int         mesh_id,
 {
   const cs_post_mesh_t  *mesh = _cs_post_meshes + _cs_post_mesh_id(mesh_id);
 
-  if (mesh->exp_mesh != NULL) {
+  if (mesh->exp_mesh != NULL && mesh->coarsening > 1) {
+    for (cs_lnum_t i = 0; i < mesh->n_f_cells; i++)
+      cell_ids[i] = mesh->f_cell_ids[i];
+  }
+  else if (mesh->exp_mesh != NULL) {
     cs_lnum_t i;
     cs_lnum_t n_cells = fvm_nodal_get_n_entities(mesh->exp_mesh, 3);
     fvm_nodal_get_parent_num(mesh->exp_mesh, 3, cell_ids);
@@ -4943,6 +5282,45 @@ cs_post_mesh_set_post_domain(int   mesh_id,
   mesh->post_domain = post_domain;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the coarsening of a volume postprocessing mesh.
+ *
+ * When the coarsening is greater than 1, the mesh's cells are agglomerated
+ * (locally on each rank) into coarse cells of approximately the given
+ * number of cells: connected cells of a same bin of a regular lattice,
+ * whose step is based on the mean cell volume, form a coarse cell.
+ * Cell values are then output as volume-weighted averages on the coarse
+ * cells, reducing the volume of output data.
+ *
+ * Values given to \ref cs_post_write_var for such meshes are still defined
+ * on the main mesh cells (or on the cells returned by
+ * \ref cs_post_mesh_get_cell_ids if not using the parent numbering).
+ *
+ * This function must be called before postprocessing meshes are built
+ * (i.e. in \ref cs_user_postprocess_meshes), and is ignored for meshes
+ * not containing cells.
+ *
+ * \param[in]  mesh_id     postprocessing mesh id
+ * \param[in]  coarsening  target number of cells per coarse cell
+ *                         (0 or 1 for no coarsening)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_mesh_set_coarsening(int  mesh_id,
+                            int  coarsening)
+{
+  cs_post_mesh_t  *mesh = _cs_post_meshes + _cs_post_mesh_id(mesh_id);
+
+  if (mesh->exp_mesh != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s called after post-processing meshes are built."),
+              __func__);
+
+  mesh->coarsening = CS_MAX(coarsening, 0);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Remove a post-processing mesh.
@@ -5540,7 +5918,29 @@ cs_post_write_var(int                    mesh_id,
   /* Case of cells */
   /*---------------*/
 
-  if (post_mesh->ent_flag[CS_POST_LOCATION_CELL] == 1) {
+  if (   post_mesh->ent_flag[CS_POST_LOCATION_CELL] == 1
+      && post_mesh->coarsening > 1) {
+
+    /* Coarsened mesh: average values (exported mesh's parent numbering
+       is relative to coarse cells) */
+
+    var_tmp = _coarse_cell_values(post_mesh,
+                                  var_dim,
+                                  interlace,
+                                  use_parent,
+                                  datatype,
+                                  cel_vals);
+
+    n_parent_lists = 1;
+    parent_num_shift[0] = 0;
+
+    _interlace = CS_INTERLACE;
+    datatype = _cs_post_cnv_datatype(CS_POST_TYPE_cs_real_t);
+
+    var_ptr[0] = var_tmp;
+  }
+
+  else if (post_mesh->ent_flag[CS_POST_LOCATION_CELL] == 1) {
 
     if (use_parent) {
       n_parent_lists = 1;
@@ -6709,6 +7109,11 @@ cs_post_time_step_output(const cs_time_step_t  *ts)
       int  dim_ent = fvm_nodal_get_max_entity_dim(exp_mesh);
       cs_lnum_t  n_elts = fvm_nodal_get_n_entities(exp_mesh, dim_ent);
 
+      /* Values on coarsened meshes are based on the associated cells */
+
+      if (post_mesh->coarsening > 1 && dim_ent == 3)
+        n_elts = post_mesh->n_f_cells;
+
       if (n_elts > n_elts_max) {
         n_elts_max = n_elts;
         BFT_REALLOC(parent_ids, n_elts_max, cs_lnum_t);
@@ -6716,10 +7121,15 @@ cs_post_time_step_output(const cs_time_step_t  *ts)
 
       /* Get corresponding element ids */
 
-      fvm_nodal_get_parent_num(exp_mesh, dim_ent, parent_ids);
-
-      for (cs_lnum_t k = 0; k < n_elts; k++)
-        parent_ids[k] -= 1;
+      if (post_mesh->coarsening > 1 && dim_ent == 3) {
+        for (cs_lnum_t k = 0; k < n_elts; k++)
+          parent_ids[k] = post_mesh->f_cell_ids[k];
+      }
+      else {
+        fvm_nodal_get_parent_num(exp_mesh, dim_ent, parent_ids);
+        for (cs_lnum_t k = 0; k < n_elts; k++)
+          parent_ids[k] -= 1;
+      }
 
       /* We can output variables for this time step */
       /*--------------------------------------------*/
@@ -7033,6 +7443,7 @@ cs_post_finalize(void)
     post_mesh = _cs_post_meshes + i;
     if (post_mesh->_exp_mesh != NULL)
       fvm_nodal_destroy(post_mesh->_exp_mesh);
+    _free_coarse_cells(post_mesh);
     BFT_FREE(post_mesh->name);
     for (j = 0; j < 4; j++)
       BFT_FREE(post_mesh->criteria[j]);
@@ -262,6 +262,10 @@ typedef void
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b async to use non-blocking writes (for binary \c \b EnSight with
+ *         MPI-IO), so that ranks return as soon as their data is handed
+ *         to the I/O ranks (defined by the file block rank step); pending
+ *         writes are completed at the writer's next output.
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -801,6 +805,28 @@ void
 cs_post_mesh_set_post_domain(int   mesh_id,
                              bool  post_domain);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the coarsening of a volume postprocessing mesh.
+ *
+ * When the coarsening is greater than 1, the mesh's cells are agglomerated
+ * (locally on each rank) into coarse cells of approximately the given
+ * number of cells, and cell values are output as volume-weighted averages
+ * on those coarse cells.
+ *
+ * This function must be called before postprocessing meshes are built
+ * (i.e. in \ref cs_user_postprocess_meshes).
+ *
+ * \param[in]  mesh_id     postprocessing mesh id
+ * \param[in]  coarsening  target number of cells per coarse cell
+ *                         (0 or 1 for no coarsening)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_mesh_set_coarsening(int  mesh_id,
+                            int  coarsening);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Remove a post-processing mesh.
@@ -60,6 +60,11 @@ BEGIN_C_DECLS
   Based on the uniform, gaussian, and poisson random number generation code
   from netlib.org: lagged (-273,-607) Fibonacci; Box-Muller;
   by W.P. Petersen, IPS, ETH Zuerich.
+
+  Counter-based streams use the Philox4x32-10 generator from
+  J.K. Salmon, M.A. Moraes, R.O. Dror and D.E. Shaw, "Parallel random
+  numbers: as easy as 1, 2, 3", SC'11. They have no shared state, and may
+  be used from any thread.
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -68,6 +73,13 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Philox4x32 multipliers and Weyl sequence key increments */
+
+#define _PHILOX_M0 0xD2511F53U
+#define _PHILOX_M1 0xCD9E8D57U
+#define _PHILOX_W0 0x9E3779B9U
+#define _PHILOX_W1 0xBB67AE85U
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -90,6 +102,8 @@ static struct {
   double   e_3;
 } klotz1_1 = {{0}, 0, 0, 0.};
 
+static uint32_t _stream_seed = 0x2545F491U;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -171,6 +185,90 @@ _normal00(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Philox4x32-10 block function.
+ *
+ * \param[in]   ctr  counter
+ * \param[in]   key  key
+ * \param[out]  r    4 random 32-bit words
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_philox4x32_10(const uint32_t  ctr[4],
+               const uint32_t  key[2],
+               uint32_t        r[4])
+{
+  uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for (int i = 0; i < 10; i++) {
+    uint64_t p0 = (uint64_t)_PHILOX_M0 * c0;
+    uint64_t p1 = (uint64_t)_PHILOX_M1 * c2;
+    uint32_t hi0 = (uint32_t)(p0 >> 32), lo0 = (uint32_t)p0;
+    uint32_t hi1 = (uint32_t)(p1 >> 32), lo1 = (uint32_t)p1;
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+    k0 += _PHILOX_W0;
+    k1 += _PHILOX_W1;
+  }
+
+  r[0] = c0; r[1] = c1; r[2] = c2; r[3] = c3;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Draw 2 uniform values in ]0, 1[ from a stream and advance it.
+ *
+ * \param[in, out]  s  pointer to stream
+ * \param[out]      u  uniform values
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_stream_uniform_2(cs_random_stream_t  *s,
+                  double               u[2])
+{
+  const double eps = 1.1102230246251565e-16; /* 2^-53 */
+
+  uint32_t r[4];
+  _philox4x32_10(s->ctr, s->key, r);
+  s->ctr[0] += 1;
+
+  /* 53-bit mantissas, shifted by half a unit so that 0 is never reached */
+
+  uint64_t i0 = ((uint64_t)(r[0] >> 5) << 26) | (r[1] >> 6);
+  uint64_t i1 = ((uint64_t)(r[2] >> 5) << 26) | (r[3] >> 6);
+  u[0] = ((double)i0 + 0.5) * eps;
+  u[1] = ((double)i1 + 0.5) * eps;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Draw 2 normal values from a stream and advance it.
+ *
+ * \param[in, out]  s  pointer to stream
+ * \param[out]      x  normal values
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_stream_normal_2(cs_random_stream_t  *s,
+                 double               x[2])
+{
+  const double twopi = 6.2831853071795862;
+
+  double u[2];
+  _stream_uniform_2(s, u);
+
+  double r = sqrt(-2.*log(u[0]));
+  x[0] = r * cos(twopi*u[1]);
+  x[1] = r * sin(twopi*u[1]);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -585,6 +683,179 @@ cs_random_restore(cs_real_t  save_block[1634])
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the seed used by counter-based random number streams.
+ *
+ * Unlike \ref cs_random_seed, this seed should be identical on all ranks
+ * so that streams only depend on their identifiers.
+ *
+ * \param[in]  seed  stream seed
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_seed(uint32_t  seed)
+{
+  _stream_seed = seed;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize a counter-based random number stream.
+ *
+ * \param[out]  s       pointer to stream
+ * \param[in]   id      stream identifier (such as a particle number)
+ * \param[in]   sub_id  stream sub-identifier (such as a time step number)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_init(cs_random_stream_t  *s,
+                      uint64_t             id,
+                      uint64_t             sub_id)
+{
+  s->key[0] = _stream_seed;
+  s->key[1] = (uint32_t)(sub_id >> 32);
+
+  s->ctr[0] = 0;
+  s->ctr[1] = (uint32_t)(sub_id & 0xFFFFFFFFU);
+  s->ctr[2] = (uint32_t)(id & 0xFFFFFFFFU);
+  s->ctr[3] = (uint32_t)(id >> 32);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Uniform distribution values from a counter-based stream.
+ *
+ * Values are in the open interval ]0, 1[. Each block of 2 values
+ * advances the stream counter by one.
+ *
+ * \param[in, out]  s  pointer to stream
+ * \param[in]       n  number of values to compute
+ * \param[out]      a  pseudo-random numbers following uniform distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_uniform(cs_random_stream_t  *s,
+                         cs_lnum_t            n,
+                         cs_real_t            a[])
+{
+  double u[2];
+
+  cs_lnum_t i = 0;
+  for (i = 0; i + 1 < n; i += 2)
+    _stream_uniform_2(s, a + i);
+
+  if (i < n) {
+    _stream_uniform_2(s, u);
+    a[i] = u[0];
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Normal distribution values from a counter-based stream.
+ *
+ * Box-Muller method. Each block of 2 values advances the stream counter
+ * by one.
+ *
+ * \param[in, out]  s  pointer to stream
+ * \param[in]       n  number of values to compute
+ * \param[out]      x  pseudo-random numbers following normal distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_normal(cs_random_stream_t  *s,
+                        cs_lnum_t            n,
+                        cs_real_t            x[])
+{
+  double y[2];
+
+  cs_lnum_t i = 0;
+  for (i = 0; i + 1 < n; i += 2)
+    _stream_normal_2(s, x + i);
+
+  if (i < n) {
+    _stream_normal_2(s, y);
+    x[i] = y[0];
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Uniform distribution values for a set of counter-based streams.
+ *
+ * Values a[i*stride] to a[i*stride + stride-1] are drawn from the stream
+ * with identifier id_shift + i (or ids[i] if non-NULL) and the given
+ * sub-identifier, so the result does not depend on the number of threads
+ * or the order in which elements are processed.
+ *
+ * \param[in]   n         number of streams
+ * \param[in]   ids       stream identifiers, or NULL
+ * \param[in]   id_shift  shift added to stream identifiers
+ * \param[in]   sub_id    stream sub-identifier
+ * \param[in]   stride    number of values per stream
+ * \param[out]  a         pseudo-random numbers following uniform
+ *                        distribution (size: n*stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_uniform_set(cs_lnum_t         n,
+                             const cs_gnum_t   ids[],
+                             uint64_t          id_shift,
+                             uint64_t          sub_id,
+                             cs_lnum_t         stride,
+                             cs_real_t         a[])
+{
+# pragma omp parallel for if (n > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n; i++) {
+    cs_random_stream_t s;
+    uint64_t id = (ids != NULL) ? ids[i] : (uint64_t)i;
+    cs_random_stream_init(&s, id + id_shift, sub_id);
+    cs_random_stream_uniform(&s, stride, a + i*stride);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Normal distribution values for a set of counter-based streams.
+ *
+ * Values x[i*stride] to x[i*stride + stride-1] are drawn from the stream
+ * with identifier id_shift + i (or ids[i] if non-NULL) and the given
+ * sub-identifier, so the result does not depend on the number of threads
+ * or the order in which elements are processed.
+ *
+ * \param[in]   n         number of streams
+ * \param[in]   ids       stream identifiers, or NULL
+ * \param[in]   id_shift  shift added to stream identifiers
+ * \param[in]   sub_id    stream sub-identifier
+ * \param[in]   stride    number of values per stream
+ * \param[out]  x         pseudo-random numbers following normal
+ *                        distribution (size: n*stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_normal_set(cs_lnum_t         n,
+                            const cs_gnum_t   ids[],
+                            uint64_t          id_shift,
+                            uint64_t          sub_id,
+                            cs_lnum_t         stride,
+                            cs_real_t         x[])
+{
+# pragma omp parallel for if (n > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n; i++) {
+    cs_random_stream_t s;
+    uint64_t id = (ids != NULL) ? ids[i] : (uint64_t)i;
+    cs_random_stream_init(&s, id + id_shift, sub_id);
+    cs_random_stream_normal(&s, stride, x + i*stride);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -49,6 +49,22 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Counter-based random number stream (Philox4x32-10).
+ *
+ * A stream is fully determined by its identifier (for example a particle
+ * number), a sub-identifier (for example a time step number and a tag) and
+ * the number of blocks already drawn; it holds no shared state, so
+ * different streams may be used concurrently by threads or ranks.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  uint32_t  key[2];    /* Philox key (seed and high bits of sub-id) */
+  uint32_t  ctr[4];    /* Philox counter (block, sub-id, id) */
+
+} cs_random_stream_t;
+
 /*=============================================================================
  * Global variables
  *============================================================================*/
@@ -142,6 +158,125 @@ cs_random_save(cs_real_t  save_block[1634]);
 void
 cs_random_restore(cs_real_t  save_block[1634]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the seed used by counter-based random number streams.
+ *
+ * Unlike \ref cs_random_seed, this seed should be identical on all ranks
+ * so that streams only depend on their identifiers.
+ *
+ * \param[in]  seed  stream seed
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_seed(uint32_t  seed);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize a counter-based random number stream.
+ *
+ * \param[out]  s       pointer to stream
+ * \param[in]   id      stream identifier (such as a particle number)
+ * \param[in]   sub_id  stream sub-identifier (such as a time step number)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_init(cs_random_stream_t  *s,
+                      uint64_t             id,
+                      uint64_t             sub_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Uniform distribution values from a counter-based stream.
+ *
+ * Values are in the open interval ]0, 1[. Each block of 2 values
+ * advances the stream counter by one.
+ *
+ * \param[in, out]  s  pointer to stream
+ * \param[in]       n  number of values to compute
+ * \param[out]      a  pseudo-random numbers following uniform distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_uniform(cs_random_stream_t  *s,
+                         cs_lnum_t            n,
+                         cs_real_t            a[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Normal distribution values from a counter-based stream.
+ *
+ * Box-Muller method. Each block of 2 values advances the stream counter
+ * by one.
+ *
+ * \param[in, out]  s  pointer to stream
+ * \param[in]       n  number of values to compute
+ * \param[out]      x  pseudo-random numbers following normal distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_normal(cs_random_stream_t  *s,
+                        cs_lnum_t            n,
+                        cs_real_t            x[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Uniform distribution values for a set of counter-based streams.
+ *
+ * Values a[i*stride] to a[i*stride + stride-1] are drawn from the stream
+ * with identifier id_shift + i (or ids[i] if non-NULL) and the given
+ * sub-identifier, so the result does not depend on the number of threads
+ * or the order in which elements are processed.
+ *
+ * \param[in]   n         number of streams
+ * \param[in]   ids       stream identifiers, or NULL
+ * \param[in]   id_shift  shift added to stream identifiers
+ * \param[in]   sub_id    stream sub-identifier
+ * \param[in]   stride    number of values per stream
+ * \param[out]  a         pseudo-random numbers following uniform
+ *                        distribution (size: n*stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_uniform_set(cs_lnum_t         n,
+                             const cs_gnum_t   ids[],
+                             uint64_t          id_shift,
+                             uint64_t          sub_id,
+                             cs_lnum_t         stride,
+                             cs_real_t         a[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Normal distribution values for a set of counter-based streams.
+ *
+ * Values x[i*stride] to x[i*stride + stride-1] are drawn from the stream
+ * with identifier id_shift + i (or ids[i] if non-NULL) and the given
+ * sub-identifier, so the result does not depend on the number of threads
+ * or the order in which elements are processed.
+ *
+ * \param[in]   n         number of streams
+ * \param[in]   ids       stream identifiers, or NULL
+ * \param[in]   id_shift  shift added to stream identifiers
+ * \param[in]   sub_id    stream sub-identifier
+ * \param[in]   stride    number of values per stream
+ * \param[out]  x         pseudo-random numbers following normal
+ *                        distribution (size: n*stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_stream_normal_set(cs_lnum_t         n,
+                            const cs_gnum_t   ids[],
+                            uint64_t          id_shift,
+                            uint64_t          sub_id,
+                            cs_lnum_t         stride,
+                            cs_real_t         x[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -5680,6 +5680,461 @@ _renumber_mesh(cs_mesh_t  *mesh)
       ("\n ----------------------------------------------------------\n");
 }
 
+#if defined(HAVE_METIS) || defined(HAVE_PARMETIS)
+
+/*----------------------------------------------------------------------------
+ * Compute a fill-reducing ordering of a graph using METIS
+ *
+ * parameters:
+ *   n_elts      <-- number of elements in graph
+ *   elt_idx     <-- element -> neighbors index
+ *   elt_nbr     <-- element -> neighbors connectivity
+ *   new_to_old  --> new to old element numbering
+ *
+ * returns:
+ *   0 in case of success, 1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_graph_metis_order(cs_lnum_t         n_elts,
+                   const cs_lnum_t   elt_idx[],
+                   const cs_lnum_t   elt_nbr[],
+                   cs_lnum_t         new_to_old[])
+{
+  idx_t   _n_elts = n_elts;
+  idx_t  *perm = NULL, *iperm = NULL;
+  idx_t  *_elt_idx = NULL, *_elt_nbr = NULL;
+
+  int retval = 0, retcode = METIS_OK;
+
+  BFT_MALLOC(perm, n_elts, idx_t);
+  BFT_MALLOC(iperm, n_elts, idx_t);
+  BFT_MALLOC(_elt_idx, n_elts + 1, idx_t);
+  BFT_MALLOC(_elt_nbr, elt_idx[n_elts], idx_t);
+
+  for (cs_lnum_t i = 0; i < n_elts + 1; i++)
+    _elt_idx[i] = elt_idx[i];
+  for (cs_lnum_t i = 0; i < elt_idx[n_elts]; i++)
+    _elt_nbr[i] = elt_nbr[i];
+
+  retcode = METIS_NodeND(&_n_elts,
+                         _elt_idx,
+                         _elt_nbr,
+                         NULL,       /* vwgt:   element weights */
+                         NULL,       /* options */
+                         perm,
+                         iperm);
+
+  if (retcode == METIS_OK) {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      new_to_old[i] = perm[i];
+  }
+  else
+    retval = 1;
+
+  BFT_FREE(_elt_nbr);
+  BFT_FREE(_elt_idx);
+  BFT_FREE(iperm);
+  BFT_FREE(perm);
+
+  return retval;
+}
+
+#endif /* defined(HAVE_METIS) || defined(HAVE_PARMETIS) */
+
+#if defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
+
+/*----------------------------------------------------------------------------
+ * Compute a fill-reducing ordering of a graph using SCOTCH
+ *
+ * parameters:
+ *   n_elts      <-- number of elements in graph
+ *   elt_idx     <-- element -> neighbors index
+ *   elt_nbr     <-- element -> neighbors connectivity
+ *   new_to_old  --> new to old element numbering
+ *
+ * returns:
+ *   0 in case of success, 1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_graph_scotch_order(cs_lnum_t         n_elts,
+                    const cs_lnum_t   elt_idx[],
+                    const cs_lnum_t   elt_nbr[],
+                    cs_lnum_t         new_to_old[])
+{
+  SCOTCH_Graph  grafdat;
+  SCOTCH_Strat  stradat;
+  SCOTCH_Num  *peritab = NULL;
+  SCOTCH_Num  *_elt_idx = NULL, *_elt_nbr = NULL;
+
+  int  retval = 0;
+
+  BFT_MALLOC(peritab, n_elts, SCOTCH_Num);
+  BFT_MALLOC(_elt_idx, n_elts + 1, SCOTCH_Num);
+  BFT_MALLOC(_elt_nbr, elt_idx[n_elts], SCOTCH_Num);
+
+  for (cs_lnum_t i = 0; i < n_elts + 1; i++)
+    _elt_idx[i] = elt_idx[i];
+  for (cs_lnum_t i = 0; i < elt_idx[n_elts]; i++)
+    _elt_nbr[i] = elt_nbr[i];
+
+  SCOTCH_graphInit(&grafdat);
+
+  retval
+    = SCOTCH_graphBuild(&grafdat,
+                        0,                  /* baseval; 0 to n -1 numbering */
+                        n_elts,             /* vertnbr */
+                        _elt_idx,           /* verttab */
+                        NULL,               /* vendtab: verttab + 1 or NULL */
+                        NULL,               /* velotab: vertex weights */
+                        NULL,               /* vlbltab; vertex labels */
+                        _elt_idx[n_elts],   /* edgenbr */
+                        _elt_nbr,           /* edgetab */
+                        NULL);              /* edlotab */
+
+  if (retval == 0) {
+
+    SCOTCH_stratInit(&stradat);
+
+    retval = SCOTCH_graphOrder(&grafdat,
+                               &stradat,
+                               NULL,      /* permtab */
+                               peritab,
+                               NULL,      /* cblkptr */
+                               NULL,      /* rangtab */
+                               NULL);     /* treetab */
+
+    SCOTCH_stratExit(&stradat);
+
+  }
+
+  SCOTCH_graphExit(&grafdat);
+
+  if (retval == 0) {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      new_to_old[i] = peritab[i];
+  }
+  else
+    retval = 1;
+
+  BFT_FREE(_elt_nbr);
+  BFT_FREE(_elt_idx);
+  BFT_FREE(peritab);
+
+  return retval;
+}
+
+#endif /* defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH) */
+
+/*----------------------------------------------------------------------------
+ * Build the level structure of the connected component of a subset of a
+ * graph containing a given element (breadth-first traversal).
+ *
+ * Levels of reached elements must be reset to -1 by the caller.
+ *
+ * parameters:
+ *   root       <-- id of the root element
+ *   subset_id  <-- id of the current subset
+ *   elt_idx    <-- element -> neighbors index
+ *   elt_nbr    <-- element -> neighbors connectivity
+ *   elt_subset <-- subset id of each element
+ *   level      <-> level of each element (-1 if not reached)
+ *   queue      --> reached elements, ordered by level
+ *   n_levels   --> number of levels
+ *
+ * returns:
+ *   number of reached elements
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_nd_level_structure(cs_lnum_t         root,
+                    int               subset_id,
+                    const cs_lnum_t   elt_idx[],
+                    const cs_lnum_t   elt_nbr[],
+                    const int         elt_subset[],
+                    cs_lnum_t         level[],
+                    cs_lnum_t         queue[],
+                    cs_lnum_t        *n_levels)
+{
+  cs_lnum_t  n_reached = 0, s_id = 0;
+
+  queue[n_reached++] = root;
+  level[root] = 0;
+
+  while (s_id < n_reached) {
+    cs_lnum_t  i = queue[s_id++];
+    for (cs_lnum_t k = elt_idx[i]; k < elt_idx[i+1]; k++) {
+      cs_lnum_t  j = elt_nbr[k];
+      if (elt_subset[j] == subset_id && level[j] < 0) {
+        level[j] = level[i] + 1;
+        queue[n_reached++] = j;
+      }
+    }
+  }
+
+  *n_levels = level[queue[n_reached-1]] + 1;
+
+  return n_reached;
+}
+
+/*----------------------------------------------------------------------------
+ * Order a subset of a graph by recursive nested dissection.
+ *
+ * Separators are the middle level of a level structure rooted at a
+ * pseudo-peripheral element; separator elements with no neighbor on the
+ * far side are moved to the near side. Separators are numbered last.
+ *
+ * parameters:
+ *   n_sub       <-- number of elements in subset
+ *   sub_elts    <-- ids of elements in subset
+ *   subset_id   <-- id of the subset
+ *   start_id    <-- position of the subset in the ordering
+ *   elt_idx     <-- element -> neighbors index
+ *   elt_nbr     <-- element -> neighbors connectivity
+ *   n_subsets   <-> number of subset ids used
+ *   elt_subset  <-> subset id of each element
+ *   level       <-> work array (-1 on input and output)
+ *   queue       <-> work array
+ *   new_to_old  --> new to old element numbering
+ *----------------------------------------------------------------------------*/
+
+static void
+_nd_order_subset(cs_lnum_t          n_sub,
+                 const cs_lnum_t    sub_elts[],
+                 int                subset_id,
+                 cs_lnum_t          start_id,
+                 const cs_lnum_t    elt_idx[],
+                 const cs_lnum_t    elt_nbr[],
+                 int               *n_subsets,
+                 int                elt_subset[],
+                 cs_lnum_t          level[],
+                 cs_lnum_t          queue[],
+                 cs_lnum_t          new_to_old[])
+{
+  const cs_lnum_t  leaf_size = 32;
+
+  if (n_sub <= leaf_size) {
+    for (cs_lnum_t i = 0; i < n_sub; i++)
+      new_to_old[start_id + i] = sub_elts[i];
+    return;
+  }
+
+  /* Look for a pseudo-peripheral element */
+
+  cs_lnum_t  root = sub_elts[0], n_levels = 0;
+  cs_lnum_t  n_reached = _nd_level_structure(root, subset_id,
+                                             elt_idx, elt_nbr, elt_subset,
+                                             level, queue, &n_levels);
+
+  for (int iter = 0; iter < 4; iter++) {
+
+    cs_lnum_t  n_levels_prev = n_levels;
+    cs_lnum_t  root_prev = root;
+
+    /* Element of minimum degree in the last level */
+
+    root = queue[n_reached-1];
+    for (cs_lnum_t i = n_reached-1; i > -1; i--) {
+      cs_lnum_t  j = queue[i];
+      if (level[j] < n_levels - 1)
+        break;
+      if (elt_idx[j+1] - elt_idx[j] < elt_idx[root+1] - elt_idx[root])
+        root = j;
+    }
+
+    for (cs_lnum_t i = 0; i < n_reached; i++)
+      level[queue[i]] = -1;
+
+    n_reached = _nd_level_structure(root, subset_id,
+                                    elt_idx, elt_nbr, elt_subset,
+                                    level, queue, &n_levels);
+
+    if (n_levels <= n_levels_prev) {
+      if (n_levels < n_levels_prev) { /* Revert to previous root */
+        for (cs_lnum_t i = 0; i < n_reached; i++)
+          level[queue[i]] = -1;
+        n_reached = _nd_level_structure(root_prev, subset_id,
+                                        elt_idx, elt_nbr, elt_subset,
+                                        level, queue, &n_levels);
+      }
+      break;
+    }
+
+  }
+
+  /* Disconnected subset: order the connected component first */
+
+  if (n_reached < n_sub) {
+
+    cs_lnum_t  *_sub_elts = NULL;
+    BFT_MALLOC(_sub_elts, n_sub, cs_lnum_t);
+
+    const int  c_subset_id = *n_subsets;
+    const int  r_subset_id = *n_subsets + 1;
+    *n_subsets += 2;
+
+    for (cs_lnum_t i = 0; i < n_reached; i++) {
+      _sub_elts[i] = queue[i];
+      elt_subset[queue[i]] = c_subset_id;
+      level[queue[i]] = -1;
+    }
+
+    cs_lnum_t  n_rest = 0;
+    for (cs_lnum_t i = 0; i < n_sub; i++) {
+      if (elt_subset[sub_elts[i]] == subset_id) {
+        _sub_elts[n_reached + n_rest] = sub_elts[i];
+        elt_subset[sub_elts[i]] = r_subset_id;
+        n_rest++;
+      }
+    }
+    assert(n_reached + n_rest == n_sub);
+
+    _nd_order_subset(n_reached, _sub_elts, c_subset_id, start_id,
+                     elt_idx, elt_nbr, n_subsets, elt_subset,
+                     level, queue, new_to_old);
+    _nd_order_subset(n_rest, _sub_elts + n_reached, r_subset_id,
+                     start_id + n_reached,
+                     elt_idx, elt_nbr, n_subsets, elt_subset,
+                     level, queue, new_to_old);
+
+    BFT_FREE(_sub_elts);
+    return;
+  }
+
+  /* Not enough levels for a dissection */
+
+  if (n_levels < 3) {
+    for (cs_lnum_t i = 0; i < n_reached; i++) {
+      new_to_old[start_id + i] = queue[i];
+      level[queue[i]] = -1;
+    }
+    return;
+  }
+
+  /* Separator is the first level reaching half the elements */
+
+  cs_lnum_t  sep_level = 1;
+  for (cs_lnum_t i = 0; i < n_reached; i++) {
+    if (2*i >= n_reached) {
+      sep_level = level[queue[i]];
+      break;
+    }
+  }
+  sep_level = CS_MAX(sep_level, 1);
+  sep_level = CS_MIN(sep_level, n_levels - 2);
+
+  /* Build the two parts and the separator; separator elements with no
+     neighbor in the next level are moved to the first part */
+
+  cs_lnum_t  *_sub_elts = NULL;
+  BFT_MALLOC(_sub_elts, n_sub, cs_lnum_t);
+
+  cs_lnum_t  n_p0 = 0, n_p1 = 0, n_sep = 0;
+
+  for (cs_lnum_t i = 0; i < n_reached; i++) {
+    cs_lnum_t  j = queue[i];
+    if (level[j] < sep_level)
+      n_p0++;
+    else if (level[j] > sep_level)
+      n_p1++;
+    else {
+      bool  is_sep = false;
+      for (cs_lnum_t k = elt_idx[j]; k < elt_idx[j+1]; k++) {
+        if (level[elt_nbr[k]] > sep_level) {
+          is_sep = true;
+          break;
+        }
+      }
+      if (is_sep)
+        n_sep++;
+      else {
+        n_p0++;
+        level[j] = -2; /* tag */
+      }
+    }
+  }
+
+  const int  p0_subset_id = *n_subsets;
+  const int  p1_subset_id = *n_subsets + 1;
+  *n_subsets += 2;
+
+  cs_lnum_t  s_p0 = 0, s_p1 = n_p0, s_sep = n_p0 + n_p1;
+
+  for (cs_lnum_t i = 0; i < n_reached; i++) {
+    cs_lnum_t  j = queue[i];
+    if (level[j] < sep_level) {
+      _sub_elts[s_p0++] = j;
+      elt_subset[j] = p0_subset_id;
+    }
+    else if (level[j] > sep_level) {
+      _sub_elts[s_p1++] = j;
+      elt_subset[j] = p1_subset_id;
+    }
+    else
+      _sub_elts[s_sep++] = j;
+  }
+
+  for (cs_lnum_t i = 0; i < n_reached; i++)
+    level[queue[i]] = -1;
+
+  /* Separator elements are numbered last */
+
+  for (cs_lnum_t i = 0; i < n_sep; i++)
+    new_to_old[start_id + n_p0 + n_p1 + i] = _sub_elts[n_p0 + n_p1 + i];
+
+  _nd_order_subset(n_p0, _sub_elts, p0_subset_id, start_id,
+                   elt_idx, elt_nbr, n_subsets, elt_subset,
+                   level, queue, new_to_old);
+  _nd_order_subset(n_p1, _sub_elts + n_p0, p1_subset_id, start_id + n_p0,
+                   elt_idx, elt_nbr, n_subsets, elt_subset,
+                   level, queue, new_to_old);
+
+  BFT_FREE(_sub_elts);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a fill-reducing ordering of a graph by nested dissection, using
+ * a built-in algorithm based on level structures.
+ *
+ * parameters:
+ *   n_elts      <-- number of elements in graph
+ *   elt_idx     <-- element -> neighbors index
+ *   elt_nbr     <-- element -> neighbors connectivity
+ *   new_to_old  --> new to old element numbering
+ *----------------------------------------------------------------------------*/
+
+static void
+_graph_nd_order(cs_lnum_t         n_elts,
+                const cs_lnum_t   elt_idx[],
+                const cs_lnum_t   elt_nbr[],
+                cs_lnum_t         new_to_old[])
+{
+  int  n_subsets = 1;
+  int  *elt_subset = NULL;
+  cs_lnum_t  *level = NULL, *queue = NULL, *sub_elts = NULL;
+
+  BFT_MALLOC(elt_subset, n_elts, int);
+  BFT_MALLOC(level, n_elts, cs_lnum_t);
+  BFT_MALLOC(queue, n_elts, cs_lnum_t);
+  BFT_MALLOC(sub_elts, n_elts, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    elt_subset[i] = 0;
+    level[i] = -1;
+    sub_elts[i] = i;
+  }
+
+  _nd_order_subset(n_elts, sub_elts, 0, 0,
+                   elt_idx, elt_nbr, &n_subsets, elt_subset,
+                   level, queue, new_to_old);
+
+  BFT_FREE(sub_elts);
+  BFT_FREE(queue);
+  BFT_FREE(level);
+  BFT_FREE(elt_subset);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -6316,6 +6771,45 @@ cs_renumber_vertices(cs_mesh_t  *mesh)
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a fill-reducing (nested dissection) ordering of a local
+ *        symmetric graph, for instance the adjacency graph of a sparse matrix
+ *        to be factorized.
+ *
+ * METIS or SCOTCH are used when available; otherwise, a built-in nested
+ * dissection based on level structures is used.
+ *
+ * The graph should be symmetric and should not contain self-references.
+ *
+ * \param[in]   n_elts      number of elements in graph
+ * \param[in]   elt_idx     element -> neighbors index (size: n_elts + 1)
+ * \param[in]   elt_nbr     element -> neighbors connectivity
+ * \param[out]  new_to_old  new to old element numbering (size: n_elts)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_fill_reducing_order(cs_lnum_t         n_elts,
+                                const cs_lnum_t   elt_idx[],
+                                const cs_lnum_t   elt_nbr[],
+                                cs_lnum_t         new_to_old[])
+{
+  int retval = 1;
+
+  if (n_elts < 1)
+    return;
+
+#if defined(HAVE_METIS) || defined(HAVE_PARMETIS)
+  retval = _graph_metis_order(n_elts, elt_idx, elt_nbr, new_to_old);
+#elif defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
+  retval = _graph_scotch_order(n_elts, elt_idx, elt_nbr, new_to_old);
+#endif
+
+  if (retval != 0)
+    _graph_nd_order(n_elts, elt_idx, elt_nbr, new_to_old);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -322,6 +322,30 @@ cs_renumber_b_faces_select_ignore(cs_mesh_t        *mesh,
 void
 cs_renumber_vertices(cs_mesh_t  *mesh);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a fill-reducing (nested dissection) ordering of a local
+ *        symmetric graph, for instance the adjacency graph of a sparse matrix
+ *        to be factorized.
+ *
+ * METIS or SCOTCH are used when available; otherwise, a built-in nested
+ * dissection based on level structures is used.
+ *
+ * The graph should be symmetric and should not contain self-references.
+ *
+ * \param[in]   n_elts      number of elements in graph
+ * \param[in]   elt_idx     element -> neighbors index (size: n_elts + 1)
+ * \param[in]   elt_nbr     element -> neighbors connectivity
+ * \param[out]  new_to_old  new to old element numbering (size: n_elts)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_fill_reducing_order(cs_lnum_t         n_elts,
+                                const cs_lnum_t   elt_idx[],
+                                const cs_lnum_t   elt_nbr[],
+                                cs_lnum_t         new_to_old[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
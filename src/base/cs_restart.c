@@ -97,6 +97,12 @@ BEGIN_C_DECLS
  * Local macro definitions
  *============================================================================*/
 
+/* Index id marking a section whose body is only a reference (relative path
+   to the checkpoint file actually containing its values), used for
+   incremental checkpoints */
+
+#define CS_RESTART_SECTION_REF_ID  1
+
 /*============================================================================
  * Local type definitions
  *============================================================================*/
@@ -128,8 +134,26 @@ struct _cs_restart_t {
 
   cs_restart_mode_t  mode;           /* Read or write */
 
+  int                mw_id;          /* Associated multiwriter id, or -1 */
+  bool               incremental;    /* May unchanged sections reference
+                                        a previous checkpoint ? */
+
+  int                n_refs;         /* Number of referenced files opened */
+  cs_restart_t     **refs;           /* Referenced checkpoint files opened
+                                        for reading, or NULL */
+
 };
 
+typedef struct {
+
+  char       *name;              /* Section name */
+  int         location_id;       /* Associated location id */
+  int         n_location_vals;   /* Number of values per location */
+  uint64_t    digest;            /* Digest of local section values */
+  char       *path;              /* Path of file containing values */
+
+} _section_ref_t;
+
 typedef struct {
 
   int    id;                 /* Id of the writer */
@@ -143,6 +167,14 @@ typedef struct {
                                been written */
   char **prev_files;        /* Names of the previous versions */
 
+  int    n_incremental;     /* Number of successive incremental versions */
+  int    n_sections;        /* Number of sections with known digest */
+  _section_ref_t *sections; /* Digest and location of sections, for
+                               incremental checkpoints */
+  int    n_file_refs;       /* Number of references between files */
+  char **file_refs;         /* Paths of referencing and referenced files
+                               for each reference (interlaced) */
+
 } _restart_multiwriter_t;
 
 /*============================================================================
@@ -207,6 +239,12 @@ static double _checkpoint_wt_interval = -1.; /* wall-clock interval */
 static double _checkpoint_wt_next = -1.;     /* next forced wall-clock value */
 static double _checkpoint_wt_last = 0.;      /* wall-clock time of last
                                                 checkpointing */
+static int    _checkpoint_compression = 0;   /* compression level for
+                                                distributed sections */
+static int    _checkpoint_n_incremental = 0; /* max. successive incremental
+                                                checkpoints */
+static int    _restart_n_ref_sections = 0;   /* number of sections written
+                                                as references */
 /* Are we restarting from a NCFD file ? */
 
 static int    _restart_from_ncfd = 0;
@@ -400,6 +438,9 @@ _add_file(cs_restart_t  *r)
   }
 #endif
 
+  if (r->mode == CS_RESTART_MODE_WRITE && _checkpoint_compression > 0)
+    cs_io_set_compression(r->fh, _checkpoint_compression);
+
   timing[1] = cs_timer_wtime();
   _restart_wtime[r->mode] += timing[1] - timing[0];
 
@@ -1011,6 +1052,367 @@ _default_p_rank(cs_block_dist_info_t  *p_bi,
 
 #endif /* defined(HAVE_MPI) */
 
+/*----------------------------------------------------------------------------
+ * Compute a digest of a section's values.
+ *
+ * The digest is computed on the local values only, so it only allows
+ * comparing sections written with the same partitioning (i.e. during a
+ * given computation), and digests must be compared on all ranks.
+ *
+ * parameters:
+ *   r               <-- associated restart file pointer
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- value type
+ *   val             <-- array of values
+ *
+ * returns:
+ *   section digest
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_section_digest(const cs_restart_t     *r,
+                int                     location_id,
+                int                     n_location_vals,
+                cs_restart_val_type_t   val_type,
+                const void             *val)
+{
+  size_t type_size = 0;
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    type_size = 1;
+    break;
+  case CS_TYPE_int:
+    type_size = sizeof(int);
+    break;
+  case CS_TYPE_cs_gnum_t:
+    type_size = sizeof(cs_gnum_t);
+    break;
+  case CS_TYPE_cs_real_t:
+    type_size = sizeof(cs_real_t);
+    break;
+  default:
+    assert(0);
+  }
+
+  const size_t n_bytes
+    = (size_t)((r->location[location_id-1]).n_ents) * n_location_vals
+      * type_size;
+  const unsigned char *p = val;
+
+  /* FNV-type hash, on 8-byte words (with a final mix) */
+
+  const uint64_t prime = 1099511628211ULL;
+  uint64_t h = 14695981039346656037ULL ^ (uint64_t)n_bytes;
+
+  size_t i = 0;
+  for (i = 0; i + 8 <= n_bytes; i += 8) {
+    uint64_t w;
+    memcpy(&w, p + i, 8);
+    h ^= w;
+    h *= prime;
+    h ^= h >> 32;
+  }
+  for (; i < n_bytes; i++) {
+    h ^= p[i];
+    h *= prime;
+  }
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Record that a checkpoint file references values of another file.
+ *
+ * parameters:
+ *   mw    <-> pointer to multiwriter structure
+ *   src   <-- path of referencing file
+ *   dest  <-- path of referenced file
+ *----------------------------------------------------------------------------*/
+
+static void
+_restart_multiwriter_add_file_ref(_restart_multiwriter_t  *mw,
+                                  const char              *src,
+                                  const char              *dest)
+{
+  for (int i = 0; i < mw->n_file_refs; i++) {
+    if (   strcmp(mw->file_refs[2*i], src) == 0
+        && strcmp(mw->file_refs[2*i+1], dest) == 0)
+      return;
+  }
+
+  BFT_REALLOC(mw->file_refs, 2*(mw->n_file_refs + 1), char *);
+
+  char **r = mw->file_refs + 2*mw->n_file_refs;
+  BFT_MALLOC(r[0], strlen(src) + 1, char);
+  strcpy(r[0], src);
+  BFT_MALLOC(r[1], strlen(dest) + 1, char);
+  strcpy(r[1], dest);
+
+  mw->n_file_refs += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Remove references from a given checkpoint file.
+ *
+ * parameters:
+ *   mw    <-> pointer to multiwriter structure
+ *   src   <-- path of referencing file
+ *----------------------------------------------------------------------------*/
+
+static void
+_restart_multiwriter_remove_file_refs(_restart_multiwriter_t  *mw,
+                                      const char              *src)
+{
+  int n_refs = 0;
+
+  for (int i = 0; i < mw->n_file_refs; i++) {
+    if (strcmp(mw->file_refs[2*i], src) == 0) {
+      BFT_FREE(mw->file_refs[2*i]);
+      BFT_FREE(mw->file_refs[2*i+1]);
+    }
+    else {
+      mw->file_refs[2*n_refs] = mw->file_refs[2*i];
+      mw->file_refs[2*n_refs+1] = mw->file_refs[2*i+1];
+      n_refs += 1;
+    }
+  }
+
+  mw->n_file_refs = n_refs;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a section as a reference to a previous checkpoint file if its
+ * values are unchanged, and update the associated section registry.
+ *
+ * parameters:
+ *   r               <-- associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- value type
+ *   val             <-- array of values
+ *
+ * returns:
+ *   true if the section was written as a reference, false if its values
+ *   still need to be written
+ *----------------------------------------------------------------------------*/
+
+static bool
+_write_section_ref(cs_restart_t           *r,
+                   const char             *sec_name,
+                   int                     location_id,
+                   int                     n_location_vals,
+                   cs_restart_val_type_t   val_type,
+                   const void             *val)
+{
+  if (   _checkpoint_n_incremental < 1 || r->mw_id < 0
+      || location_id < 1 || val_type == CS_TYPE_char || val == NULL)
+    return false;
+
+  _restart_multiwriter_t *mw = _restart_multiwriter[r->mw_id];
+
+  uint64_t digest
+    = _section_digest(r, location_id, n_location_vals, val_type, val);
+
+  _section_ref_t *s = NULL;
+  for (int i = 0; i < mw->n_sections; i++) {
+    if (   mw->sections[i].location_id == location_id
+        && strcmp(mw->sections[i].name, sec_name) == 0) {
+      s = mw->sections + i;
+      break;
+    }
+  }
+
+  /* Values are unchanged only if local digests match on all ranks
+     (combining digests across ranks could lead to collisions) */
+
+  int unchanged = (   s != NULL && r->incremental
+                   && s->digest == digest
+                   && s->n_location_vals == n_location_vals
+                   && strcmp(s->path, r->name) != 0) ? 1 : 0;
+
+  cs_parall_min(1, CS_INT_TYPE, &unchanged);
+
+  /* Reference unchanged values (in a file of the same directory) */
+
+  if (unchanged) {
+
+    size_t ldir = 0;
+    for (size_t j = 0; r->name[j] != '\0'; j++) {
+      if (r->name[j] == _dir_separator)
+        ldir = j + 1;
+    }
+
+    if (strncmp(s->path, r->name, ldir) == 0) {
+      const char *rel_path = s->path + ldir;
+      cs_io_write_global(sec_name,
+                         strlen(rel_path) + 1,
+                         location_id,
+                         CS_RESTART_SECTION_REF_ID,
+                         n_location_vals,
+                         CS_CHAR,
+                         rel_path,
+                         r->fh);
+      _restart_multiwriter_add_file_ref(mw, r->name, s->path);
+      _restart_n_ref_sections += 1;
+      return true;
+    }
+
+  }
+
+  /* Otherwise, values will be written to this file */
+
+  if (s == NULL) {
+    BFT_REALLOC(mw->sections, mw->n_sections + 1, _section_ref_t);
+    s = mw->sections + mw->n_sections;
+    mw->n_sections += 1;
+    BFT_MALLOC(s->name, strlen(sec_name) + 1, char);
+    strcpy(s->name, sec_name);
+    s->location_id = location_id;
+    s->path = NULL;
+  }
+
+  s->n_location_vals = n_location_vals;
+  s->digest = digest;
+  BFT_REALLOC(s->path, strlen(r->name) + 1, char);
+  strcpy(s->path, r->name);
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Open the checkpoint file referenced by a section in read mode.
+ *
+ * The returned structure shares the locations of the parent structure.
+ * Referenced files are kept open (and their index kept in memory) until
+ * the referencing structure is destroyed, so that each file is opened only
+ * once even if it holds many sections.
+ *
+ * parameters:
+ *   r       <-- associated restart file pointer
+ *   header  <-- header of referencing section
+ *   rec_id  <-- id of referencing section in index
+ *
+ * returns:
+ *   pointer to restart structure associated with referenced file
+ *----------------------------------------------------------------------------*/
+
+static cs_restart_t *
+_open_section_ref(cs_restart_t              *r,
+                  const cs_io_sec_header_t  *header,
+                  size_t                     rec_id)
+{
+  cs_io_sec_header_t h = *header;
+
+  char *path = NULL;
+  BFT_MALLOC(path, h.n_vals + 1, char);
+
+  cs_io_set_indexed_position(r->fh, &h, rec_id);
+  cs_io_read_global(&h, path, r->fh);
+  path[h.n_vals] = '\0';
+
+  /* Referenced path is relative to the checkpoint directory, which is the
+     parent directory of the referencing file if it is a previous version
+     (moved to a "previous_dump_<n>" subdirectory) */
+
+  size_t ldir = 0, lpdir = 0;
+  for (size_t j = 0; r->name[j] != '\0'; j++) {
+    if (r->name[j] == _dir_separator) {
+      lpdir = ldir;
+      ldir = j + 1;
+    }
+  }
+
+  if (strncmp(r->name + lpdir, "previous_dump_", 14) == 0)
+    ldir = lpdir;
+
+  char *ref_name = NULL;
+  BFT_MALLOC(ref_name, ldir + strlen(path) + 1, char);
+  strncpy(ref_name, r->name, ldir);
+  strcpy(ref_name + ldir, path);
+
+  BFT_FREE(path);
+
+  /* Reuse an already opened file */
+
+  cs_restart_t *ref = NULL;
+
+  for (int i = 0; i < r->n_refs; i++) {
+    if (strcmp(r->refs[i]->name, ref_name) == 0) {
+      ref = r->refs[i];
+      BFT_FREE(ref_name);
+      ref->n_locations = r->n_locations;
+      ref->location = r->location;
+      return ref;
+    }
+  }
+
+  BFT_MALLOC(ref, 1, cs_restart_t);
+  ref->name = ref_name;
+
+  if (cs_file_isreg(ref->name) == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Section \"%s\" of checkpoint file \"%s\" references\n"
+                "file \"%s\", which is not present."),
+              header->sec_name, r->name, ref->name);
+
+  ref->mode = CS_RESTART_MODE_READ;
+  ref->fh = NULL;
+  ref->rank_step = 1;
+  ref->min_block_size = 0;
+  ref->n_locations = 0;
+  ref->location = NULL;
+  ref->mw_id = -1;
+  ref->incremental = false;
+  ref->n_refs = 0;
+  ref->refs = NULL;
+
+  _add_file(ref);
+
+  /* Use the fully defined locations of the referencing file */
+
+  for (size_t loc_id = 0; loc_id < ref->n_locations; loc_id++)
+    BFT_FREE((ref->location[loc_id]).name);
+  BFT_FREE(ref->location);
+
+  ref->n_locations = r->n_locations;
+  ref->location = r->location;
+
+  BFT_REALLOC(r->refs, r->n_refs + 1, cs_restart_t *);
+  r->refs[r->n_refs] = ref;
+  r->n_refs += 1;
+
+  return ref;
+}
+
+/*----------------------------------------------------------------------------
+ * Close checkpoint files opened through _open_section_ref().
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_close_section_refs(cs_restart_t  *r)
+{
+  for (int i = 0; i < r->n_refs; i++) {
+    cs_restart_t *ref = r->refs[i];
+
+    _close_section_refs(ref);
+
+    if (ref->fh != NULL)
+      cs_io_finalize(&(ref->fh));
+
+    BFT_FREE(ref->name);
+    BFT_FREE(ref);
+  }
+
+  BFT_FREE(r->refs);
+  r->n_refs = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check the presence of a given section in a restart file.
@@ -1109,6 +1511,16 @@ _check_section(cs_restart_t           *restart,
   else if (header.location_id == 0 && header.n_vals != n_ents)
     return CS_RESTART_ERR_N_VALS;
 
+  /* Values may be stored in a previous checkpoint file */
+
+  if (   header.location_id > 0
+      && header.index_id == CS_RESTART_SECTION_REF_ID
+      && header.elt_type == CS_CHAR && val_type != CS_TYPE_char) {
+    cs_restart_t *ref = _open_section_ref(restart, &header, rec_id);
+    return _check_section(ref, context, sec_name, location_id,
+                          n_location_vals, val_type);
+  }
+
   /* If the type of value does not match */
 
   if (header.elt_type == CS_CHAR) {
@@ -1266,6 +1678,16 @@ _read_section(cs_restart_t           *restart,
     return CS_RESTART_ERR_N_VALS;
   }
 
+  /* Values may be stored in a previous checkpoint file */
+
+  if (   header.location_id > 0
+      && header.index_id == CS_RESTART_SECTION_REF_ID
+      && header.elt_type == CS_CHAR && val_type != CS_TYPE_char) {
+    cs_restart_t *ref = _open_section_ref(restart, &header, rec_id);
+    return _read_section(ref, context, sec_name, location_id,
+                         n_location_vals, val_type, val);
+  }
+
   /* If the type of value does not match */
 
   if (header.elt_type == CS_CHAR) {
@@ -1429,6 +1851,12 @@ _write_section(cs_restart_t           *restart,
     assert(0);
   }
 
+  /* Unchanged values may simply reference a previous checkpoint */
+
+  if (_write_section_ref(restart, sec_name, location_id, n_location_vals,
+                         val_type, val))
+    return;
+
   /* Section contents */
   /*------------------*/
 
@@ -1618,6 +2046,11 @@ _restart_multiwriter_create(void)
   new_writer->n_prev_files = -1;  /* set at 0 after first (single) output */
   new_writer->n_prev_files_tot = 0;
   new_writer->prev_files = NULL;
+  new_writer->n_incremental = 0;
+  new_writer->n_sections = 0;
+  new_writer->sections = NULL;
+  new_writer->n_file_refs = 0;
+  new_writer->file_refs = NULL;
 
   return new_writer;
 }
@@ -2118,6 +2551,8 @@ cs_restart_create(const char         *name,
   double timing[2];
 
   char *_name = NULL;
+  int writer_id = -1;
+  bool incremental = false;
   size_t  ldir, lname, lext;
 
   const char  *_path = path;
@@ -2195,11 +2630,15 @@ cs_restart_create(const char         *name,
   } else if (mode == CS_RESTART_MODE_WRITE) {
 
     /* Check if file already exists, and if so rename and delete if needed */
-    int writer_id = _add_restart_multiwriter(name, _name);
+    writer_id = _add_restart_multiwriter(name, _name);
     _restart_multiwriter_t *mw = _restart_multiwriter_by_id(writer_id);
 
-    /* Rename an already existing file */
-    if (cs_file_isreg(_name) && mw->n_prev_files > -1) {
+    /* Rename an already existing file (ensuring all ranks agree, as the
+       incremental checkpoint logic relies on a consistent history) */
+    int file_exists = cs_file_isreg(_name);
+    cs_parall_bcast(0, 1, CS_INT_TYPE, &file_exists);
+
+    if (file_exists && mw->n_prev_files > -1) {
 
       char _subdir[19];
       sprintf(_subdir, "previous_dump_%04d", mw->n_prev_files_tot);
@@ -2224,14 +2663,47 @@ cs_restart_create(const char         *name,
       strcat(_re_name, name);
       _re_name[ldir+lsdir+lname+2] = '\0';
 
-      rename(_name, _re_name);
+      if (cs_glob_rank_id < 1)
+        rename(_name, _re_name);
+
+#if defined(HAVE_MPI)
+      if (cs_glob_n_ranks > 1)
+        MPI_Barrier(cs_glob_mpi_comm);
+#endif
 
       _restart_multiwriter_increment(mw, _re_name);
 
+      /* Values of the renamed file may be referenced by the new one */
+      for (int i = 0; i < mw->n_sections; i++) {
+        _section_ref_t *sr = mw->sections + i;
+        if (strcmp(sr->path, _name) == 0) {
+          BFT_REALLOC(sr->path, strlen(_re_name) + 1, char);
+          strcpy(sr->path, _re_name);
+        }
+      }
+      for (int i = 0; i < 2*mw->n_file_refs; i++) {
+        if (strcmp(mw->file_refs[i], _name) == 0) {
+          BFT_REALLOC(mw->file_refs[i], strlen(_re_name) + 1, char);
+          strcpy(mw->file_refs[i], _re_name);
+        }
+      }
+
       BFT_FREE(_re_name);
     }
     else
       mw->n_prev_files = 0;
+
+    /* References from an overwritten file are obsolete */
+    _restart_multiwriter_remove_file_refs(mw, _name);
+
+    /* Incremental checkpoint if allowed, full checkpoint otherwise */
+    if (   mw->n_sections > 0
+        && mw->n_incremental < _checkpoint_n_incremental) {
+      incremental = true;
+      mw->n_incremental += 1;
+    }
+    else
+      mw->n_incremental = 0;
   }
 
   /* Allocate and initialize base structure */
@@ -2253,6 +2725,12 @@ cs_restart_create(const char         *name,
   restart->rank_step = 1;
   restart->min_block_size = 0;
 
+  restart->mw_id = writer_id;
+  restart->incremental = incremental;
+
+  restart->n_refs = 0;
+  restart->refs = NULL;
+
   /* Initialize location data */
 
   restart->n_locations = 0;
@@ -2306,6 +2784,8 @@ cs_restart_destroy(cs_restart_t  **restart)
 
   mode = r->mode;
 
+  _close_section_refs(r);
+
   if (r->fh != NULL)
     cs_io_finalize(&(r->fh));
 
@@ -3961,6 +4441,11 @@ cs_restart_print_stats(void)
                "  Elapsed time for writing:         %12.3f\n"),
              _restart_n_opens[0], _restart_n_opens[1],
              _restart_wtime[0], _restart_wtime[1]);
+
+  if (_restart_n_ref_sections > 0)
+    bft_printf(_("\n"
+                 "  Unchanged sections referenced:    %3d\n"),
+               _restart_n_ref_sections);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4037,6 +4522,51 @@ cs_restart_set_n_max_checkpoints(int  n_checkpoints)
   return;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the compression level used for checkpoint files.
+ *
+ * When active, sections defined on mesh locations are byte-shuffled and
+ * losslessly compressed by blocks (see \ref cs_io_set_compression), so
+ * restart files remain readable in parallel with any number of ranks.
+ * The default value is 0 (no compression).
+ *
+ * \param[in]  level  compression level (0: none, 1: fastest, 9: best)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_compression(int  level)
+{
+  _checkpoint_compression = CS_MIN(CS_MAX(level, 0), 9);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum number of successive incremental checkpoints.
+ *
+ * In an incremental checkpoint, sections defined on mesh locations whose
+ * values have not changed since they were last written (based on a digest
+ * of their values) are not written again, but only reference the previous
+ * checkpoint file containing them. Referenced files are kept in the
+ * "previous_dump_<n>" subdirectories of the checkpoint directory, even
+ * beyond the number of checkpoints to keep, so the whole checkpoint
+ * directory should be used for restart.
+ *
+ * A full checkpoint is written after the given number of successive
+ * incremental checkpoints. The default value is 0 (always full checkpoints).
+ *
+ * \param[in]  n_incremental  maximum number of successive incremental
+ *                            checkpoints
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_incremental(int  n_incremental)
+{
+  _checkpoint_n_incremental = CS_MAX(n_incremental, 0);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Remove all previous checkpoints which are not to be retained.
@@ -4058,7 +4588,62 @@ cs_restart_clean_multiwriters_history(void)
       = mw->n_prev_files - _n_restart_directories_to_write + 1;
 
     if (n_files_to_remove > 0) {
-      for (int ii = 0; ii < n_files_to_remove; ii++) {
+
+      /* Files referenced (possibly indirectly) by the latest checkpoint
+         or by a retained one are also kept */
+
+      bool *keep = NULL;
+      BFT_MALLOC(keep, mw->n_prev_files, bool);
+
+      for (int ii = 0; ii < mw->n_prev_files; ii++)
+        keep[ii] = (ii >= n_files_to_remove) ? true : false;
+
+      bool changed = true;
+      while (changed) {
+        changed = false;
+        for (int j = 0; j < mw->n_file_refs; j++) {
+          const char *src = mw->file_refs[2*j];
+          const char *dest = mw->file_refs[2*j+1];
+          bool src_kept = (strcmp(src, mw->path) == 0) ? true : false;
+          for (int ii = 0; ii < mw->n_prev_files && !src_kept; ii++) {
+            if (keep[ii] && strcmp(src, mw->prev_files[ii]) == 0)
+              src_kept = true;
+          }
+          if (!src_kept)
+            continue;
+          for (int ii = 0; ii < mw->n_prev_files; ii++) {
+            if (!keep[ii] && strcmp(dest, mw->prev_files[ii]) == 0) {
+              keep[ii] = true;
+              changed = true;
+            }
+          }
+        }
+      }
+
+      int n_kept = 0;
+
+      for (int ii = 0; ii < mw->n_prev_files; ii++) {
+
+        if (keep[ii]) {
+          mw->prev_files[n_kept++] = mw->prev_files[ii];
+          continue;
+        }
+
+        _restart_multiwriter_remove_file_refs(mw, mw->prev_files[ii]);
+
+        /* Sections whose values were only in this file must be written
+           again by the next checkpoint */
+        int n_sections = 0;
+        for (int j = 0; j < mw->n_sections; j++) {
+          _section_ref_t *sr = mw->sections + j;
+          if (strcmp(sr->path, mw->prev_files[ii]) == 0) {
+            BFT_FREE(sr->name);
+            BFT_FREE(sr->path);
+          }
+          else
+            mw->sections[n_sections++] = *sr;
+        }
+        mw->n_sections = n_sections;
 
         if (cs_glob_rank_id <= 0) {
           char *path = mw->prev_files[ii];
@@ -4081,15 +4666,9 @@ cs_restart_clean_multiwriters_history(void)
 
       }
 
-      /* Rotate available paths */
-
-      int ii = 0;
-      for (int jj = n_files_to_remove; jj < mw->n_prev_files; jj++) {
-        mw->prev_files[ii] = mw->prev_files[jj];
-        mw->prev_files[jj] = NULL;
-      }
+      BFT_FREE(keep);
 
-      mw->n_prev_files -= n_files_to_remove;
+      mw->n_prev_files = n_kept;
       /* No need for extra reallocation of mw->prev_files */
     }
 
@@ -4116,10 +4695,21 @@ cs_restart_multiwriters_destroy_all(void)
         BFT_FREE(w->prev_files[j]);
       BFT_FREE(w->prev_files);
 
+      for (int j = 0; j < w->n_sections; j++) {
+        BFT_FREE(w->sections[j].name);
+        BFT_FREE(w->sections[j].path);
+      }
+      BFT_FREE(w->sections);
+
+      for (int j = 0; j < 2*w->n_file_refs; j++)
+        BFT_FREE(w->file_refs[j]);
+      BFT_FREE(w->file_refs);
+
       BFT_FREE(w);
 
     }
     BFT_FREE(_restart_multiwriter);
+    _n_restart_multiwriters = 0;
   }
 }
 
@@ -974,6 +974,39 @@ cs_restart_is_from_ncfd(void);
 void
 cs_restart_set_n_max_checkpoints(int  n_checkpoints);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the compression level used for checkpoint files.
+ *
+ * When active, sections defined on mesh locations are byte-shuffled and
+ * losslessly compressed by blocks, so restart files remain readable in
+ * parallel with any number of ranks. The default value is 0 (no compression).
+ *
+ * \param[in]  level  compression level (0: none, 1: fastest, 9: best)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_compression(int  level);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum number of successive incremental checkpoints.
+ *
+ * In an incremental checkpoint, sections defined on mesh locations whose
+ * values have not changed since they were last written only reference
+ * the previous checkpoint file containing them. A full checkpoint is
+ * written after the given number of successive incremental checkpoints.
+ * The default value is 0 (always full checkpoints).
+ *
+ * \param[in]  n_incremental  maximum number of successive incremental
+ *                            checkpoints
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_incremental(int  n_incremental);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Remove all previous checkpoints which are not to be retained.
@@ -50,6 +50,7 @@
 #include "cs_parall.h"
 #include "cs_param_types.h"
 #include "cs_param_cdo.h"
+#include "cs_search.h"
 #include "cs_sort.h"
 #include "cs_volume_zone.h"
 
@@ -85,165 +86,241 @@ BEGIN_C_DECLS
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief  Add a entry in the face --> edges connectivity
+ * \brief  Get the list of vertices of a face (interior faces are numbered
+ *         first)
  *
- * \param[in]      shift     position where to add the new entry
- * \param[in]      v1_id     id of the first vertex
- * \param[in]      v2_id     id of the second vertex
- * \param[in]      v2v       pointer to a cs_adjacency_t structure
- * \param[in, out] f2e       face --> edges connectivity
+ * \param[in]  m       pointer to a cs_mesh_t structure
+ * \param[in]  f_id    id of the face
+ * \param[out] n_vf    number of vertices of the face
+ *
+ * \return a pointer to the list of vertex ids
  */
 /*----------------------------------------------------------------------------*/
 
-static inline void
-_add_f2e_entry(cs_lnum_t                  shift,
-               cs_lnum_t                  v1_id,
-               cs_lnum_t                  v2_id,
-               const cs_adjacency_t      *v2v,
-               cs_adjacency_t            *f2e)
+static inline const cs_lnum_t *
+_get_f2v(const cs_mesh_t   *m,
+         cs_lnum_t          f_id,
+         int               *n_vf)
 {
-  /* Convention:  sgn = -1 => v2 < v1 otherwise sgn = 1
-     Edge id corresponds to the position in v2v->idx
-  */
-  cs_lnum_t  vidx, vref;
-  if (v1_id < v2_id)
-    f2e->sgn[shift] = 1, vidx = v1_id, vref = v2_id;
-  else
-    f2e->sgn[shift] = -1, vidx = v2_id, vref = v1_id;
-
-#if defined(DEBUG) && !defined(NDEBUG)
-  f2e->ids[shift] = -1;
-#endif
-
-  for (cs_lnum_t i = v2v->idx[vidx]; i < v2v->idx[vidx+1]; i++) {
-    if (v2v->ids[i] == vref) {
-      f2e->ids[shift] = i;
-      break;
-    }
+  if (f_id < m->n_i_faces) {
+    const cs_lnum_t  s = m->i_face_vtx_idx[f_id];
+    *n_vf = m->i_face_vtx_idx[f_id+1] - s;
+    return m->i_face_vtx_lst + s;
+  }
+  else {
+    const cs_lnum_t  bf_id = f_id - m->n_i_faces;
+    const cs_lnum_t  s = m->b_face_vtx_idx[bf_id];
+    *n_vf = m->b_face_vtx_idx[bf_id+1] - s;
+    return m->b_face_vtx_lst + s;
   }
-
-#if defined(DEBUG) && !defined(NDEBUG)
-  if (f2e->ids[shift] == -1)
-    bft_error(__FILE__, __LINE__, 0, " %s: edge not found (v1: %ld, v2: %ld)\n",
-              __func__, (long)v1_id, (long)v2_id);
-#endif
 }
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief  Define the face -> edges connectivity which is stored in a
- *         cs_adjacency_t structure
+ * \brief  Build the edges of the mesh and define the face -> edges and the
+ *         edge -> vertices connectivities.
  *
- * \param[in]  m      pointer to a cs_mesh_t structure
- * \param[in]  v2v    pointer to the cs_adjacency_t structure
+ *         Edges are hashed by their vertex with the lowest id: each vertex
+ *         owns a bucket in which the other vertex of each face edge is stored.
+ *         Duplicated entries are removed by a single pass on each bucket
+ *         (sorted insertion), so that edges are numbered following the pairs
+ *         (v1, v2) with v1 < v2 in lexicographic order. All steps are
+ *         threaded.
  *
- * \return a pointer to a new allocated cs_adjacency_t structure
+ * \param[in]      m        pointer to a cs_mesh_t structure
+ * \param[in, out] connect  pointer to a cs_cdo_connect_t structure
  */
 /*----------------------------------------------------------------------------*/
 
-static cs_adjacency_t *
-_build_f2e_connect(const cs_mesh_t         *m,
-                   const cs_adjacency_t    *v2v)
+static void
+_build_edge_connect(const cs_mesh_t      *m,
+                    cs_cdo_connect_t     *connect)
 {
-  /* Sanity checks */
-  assert(v2v != NULL);
-
+  const cs_lnum_t  n_vertices = m->n_vertices;
   const cs_lnum_t  n_i_faces = m->n_i_faces;
-  const cs_lnum_t  n_b_faces = m->n_b_faces;
-  const cs_lnum_t  n_faces = n_i_faces + n_b_faces;
+  const cs_lnum_t  n_faces = n_i_faces + m->n_b_faces;
 
+  /* Face -> edges index (one edge per face vertex) */
   cs_adjacency_t  *f2e = cs_adjacency_create(CS_ADJACENCY_SIGNED, -1, n_faces);
 
-  /* Build index */
-  for (cs_lnum_t i = 0; i < n_i_faces; i++)
-    f2e->idx[i+1] += m->i_face_vtx_idx[i+1] - m->i_face_vtx_idx[i];
-  for (cs_lnum_t i = 0; i < n_b_faces; i++)
-    f2e->idx[n_i_faces+i+1] += m->b_face_vtx_idx[i+1] - m->b_face_vtx_idx[i];
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+    int  n_vf;
+    _get_f2v(m, f_id, &n_vf);
+    f2e->idx[f_id+1] = n_vf;
+  }
+
   for (cs_lnum_t i = 0; i < n_faces; i++)
     f2e->idx[i+1] += f2e->idx[i];
 
-  assert(f2e->idx[n_faces] ==
-         m->i_face_vtx_idx[n_i_faces] + m->b_face_vtx_idx[n_b_faces]);
+  const cs_lnum_t  n_fe = f2e->idx[n_faces];
+  assert(n_fe == m->i_face_vtx_idx[n_i_faces] + m->b_face_vtx_idx[m->n_b_faces]);
+
+  /* Count the number of face edges stored in the bucket of each vertex */
+  cs_lnum_t  *v_idx = NULL, *v_count = NULL;
+  BFT_MALLOC(v_idx, n_vertices + 1, cs_lnum_t);
+  BFT_MALLOC(v_count, n_vertices, cs_lnum_t);
+
+# pragma omp parallel for if (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t v = 0; v < n_vertices; v++) {
+    v_idx[v+1] = 0;
+    v_count[v] = 0;
+  }
+  v_idx[0] = 0;
+
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+
+    int  n_vf;
+    const cs_lnum_t  *f2v = _get_f2v(m, f_id, &n_vf);
+
+    for (int j = 0; j < n_vf; j++) {
+      const cs_lnum_t  v1 = f2v[j], v2 = f2v[(j+1) % n_vf];
+#     pragma omp atomic
+      v_idx[CS_MIN(v1, v2) + 1] += 1;
+    }
+
+  }
+
+  for (cs_lnum_t v = 0; v < n_vertices; v++)
+    v_idx[v+1] += v_idx[v];
 
-  /* Build matrix */
-  BFT_MALLOC(f2e->ids, f2e->idx[n_faces], cs_lnum_t);
-  BFT_MALLOC(f2e->sgn, f2e->idx[n_faces], short int);
+  /* Fill the buckets */
+  cs_lnum_t  *buckets = NULL;
+  BFT_MALLOC(buckets, n_fe, cs_lnum_t);
 
-  /* Interior faces */
-# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_i_faces; i++) {
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+
+    int  n_vf;
+    const cs_lnum_t  *f2v = _get_f2v(m, f_id, &n_vf);
+
+    for (int j = 0; j < n_vf; j++) {
+
+      const cs_lnum_t  v1 = f2v[j], v2 = f2v[(j+1) % n_vf];
+      const cs_lnum_t  v_min = CS_MIN(v1, v2);
 
-    const cs_lnum_t  s = m->i_face_vtx_idx[i];
-    const int  n_vf = m->i_face_vtx_idx[i+1] - s;
-    const cs_lnum_t  *f2v_lst = m->i_face_vtx_lst + s;
+      cs_lnum_t  shift;
+#     pragma omp atomic capture
+      shift = v_count[v_min]++;
+
+      buckets[v_idx[v_min] + shift] = CS_MAX(v1, v2);
 
-    cs_lnum_t  shift = f2e->idx[i];
-    for (int j = 0; j < n_vf - 1; j++) {
-      _add_f2e_entry(shift, f2v_lst[j], f2v_lst[j+1], v2v, f2e);
-      shift++;
     }
-    _add_f2e_entry(shift, f2v_lst[n_vf-1], f2v_lst[0], v2v, f2e);
 
   }
 
-  /* Boundary faces */
-# pragma omp parallel for if (n_b_faces > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+  /* Remove duplicated entries in each bucket: the distinct entries are kept
+     sorted at the beginning of the bucket. v_count stores now the number of
+     distinct edges related to each vertex */
+
+# pragma omp parallel for if (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t v = 0; v < n_vertices; v++) {
+
+    cs_lnum_t  *b = buckets + v_idx[v];
+    const cs_lnum_t  n_b = v_idx[v+1] - v_idx[v];
 
-    const cs_lnum_t  s = m->b_face_vtx_idx[i];
-    const int  n_vf = m->b_face_vtx_idx[i+1] - s;
-    const cs_lnum_t  *f2v_lst = m->b_face_vtx_lst + s;
+    cs_lnum_t  n_u = 0;
+    for (cs_lnum_t k = 0; k < n_b; k++) {
+
+      const cs_lnum_t  val = b[k];
+
+      cs_lnum_t  pos = n_u;
+      while (pos > 0 && b[pos-1] > val)
+        pos--;
+
+      if (pos > 0 && b[pos-1] == val)
+        continue; /* Already stored */
+
+      for (cs_lnum_t l = n_u; l > pos; l--)
+        b[l] = b[l-1];
+      b[pos] = val;
+      n_u++;
 
-    cs_lnum_t  shift = f2e->idx[i + n_i_faces];
-    for (int j = 0; j < n_vf - 1; j++) {
-      _add_f2e_entry(shift, f2v_lst[j], f2v_lst[j+1], v2v, f2e);
-      shift++;
     }
-    _add_f2e_entry(shift, f2v_lst[n_vf-1], f2v_lst[0], v2v, f2e);
 
-  } /* End of loop on border faces */
+    v_count[v] = n_u;
 
-  return f2e;
-}
+  } /* Loop on vertices */
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief  Define the edge -> vertices connectivity which is stored in a
- *         cs_adjacency_t structure
- *
- * \param[in]  v2v   pointer to a cs_adjacency_t structure
- *
- * \return a pointer to a new allocated cs_adjacency_t structure
- */
-/*----------------------------------------------------------------------------*/
+  /* Edge numbering: edges related to the vertex v start at e_idx[v] */
+  cs_lnum_t  *e_idx = NULL;
+  BFT_MALLOC(e_idx, n_vertices + 1, cs_lnum_t);
 
-static cs_adjacency_t *
-_build_e2v_connect(const cs_adjacency_t  *v2v)
-{
-  const cs_lnum_t  n_edges = v2v->idx[v2v->n_elts];
+  e_idx[0] = 0;
+  for (cs_lnum_t v = 0; v < n_vertices; v++)
+    e_idx[v+1] = e_idx[v] + v_count[v];
+
+  BFT_FREE(v_count);
+
+  const cs_lnum_t  n_edges = e_idx[n_vertices];
 
-  /* Arrays ids and sgn are allocated during the creation of the structure */
+  /* Edge -> vertices connectivity. Arrays ids and sgn are allocated during
+     the creation of the structure */
   cs_adjacency_t  *e2v = cs_adjacency_create(CS_ADJACENCY_SIGNED,
                                              2, /* stride */
                                              n_edges);
 
-  /* Fill arrays */
-# pragma omp parallel for if (n_edges > CS_THR_MIN)
-  for (cs_lnum_t v1_id = 0; v1_id < v2v->n_elts; v1_id++) {
-    for (cs_lnum_t j = v2v->idx[v1_id]; j < v2v->idx[v1_id+1]; j++) {
+# pragma omp parallel for if (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t v1_id = 0; v1_id < n_vertices; v1_id++) {
+
+    const cs_lnum_t  *b = buckets + v_idx[v1_id];
+
+    for (cs_lnum_t e_id = e_idx[v1_id]; e_id < e_idx[v1_id+1]; e_id++) {
 
-      e2v->ids[2*j] = v1_id;         /* v1_id */
-      e2v->ids[2*j+1] = v2v->ids[j]; /* v2_id */
-      e2v->sgn[2*j] = -1;            /* orientation v1 -> v2 */
-      e2v->sgn[2*j+1] = 1;
+      e2v->ids[2*e_id] = v1_id;
+      e2v->ids[2*e_id+1] = b[e_id - e_idx[v1_id]];
+      e2v->sgn[2*e_id] = -1;            /* orientation v1 -> v2 */
+      e2v->sgn[2*e_id+1] = 1;
 
       /* Assumption made when building a discrete Hodge operator */
-      assert(e2v->ids[2*j+1] > e2v->ids[2*j]);
+      assert(e2v->ids[2*e_id+1] > e2v->ids[2*e_id]);
 
     }
+
   } /* Loop on vertices */
 
-  return e2v;
+  /* Face -> edges connectivity. Convention: sgn = -1 if v2 < v1 otherwise
+     sgn = 1. The edge id is retrieved by a binary search in the (sorted)
+     bucket of the vertex with the lowest id */
+  BFT_MALLOC(f2e->ids, n_fe, cs_lnum_t);
+  BFT_MALLOC(f2e->sgn, n_fe, short int);
+
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+
+    int  n_vf;
+    const cs_lnum_t  *f2v = _get_f2v(m, f_id, &n_vf);
+    const cs_lnum_t  shift = f2e->idx[f_id];
+
+    for (int j = 0; j < n_vf; j++) {
+
+      const cs_lnum_t  v1 = f2v[j], v2 = f2v[(j+1) % n_vf];
+
+      cs_lnum_t  v_min, v_max;
+      if (v1 < v2)
+        f2e->sgn[shift + j] = 1, v_min = v1, v_max = v2;
+      else
+        f2e->sgn[shift + j] = -1, v_min = v2, v_max = v1;
+
+      const int  pos = cs_search_binary(e_idx[v_min+1] - e_idx[v_min],
+                                        v_max,
+                                        buckets + v_idx[v_min]);
+      assert(pos > -1);
+
+      f2e->ids[shift + j] = e_idx[v_min] + pos;
+
+    }
+
+  } /* Loop on faces */
+
+  BFT_FREE(buckets);
+  BFT_FREE(v_idx);
+  BFT_FREE(e_idx);
+
+  connect->n_edges = n_edges;
+  connect->f2e = f2e;
+  connect->e2v = e2v;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -266,16 +343,13 @@ _build_v2v_through_cell(const cs_cdo_connect_t     *connect)
   cs_adjacency_t  *v2c = cs_adjacency_transpose(n_vertices, c2v);
   cs_adjacency_t  *v2v = cs_adjacency_compose(n_vertices, v2c, c2v);
 
-  cs_adjacency_sort(v2v);
+  cs_adjacency_destroy(&v2c);
 
   /* Update index (v2v has a diagonal entry. We remove it since we have in
      mind an matrix structure stored using the MSR format (with diagonal terms
      counted outside the index) */
   cs_adjacency_remove_self_entries(v2v);
 
-  /* Free temporary buffers */
-  cs_adjacency_destroy(&v2c);
-
   return v2v;
 }
 
@@ -298,7 +372,6 @@ _build_f2f_through_cell(const cs_cdo_connect_t     *connect)
 
   /* Build a face -> face connectivity */
   f2f = cs_adjacency_compose(n_faces, connect->f2c, connect->c2f);
-  cs_adjacency_sort(f2f);
 
   /* Update index (f2f has a diagonal entry. We remove it since we have in
      mind an index structure for a matrix stored using the MSR format */
@@ -327,15 +400,12 @@ _build_e2e_through_cell(const cs_cdo_connect_t     *connect)
   assert(e2c != NULL);
   cs_adjacency_t  *e2e = cs_adjacency_compose(n_edges, e2c, connect->c2e);
 
-  cs_adjacency_sort(e2e);
+  cs_adjacency_destroy(&e2c);
 
   /* Update index (e2e has a diagonal entry. We remove it since we have in
      mind an index structure for a matrix stored using the MSR format */
   cs_adjacency_remove_self_entries(e2e);
 
-  /* Free temporary buffers */
-  cs_adjacency_destroy(&e2c);
-
   return e2e;
 }
 
@@ -357,17 +427,10 @@ _compute_max_ent(const cs_mesh_t      *m,
   assert(connect->c2v != NULL && connect->c2e != NULL && connect->f2c != NULL);
   assert(connect->f2e != NULL);
 
-  const cs_lnum_t  n_vertices = connect->n_vertices;
-
-  short int  *v_count = NULL;
-  BFT_MALLOC(v_count, n_vertices, short int);
-# pragma omp parallel for if (n_vertices > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_vertices; i++) v_count[i] = 0;
-
   const cs_lnum_t  n_cells = connect->n_cells;
-  const cs_lnum_t  n_edges = connect->n_edges;
   const cs_adjacency_t  *c2v = connect->c2v;
   const cs_adjacency_t  *c2e = connect->c2e;
+  const cs_adjacency_t  *c2f = connect->c2f;
   const cs_adjacency_t  *e2v = connect->e2v;
 
   assert(c2e->n_elts == n_cells);
@@ -375,111 +438,93 @@ _compute_max_ent(const cs_mesh_t      *m,
 
   int  n_max_vc = 0, n_max_ec = 0, n_max_fc = 0;
   int  n_max_v2ec = 0, n_max_v2fc = 0, n_max_vf = 0;
+  cs_lnum_t  e_max_range = 0, v_max_range = 0;
 
-  connect->e_max_cell_range = 0;
-  connect->v_max_cell_range = 0;
-
+  /* Max. number of vertices by cell (size of the thread-local buffers) */
+# pragma omp parallel for reduction(max:n_max_vc) if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-
-    /* Vertices */
-    const cs_lnum_t  *c2v_idx = c2v->idx + c_id;
-    const cs_lnum_t  *c2v_ids = c2v->ids + c2v_idx[0];
-    const int n_vc = c2v_idx[1] - c2v_idx[0];
-
-    cs_lnum_t  min_id = n_vertices, max_id = 0;
-    for (short int v = 0; v < n_vc; v++) {
-      if (c2v_ids[v] < min_id) min_id = c2v_ids[v];
-      if (c2v_ids[v] > max_id) max_id = c2v_ids[v];
-    }
-    cs_lnum_t  _range = max_id - min_id;
-
+    const int n_vc = c2v->idx[c_id+1] - c2v->idx[c_id];
     if (n_vc > n_max_vc) n_max_vc = n_vc;
-    if (connect->v_max_cell_range < _range)
-      connect->v_max_cell_range = _range;
-
-    /* Edges */
-    const cs_lnum_t  *c2e_idx = c2e->idx + c_id;
-    const cs_lnum_t  *c2e_ids = c2e->ids + c2e_idx[0];
-    const int n_ec = c2e_idx[1] - c2e_idx[0];
-
-    min_id = n_edges, max_id = 0;
-    for (short int e = 0; e < n_ec; e++) {
-      if (c2e_ids[e] < min_id) min_id = c2e_ids[e];
-      if (c2e_ids[e] > max_id) max_id = c2e_ids[e];
-    }
-    _range = max_id - min_id;
-
-    if (n_ec > n_max_ec) n_max_ec = n_ec;
-    if (connect->e_max_cell_range < _range)
-      connect->e_max_cell_range = _range;
+  }
 
-    for (short int e = 0; e < n_ec; e++) {
+# pragma omp parallel if (n_cells > CS_THR_MIN)
+  {
+    /* Counter related to each vertex of the current cell. Since the list of
+       vertices of a cell is sorted, the local id of a vertex is retrieved
+       by a binary search */
+    short int  *v_count = NULL;
+    BFT_MALLOC(v_count, n_max_vc, short int);
+    for (int v = 0; v < n_max_vc; v++) v_count[v] = 0;
+
+#   pragma omp for reduction(max:n_max_ec, n_max_fc, n_max_v2ec, n_max_v2fc, \
+                              n_max_vf, e_max_range, v_max_range)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
-      const cs_lnum_t  *e2v_ids = e2v->ids + 2*c2e_ids[e];
+      /* Vertices (sorted list) */
+      const cs_lnum_t  *c2v_idx = c2v->idx + c_id;
+      const cs_lnum_t  *c2v_ids = c2v->ids + c2v_idx[0];
+      const int n_vc = c2v_idx[1] - c2v_idx[0];
 
-      v_count[e2v_ids[0]] += 1;
-      v_count[e2v_ids[1]] += 1;
+      cs_lnum_t  _range = (n_vc > 0) ? c2v_ids[n_vc-1] - c2v_ids[0] : 0;
+      if (v_max_range < _range) v_max_range = _range;
 
-    }
+      /* Edges (sorted list) */
+      const cs_lnum_t  *c2e_idx = c2e->idx + c_id;
+      const cs_lnum_t  *c2e_ids = c2e->ids + c2e_idx[0];
+      const int n_ec = c2e_idx[1] - c2e_idx[0];
 
-    /* Update n_max_v2ec and reset v_count */
-    for (short int v = 0; v < n_vc; v++) {
+      _range = (n_ec > 0) ? c2e_ids[n_ec-1] - c2e_ids[0] : 0;
+      if (e_max_range < _range) e_max_range = _range;
 
-      const cs_lnum_t  v_id = c2v_ids[v];
-      if (v_count[v_id] > n_max_v2ec) n_max_v2ec = v_count[v_id];
-      v_count[v_id] = 0; /* reset */
+      if (n_ec > n_max_ec) n_max_ec = n_ec;
 
-    }
+      for (short int e = 0; e < n_ec; e++) {
 
-    const cs_lnum_t  *c2f_idx = connect->c2f->idx + c_id;
-    const cs_lnum_t  *c2f_ids = connect->c2f->ids + c2f_idx[0];
-    const int  n_fc = c2f_idx[1] - c2f_idx[0];
+        const cs_lnum_t  *e2v_ids = e2v->ids + 2*c2e_ids[e];
 
-    if (n_fc > n_max_fc) n_max_fc = n_fc;
+        v_count[cs_search_binary(n_vc, e2v_ids[0], c2v_ids)] += 1;
+        v_count[cs_search_binary(n_vc, e2v_ids[1], c2v_ids)] += 1;
 
-    for (short int f = 0; f < n_fc; f++) {
+      }
 
-      const cs_lnum_t  f_id = c2f_ids[f];
-      if (f_id < m->n_i_faces) { /* Interior face */
+      /* Update n_max_v2ec and reset v_count */
+      for (short int v = 0; v < n_vc; v++) {
+        if (v_count[v] > n_max_v2ec) n_max_v2ec = v_count[v];
+        v_count[v] = 0; /* reset */
+      }
 
-        const cs_lnum_t  *f2v_idx = m->i_face_vtx_idx + f_id;
-        const cs_lnum_t  *f2v_ids = m->i_face_vtx_lst + f2v_idx[0];
-        const int  n_vf = f2v_idx[1] - f2v_idx[0];
+      const cs_lnum_t  *c2f_idx = c2f->idx + c_id;
+      const cs_lnum_t  *c2f_ids = c2f->ids + c2f_idx[0];
+      const int  n_fc = c2f_idx[1] - c2f_idx[0];
 
-        if (n_vf > n_max_vf) n_max_vf = n_vf;
-        for (short int v = 0; v < n_vf; v++)
-          v_count[f2v_ids[v]] += 1;
+      if (n_fc > n_max_fc) n_max_fc = n_fc;
 
-      }
-      else { /* Border face */
+      for (short int f = 0; f < n_fc; f++) {
 
-        const cs_lnum_t  *f2v_idx =
-          m->b_face_vtx_idx + f_id - m->n_i_faces;
-        const cs_lnum_t  *f2v_ids = m->b_face_vtx_lst + f2v_idx[0];
-        const int  n_vf = f2v_idx[1] - f2v_idx[0];
+        int  n_vf;
+        const cs_lnum_t  *f2v_ids = _get_f2v(m, c2f_ids[f], &n_vf);
 
         if (n_vf > n_max_vf) n_max_vf = n_vf;
         for (short int v = 0; v < n_vf; v++)
-          v_count[f2v_ids[v]] += 1;
-
-      }
+          v_count[cs_search_binary(n_vc, f2v_ids[v], c2v_ids)] += 1;
 
-    } /* Loop on cell faces */
+      } /* Loop on cell faces */
 
-    /* Update n_max_v2fc and reset  v_count */
-    for (short int v = 0; v < n_vc; v++) {
-
-      const cs_lnum_t  v_id = c2v_ids[v];
-      if (v_count[v_id] > n_max_v2fc) n_max_v2fc = v_count[v_id];
-      v_count[v_id] = 0; /* reset */
+      /* Update n_max_v2fc and reset v_count */
+      for (short int v = 0; v < n_vc; v++) {
+        if (v_count[v] > n_max_v2fc) n_max_v2fc = v_count[v];
+        v_count[v] = 0; /* reset */
+      }
 
-    }
+    } /* Loop on cells */
 
-  } /* Loop on cells */
+    BFT_FREE(v_count);
 
-  BFT_FREE(v_count);
+  } /* OpenMP block */
 
   /* Store computed values */
+  connect->e_max_cell_range = e_max_range;
+  connect->v_max_cell_range = v_max_range;
   connect->n_max_vbyc = n_max_vc;   /* Max number of vertices for a cell */
   connect->n_max_ebyc = n_max_ec;   /* Max number of edges for a cell */
   connect->n_max_fbyc = n_max_fc;   /* Max number of faces for a cell */
@@ -632,6 +677,7 @@ _build_cell_flag(cs_cdo_connect_t   *connect,
                            is_border_vtx);
 
     const cs_adjacency_t  *c2v = connect->c2v;
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
       for (cs_lnum_t j = c2v->idx[c_id]; j < c2v->idx[c_id+1]; j++) {
         if (is_border_vtx[c2v->ids[j]] > 0)
@@ -669,6 +715,7 @@ _build_cell_flag(cs_cdo_connect_t   *connect,
                            is_border_edge);
 
     const cs_adjacency_t  *c2e = connect->c2e;
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
       for (cs_lnum_t j = c2e->idx[c_id]; j < c2e->idx[c_id+1]; j++) {
         if (is_border_edge[c2e->ids[j]] > 0)
@@ -1078,18 +1125,13 @@ cs_cdo_connect_init(cs_mesh_t      *mesh,
   /* Build the face --> cells connectivity */
   connect->f2c = cs_adjacency_transpose(n_faces, connect->c2f);
 
-  /* Build the face --> edges connectivity */
-  cs_adjacency_t  *v2v_e = cs_mesh_adjacency_v2v(mesh);
-  const cs_lnum_t  n_edges = v2v_e->idx[n_vertices];
-  connect->f2e = _build_f2e_connect(mesh, v2v_e);
+  /* Build the edges with the face --> edges and the edge --> vertices
+     connectivities */
+  _build_edge_connect(mesh, connect);
 
-  /* Build the edge --> vertices connectivity */
-  connect->e2v = _build_e2v_connect(v2v_e);
-
-  cs_adjacency_destroy(&v2v_e);
+  const cs_lnum_t  n_edges = connect->n_edges;
 
   connect->n_vertices = n_vertices;
-  connect->n_edges = n_edges;
   connect->n_g_edges = n_edges;
   connect->n_faces[CS_ALL_FACES] = n_faces;
   connect->n_faces[CS_BND_FACES] = mesh->n_b_faces;
@@ -1100,10 +1142,7 @@ cs_cdo_connect_init(cs_mesh_t      *mesh,
      Useful for accessing dual faces and dual volumes for instance */
 
   connect->c2e = cs_adjacency_compose(n_edges, connect->c2f, connect->f2e);
-  cs_adjacency_sort(connect->c2e);
-
   connect->c2v = cs_adjacency_compose(n_vertices, connect->c2e, connect->e2v);
-  cs_adjacency_sort(connect->c2v);
 
   /* Max number of entities (vertices, edges and faces) by cell */
   _compute_max_ent(mesh, connect);
@@ -1203,7 +1242,7 @@ cs_cdo_connect_init(cs_mesh_t      *mesh,
 
   /* Build the cell type for each cell */
   BFT_MALLOC(connect->cell_type, n_cells, fvm_element_t);
-# pragma omp parallel if (n_cells > CS_THR_MIN)
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
     connect->cell_type[c_id] = _get_cell_type(c_id, connect);
 
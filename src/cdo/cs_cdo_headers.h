@@ -69,6 +69,7 @@
 #include "cs_hho_stokes.h"
 #include "cs_hho_vecteq.h"
 #include "cs_hodge.h"
+#include "cs_hodge_cache.h"
 #include "cs_maxwell.h"
 #include "cs_mesh_deform.h"
 #include "cs_navsto_coupling.h"
@@ -85,6 +86,7 @@
 #include "cs_static_condensation.h"
 #include "cs_thermal_system.h"
 #include "cs_walldistance.h"
+#include "cs_xdef_cache.h"
 #include "cs_xdef_cw_eval.h"
 #include "cs_xdef_eval.h"
 #include "cs_xdef.h"
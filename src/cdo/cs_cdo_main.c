@@ -110,6 +110,14 @@ _compute_steady_user_equations(cs_domain_t   *domain)
 {
   int  n_equations = cs_equation_get_n_equations();
 
+  /* Consecutive equations which may share the same loop on cells */
+  const bool  shared_sweep = cs_equation_has_shared_cell_sweep();
+  int  n_group_eqs = 0;
+  cs_equation_t  **group_eqs = NULL;
+
+  if (shared_sweep)
+    BFT_MALLOC(group_eqs, n_equations, cs_equation_t *);
+
   for (int eq_id = 0; eq_id < n_equations; eq_id++) {
 
     cs_equation_t  *eq = cs_equation_by_id(eq_id);
@@ -120,11 +128,24 @@ _compute_steady_user_equations(cs_domain_t   *domain)
 
       if (type == CS_EQUATION_TYPE_USER) {
 
-        if (cs_equation_uses_new_mechanism(eq))
-          cs_equation_solve_steady_state(domain->mesh, eq);
+        if (cs_equation_uses_new_mechanism(eq)) {
+
+          if (shared_sweep)
+            group_eqs[n_group_eqs++] = eq;
+          else
+            cs_equation_solve_steady_state(domain->mesh, eq);
+
+        }
 
         else { /* Deprecated */
 
+          /* Solve first the previous equations to keep the same order */
+          if (n_group_eqs > 0) {
+            cs_equation_solve_group(true, false, domain->mesh,
+                                    n_group_eqs, group_eqs);
+            n_group_eqs = 0;
+          }
+
           /* Define the algebraic system */
           cs_equation_build_system(domain->mesh, eq);
 
@@ -139,6 +160,11 @@ _compute_steady_user_equations(cs_domain_t   *domain)
 
   } /* Loop on equations */
 
+  if (shared_sweep) {
+    cs_equation_solve_group(true, false, domain->mesh, n_group_eqs, group_eqs);
+    BFT_FREE(group_eqs);
+  }
+
 }
 
 /*----------------------------------------------------------------------------*/
@@ -158,6 +184,14 @@ _compute_unsteady_user_equations(cs_domain_t   *domain,
 
   if (nt_cur > 0) {
 
+    /* Consecutive equations which may share the same loop on cells */
+    const bool  shared_sweep = cs_equation_has_shared_cell_sweep();
+    int  n_group_eqs = 0;
+    cs_equation_t  **group_eqs = NULL;
+
+    if (shared_sweep)
+      BFT_MALLOC(group_eqs, n_equations, cs_equation_t *);
+
     for (int eq_id = 0; eq_id < n_equations; eq_id++) {
 
       cs_equation_t  *eq = cs_equation_by_id(eq_id);
@@ -168,13 +202,26 @@ _compute_unsteady_user_equations(cs_domain_t   *domain,
 
         if (type == CS_EQUATION_TYPE_USER) {
 
-          if (cs_equation_uses_new_mechanism(eq))
-            /* By default, a current to previous operation is
-               performed */
-            cs_equation_solve(true, domain->mesh, eq);
+          if (cs_equation_uses_new_mechanism(eq)) {
+
+            if (shared_sweep)
+              group_eqs[n_group_eqs++] = eq;
+            else
+              /* By default, a current to previous operation is
+                 performed */
+              cs_equation_solve(true, domain->mesh, eq);
+
+          }
 
           else { /* Deprecated */
 
+            /* Solve first the previous equations to keep the same order */
+            if (n_group_eqs > 0) {
+              cs_equation_solve_group(false, true, domain->mesh,
+                                      n_group_eqs, group_eqs);
+              n_group_eqs = 0;
+            }
+
             /* Define the algebraic system */
             cs_equation_build_system(domain->mesh, eq);
 
@@ -189,6 +236,12 @@ _compute_unsteady_user_equations(cs_domain_t   *domain,
 
     } /* Loop on equations */
 
+    if (shared_sweep) {
+      cs_equation_solve_group(false, true, domain->mesh,
+                              n_group_eqs, group_eqs);
+      BFT_FREE(group_eqs);
+    }
+
   } /* nt_cur > 0 */
 
 }
@@ -48,6 +48,7 @@
 #include "cs_parall.h"
 #include "cs_param_cdo.h"
 #include "cs_prototypes.h"
+#include "cs_search.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -691,6 +692,36 @@ _compute_dcell_quantities(const cs_cdo_connect_t  *topo,
 }
 
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update a cs_quant_info_t structure with the min./max. measures
+ *        of a set of entities. The characteristic length h is meas^(1/dim)
+ *
+ * \param[in]      meas_min   min. measure on the set of entities
+ * \param[in]      meas_max   max. measure on the set of entities
+ * \param[in]      dim        dimension of the entities (1, 2 or 3)
+ * \param[in, out] info       pointer to the cs_quant_info_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_quant_info(double              meas_min,
+                   double              meas_max,
+                   int                 dim,
+                   cs_quant_info_t    *info)
+{
+  if (meas_max > info->meas_max) {
+    info->meas_max = meas_max;
+    info->h_max = (dim == 3) ? cbrt(meas_max) :
+      (dim == 2) ? sqrt(meas_max) : meas_max;
+  }
+  if (meas_min < info->meas_min) {
+    info->meas_min = meas_min;
+    info->h_min = (dim == 3) ? cbrt(meas_min) :
+      (dim == 2) ? sqrt(meas_min) : meas_min;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define the cs_quant_info_t structures related to cells, faces and
@@ -707,70 +738,66 @@ _compute_quant_info(cs_cdo_quantities_t     *quant)
     return;
 
   /* Cell info */
+  double  meas_min = DBL_MAX, meas_max = -DBL_MAX;
+
+# pragma omp parallel for reduction(min:meas_min) reduction(max:meas_max) \
+  if (quant->n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
 
     const double  meas = quant->cell_vol[c_id];
 
-    if (meas > quant->cell_info.meas_max) {
-      quant->cell_info.meas_max = meas;
-      quant->cell_info.h_max = cbrt(meas);
-    }
-    if (meas < quant->cell_info.meas_min) {
-      quant->cell_info.meas_min = meas;
-      quant->cell_info.h_min = cbrt(meas);
-    }
+    if (meas > meas_max) meas_max = meas;
+    if (meas < meas_min) meas_min = meas;
 
   } /* Loop on cells */
 
+  _update_quant_info(meas_min, meas_max, 3, &(quant->cell_info));
+
   /* Face info */
+  meas_min = DBL_MAX, meas_max = -DBL_MAX;
+
+# pragma omp parallel for reduction(min:meas_min) reduction(max:meas_max) \
+  if (quant->n_i_faces > CS_THR_MIN)
   for (cs_lnum_t  f_id = 0; f_id < quant->n_i_faces; f_id++) {
 
     const cs_real_t  meas = quant->i_face_surf[f_id];
 
-    if (meas > quant->face_info.meas_max) {
-      quant->face_info.meas_max = meas;
-      quant->face_info.h_max = sqrt(meas);
-    }
-    if (meas < quant->face_info.meas_min) {
-      quant->face_info.meas_min = meas;
-      quant->face_info.h_min = sqrt(meas);
-    }
+    if (meas > meas_max) meas_max = meas;
+    if (meas < meas_min) meas_min = meas;
 
   } /* Loop on interior faces */
 
+# pragma omp parallel for reduction(min:meas_min) reduction(max:meas_max) \
+  if (quant->n_b_faces > CS_THR_MIN)
   for (cs_lnum_t  f_id = 0; f_id < quant->n_b_faces; f_id++) {
 
     const cs_real_t  meas = quant->b_face_surf[f_id];
 
-    if (meas > quant->face_info.meas_max) {
-      quant->face_info.meas_max = meas;
-      quant->face_info.h_max = sqrt(meas);
-    }
-    if (meas < quant->face_info.meas_min) {
-      quant->face_info.meas_min = meas;
-      quant->face_info.h_min = sqrt(meas);
-    }
+    if (meas > meas_max) meas_max = meas;
+    if (meas < meas_min) meas_min = meas;
 
   } /* Loop on border faces */
 
+  _update_quant_info(meas_min, meas_max, 2, &(quant->face_info));
+
   /* Edge info */
   if (quant->edge_vector != NULL) {
 
+    meas_min = DBL_MAX, meas_max = -DBL_MAX;
+
+#   pragma omp parallel for reduction(min:meas_min) reduction(max:meas_max) \
+    if (quant->n_edges > CS_THR_MIN)
     for (cs_lnum_t  e_id = 0; e_id < quant->n_edges; e_id++) {
 
       cs_nvec3_t  edge = cs_quant_set_edge_nvec(e_id, quant);
 
-      if (edge.meas > quant->edge_info.meas_max) {
-        quant->edge_info.meas_max = edge.meas;
-        quant->edge_info.h_max = edge.meas;
-      }
-      if (edge.meas < quant->edge_info.meas_min) {
-        quant->edge_info.meas_min = edge.meas;
-        quant->edge_info.h_min = edge.meas;
-      }
+      if (edge.meas > meas_max) meas_max = edge.meas;
+      if (edge.meas < meas_min) meas_min = edge.meas;
 
     } /* Loop on edges */
 
+    _update_quant_info(meas_min, meas_max, 1, &(quant->edge_info));
+
   }
 
   if (cs_glob_n_ranks > 1) { /* Synchronization across ranks */
@@ -815,6 +842,7 @@ _vtx_algorithm(const cs_cdo_connect_t      *connect,
   const cs_adjacency_t  *c2v = connect->c2v;
 
   /* Compute cell centers */
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
     const cs_lnum_t  vs = c2v->idx[c_id];
@@ -866,10 +894,13 @@ _mirtich_algorithm(const cs_mesh_t             *mesh,
   assert(connect->f2c != NULL);
   assert(connect->c2f != NULL);
 
-# pragma omp parallel for if (3*n_cells > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < 3*n_cells; i++)
-    quant->cell_centers[i] = 0.0;
+  /* Contribution of each face (computed once and then gathered cell-wise).
+     Faces of a cell are ordered by increasing ids in c2f so that the
+     summation follows the same order as a loop on faces. */
+  cs_real_t  *f_contrib = NULL;
+  BFT_MALLOC(f_contrib, 3*n_faces, cs_real_t);
 
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
   for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {   /* Loop on faces */
 
     /* Choose gamma to maximize normal according gamma (x, y, or z)
@@ -886,29 +917,40 @@ _mirtich_algorithm(const cs_mesh_t             *mesh,
                                                connect, quant->vtx_coord,
                                                fspec);
 
-    /* Update cell quantities */
-    const cs_adjacency_t  *f2c = connect->f2c;
-    for (cs_lnum_t i = f2c->idx[f_id]; i < f2c->idx[f_id+1]; i++) {
+    cs_real_t  *_contrib = f_contrib + 3*f_id;
 
-      const cs_lnum_t  c_id = f2c->ids[i];
-      const short int  sgn = f2c->sgn[i];
-
-      quant->cell_centers[3*c_id + A] += sgn * fspec.q.unitv[A] * fsubq.Fa2;
-      quant->cell_centers[3*c_id + B] += sgn * fspec.q.unitv[B] * fsubq.Fb2;
-      quant->cell_centers[3*c_id + C] += sgn * fspec.q.unitv[C] * fsubq.Fc2;
-
-    } /* End of loop on cell faces */
+    _contrib[A] = fspec.q.unitv[A] * fsubq.Fa2;
+    _contrib[B] = fspec.q.unitv[B] * fsubq.Fb2;
+    _contrib[C] = fspec.q.unitv[C] * fsubq.Fc2;
 
   } /* End of loop on faces */
 
   /* Compute cell center of gravity and total volume */
+  const cs_adjacency_t  *c2f = connect->c2f;
+
 # pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_cells; i++) {
-    const double  inv_2vol = 0.5 / quant->cell_vol[i];
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    cs_real_t  *xc = quant->cell_centers + 3*c_id;
+
+    xc[0] = xc[1] = xc[2] = 0.;
+    for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++) {
+
+      const cs_real_t  *_contrib = f_contrib + 3*c2f->ids[j];
+      const short int  sgn = c2f->sgn[j];
+
+      for (int k = 0; k < 3; k++)
+        xc[k] += sgn * _contrib[k];
+
+    } /* Loop on cell faces */
+
+    const double  inv_2vol = 0.5 / quant->cell_vol[c_id];
     for (int k = 0; k < 3; k++)
-      quant->cell_centers[3*i+k] *= inv_2vol;
-  }
+      xc[k] *= inv_2vol;
 
+  } /* Loop on cells */
+
+  BFT_FREE(f_contrib);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -1373,11 +1415,47 @@ cs_cdo_quantities_compute_dual_volumes(const cs_cdo_quantities_t   *cdoq,
 
   assert(cdoq != NULL && c2v != NULL);
 
-  memset(dual_vol, 0, cdoq->n_vertices*sizeof(cs_real_t));
+  const cs_lnum_t  n_vertices = cdoq->n_vertices;
+
+  if (cs_glob_n_threads > 1 && n_vertices > CS_THR_MIN) {
+
+    /* Gather the contributions of the cells sharing each vertex. Cells are
+       scanned by increasing ids (as in the sequential scatter) so that the
+       result does not depend on the number of threads. */
+    cs_adjacency_t  *v2c = cs_adjacency_transpose(n_vertices, c2v);
 
-  for (cs_lnum_t c_id = 0; c_id < cdoq->n_cells; c_id++)
-    for (cs_lnum_t j = c2v->idx[c_id]; j < c2v->idx[c_id+1]; j++)
-      dual_vol[c2v->ids[j]] += cdoq->dcell_vol[j];
+#   pragma omp parallel for
+    for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
+
+      cs_real_t  _vol = 0.;
+      for (cs_lnum_t i = v2c->idx[v_id]; i < v2c->idx[v_id+1]; i++) {
+
+        const cs_lnum_t  c_id = v2c->ids[i];
+        const cs_lnum_t  s = c2v->idx[c_id];
+        const int  pos = cs_search_binary(c2v->idx[c_id+1] - s,
+                                          v_id,
+                                          c2v->ids + s);
+
+        assert(pos > -1);
+        _vol += cdoq->dcell_vol[s + pos];
+
+      }
+      dual_vol[v_id] = _vol;
+
+    } /* Loop on vertices */
+
+    cs_adjacency_destroy(&v2c);
+
+  }
+  else {
+
+    memset(dual_vol, 0, n_vertices*sizeof(cs_real_t));
+
+    for (cs_lnum_t c_id = 0; c_id < cdoq->n_cells; c_id++)
+      for (cs_lnum_t j = c2v->idx[c_id]; j < c2v->idx[c_id+1]; j++)
+        dual_vol[c2v->ids[j]] += cdoq->dcell_vol[j];
+
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -817,7 +817,7 @@ _assembly_by_blocks(const cs_cell_sys_t            *csys,
       cs_matrix_assembler_values_t   *mav = sc->mav_structures[3*i+j];
       cs_sdm_t  *m_ij = cs_sdm_get_block(cw_mat, i, j);
 
-      sc->elemental_assembly(m_ij, cm->f_ids, rs, eqa, mav);
+      sc->elemental_assembly(m_ij, cm->c_id, cm->f_ids, rs, eqa, mav);
 
     } /* Loop on blocks (j) */
   } /* Loop on blocks (i) */
@@ -1786,6 +1786,7 @@ cs_cdofb_monolithic_init_common(const cs_navsto_param_t       *nsp,
     }
     break;
 
+  case CS_NAVSTO_SLES_BLOCK_FGMRES:
   case CS_NAVSTO_SLES_GKB_SATURNE:
   case CS_NAVSTO_SLES_UZAWA_AL:
     cs_shared_range_set = connect->range_sets[CS_CDO_CONNECT_FACE_VP0];
@@ -1981,6 +1982,23 @@ cs_cdofb_monolithic_init_scheme_context(const cs_navsto_param_t   *nsp,
                cs_real_t);
     break;
 
+  case CS_NAVSTO_SLES_BLOCK_FGMRES:
+    sc->init_system = _init_system_default;
+    sc->solve = cs_cdofb_monolithic_block_fgmres_solve;
+    sc->assemble = _velocity_full_assembly;
+    sc->elemental_assembly = cs_equation_assemble_set(CS_SPACE_SCHEME_CDOFB,
+                                                      CS_CDO_CONNECT_FACE_VP0);
+
+    BFT_MALLOC(sc->mav_structures, 1, cs_matrix_assembler_values_t *);
+
+    msles->graddiv_coef = nsp->gd_scale_coef;
+    msles->n_row_blocks = 1;
+    BFT_MALLOC(msles->block_matrices, 1, cs_matrix_t *);
+    BFT_MALLOC(msles->div_op,
+               3*cs_shared_connect->c2f->idx[cs_shared_quant->n_cells],
+               cs_real_t);
+    break;
+
   case CS_NAVSTO_SLES_GKB_SATURNE:
     sc->init_system = _init_system_default;
     sc->solve = cs_cdofb_monolithic_gkb_solve;
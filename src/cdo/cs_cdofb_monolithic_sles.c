@@ -65,6 +65,7 @@
 #include "cs_navsto_coupling.h"
 #include "cs_parall.h"
 #include "cs_sles.h"
+#include "cs_time_step.h"
 #include "cs_timer.h"
 
 #if defined(DEBUG) && !defined(NDEBUG)
@@ -113,6 +114,14 @@ BEGIN_C_DECLS
 
 #define CS_GKB_TRUNCATION_THRESHOLD       5
 
+/* In-house block-preconditioned FGMRES: size of the Krylov space before a
+   restart and reduction of the residual requested for the approximate
+   resolution of each diagonal block inside the preconditioner */
+
+#define CS_FGMRES_RESTART                 30
+#define CS_FGMRES_BLOCK_RTOL              1e-2
+#define CS_FGMRES_SCHUR_MAX_ITER          50
+
 /* Block size for superblock algorithm */
 
 #define CS_SBLOCK_BLOCK_SIZE 60
@@ -196,6 +205,57 @@ typedef struct {
 
 } cs_uza_builder_t;
 
+/* Structure used in the in-house flexible GMRES algorithm with an upper block
+ * triangular preconditioner. The velocity unknowns are stored in the
+ * "gathered" numbering (i.e. only the DoFs owned by the local rank are
+ * considered) followed by the pressure unknowns so that a dot product only
+ * requires a global sum.
+ */
+
+typedef struct {
+
+  /* Value of the grad-div coefficient */
+  cs_real_t               gamma;
+
+  /* Size of spaces */
+  cs_lnum_t               n_u_dofs;   /* Number of owned velocity DoFs */
+  cs_lnum_t               n_p_dofs;   /* Number of pressure DoFs */
+  cs_lnum_t               n_dofs;     /* n_u_dofs + n_p_dofs */
+  cs_lnum_t               n_u_cols;   /* Number of columns of A_{00} */
+
+  /* Approximation of the Schur complement */
+  cs_navsto_schur_approx_t  schur_type;
+  cs_real_t              *inv_s;    /* Diagonal part of the approximation of
+                                       -S^-1 or NULL */
+  cs_real_t              *inv_da;   /* Inverse of the diagonal velocity
+                                       operator D in the pressure Laplacian
+                                       B.D^-1.B^t (scattered) or NULL */
+  cs_real_t              *inv_dl;   /* Inverse of the diagonal of B.D^-1.B^t
+                                       or NULL */
+
+  /* Krylov spaces */
+  int                     restart;
+  cs_real_t              *v;        /* (restart+1) basis vectors */
+  cs_real_t              *z;        /* restart preconditioned vectors */
+  cs_real_t              *h;        /* Hessenberg matrix */
+  cs_real_t              *g;        /* Rotated residual norms */
+  cs_real_t              *cs;       /* Cosines of the Givens rotations */
+  cs_real_t              *sn;       /* Sines of the Givens rotations */
+
+  /* Auxiliary vectors */
+  cs_real_t              *b;        /* Right-hand side */
+  cs_real_t              *x;        /* Solution */
+  cs_real_t              *w;        /* buffer in the full space */
+  cs_real_t              *u_scat;   /* buffer in space M (scattered) */
+  cs_real_t              *u_col1;   /* buffer of size n_u_cols */
+  cs_real_t              *u_col2;   /* buffer of size n_u_cols */
+  cs_real_t              *p_buf;    /* 4 buffers in space N */
+
+  cs_iter_algo_info_t    *info;     /* Information related to the convergence
+                                       of the algorithm */
+
+} cs_fgmres_builder_t;
+
 /*============================================================================
  * Private variables
  *============================================================================*/
@@ -1448,6 +1508,254 @@ _free_uza_builder(cs_uza_builder_t   **p_uza)
   *p_uza = NULL;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Initialize and allocate a builder structure for the in-house
+ *         block-preconditioned flexible GMRES algorithm
+ *
+ * \param[in]  nsp        pointer to a cs_navsto_param_t structure
+ * \param[in]  eqp        pointer to the momentum cs_equation_param_t
+ * \param[in]  matrix     pointer to the matrix related to the velocity block
+ * \param[in]  div_op     pointer to the values of divergence operator
+ * \param[in]  gamma      value of the grad-div coefficient
+ * \param[in]  n_p_dofs   number of pressure DoFs
+ * \param[in]  quant      pointer to additional mesh quantities
+ *
+ * \return a pointer to a new allocated FGMRES builder
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_fgmres_builder_t *
+_init_fgmres_builder(const cs_navsto_param_t      *nsp,
+                     const cs_equation_param_t    *eqp,
+                     const cs_matrix_t            *matrix,
+                     const cs_real_t              *div_op,
+                     cs_real_t                     gamma,
+                     cs_lnum_t                     n_p_dofs,
+                     const cs_cdo_quantities_t    *quant)
+{
+  const cs_range_set_t  *rset = cs_shared_range_set;
+  const cs_adjacency_t  *c2f = cs_shared_connect->c2f;
+  const cs_navsto_param_sles_t  nslesp = nsp->sles_param;
+
+  cs_fgmres_builder_t  *fgm = NULL;
+
+  BFT_MALLOC(fgm, 1, cs_fgmres_builder_t);
+
+  fgm->gamma = gamma;
+  fgm->n_u_dofs = rset->n_elts[0];
+  fgm->n_p_dofs = n_p_dofs;
+  fgm->n_dofs = fgm->n_u_dofs + n_p_dofs;
+  fgm->n_u_cols = cs_matrix_get_n_columns(matrix);
+
+  const cs_lnum_t  n_dofs = fgm->n_dofs;
+  const cs_lnum_t  n_u_scat = rset->n_elts[1];
+
+  /* Krylov spaces */
+  const int  m = CS_FGMRES_RESTART;
+
+  fgm->restart = m;
+  BFT_MALLOC(fgm->v, (m+1)*n_dofs, cs_real_t);
+  BFT_MALLOC(fgm->z, m*n_dofs, cs_real_t);
+  BFT_MALLOC(fgm->h, (m+1)*m, cs_real_t);
+  BFT_MALLOC(fgm->g, m+1, cs_real_t);
+  BFT_MALLOC(fgm->cs, m, cs_real_t);
+  BFT_MALLOC(fgm->sn, m, cs_real_t);
+
+  /* Auxiliary vectors */
+  BFT_MALLOC(fgm->b, n_dofs, cs_real_t);
+  BFT_MALLOC(fgm->x, n_dofs, cs_real_t);
+  BFT_MALLOC(fgm->w, n_dofs, cs_real_t);
+  BFT_MALLOC(fgm->u_scat, n_u_scat, cs_real_t);
+  BFT_MALLOC(fgm->u_col1, fgm->n_u_cols, cs_real_t);
+  BFT_MALLOC(fgm->u_col2, fgm->n_u_cols, cs_real_t);
+  BFT_MALLOC(fgm->p_buf, 4*n_p_dofs, cs_real_t);
+
+  /* Approximation of the Schur complement */
+  fgm->schur_type = nslesp.schur_approximation;
+  fgm->inv_s = NULL;
+  fgm->inv_da = NULL;
+  fgm->inv_dl = NULL;
+
+  switch (fgm->schur_type) {
+
+  case CS_NAVSTO_SCHUR_DIAG_INVERSE:
+    {
+      /* -S^-1 is approximated by (B.diag(A)^-1.B^t)^-1 */
+      const cs_real_t  *diag = cs_matrix_get_diagonal(matrix);
+
+      BFT_MALLOC(fgm->inv_da, n_u_scat, cs_real_t);
+      memcpy(fgm->inv_da, diag, fgm->n_u_dofs*sizeof(cs_real_t));
+
+      if (cs_glob_n_ranks > 1)
+        cs_range_set_scatter(rset,
+                             CS_REAL_TYPE, 1, /* type and stride */
+                             fgm->inv_da, fgm->inv_da);
+
+#     pragma omp parallel for if (n_u_scat > CS_THR_MIN)
+      for (cs_lnum_t iu = 0; iu < n_u_scat; iu++)
+        fgm->inv_da[iu] = 1./fgm->inv_da[iu];
+    }
+    break;
+
+  default: /* CS_NAVSTO_SCHUR_MASS_SCALED */
+    {
+      /* -S^-1 is approximated by (nu + gamma).Mp^-1 for a steady system and
+         by the Cahouet-Chabard combination (nu + gamma).Mp^-1 + rho/dt.Lp^-1
+         for an unsteady one, where Lp = B.Mu^-1.B^t is the pressure
+         Laplacian built with the lumped velocity mass matrix Mu. The
+         properties are only used to scale the preconditioner so that the
+         current time is accurate enough for their evaluation. The time
+         term is approximated by an implicit Euler scheme. */
+      const cs_real_t  t_eval = cs_glob_time_step->t_cur;
+      const cs_property_t  *visc = nsp->lami_viscosity;
+
+      BFT_MALLOC(fgm->inv_s, n_p_dofs, cs_real_t);
+
+      if (cs_property_is_uniform(visc)) {
+
+        const cs_real_t  nu = cs_property_get_cell_value(0, t_eval, visc);
+
+#       pragma omp parallel for if (n_p_dofs > CS_THR_MIN)
+        for (cs_lnum_t ip = 0; ip < n_p_dofs; ip++)
+          fgm->inv_s[ip] = (nu + gamma)/quant->cell_vol[ip];
+
+      }
+      else {
+
+        cs_property_eval_at_cells(t_eval, visc, fgm->inv_s);
+
+#       pragma omp parallel for if (n_p_dofs > CS_THR_MIN)
+        for (cs_lnum_t ip = 0; ip < n_p_dofs; ip++)
+          fgm->inv_s[ip] = (fgm->inv_s[ip] + gamma)/quant->cell_vol[ip];
+
+      }
+
+      if (cs_equation_param_has_time(eqp)) {
+
+        /* Inverse of (rho/dt).Mu, where the lumped velocity mass of a face
+           gathers the portions of volume of its adjacent cells */
+        const cs_real_t  inv_dt = 1./cs_glob_time_step->dt[0];
+        const cs_property_t  *rho = nsp->mass_density;
+
+        cs_real_t  *rho_c = fgm->p_buf;
+        if (cs_property_is_uniform(rho)) {
+          const cs_real_t  rho0 = cs_property_get_cell_value(0, t_eval, rho);
+#         pragma omp parallel for if (n_p_dofs > CS_THR_MIN)
+          for (cs_lnum_t ip = 0; ip < n_p_dofs; ip++)
+            rho_c[ip] = rho0;
+        }
+        else
+          cs_property_eval_at_cells(t_eval, rho, rho_c);
+
+        cs_real_t  *pvol_fc = NULL;
+        cs_cdo_quantities_compute_pvol_fc(quant, c2f, &pvol_fc);
+
+        BFT_MALLOC(fgm->inv_da, n_u_scat, cs_real_t);
+        memset(fgm->inv_da, 0, n_u_scat*sizeof(cs_real_t));
+
+#       pragma omp parallel for if (n_p_dofs > CS_THR_MIN)
+        for (cs_lnum_t c_id = 0; c_id < n_p_dofs; c_id++) {
+          const cs_real_t  rho_dt = rho_c[c_id]*inv_dt;
+          for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++) {
+            const cs_real_t  m_fc = rho_dt*pvol_fc[j];
+            cs_real_t  *_m_f = fgm->inv_da + 3*c2f->ids[j];
+            for (int k = 0; k < 3; k++) {
+#             pragma omp atomic
+              _m_f[k] += m_fc;
+            }
+          }
+        }
+
+        BFT_FREE(pvol_fc);
+
+        if (cs_glob_n_ranks > 1)
+          cs_interface_set_sum(rset->ifs,
+                               n_u_scat,
+                               1, false, CS_REAL_TYPE, /* stride, interlaced */
+                               fgm->inv_da);
+
+#       pragma omp parallel for if (n_u_scat > CS_THR_MIN)
+        for (cs_lnum_t iu = 0; iu < n_u_scat; iu++)
+          fgm->inv_da[iu] = 1./fgm->inv_da[iu];
+
+      }
+    }
+    break;
+
+  } /* Switch on the type of Schur approximation */
+
+  if (fgm->inv_da != NULL) {
+
+    /* Inverse of the diagonal of B.D^-1.B^t (Jacobi preconditioner) */
+    BFT_MALLOC(fgm->inv_dl, n_p_dofs, cs_real_t);
+
+#   pragma omp parallel for if (n_p_dofs > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_p_dofs; c_id++) {
+
+      cs_real_t  d_c = 0;
+      for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++) {
+        const cs_real_t  *_div = div_op + 3*j;
+        const cs_real_t  *_inv_da = fgm->inv_da + 3*c2f->ids[j];
+        for (int k = 0; k < 3; k++)
+          d_c += _div[k]*_div[k]*_inv_da[k];
+      }
+      fgm->inv_dl[c_id] = (d_c > 0) ? 1./d_c : 0.;
+
+    } /* Loop on cells */
+
+  }
+
+  fgm->info = cs_iter_algo_define(nslesp.il_algo_verbosity,
+                                  nslesp.n_max_il_algo_iter,
+                                  nslesp.il_algo_atol,
+                                  nslesp.il_algo_rtol,
+                                  nslesp.il_algo_dtol);
+
+  return fgm;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a FGMRES builder structure
+ *
+ * \param[in, out]  p_fgm   double pointer to a FGMRES builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_fgmres_builder(cs_fgmres_builder_t   **p_fgm)
+{
+  cs_fgmres_builder_t  *fgm = *p_fgm;
+
+  if (fgm == NULL)
+    return;
+
+  BFT_FREE(fgm->inv_s);
+  BFT_FREE(fgm->inv_da);
+  BFT_FREE(fgm->inv_dl);
+
+  BFT_FREE(fgm->v);
+  BFT_FREE(fgm->z);
+  BFT_FREE(fgm->h);
+  BFT_FREE(fgm->g);
+  BFT_FREE(fgm->cs);
+  BFT_FREE(fgm->sn);
+
+  BFT_FREE(fgm->b);
+  BFT_FREE(fgm->x);
+  BFT_FREE(fgm->w);
+  BFT_FREE(fgm->u_scat);
+  BFT_FREE(fgm->u_col1);
+  BFT_FREE(fgm->u_col2);
+  BFT_FREE(fgm->p_buf);
+
+  BFT_FREE(fgm->info);
+
+  BFT_FREE(fgm);
+  *p_fgm = NULL;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Apply the divergence operator and store the result in div_v
@@ -1943,6 +2251,362 @@ _uza_incr_cvg_test(cs_real_t                   delta_u_l2,
     return false;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply the gradient operator (transpose of the divergence operator)
+ *         to a pressure array. The result is stored in fgm->u_scat in the
+ *         "gathered" numbering
+ *
+ * \param[in]      div_op  pointer to the values of divergence operator
+ * \param[in]      q       vector to apply in pressure space
+ * \param[in, out] fgm     pointer to a FGMRES builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_fgmres_gather_gradient(const cs_real_t         *div_op,
+                        const cs_real_t         *q,
+                        cs_fgmres_builder_t     *fgm)
+{
+  const cs_range_set_t  *rset = cs_shared_range_set;
+
+  _apply_div_op_transpose(div_op, q, fgm->u_scat);
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_interface_set_sum(rset->ifs,
+                         rset->n_elts[1],
+                         1, false, CS_REAL_TYPE, /* stride, interlaced */
+                         fgm->u_scat);
+
+    cs_range_set_gather(rset,
+                        CS_REAL_TYPE, 1, /* type and stride */
+                        fgm->u_scat, fgm->u_scat);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply the divergence operator to a velocity array given in the
+ *         "gathered" numbering
+ *
+ * \param[in]      div_op  pointer to the values of divergence operator
+ * \param[in]      u       vector to apply in velocity space (gathered)
+ * \param[in, out] div_u   resulting vector in pressure space
+ * \param[in, out] fgm     pointer to a FGMRES builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_fgmres_apply_div_op(const cs_real_t         *div_op,
+                     const cs_real_t         *u,
+                     cs_real_t               *div_u,
+                     cs_fgmres_builder_t     *fgm)
+{
+  const cs_range_set_t  *rset = cs_shared_range_set;
+
+  memcpy(fgm->u_scat, u, fgm->n_u_dofs*sizeof(cs_real_t));
+
+  if (cs_glob_n_ranks > 1)
+    cs_range_set_scatter(rset,
+                         CS_REAL_TYPE, 1, /* type and stride */
+                         fgm->u_scat, fgm->u_scat);
+
+  _apply_div_op(div_op, fgm->u_scat, div_u);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply the saddle-point operator: y = [A B^t; B 0].x
+ *
+ * \param[in]      matrix  pointer to the matrix related to the velocity block
+ * \param[in]      div_op  pointer to the values of divergence operator
+ * \param[in]      x       vector to apply (velocity then pressure)
+ * \param[in, out] y       resulting vector (velocity then pressure)
+ * \param[in, out] fgm     pointer to a FGMRES builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_fgmres_matvec(const cs_matrix_t       *matrix,
+               const cs_real_t         *div_op,
+               const cs_real_t         *x,
+               cs_real_t               *y,
+               cs_fgmres_builder_t     *fgm)
+{
+  const cs_lnum_t  n_u = fgm->n_u_dofs;
+
+  /* Velocity block: y_u = A.x_u + B^t.x_p */
+  memcpy(fgm->u_col1, x, n_u*sizeof(cs_real_t));
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_IGNORE,
+                            matrix, fgm->u_col1, fgm->u_col2);
+
+  _fgmres_gather_gradient(div_op, x + n_u, fgm);
+
+# pragma omp parallel for if (n_u > CS_THR_MIN)
+  for (cs_lnum_t iu = 0; iu < n_u; iu++)
+    y[iu] = fgm->u_col2[iu] + fgm->u_scat[iu];
+
+  /* Pressure block: y_p = B.x_u */
+  _fgmres_apply_div_op(div_op, x, y + n_u, fgm);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply the scaled pressure Laplacian: lq = B.D^-1.B^t.q
+ *
+ * \param[in]      div_op  pointer to the values of divergence operator
+ * \param[in]      q       vector to apply in pressure space
+ * \param[in, out] lq      resulting vector in pressure space
+ * \param[in, out] fgm     pointer to a FGMRES builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_fgmres_apply_schur_laplacian(const cs_real_t         *div_op,
+                              const cs_real_t         *q,
+                              cs_real_t               *lq,
+                              cs_fgmres_builder_t     *fgm)
+{
+  const cs_range_set_t  *rset = cs_shared_range_set;
+  const cs_lnum_t  n_u_scat = rset->n_elts[1];
+
+  _apply_div_op_transpose(div_op, q, fgm->u_scat);
+
+  if (cs_glob_n_ranks > 1)
+    cs_interface_set_sum(rset->ifs,
+                         n_u_scat,
+                         1, false, CS_REAL_TYPE, /* stride, interlaced */
+                         fgm->u_scat);
+
+# pragma omp parallel for if (n_u_scat > CS_THR_MIN)
+  for (cs_lnum_t iu = 0; iu < n_u_scat; iu++)
+    fgm->u_scat[iu] *= fgm->inv_da[iu];
+
+  _apply_div_op(div_op, fgm->u_scat, lq);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Approximately solve B.D^-1.B^t.y = r with a conjugate
+ *         gradient preconditioned by a Jacobi algorithm
+ *
+ * \param[in]      div_op  pointer to the values of divergence operator
+ * \param[in]      r       right-hand side in pressure space
+ * \param[in, out] y       solution in pressure space
+ * \param[in, out] fgm     pointer to a FGMRES builder structure
+ *
+ * \return the number of iterations
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_fgmres_schur_solve(const cs_real_t         *div_op,
+                    const cs_real_t         *r,
+                    cs_real_t               *y,
+                    cs_fgmres_builder_t     *fgm)
+{
+  const cs_lnum_t  n_p = fgm->n_p_dofs;
+  const cs_real_t  *inv_d = fgm->inv_dl;
+
+  cs_real_t  *res = fgm->p_buf;
+  cs_real_t  *zr = fgm->p_buf + n_p;
+  cs_real_t  *dir = fgm->p_buf + 2*n_p;
+  cs_real_t  *ldir = fgm->p_buf + 3*n_p;
+
+  memset(y, 0, n_p*sizeof(cs_real_t));
+  memcpy(res, r, n_p*sizeof(cs_real_t));
+
+  const double  r_norm2 = cs_gdot(n_p, res, res);
+  if (r_norm2 < DBL_MIN)
+    return 0;
+
+  const double  tol2 = CS_FGMRES_BLOCK_RTOL*CS_FGMRES_BLOCK_RTOL * r_norm2;
+
+# pragma omp parallel for if (n_p > CS_THR_MIN)
+  for (cs_lnum_t ip = 0; ip < n_p; ip++) {
+    zr[ip] = inv_d[ip]*res[ip];
+    dir[ip] = zr[ip];
+  }
+
+  double  rho = cs_gdot(n_p, res, zr);
+  int  n_iter = 0;
+
+  while (n_iter < CS_FGMRES_SCHUR_MAX_ITER) {
+
+    _fgmres_apply_schur_laplacian(div_op, dir, ldir, fgm);
+
+    const double  dld = cs_gdot(n_p, dir, ldir);
+    if (dld < DBL_MIN)
+      break;
+
+    const double  alpha = rho/dld;
+
+#   pragma omp parallel for if (n_p > CS_THR_MIN)
+    for (cs_lnum_t ip = 0; ip < n_p; ip++) {
+      y[ip] += alpha*dir[ip];
+      res[ip] -= alpha*ldir[ip];
+    }
+
+    n_iter++;
+
+    if (cs_gdot(n_p, res, res) < tol2)
+      break;
+
+#   pragma omp parallel for if (n_p > CS_THR_MIN)
+    for (cs_lnum_t ip = 0; ip < n_p; ip++)
+      zr[ip] = inv_d[ip]*res[ip];
+
+    const double  rho_next = cs_gdot(n_p, res, zr);
+    const double  beta = rho_next/rho;
+    rho = rho_next;
+
+#   pragma omp parallel for if (n_p > CS_THR_MIN)
+    for (cs_lnum_t ip = 0; ip < n_p; ip++)
+      dir[ip] = zr[ip] + beta*dir[ip];
+
+  } /* CG iterations */
+
+  return n_iter;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply the upper block triangular preconditioner
+ *         z = [A B^t; 0 S]^-1.r where the Schur complement S = -B.A^-1.B^t is
+ *         approximated and the velocity block is approximately inverted
+ *
+ * \param[in]      matrix  pointer to the matrix related to the velocity block
+ * \param[in]      div_op  pointer to the values of divergence operator
+ * \param[in]      sles    pointer to the SLES related to the velocity block
+ * \param[in]      r       vector to precondition (velocity then pressure)
+ * \param[in, out] z       resulting vector (velocity then pressure)
+ * \param[in, out] fgm     pointer to a FGMRES builder structure
+ *
+ * \return the number of iterations of the inner solvers
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_fgmres_precond(const cs_matrix_t       *matrix,
+                const cs_real_t         *div_op,
+                cs_sles_t               *sles,
+                const cs_real_t         *r,
+                cs_real_t               *z,
+                cs_fgmres_builder_t     *fgm)
+{
+  const cs_lnum_t  n_u = fgm->n_u_dofs;
+  const cs_lnum_t  n_p = fgm->n_p_dofs;
+  const cs_real_t  *r_p = r + n_u;
+
+  cs_real_t  *z_p = z + n_u;
+  int  n_iter = 0;
+
+  /* Pressure block: z_p = S^-1.r_p with -S^-1 approximated by
+     (B.D^-1.B^t)^-1 and/or a diagonal part */
+  if (fgm->inv_dl != NULL)
+    n_iter += _fgmres_schur_solve(div_op, r_p, z_p, fgm);
+  else
+    memset(z_p, 0, n_p*sizeof(cs_real_t));
+
+  if (fgm->inv_s != NULL) {
+
+#   pragma omp parallel for if (n_p > CS_THR_MIN)
+    for (cs_lnum_t ip = 0; ip < n_p; ip++)
+      z_p[ip] = -(z_p[ip] + fgm->inv_s[ip]*r_p[ip]);
+
+  }
+  else {
+
+#   pragma omp parallel for if (n_p > CS_THR_MIN)
+    for (cs_lnum_t ip = 0; ip < n_p; ip++)
+      z_p[ip] *= -1;
+
+  }
+
+  /* Velocity block: A.z_u = r_u - B^t.z_p */
+  _fgmres_gather_gradient(div_op, z_p, fgm);
+
+  cs_real_t  *rhs = fgm->u_col2;
+  cs_real_t  *z_u = fgm->u_col1;
+
+# pragma omp parallel for if (n_u > CS_THR_MIN)
+  for (cs_lnum_t iu = 0; iu < n_u; iu++)
+    rhs[iu] = r[iu] - fgm->u_scat[iu];
+
+  memset(z_u, 0, fgm->n_u_cols*sizeof(cs_real_t));
+
+  const double  r_norm = sqrt(cs_gdot(n_u, rhs, rhs));
+
+  if (r_norm > 0) {
+
+    int  n_u_iter = 0;
+    double  residual = DBL_MAX;
+
+    cs_sles_solve(sles,
+                  matrix,
+                  CS_HALO_ROTATION_IGNORE,
+                  CS_FGMRES_BLOCK_RTOL,
+                  r_norm,
+                  &n_u_iter,
+                  &residual,
+                  rhs,
+                  z_u,
+                  0,      /* aux. size */
+                  NULL);  /* aux. buffers */
+
+    n_iter += n_u_iter;
+
+  }
+
+  memcpy(z, z_u, n_u*sizeof(cs_real_t));
+
+  return n_iter;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update the convergence status of the in-house FGMRES algorithm
+ *
+ * \param[in]      res     current (estimated) norm of the residual
+ * \param[in, out] fgm     pointer to a FGMRES builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_fgmres_cvg_test(cs_real_t                  res,
+                 cs_fgmres_builder_t       *fgm)
+{
+  cs_iter_algo_info_t  *info = fgm->info;
+
+  /* Increment the number of algo. iterations */
+  info->n_algo_iter += 1;
+
+  const cs_real_t  prev_res = info->res;
+  info->res = res;
+
+  /* Set the convergence status */
+  if (info->res < info->tol)
+    info->cvg = CS_SLES_CONVERGED;
+
+  else if (info->n_algo_iter >= info->n_max_algo_iter)
+    info->cvg = CS_SLES_MAX_ITERATION;
+
+  else if (info->res > info->dtol * prev_res)
+    info->cvg = CS_SLES_DIVERGED;
+
+  else
+    info->cvg = CS_SLES_ITERATING;
+
+  if (info->verbosity > 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  "### FGMRES.It%02d-- %5.3e %5d %6d cvg:%d\n",
+                  info->n_algo_iter, info->res,
+                  info->last_inner_iter, info->n_inner_iter,
+                  info->cvg);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -2158,6 +2822,24 @@ cs_cdofb_monolithic_set_sles(cs_navsto_param_t    *nsp,
     cs_equation_param_set_sles(mom_eqp);
     break;
 
+  case CS_NAVSTO_SLES_BLOCK_FGMRES:
+    /* The velocity block is approximately solved with the in-house multigrid
+     * used as a preconditioner. A linear preconditioner (V-cycle) is needed
+     * by GMRES when the velocity block is not symmetric */
+    mom_slesp->solver_class = CS_PARAM_SLES_CLASS_CS;
+    mom_slesp->precond = CS_PARAM_PRECOND_AMG;
+    if (nsp->model & CS_NAVSTO_MODEL_STOKES) {
+      mom_slesp->solver = CS_PARAM_ITSOL_FCG;
+      if (mom_slesp->amg_type != CS_PARAM_AMG_HOUSE_V)
+        mom_slesp->amg_type = CS_PARAM_AMG_HOUSE_K;
+    }
+    else {
+      mom_slesp->solver = CS_PARAM_ITSOL_GMRES;
+      mom_slesp->amg_type = CS_PARAM_AMG_HOUSE_V;
+    }
+    cs_equation_param_set_sles(mom_eqp);
+    break;
+
   case CS_NAVSTO_SLES_GKB_SATURNE:
      /* Set solver and preconditioner for solving M = A + zeta * Bt*N^-1*B
       * Notice that zeta can be equal to 0 */
@@ -2971,6 +3653,255 @@ cs_cdofb_monolithic_uzawa_al_incr_solve(const cs_navsto_param_t       *nsp,
   return  n_inner_iter;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Use an in-house flexible GMRES algorithm with an upper block
+ *         triangular preconditioner to solve the saddle-point problem arising
+ *         from CDO-Fb schemes for Stokes, Oseen and Navier-Stokes with a
+ *         monolithic coupling. The velocity block is approximately solved
+ *         with the SLES of the momentum equation (in-house multigrid) and the
+ *         Schur complement is approximated according to the setting
+ *         \ref cs_navsto_param_sles_t.schur_approximation
+ *
+ * \param[in]      nsp      pointer to a cs_navsto_param_t structure
+ * \param[in]      eqp      pointer to a cs_equation_param_t structure
+ * \param[in, out] msles    pointer to a cs_cdofb_monolithic_sles_t structure
+ *
+ * \return the cumulated number of iterations of the solver
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_cdofb_monolithic_block_fgmres_solve(const cs_navsto_param_t       *nsp,
+                                       const cs_equation_param_t     *eqp,
+                                       cs_cdofb_monolithic_sles_t    *msles)
+{
+  /* Sanity checks */
+  assert(nsp != NULL &&
+         nsp->sles_param.strategy == CS_NAVSTO_SLES_BLOCK_FGMRES);
+  assert(cs_shared_range_set != NULL);
+
+  const cs_range_set_t  *rset = cs_shared_range_set;
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_matrix_t  *matrix = msles->block_matrices[0];
+  const cs_real_t  gamma = msles->graddiv_coef;
+  const cs_real_t  *div_op = msles->div_op;
+
+  cs_real_t  *u_f = msles->u_f;
+  cs_real_t  *p_c = msles->p_c;
+  cs_real_t  *b_f = msles->b_f;
+  cs_real_t  *b_c = msles->b_c;
+
+  /* Allocate and initialize the FGMRES builder structure */
+  cs_fgmres_builder_t  *fgm = _init_fgmres_builder(nsp,
+                                                   eqp,
+                                                   matrix,
+                                                   div_op,
+                                                   gamma,
+                                                   msles->n_cells,
+                                                   quant);
+
+  const cs_lnum_t  n_u = fgm->n_u_dofs;
+  const cs_lnum_t  n_p = fgm->n_p_dofs;
+  const cs_lnum_t  n = fgm->n_dofs;
+  const cs_lnum_t  n_u_scat = rset->n_elts[1];
+  const int  m = fgm->restart;
+
+  cs_iter_algo_info_t  *info = fgm->info;
+  cs_real_t  *h = fgm->h, *g = fgm->g, *cs = fgm->cs, *sn = fgm->sn;
+  cs_real_t  *x = fgm->x;
+
+  /* Transformation of the initial right-hand side (the system is solved in
+   * the "gathered" numbering): b_tilda = b_f + gamma*Dt.W^-1.b_c */
+  if (cs_glob_n_ranks > 1)
+    cs_interface_set_sum(rset->ifs,
+                         n_u_scat,
+                         1, false, CS_REAL_TYPE, /* stride, interlaced */
+                         b_f);
+
+  if (gamma > 0) {
+
+    cs_real_t  *btilda_c = fgm->p_buf;
+#   pragma omp parallel for if (n_p > CS_THR_MIN)
+    for (cs_lnum_t ip = 0; ip < n_p; ip++)
+      btilda_c[ip] = b_c[ip]/quant->cell_vol[ip];
+
+    _fgmres_gather_gradient(div_op, btilda_c, fgm);
+
+#   pragma omp parallel for if (n_u > CS_THR_MIN)
+    for (cs_lnum_t iu = 0; iu < n_u; iu++)
+      fgm->b[iu] = gamma*fgm->u_scat[iu];
+
+  }
+  else
+    memset(fgm->b, 0, n_u*sizeof(cs_real_t));
+
+  memcpy(fgm->u_scat, b_f, n_u_scat*sizeof(cs_real_t));
+  if (cs_glob_n_ranks > 1)
+    cs_range_set_gather(rset,
+                        CS_REAL_TYPE, 1, /* type and stride */
+                        fgm->u_scat, fgm->u_scat);
+
+# pragma omp parallel for if (n_u > CS_THR_MIN)
+  for (cs_lnum_t iu = 0; iu < n_u; iu++)
+    fgm->b[iu] += fgm->u_scat[iu];
+
+  memcpy(fgm->b + n_u, b_c, n_p*sizeof(cs_real_t));
+
+  /* Initial guess */
+  memcpy(fgm->u_scat, u_f, n_u_scat*sizeof(cs_real_t));
+  if (cs_glob_n_ranks > 1)
+    cs_range_set_gather(rset,
+                        CS_REAL_TYPE, 1, /* type and stride */
+                        fgm->u_scat, fgm->u_scat);
+
+  memcpy(x, fgm->u_scat, n_u*sizeof(cs_real_t));
+  memcpy(x + n_u, p_c, n_p*sizeof(cs_real_t));
+
+  const double  b_norm = sqrt(cs_gdot(n, fgm->b, fgm->b));
+
+  info->res0 = b_norm;
+  info->tol = fmax(info->atol, info->rtol*b_norm);
+
+  /* Main loop (restarted flexible GMRES with a right preconditioning) */
+  /* ================================================================= */
+
+  while (info->cvg == CS_SLES_ITERATING) {
+
+    /* Compute the residual r = b - K.x (first vector of the Krylov basis) */
+    cs_real_t  *v0 = fgm->v;
+
+    _fgmres_matvec(matrix, div_op, x, fgm->w, fgm);
+
+#   pragma omp parallel for if (n > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n; i++)
+      v0[i] = fgm->b[i] - fgm->w[i];
+
+    const double  beta = sqrt(cs_gdot(n, v0, v0));
+
+    info->res = beta;
+    if (beta < info->tol) {
+      info->cvg = CS_SLES_CONVERGED;
+      break;
+    }
+
+    const double  ov_beta = 1./beta;
+#   pragma omp parallel for if (n > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n; i++)
+      v0[i] *= ov_beta;
+
+    g[0] = beta;
+    int  k = 0;
+
+    for (int j = 0; j < m && info->cvg == CS_SLES_ITERATING; j++) {
+
+      const cs_real_t  *vj = fgm->v + j*n;
+      cs_real_t  *zj = fgm->z + j*n;
+      cs_real_t  *w = fgm->v + (j+1)*n;
+
+      /* Preconditioning step then apply the saddle-point operator */
+      info->n_inner_iter
+        += (info->last_inner_iter = _fgmres_precond(matrix, div_op,
+                                                    msles->sles,
+                                                    vj, zj, fgm));
+
+      _fgmres_matvec(matrix, div_op, zj, w, fgm);
+
+      /* Modified Gram-Schmidt orthogonalization */
+      for (int i = 0; i < j + 1; i++) {
+
+        const cs_real_t  *vi = fgm->v + i*n;
+        const double  h_ij = cs_gdot(n, w, vi);
+
+        h[i*m + j] = h_ij;
+
+#       pragma omp parallel for if (n > CS_THR_MIN)
+        for (cs_lnum_t l = 0; l < n; l++)
+          w[l] -= h_ij*vi[l];
+
+      }
+
+      const double  h_j1 = sqrt(cs_gdot(n, w, w));
+
+      if (h_j1 > 0) {
+        const double  ov_h_j1 = 1./h_j1;
+#       pragma omp parallel for if (n > CS_THR_MIN)
+        for (cs_lnum_t l = 0; l < n; l++)
+          w[l] *= ov_h_j1;
+      }
+
+      /* Apply the previous Givens rotations to the new column of the
+         Hessenberg matrix and then compute the new rotation */
+      for (int i = 0; i < j; i++) {
+        const double  h_ij = h[i*m + j];
+        h[i*m + j]     =  cs[i]*h_ij + sn[i]*h[(i+1)*m + j];
+        h[(i+1)*m + j] = -sn[i]*h_ij + cs[i]*h[(i+1)*m + j];
+      }
+
+      const double  h_jj = h[j*m + j];
+      const double  denom = sqrt(h_jj*h_jj + h_j1*h_j1);
+
+      if (denom > DBL_MIN) {
+        cs[j] = h_jj/denom;
+        sn[j] = h_j1/denom;
+      }
+      else {
+        cs[j] = 1.;
+        sn[j] = 0.;
+      }
+
+      h[j*m + j] = cs[j]*h_jj + sn[j]*h_j1;
+      g[j+1] = -sn[j]*g[j];
+      g[j] = cs[j]*g[j];
+
+      k = j + 1;
+
+      /* Update the residual norm and test the convergence */
+      _fgmres_cvg_test(fabs(g[j+1]), fgm);
+
+      if (h_j1 < DBL_MIN && info->cvg == CS_SLES_ITERATING)
+        break; /* Lucky breakdown */
+
+    } /* Arnoldi process */
+
+    /* Solve the upper triangular system H.y = g (y is stored in g) */
+    for (int i = k - 1; i > -1; i--) {
+      for (int l = i + 1; l < k; l++)
+        g[i] -= h[i*m + l]*g[l];
+      g[i] /= h[i*m + i];
+    }
+
+    /* Update the solution: x = x + Z.y */
+    for (int i = 0; i < k; i++) {
+
+      const cs_real_t  *zi = fgm->z + i*n;
+      const cs_real_t  y_i = g[i];
+
+#     pragma omp parallel for if (n > CS_THR_MIN)
+      for (cs_lnum_t l = 0; l < n; l++)
+        x[l] += y_i*zi[l];
+
+    }
+
+  } /* Restart */
+
+  /* Return to the "scattered" numbering for the velocity */
+  memcpy(u_f, x, n_u*sizeof(cs_real_t));
+  if (cs_glob_n_ranks > 1)
+    cs_range_set_scatter(rset,
+                         CS_REAL_TYPE, 1, /* type and stride */
+                         u_f, u_f);
+
+  memcpy(p_c, x + n_u, n_p*sizeof(cs_real_t));
+
+  int n_inner_iter = info->n_inner_iter;
+
+  /* Last step: Free temporary memory */
+  _free_fgmres_builder(&fgm);
+
+  return  n_inner_iter;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
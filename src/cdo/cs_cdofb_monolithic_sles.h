@@ -290,6 +290,29 @@ cs_cdofb_monolithic_uzawa_al_incr_solve(const cs_navsto_param_t       *nsp,
                                         const cs_equation_param_t     *eqp,
                                         cs_cdofb_monolithic_sles_t    *msles);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Use an in-house flexible GMRES algorithm with an upper block
+ *         triangular preconditioner to solve the saddle-point problem arising
+ *         from CDO-Fb schemes for Stokes, Oseen and Navier-Stokes with a
+ *         monolithic coupling. The velocity block is approximately solved
+ *         with the SLES of the momentum equation (in-house multigrid) and the
+ *         Schur complement is approximated according to the setting
+ *         \ref cs_navsto_param_sles_t.schur_approximation
+ *
+ * \param[in]      nsp      pointer to a cs_navsto_param_t structure
+ * \param[in]      eqp      pointer to a cs_equation_param_t structure
+ * \param[in, out] msles    pointer to a cs_cdofb_monolithic_sles_t structure
+ *
+ * \return the cumulated number of iterations of the solver
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_cdofb_monolithic_block_fgmres_solve(const cs_navsto_param_t       *nsp,
+                                       const cs_equation_param_t     *eqp,
+                                       cs_cdofb_monolithic_sles_t    *msles);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
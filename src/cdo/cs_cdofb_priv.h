@@ -31,6 +31,7 @@
 
 #include "cs_defs.h"
 #include "cs_hodge.h"
+#include "cs_hodge_cache.h"
 #include "cs_cdo_advection.h"
 #include "cs_equation_assemble.h"
 #include "cs_equation_bc.h"
@@ -79,6 +80,7 @@ struct  _cs_cdofb_t {
   /* Pointer of function to build the diffusion term */
   cs_hodge_t               **diffusion_hodge;
   cs_hodge_compute_t        *get_stiffness_matrix;
+  cs_hodge_cache_t          *stiffness_cache;  /* NULL if not steady */
   cs_cdo_enforce_bc_t       *enforce_dirichlet;
   cs_cdo_enforce_bc_t       *enforce_robin_bc;
   cs_cdo_enforce_bc_t       *enforce_sliding;
@@ -91,6 +93,7 @@ struct  _cs_cdofb_t {
   cs_hodge_param_t           mass_hodgep;
   cs_hodge_t               **mass_hodge;
   cs_hodge_compute_t        *get_mass_matrix;
+  cs_hodge_cache_t          *mass_cache;       /* NULL if not used */
 };
 
 /*============================================================================
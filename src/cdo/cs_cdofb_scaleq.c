@@ -322,8 +322,12 @@ _sfb_conv_diff_reac(const cs_equation_param_t     *eqp,
                                                   * =========== */
     assert(mass_hodge != NULL);
 
-    /* Build the mass matrix and store it in mass_hodge->matrix */
-    eqc->get_mass_matrix(cm, mass_hodge, cb);
+    /* Build the mass matrix and store it in mass_hodge->matrix (or retrieve
+       it from the cache if possible) */
+    if (!cs_hodge_cache_load(eqc->mass_cache, cm->c_id, mass_hodge->matrix)) {
+      eqc->get_mass_matrix(cm, mass_hodge, cb);
+      cs_hodge_cache_store(eqc->mass_cache, cm->c_id, mass_hodge->matrix);
+    }
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
     if (cs_dbg_cw_test(eqp, cm, csys)) {
@@ -344,8 +348,12 @@ _sfb_conv_diff_reac(const cs_equation_param_t     *eqp,
                                      diff_hodge);
 
     /* Define the local stiffness matrix: local matrix owned by the cellwise
-       builder (store in cb->loc) */
-    eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+       builder (store in cb->loc). It is retrieved from the cache if the
+       diffusion property is steady and it has already been computed. */
+    if (!cs_hodge_cache_load(eqc->stiffness_cache, cm->c_id, cb->loc)) {
+      eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+      cs_hodge_cache_store(eqc->stiffness_cache, cm->c_id, cb->loc);
+    }
 
     /* Add the local diffusion operator to the local system */
     cs_sdm_add(csys->mat, cb->loc);
@@ -635,7 +643,7 @@ _assemble(const cs_cdofb_scaleq_t           *eqc,
           cs_real_t                         *rhs)
 {
   /* Matrix assembly */
-  eqc->assemble(csys->mat, csys->dof_ids, rs, eqa, mav);
+  eqc->assemble(csys->mat, csys->c_id, csys->dof_ids, rs, eqa, mav);
 
   /* RHS assembly */
 # pragma omp critical
@@ -916,6 +924,7 @@ cs_cdofb_scaleq_init_context(const cs_equation_param_t   *eqp,
   /* Diffusion term */
   eqc->get_stiffness_matrix = NULL;
   eqc->diffusion_hodge = NULL;
+  eqc->stiffness_cache = NULL;
 
   if (cs_equation_param_has_diffusion(eqp)) {
 
@@ -954,6 +963,14 @@ cs_cdofb_scaleq_init_context(const cs_equation_param_t   *eqp,
       eqb->msh_flag |= cs_quadrature_get_flag(diff_def->qtype,
                                               cs_flag_primal_cell);
 
+    /* Local stiffness matrices do not change if the diffusion property is
+       steady: store them once for all */
+    if (cs_property_is_steady(eqp->diffusion_property))
+      eqc->stiffness_cache = cs_hodge_cache_acquire(eqp->diffusion_hodgep,
+                                                    eqp->diffusion_property,
+                                                    connect->c2f,
+                                                    1);
+
   } /* Diffusion */
 
   eqc->enforce_robin_bc = cs_cdo_diffusion_sfb_cost_robin;
@@ -1180,6 +1197,7 @@ cs_cdofb_scaleq_init_context(const cs_equation_param_t   *eqp,
 
   eqc->get_mass_matrix = NULL;
   eqc->mass_hodge = NULL;
+  eqc->mass_cache = NULL;
 
   if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX) {
 
@@ -1190,6 +1208,12 @@ cs_cdofb_scaleq_init_context(const cs_equation_param_t   *eqp,
                                             false,  /* tensor ? */
                                             false); /* eigen ? */
 
+    /* The mass matrix only depends on the mesh: store it once for all */
+    eqc->mass_cache = cs_hodge_cache_acquire(eqc->mass_hodgep,
+                                             NULL,
+                                             connect->c2f,
+                                             1);
+
     if (eqp->verbosity > 1) {
       cs_log_printf(CS_LOG_SETUP,
                     "#### Parameters of the mass matrix of the equation %s\n",
@@ -1240,6 +1264,9 @@ cs_cdofb_scaleq_free_context(void   *data)
   cs_hodge_free_context(&(eqc->diffusion_hodge));
   cs_hodge_free_context(&(eqc->mass_hodge));
 
+  cs_hodge_cache_release(&(eqc->stiffness_cache));
+  cs_hodge_cache_release(&(eqc->mass_cache));
+
   /* Free temporary buffers */
   BFT_FREE(eqc->source_terms);
   BFT_FREE(eqc->face_values);
@@ -700,7 +700,7 @@ cs_cdofb_vecteq_assembly(const cs_cell_sys_t            *csys,
   const short int n_f_dofs = 3*cm->n_fc;
 
   /* Matrix assembly */
-  eqc->assemble(csys->mat, csys->dof_ids, rs, eqa, mav);
+  eqc->assemble(csys->mat, csys->c_id, csys->dof_ids, rs, eqa, mav);
 
   /* RHS assembly */
 # pragma omp critical
@@ -1688,6 +1688,7 @@ cs_cdofb_vecteq_init_context(const cs_equation_param_t   *eqp,
   /* Diffusion term */
   eqc->get_stiffness_matrix = NULL;
   eqc->diffusion_hodge = NULL;
+  eqc->stiffness_cache = NULL;  /* Not used for vector-valued eq. */
   eqc->enforce_robin_bc = NULL;
 
   if (cs_equation_param_has_diffusion(eqp)) {
@@ -1962,6 +1963,7 @@ cs_cdofb_vecteq_init_context(const cs_equation_param_t   *eqp,
 
   eqc->get_mass_matrix = NULL;
   eqc->mass_hodge = NULL;
+  eqc->mass_cache = NULL;  /* Not used for vector-valued eq. */
 
   if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX) {
 
@@ -31,9 +31,11 @@
 
 #include "cs_defs.h"
 #include "cs_hodge.h"
+#include "cs_hodge_cache.h"
 #include "cs_cdo_advection.h"
 #include "cs_equation_assemble.h"
 #include "cs_equation_bc.h"
+#include "cs_equation_mfree.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -78,6 +80,8 @@ struct _cs_cdovb_t {
 
   /* Assembly process */
   cs_equation_assembly_t   *assemble;
+  cs_equation_mfree_t      *mfree;  /* Matrix-free operator (NULL if the
+                                       matrix is assembled) */
 
   /* Boundary conditions */
   cs_flag_t                *vtx_bc_flag;
@@ -90,6 +94,7 @@ struct _cs_cdovb_t {
   /* Pointer of function to build the diffusion term */
   cs_hodge_t              **diffusion_hodge;
   cs_hodge_compute_t       *get_stiffness_matrix;
+  cs_hodge_cache_t         *stiffness_cache;  /* NULL if not steady */
 
   /* Pointer of function to build the advection term */
   cs_cdovb_advection_t     *get_advection_matrix;
@@ -100,6 +105,7 @@ struct _cs_cdovb_t {
   cs_hodge_param_t          mass_hodgep;
   cs_hodge_t              **mass_hodge;
   cs_hodge_compute_t       *get_mass_matrix;
+  cs_hodge_cache_t         *mass_cache;       /* NULL if not used */
 
 };
 
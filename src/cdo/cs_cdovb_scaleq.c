@@ -106,6 +106,28 @@ BEGIN_C_DECLS
 /* Algebraic system for CDO vertex-based discretization */
 typedef struct _cs_cdovb_t cs_cdovb_scaleq_t;
 
+/* Data related to the build of the algebraic system of one equation. This
+   allows several equations to share the same loop on cells. */
+
+typedef struct {
+
+  const cs_equation_param_t      *eqp;
+  cs_equation_builder_t          *eqb;
+  cs_cdovb_scaleq_t              *eqc;
+  cs_field_t                     *fld;
+
+  bool                            steady;     /* no unsteady term to build */
+
+  cs_real_t                      *dir_values; /* Dirichlet values at vertices */
+  cs_lnum_t                      *forced_ids; /* enforced DoFs (or NULL) */
+
+  cs_matrix_t                    *matrix;
+  cs_matrix_assembler_values_t   *mav;
+  cs_real_t                      *rhs;
+  double                          rhs_norm;
+
+} _svb_build_t;
+
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
 /*============================================================================
@@ -365,8 +387,12 @@ _svb_conv_diff_reac(const cs_equation_param_t     *eqp,
                                                   * =========== */
     assert(mass_hodge != NULL);
 
-    /* Build the mass matrix and store it in mass_hodge->matrix */
-    eqc->get_mass_matrix(cm, mass_hodge, cb);
+    /* Build the mass matrix and store it in mass_hodge->matrix (or retrieve
+       it from the cache if possible) */
+    if (!cs_hodge_cache_load(eqc->mass_cache, cm->c_id, mass_hodge->matrix)) {
+      eqc->get_mass_matrix(cm, mass_hodge, cb);
+      cs_hodge_cache_store(eqc->mass_cache, cm->c_id, mass_hodge->matrix);
+    }
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
     if (cs_dbg_cw_test(eqp, cm, csys)) {
@@ -387,8 +413,12 @@ _svb_conv_diff_reac(const cs_equation_param_t     *eqp,
                                      diff_hodge);
 
     /* Define the local stiffness matrix: local matrix owned by the cellwise
-       builder (store in cb->loc) */
-    eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+       builder (store in cb->loc). It is retrieved from the cache if the
+       diffusion property is steady and it has already been computed. */
+    if (!cs_hodge_cache_load(eqc->stiffness_cache, cm->c_id, cb->loc)) {
+      eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+      cs_hodge_cache_store(eqc->stiffness_cache, cm->c_id, cb->loc);
+    }
 
     /* Add the local diffusion operator to the local system */
     cs_sdm_add(csys->mat, cb->loc);
@@ -666,8 +696,12 @@ _svb_assemble(const cs_cdovb_scaleq_t           *eqc,
               cs_matrix_assembler_values_t      *mav,
               cs_real_t                         *rhs)
 {
-  /* Matrix assembly */
-  eqc->assemble(csys->mat, csys->dof_ids, rs, eqa, mav);
+  /* Matrix assembly (or storage of the cellwise matrix in the matrix-free
+     case) */
+  if (eqc->mfree != NULL)
+    cs_equation_mfree_add_cw(csys->mat, csys->c_id, eqc->mfree);
+  else
+    eqc->assemble(csys->mat, csys->c_id, csys->dof_ids, rs, eqa, mav);
 
   /* RHS assembly */
 #if CS_CDO_OMP_SYNC_SECTIONS > 0
@@ -698,6 +732,309 @@ _svb_assemble(const cs_cdovb_scaleq_t           *eqc,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Initialize the structures used to build the algebraic system of a
+ *         scalar-valued CDO-Vb equation (steady or with an implicit Euler
+ *         time scheme)
+ *
+ * \param[in]      t_eval     time at which one performs the evaluation
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      field_id   id of the variable field related to this equation
+ * \param[in]      steady     true if the unsteady term is not considered
+ * \param[in]      eqp        pointer to a cs_equation_param_t structure
+ * \param[in, out] eqb        pointer to a cs_equation_builder_t structure
+ * \param[in, out] eqc        pointer to a cs_cdovb_scaleq_t structure
+ * \param[out]     b          pointer to the _svb_build_t structure to set
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_build_init(cs_real_t                     t_eval,
+                const cs_mesh_t              *mesh,
+                int                           field_id,
+                bool                          steady,
+                const cs_equation_param_t    *eqp,
+                cs_equation_builder_t        *eqb,
+                cs_cdovb_scaleq_t            *eqc,
+                _svb_build_t                 *b)
+{
+  const cs_lnum_t  n_vertices = cs_shared_quant->n_vertices;
+
+  b->eqp = eqp;
+  b->eqb = eqb;
+  b->eqc = eqc;
+  b->fld = cs_field_by_id(field_id);
+  b->steady = steady;
+
+  /* Build an array storing the Dirichlet values at vertices and another one
+     to detect vertices with an enforcement */
+  b->dir_values = NULL;
+  b->forced_ids = NULL;
+
+  _svb_setup(t_eval, mesh, eqp, eqb, eqc->vtx_bc_flag,
+             &(b->dir_values), &(b->forced_ids));
+
+  if (eqb->init_step)
+    eqb->init_step = false;
+
+  /* Initialize the local system: matrix and rhs */
+  b->matrix = cs_matrix_create(cs_shared_ms);
+  b->rhs = NULL;
+  b->rhs_norm = 0.0;
+
+  cs_real_t  *rhs = NULL;
+  BFT_MALLOC(rhs, n_vertices, cs_real_t);
+# pragma omp parallel for if  (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vertices; i++) rhs[i] = 0.0;
+  b->rhs = rhs;
+
+  /* Initialize the structure to assemble values */
+  b->mav = NULL;
+  if (eqc->mfree != NULL)
+    cs_equation_mfree_reset(eqc->mfree);
+  else
+    b->mav = cs_matrix_assembler_values_init(b->matrix, NULL, NULL);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the local system of a scalar-valued CDO-Vb equation for the
+ *         current cell and assemble it. The cellwise view of the mesh has
+ *         to be built with (at least) the flags requested by the equation.
+ *
+ * \param[in]      b           pointer to a _svb_build_t structure
+ * \param[in]      inv_dtcur   inverse of the current time step
+ * \param[in]      cm          pointer to a cellwise view of the mesh
+ * \param[in, out] fm          pointer to a facewise view of the mesh
+ * \param[in, out] mass_hodge  pointer to a cs_hodge_t structure (mass matrix)
+ * \param[in, out] diff_hodge  pointer to a cs_hodge_t structure (diffusion)
+ * \param[in, out] eqa         pointer to a cs_equation_assemble_t structure
+ * \param[in, out] csys        pointer to a cellwise view of the system
+ * \param[in, out] cb          pointer to a cellwise builder
+ *
+ * \return the cellwise contribution to the normalization of the residual
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_svb_build_cw(const _svb_build_t            *b,
+              cs_real_t                      inv_dtcur,
+              const cs_cell_mesh_t          *cm,
+              cs_face_mesh_t                *fm,
+              cs_hodge_t                    *mass_hodge,
+              cs_hodge_t                    *diff_hodge,
+              cs_equation_assemble_t        *eqa,
+              cs_cell_sys_t                 *csys,
+              cs_cell_builder_t             *cb)
+{
+  const cs_equation_param_t  *eqp = b->eqp;
+  cs_equation_builder_t  *eqb = b->eqb;
+  const cs_cdovb_scaleq_t  *eqc = b->eqc;
+  const cs_range_set_t  *rs =
+    cs_shared_connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
+
+  double  rhs_norm = 0.;
+
+  /* Set the local (i.e. cellwise) structures for the current cell */
+  _svb_init_cell_system(cm, eqp, eqb, b->dir_values, eqc->vtx_bc_flag,
+                        b->forced_ids, b->fld->val,
+                        csys, cb);
+
+  /* Build and add the diffusion/advection/reaction terms into the local
+   * system.
+   * A mass matrix is also built if needed (stored in mass_hodge->matrix)
+   */
+  _svb_conv_diff_reac(eqp, eqb, eqc, cm, fm, mass_hodge, diff_hodge, csys, cb);
+
+  if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                * =========== */
+    /* Reset the local contribution */
+    memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+
+    /* Source term contribution to the algebraic system
+       If the equation is steady, the source term has already been computed
+       and is added to the right-hand side during its initialization. */
+    cs_source_term_compute_cellwise(eqp->n_source_terms,
+                (cs_xdef_t *const *)eqp->source_terms,
+                                    cm,
+                                    eqb->source_mask,
+                                    eqb->compute_source,
+                                    cb->t_st_eval,
+                                    mass_hodge,
+                                    cb,
+                                    csys->source);
+
+    /* Update the RHS */
+    for (short int v = 0; v < cm->n_vc; v++)
+      csys->rhs[v] += csys->source[v];
+
+  } /* End of term source */
+
+  if (b->steady) {
+
+    /* Compute a cellwise norm of the RHS for the normalization of the
+       residual during the resolution of the linear system */
+    rhs_norm = _svb_cw_rhs_normalization(eqp->sles_param.resnorm_type,
+                                         cm, csys);
+
+    /* Apply boundary conditions (those which are weakly enforced) */
+    _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+
+  }
+  else {
+
+    /* Apply boundary conditions (those which are weakly enforced) */
+    _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+
+    /* Unsteady term + time scheme
+     * =========================== */
+
+    if (!(eqb->time_pty_uniform))
+      cb->tpty_val = cs_property_value_in_cell(cm, eqp->time_property,
+                                               cb->t_pty_eval);
+
+    if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) { /* Mass lumping */
+
+      /* |c|*wvc = |dual_cell(v) cap c| */
+      CS_CDO_OMP_ASSERT(cs_eflag_test(eqb->msh_flag, CS_FLAG_COMP_PVQ));
+      const double  ptyc = cb->tpty_val * cm->vol_c * inv_dtcur;
+
+      /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
+       *       >> Update the cellwise system with the time matrix */
+      for (short int i = 0; i < cm->n_vc; i++) {
+
+        const double  dval =  ptyc * cm->wvc[i];
+
+        /* Update the RHS with values at time t_n */
+        csys->rhs[i] += dval * csys->val_n[i];
+
+        /* Add the diagonal contribution from time matrix */
+        csys->mat->val[i*(cm->n_vc + 1)] += dval;
+
+      }
+
+    }
+    else { /* Use the mass matrix */
+
+      const double  tpty_coef = cb->tpty_val * inv_dtcur;
+      const cs_sdm_t  *mass_mat = mass_hodge->matrix;
+
+      /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
+       *       >> Update the cellwise system with the time matrix */
+
+      /* Update rhs with csys->mat*p^n */
+      double  *time_pn = cb->values;
+      cs_sdm_square_matvec(mass_mat, csys->val_n, time_pn);
+      for (short int i = 0; i < csys->n_dofs; i++)
+        csys->rhs[i] += tpty_coef*time_pn[i];
+
+      /* Update the cellwise system with the time matrix */
+      cs_sdm_add_mult(csys->mat, tpty_coef, mass_mat);
+
+    }
+
+#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
+    if (cs_dbg_cw_test(eqp, cm, csys))
+      cs_cell_sys_dump("\n>> Cell system after time", csys);
+#endif
+
+    /* Compute a norm of the RHS for the normalization of the residual
+       of the linear system to solve */
+    rhs_norm = _svb_cw_rhs_normalization(eqp->sles_param.resnorm_type,
+                                         cm, csys);
+
+  }
+
+  /* Enforce values if needed (internal or Dirichlet) */
+  _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+
+#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
+  if (cs_dbg_cw_test(eqp, cm, csys))
+    cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+#endif
+
+  /* Assembly process
+   * ================ */
+
+  _svb_assemble(eqc, cm, csys, rs, eqa, b->mav, b->rhs);
+
+  return rhs_norm;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Finalize the assembly of the algebraic system of a scalar-valued
+ *         CDO-Vb equation, solve it and free the related structures
+ *
+ * \param[in]      cur2prev   true="current to previous" operation is performed
+ * \param[in, out] b          pointer to a _svb_build_t structure
+ * \param[in]      t0         time at which the build step has begun
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_build_solve(bool                 cur2prev,
+                 _svb_build_t        *b,
+                 const cs_timer_t    *t0)
+{
+  const cs_equation_param_t  *eqp = b->eqp;
+  cs_equation_builder_t  *eqb = b->eqb;
+  cs_cdovb_scaleq_t  *eqc = b->eqc;
+  const cs_range_set_t  *rs =
+    cs_shared_connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
+
+  if (eqc->mfree != NULL)
+    cs_equation_mfree_set_matrix(eqc->mfree, b->matrix);
+  else
+    cs_matrix_assembler_values_done(b->mav); /* optional */
+
+  /* Free temporary buffers and structures */
+  BFT_FREE(b->dir_values);
+  BFT_FREE(b->forced_ids);
+
+  if (b->mav != NULL)
+    cs_matrix_assembler_values_finalize(&(b->mav));
+
+  /* End of the system building */
+  cs_timer_t  t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(eqb->tcb), t0, &t1);
+
+  /* Copy current field values to previous values */
+  if (cur2prev)
+    cs_field_current_to_previous(b->fld);
+
+  /* Solve the linear system */
+  /* ======================= */
+
+  /* Last step in the computation of the renormalization coefficient */
+  cs_equation_sync_rhs_normalization(eqp->sles_param.resnorm_type,
+                                     eqc->n_dofs,
+                                     b->rhs,
+                                     &(b->rhs_norm));
+
+  cs_sles_t  *sles = cs_sles_find_or_add(eqp->sles_param.field_id, NULL);
+
+  cs_equation_solve_scalar_system(eqc->n_dofs,
+                                  eqp,
+                                  b->matrix,
+                                  rs,
+                                  b->rhs_norm,
+                                  true, /* rhs_redux */
+                                  sles,
+                                  b->fld->val,
+                                  b->rhs);
+
+  cs_timer_t  t2 = cs_timer_time();
+  cs_timer_counter_add_diff(&(eqb->tcs), &t1, &t2);
+
+  /* Free remaining buffers */
+  BFT_FREE(b->rhs);
+  cs_sles_free(sles);
+  cs_equation_mfree_release_matrix(eqc->mfree);
+  cs_matrix_destroy(&(b->matrix));
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -888,6 +1225,7 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
   /* Diffusion term */
   eqc->diffusion_hodge = NULL;
   eqc->get_stiffness_matrix = NULL;
+  eqc->stiffness_cache = NULL;
 
   if (cs_equation_param_has_diffusion(eqp)) {
 
@@ -943,6 +1281,14 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
 
     } /* Switch on Hodge algo. */
 
+    /* Local stiffness matrices do not change if the diffusion property is
+       steady: store them once for all */
+    if (cs_property_is_steady(eqp->diffusion_property))
+      eqc->stiffness_cache = cs_hodge_cache_acquire(eqp->diffusion_hodgep,
+                                                    eqp->diffusion_property,
+                                                    connect->c2v,
+                                                    0);
+
   } /* Diffusion term is requested */
 
   /* Boundary conditions */
@@ -1276,10 +1622,43 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
   /* Set the function pointer */
   eqc->get_mass_matrix = cs_hodge_get_func(__func__, eqc->mass_hodgep);
 
+  /* The mass matrix only depends on the mesh: store it once for all (not
+     useful with a Voronoi algorithm since the matrix is diagonal) */
+  eqc->mass_cache = NULL;
+  if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX &&
+      mass_matrix_algo != CS_HODGE_ALGO_VORONOI)
+    eqc->mass_cache = cs_hodge_cache_acquire(eqc->mass_hodgep,
+                                             NULL,
+                                             connect->c2v,
+                                             0);
+
   /* Assembly process */
   eqc->assemble = cs_equation_assemble_set(CS_SPACE_SCHEME_CDOVB,
                                            CS_CDO_CONNECT_VTX_SCAL);
 
+  /* Matrix-free operator: the global matrix is not assembled. Cellwise
+     matrices are applied on-the-fly (from the cache of stiffness matrices
+     when possible) */
+  eqc->mfree = NULL;
+  if (eqp->matrix_free) {
+
+    if (cs_equation_mfree_is_compatible(eqp->sles_param))
+      eqc->mfree =
+        cs_equation_mfree_create(connect->c2v,
+                                 connect->range_sets[CS_CDO_CONNECT_VTX_SCAL],
+                                 eqc->stiffness_cache);
+
+    else {
+      cs_base_warn(__FILE__, __LINE__);
+      cs_log_printf(CS_LOG_DEFAULT,
+                    " %s: Equation \"%s\"\n"
+                    " The matrix-free mode is not available with the"
+                    " requested solver and preconditioner.\n"
+                    " The matrix is assembled.\n", __func__, eqp->name);
+    }
+
+  }
+
   /* Array used for extra-operations */
   eqc->cell_values = NULL;
 
@@ -1312,6 +1691,11 @@ cs_cdovb_scaleq_free_context(void   *builder)
   cs_hodge_free_context(&(eqc->diffusion_hodge));
   cs_hodge_free_context(&(eqc->mass_hodge));
 
+  cs_hodge_cache_release(&(eqc->stiffness_cache));
+  cs_hodge_cache_release(&(eqc->mass_cache));
+
+  cs_equation_mfree_free(&(eqc->mfree));
+
   /* Last free */
   BFT_FREE(eqc);
 
@@ -1451,42 +1835,20 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
   cs_timer_t  t0 = cs_timer_time();
 
   const cs_cdo_connect_t  *connect = cs_shared_connect;
-  const cs_range_set_t  *rs = connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
   const cs_cdo_quantities_t  *quant = cs_shared_quant;
-  const cs_lnum_t  n_vertices = quant->n_vertices;
   const cs_time_step_t  *ts = cs_shared_time_step;
   const cs_real_t  time_eval = ts->t_cur + ts->dt[0];
 
   cs_cdovb_scaleq_t  *eqc = (cs_cdovb_scaleq_t *)context;
-  cs_field_t  *fld = cs_field_by_id(field_id);
-
-  /* Build an array storing the Dirichlet values at vertices and another one
-     to detect vertices with an enforcement */
-  cs_real_t  *dir_values = NULL;
-  cs_lnum_t  *forced_ids = NULL;
 
   /* First argument is set to t_cur even if this is a steady computation since
    * one can call this function to compute a steady-state solution at each time
    * step of an unsteady computation. */
-  _svb_setup(time_eval, mesh, eqp, eqb, eqc->vtx_bc_flag,
-             &dir_values, &forced_ids);
-
-  if (eqb->init_step)
-    eqb->init_step = false;
+  _svb_build_t  b;
+  _svb_build_init(time_eval, mesh, field_id, true, eqp, eqb, eqc, &b);
 
-  /* Initialize the local system: matrix and rhs */
-  cs_matrix_t  *matrix = cs_matrix_create(cs_shared_ms);
-  cs_real_t  *rhs = NULL;
   double  rhs_norm = 0.0;
 
-  BFT_MALLOC(rhs, n_vertices, cs_real_t);
-# pragma omp parallel for if  (n_vertices > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_vertices; i++) rhs[i] = 0.0;
-
-  /* Initialize the structure to assemble values */
-  cs_matrix_assembler_values_t  *mav
-    = cs_matrix_assembler_values_init(matrix, NULL, NULL);
-
   /* ------------------------- */
   /* Main OpenMP block on cell */
   /* ------------------------- */
@@ -1514,6 +1876,8 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
     cs_hodge_t  *mass_hodge =
       (eqc->mass_hodge == NULL) ? NULL : eqc->mass_hodge[t_id];
 
+    const cs_real_t  inv_dtcur = 0.; /* Not used */
+
     /* Set times at which one evaluates quantities when needed */
     cb->t_pty_eval = time_eval; /* Dummy parameter if really steady */
     cb->t_bc_eval = time_eval;  /* Dummy parameter if really steady */
@@ -1537,109 +1901,18 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
                          cs_equation_cell_mesh_flag(cb->cell_flag, eqb),
                          connect, quant, cm);
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
-      _svb_init_cell_system(cm, eqp, eqb,
-                            dir_values, eqc->vtx_bc_flag, forced_ids, fld->val,
-                            csys, cb);
-
-      /* Build and add the diffusion/advection/reaction terms into the local
-       * system.
-       * A mass matrix is also built if needed (stored in mass_hodge->matrix)
-       */
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
-
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
-        /* Reset the local contribution */
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
-
-        /* Source term contribution to the algebraic system */
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
-
-        /* Update the RHS */
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
-
-      } /* End of term source */
-
-      /* Compute a cellwise norm of the RHS for the normalization of the
-         residual during the resolution of the linear system */
-      rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param.resnorm_type,
-                                            cm, csys);
-
-      /* Apply boundary conditions (those which are weakly enforced) */
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
-
-      /* Enforce values if needed (internal or Dirichlet) */
-      _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
-
-#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
-#endif
-
-      /* Assembly process
-       * ================ */
-
-      _svb_assemble(eqc, cm, csys, rs, eqa, mav, rhs);
+      /* Build the local system and assemble it */
+      rhs_norm += _svb_build_cw(&b, inv_dtcur, cm, fm, mass_hodge, diff_hodge,
+                                eqa, csys, cb);
 
     } /* Main loop on cells */
 
   } /* OPENMP Block */
 
-  cs_matrix_assembler_values_done(mav); /* optional */
+  b.rhs_norm = rhs_norm;
 
-  /* Free temporary buffers and structures */
-  BFT_FREE(dir_values);
-  BFT_FREE(forced_ids);
-
-  cs_matrix_assembler_values_finalize(&mav);
-
-  /* End of the system building */
-  cs_timer_t  t1 = cs_timer_time();
-  cs_timer_counter_add_diff(&(eqb->tcb), &t0, &t1);
-
-  /* Copy current field values to previous values */
-  if (cur2prev)
-    cs_field_current_to_previous(fld);
-
-  /* Solve the linear system */
-  /* ======================= */
-
-  /* Last step in the computation of the renormalization coefficient */
-  cs_equation_sync_rhs_normalization(eqp->sles_param.resnorm_type,
-                                     eqc->n_dofs,
-                                     rhs,
-                                     &rhs_norm);
-
-  cs_sles_t  *sles = cs_sles_find_or_add(eqp->sles_param.field_id, NULL);
-
-  cs_equation_solve_scalar_system(eqc->n_dofs,
-                                  eqp,
-                                  matrix,
-                                  rs,
-                                  rhs_norm,
-                                  true, /* rhs_redux */
-                                  sles,
-                                  fld->val,
-                                  rhs);
-
-  cs_timer_t  t2 = cs_timer_time();
-  cs_timer_counter_add_diff(&(eqb->tcs), &t1, &t2);
-
-  /* Free remaining buffers */
-  BFT_FREE(rhs);
-  cs_sles_free(sles);
-  cs_matrix_destroy(&matrix);
+  /* Finalize the assembly and solve the linear system */
+  _svb_build_solve(cur2prev, &b, &t0);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1669,40 +1942,19 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
   cs_timer_t  t0 = cs_timer_time();
 
   const cs_cdo_connect_t  *connect = cs_shared_connect;
-  const cs_range_set_t  *rs = connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
   const cs_cdo_quantities_t  *quant = cs_shared_quant;
   const cs_time_step_t  *ts = cs_shared_time_step;
-  const cs_lnum_t  n_vertices = quant->n_vertices;
+  const cs_real_t  time_eval = ts->t_cur + ts->dt[0];
 
   assert(cs_equation_param_has_time(eqp) == true);
   assert(eqp->time_scheme == CS_TIME_SCHEME_EULER_IMPLICIT);
 
   cs_cdovb_scaleq_t  *eqc = (cs_cdovb_scaleq_t *)context;
-  cs_field_t  *fld = cs_field_by_id(field_id);
-
-  /* Build an array storing the Dirichlet values at vertices and another one
-     to detect vertices with an enforcement */
-  cs_real_t  *dir_values = NULL;
-  cs_lnum_t  *forced_ids = NULL;
-
-  _svb_setup(ts->t_cur + ts->dt[0], mesh, eqp, eqb, eqc->vtx_bc_flag,
-             &dir_values,  &forced_ids);
-
-  if (eqb->init_step)
-    eqb->init_step = false;
-
-  /* Initialize the local system: matrix and rhs */
-  cs_matrix_t  *matrix = cs_matrix_create(cs_shared_ms);
-  cs_real_t  *rhs = NULL;
-  double  rhs_norm = 0.;
 
-  BFT_MALLOC(rhs, n_vertices, cs_real_t);
-# pragma omp parallel for if  (n_vertices > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_vertices; i++) rhs[i] = 0.0;
+  _svb_build_t  b;
+  _svb_build_init(time_eval, mesh, field_id, false, eqp, eqb, eqc, &b);
 
-  /* Initialize the structure to assemble values */
-  cs_matrix_assembler_values_t  *mav
-    = cs_matrix_assembler_values_init(matrix, NULL, NULL);
+  double  rhs_norm = 0.0;
 
   /* ------------------------- */
   /* Main OpenMP block on cell */
@@ -1721,17 +1973,16 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
 
     /* Each thread get back its related structures:
        Get the cell-wise view of the mesh and the algebraic system */
-    cs_equation_assemble_t  *eqa = cs_equation_assemble_get(t_id);
     cs_face_mesh_t  *fm = cs_cdo_local_get_face_mesh(t_id);
     cs_cell_mesh_t  *cm = cs_cdo_local_get_cell_mesh(t_id);
     cs_cell_sys_t  *csys = _svb_cell_system[t_id];
     cs_cell_builder_t  *cb = _svb_cell_builder[t_id];
+    cs_equation_assemble_t  *eqa = cs_equation_assemble_get(t_id);
     cs_hodge_t  *diff_hodge =
       (eqc->diffusion_hodge == NULL) ? NULL : eqc->diffusion_hodge[t_id];
     cs_hodge_t  *mass_hodge =
       (eqc->mass_hodge == NULL) ? NULL : eqc->mass_hodge[t_id];
 
-    const cs_real_t  time_eval = ts->t_cur + ts->dt[0];
     const cs_real_t  inv_dtcur = 1./ts->dt[0];
 
     /* Set times at which one evaluates quantities if needed */
@@ -1757,158 +2008,207 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
                          cs_equation_cell_mesh_flag(cb->cell_flag, eqb),
                          connect, quant, cm);
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
-      _svb_init_cell_system(cm, eqp, eqb, dir_values, eqc->vtx_bc_flag,
-                            forced_ids, fld->val,
-                            csys, cb);
+      /* Build the local system and assemble it */
+      rhs_norm += _svb_build_cw(&b, inv_dtcur, cm, fm, mass_hodge, diff_hodge,
+                                eqa, csys, cb);
 
-      /* Build and add the diffusion/advection/reaction term to the local
-         system. A mass matrix is also built if needed */
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
+    } /* Main loop on cells */
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
-        /* Reset the local contribution */
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+  } /* OPENMP Block */
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+  b.rhs_norm = rhs_norm;
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
+  /* Finalize the assembly and solve the linear system */
+  _svb_build_solve(cur2prev, &b, &t0);
+}
 
-      } /* End of term source */
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build and solve the linear systems arising from a set of scalar
+ *         convection/diffusion/reaction equations discretized with a CDO-Vb
+ *         scheme on the same mesh. Each equation is either steady or relies
+ *         on an implicit Euler time scheme.
+ *         Cells are swept only once: the cellwise view of the mesh is built
+ *         with the union of the flags requested by the equations and the
+ *         local build of each equation is then performed on this view.
+ *         Local Hodge operators shared between equations are retrieved from
+ *         the cache of Hodge operators (when activated).
+ *
+ * \param[in]      cur2prev   true="current to previous" operation is performed
+ * \param[in]      steady     true=solve the steady-state of each equation
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      n_eqs      number of equations to build and solve
+ * \param[in]      field_ids  id of the variable field related to each equation
+ * \param[in]      eqps       pointers to cs_equation_param_t structures
+ * \param[in, out] eqbs       pointers to cs_equation_builder_t structures
+ * \param[in, out] contexts   pointers to cs_cdovb_scaleq_t structures
+ */
+/*----------------------------------------------------------------------------*/
 
-      /* Apply boundary conditions (those which are weakly enforced) */
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+void
+cs_cdovb_scaleq_solve_group(bool                         cur2prev,
+                            bool                         steady,
+                            const cs_mesh_t             *mesh,
+                            int                          n_eqs,
+                            const int                    field_ids[],
+                            const cs_equation_param_t   *eqps[],
+                            cs_equation_builder_t       *eqbs[],
+                            void                        *contexts[])
+{
+  if (n_eqs < 1)
+    return;
 
-      /* Unsteady term + time scheme
-       * =========================== */
+  cs_timer_t  t0 = cs_timer_time();
 
-      if (!(eqb->time_pty_uniform))
-        cb->tpty_val = cs_property_value_in_cell(cm, eqp->time_property,
-                                                 cb->t_pty_eval);
+  const cs_cdo_connect_t  *connect = cs_shared_connect;
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_time_step_t  *ts = cs_shared_time_step;
+  const cs_real_t  time_eval = ts->t_cur + ts->dt[0];
+  const cs_real_t  inv_dtcur = 1./ts->dt[0];
 
-      if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) { /* Mass lumping */
+  _svb_build_t  *b = NULL;
+  double  *rhs_norms = NULL;
 
-        /* |c|*wvc = |dual_cell(v) cap c| */
-        CS_CDO_OMP_ASSERT(cs_eflag_test(eqb->msh_flag, CS_FLAG_COMP_PVQ));
-        const double  ptyc = cb->tpty_val * cm->vol_c * inv_dtcur;
+  BFT_MALLOC(b, n_eqs, _svb_build_t);
+  BFT_MALLOC(rhs_norms, n_eqs, double);
 
-        /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
-         *       >> Update the cellwise system with the time matrix */
-        for (short int i = 0; i < cm->n_vc; i++) {
+  for (int k = 0; k < n_eqs; k++) {
 
-          const double  dval =  ptyc * cm->wvc[i];
+    const cs_equation_param_t  *eqp = eqps[k];
+    const bool  eq_steady = steady || !cs_equation_param_has_time(eqp);
 
-          /* Update the RHS with values at time t_n */
-          csys->rhs[i] += dval * csys->val_n[i];
+    if (!eq_steady && eqp->time_scheme != CS_TIME_SCHEME_EULER_IMPLICIT)
+      bft_error(__FILE__, __LINE__, 0,
+                " %s: Equation \"%s\": Only an implicit Euler time scheme is"
+                " handled when several equations share the loop on cells.",
+                __func__, eqp->name);
 
-          /* Add the diagonal contribution from time matrix */
-          csys->mat->val[i*(cm->n_vc + 1)] += dval;
+    _svb_build_init(time_eval, mesh, field_ids[k], eq_steady,
+                    eqp, eqbs[k], (cs_cdovb_scaleq_t *)contexts[k], b + k);
 
-        }
+    rhs_norms[k] = 0.;
 
-      }
-      else { /* Use the mass matrix */
+  }
 
-        const double  tpty_coef = cb->tpty_val * inv_dtcur;
-        const cs_sdm_t  *mass_mat = mass_hodge->matrix;
+  /* ------------------------- */
+  /* Main OpenMP block on cell */
+  /* ------------------------- */
 
-        /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
-         *       >> Update the cellwise system with the time matrix */
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)
+  {
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+    int  t_id = omp_get_thread_num();
+#else
+    int  t_id = 0;
+#endif
 
-        /* Update rhs with csys->mat*p^n */
-        double  *time_pn = cb->values;
-        cs_sdm_square_matvec(mass_mat, csys->val_n, time_pn);
-        for (short int i = 0; i < csys->n_dofs; i++)
-          csys->rhs[i] += tpty_coef*time_pn[i];
+    /* Each thread get back its related structures:
+       Get the cell-wise view of the mesh and the algebraic system. The
+       cellwise system is reset for each equation while a cellwise builder
+       is needed for each equation since it stores the values of the
+       properties. The first equation relies on the shared builder. */
+    cs_face_mesh_t  *fm = cs_cdo_local_get_face_mesh(t_id);
+    cs_cell_mesh_t  *cm = cs_cdo_local_get_cell_mesh(t_id);
+    cs_cell_sys_t  *csys = _svb_cell_system[t_id];
+    cs_equation_assemble_t  *eqa = cs_equation_assemble_get(t_id);
 
-        /* Update the cellwise system with the time matrix */
-        cs_sdm_add_mult(csys->mat, tpty_coef, mass_mat);
+    cs_cell_builder_t  **cbs = NULL;
+    double  *_rhs_norms = NULL;
 
-      }
+    BFT_MALLOC(cbs, n_eqs, cs_cell_builder_t *);
+    BFT_MALLOC(_rhs_norms, n_eqs, double);
 
-#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump("\n>> Cell system after time", csys);
-#endif
+    for (int k = 0; k < n_eqs; k++) {
 
-      /* Compute a norm of the RHS for the normalization of the residual
-         of the linear system to solve */
-      rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param.resnorm_type,
-                                            cm, csys);
+      const cs_cdovb_scaleq_t  *eqc = b[k].eqc;
+      cs_hodge_t  *diff_hodge =
+        (eqc->diffusion_hodge == NULL) ? NULL : eqc->diffusion_hodge[t_id];
 
-      /* Enforce values if needed (internal or Dirichlet) */
-      _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+      cbs[k] = (k == 0) ?
+        _svb_cell_builder[t_id] : _svb_create_cell_builder(connect);
 
-#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
-#endif
+      /* Set times at which one evaluates quantities if needed */
+      cbs[k]->t_pty_eval = time_eval;
+      cbs[k]->t_bc_eval = time_eval;
+      cbs[k]->t_st_eval = time_eval;
 
-      /* Assembly process
-       * ================ */
-      _svb_assemble(eqc, cm, csys, rs, eqa, mav, rhs);
+      /* Initialization of the values of properties */
+      cs_equation_init_properties(b[k].eqp, b[k].eqb, diff_hodge, cbs[k]);
+
+      _rhs_norms[k] = 0.;
+
+    }
+
+    /* --------------------------------------------- */
+    /* Main loop on cells to build the linear system */
+    /* --------------------------------------------- */
+
+#   pragma omp for CS_CDO_OMP_SCHEDULE
+    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+
+      const cs_flag_t  cell_flag = connect->cell_flag[c_id];
+
+      /* Set the local mesh structure for the current cell with the union of
+         the flags requested by all equations */
+      cs_eflag_t  msh_flag = 0;
+      for (int k = 0; k < n_eqs; k++)
+        msh_flag |= cs_equation_cell_mesh_flag(cell_flag, b[k].eqb);
+
+      cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
+
+      for (int k = 0; k < n_eqs; k++) {
+
+        const cs_cdovb_scaleq_t  *eqc = b[k].eqc;
+        cs_hodge_t  *diff_hodge =
+          (eqc->diffusion_hodge == NULL) ? NULL : eqc->diffusion_hodge[t_id];
+        cs_hodge_t  *mass_hodge =
+          (eqc->mass_hodge == NULL) ? NULL : eqc->mass_hodge[t_id];
+
+        /* Set the current cell flag */
+        cbs[k]->cell_flag = cell_flag;
+
+        /* Build the local system and assemble it */
+        _rhs_norms[k] += _svb_build_cw(b + k, inv_dtcur, cm, fm,
+                                       mass_hodge, diff_hodge,
+                                       eqa, csys, cbs[k]);
+
+      }
 
     } /* Main loop on cells */
 
-  } /* OPENMP Block */
+    for (int k = 0; k < n_eqs; k++) {
+#     pragma omp atomic
+      rhs_norms[k] += _rhs_norms[k];
+    }
 
-  cs_matrix_assembler_values_done(mav); /* optional */
+    for (int k = 1; k < n_eqs; k++)
+      cs_cell_builder_free(&(cbs[k]));
 
-  /* Free temporary buffers and structures */
-  BFT_FREE(dir_values);
-  BFT_FREE(forced_ids);
-  cs_matrix_assembler_values_finalize(&mav);
+    BFT_FREE(cbs);
+    BFT_FREE(_rhs_norms);
 
-  /* Copy current field values to previous values */
-  if (cur2prev)
-    cs_field_current_to_previous(fld);
+  } /* OPENMP Block */
 
-  /* End of the system building */
+  /* The time spent in the loop on cells is shared among the equations */
   cs_timer_t  t1 = cs_timer_time();
-  cs_timer_counter_add_diff(&(eqb->tcb), &t0, &t1);
+  cs_timer_counter_t  tc = cs_timer_diff(&t0, &t1);
 
-  /* Solve the linear system */
-  /* ======================= */
+  for (int k = 0; k < n_eqs; k++) {
 
-  /* Last step in the computation of the renormalization coefficient */
-  cs_equation_sync_rhs_normalization(eqp->sles_param.resnorm_type,
-                                     eqc->n_dofs,
-                                     rhs,
-                                     &rhs_norm);
+    cs_timer_counter_t  *tcb = &(b[k].eqb->tcb);
+    tcb->wall_nsec += tc.wall_nsec/n_eqs;
+    tcb->cpu_nsec += tc.cpu_nsec/n_eqs;
 
-  cs_sles_t  *sles = cs_sles_find_or_add(eqp->sles_param.field_id, NULL);
+    b[k].rhs_norm = rhs_norms[k];
 
-  cs_equation_solve_scalar_system(eqc->n_dofs,
-                                  eqp,
-                                  matrix,
-                                  rs,
-                                  rhs_norm,
-                                  true, /* rhs_redux */
-                                  sles,
-                                  fld->val,
-                                  rhs);
+    /* Finalize the assembly and solve the linear system */
+    cs_timer_t  t2 = cs_timer_time();
+    _svb_build_solve(cur2prev, b + k, &t2);
 
-  cs_timer_t  t2 = cs_timer_time();
-  cs_timer_counter_add_diff(&(eqb->tcs), &t1, &t2);
+  }
 
-  /* Free remaining buffers */
-  BFT_FREE(rhs);
-  cs_sles_free(sles);
-  cs_matrix_destroy(&matrix);
+  BFT_FREE(b);
+  BFT_FREE(rhs_norms);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1971,8 +2271,11 @@ cs_cdovb_scaleq_solve_theta(bool                        cur2prev,
   cs_matrix_t  *matrix = cs_matrix_create(cs_shared_ms);
 
   /* Initialize the structure to assemble values */
-  cs_matrix_assembler_values_t  *mav
-    = cs_matrix_assembler_values_init(matrix, NULL, NULL);
+  cs_matrix_assembler_values_t  *mav = NULL;
+  if (eqc->mfree != NULL)
+    cs_equation_mfree_reset(eqc->mfree);
+  else
+    mav = cs_matrix_assembler_values_init(matrix, NULL, NULL);
 
   const double  tcoef = 1 - eqp->theta;
 
@@ -2208,12 +2511,16 @@ cs_cdovb_scaleq_solve_theta(bool                        cur2prev,
 
   } /* OPENMP Block */
 
-  cs_matrix_assembler_values_done(mav); /* optional */
+  if (eqc->mfree != NULL)
+    cs_equation_mfree_set_matrix(eqc->mfree, matrix);
+  else
+    cs_matrix_assembler_values_done(mav); /* optional */
 
   /* Free temporary buffers and structures */
   BFT_FREE(dir_values);
   BFT_FREE(forced_ids);
-  cs_matrix_assembler_values_finalize(&mav);
+  if (mav != NULL)
+    cs_matrix_assembler_values_finalize(&mav);
 
   /* Copy current field values to previous values */
   if (cur2prev)
@@ -2250,6 +2557,7 @@ cs_cdovb_scaleq_solve_theta(bool                        cur2prev,
   /* Free remaining buffers */
   BFT_FREE(rhs);
   cs_sles_free(sles);
+  cs_equation_mfree_release_matrix(eqc->mfree);
   cs_matrix_destroy(&matrix);
 }
 
@@ -211,6 +211,39 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
                                cs_equation_builder_t      *eqb,
                                void                       *context);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build and solve the linear systems arising from a set of scalar
+ *         convection/diffusion/reaction equations discretized with a CDO-Vb
+ *         scheme on the same mesh. Each equation is either steady or relies
+ *         on an implicit Euler time scheme.
+ *         Cells are swept only once: the cellwise view of the mesh is built
+ *         with the union of the flags requested by the equations and the
+ *         local build of each equation is then performed on this view.
+ *         Local Hodge operators shared between equations are retrieved from
+ *         the cache of Hodge operators (when activated).
+ *
+ * \param[in]      cur2prev   true="current to previous" operation is performed
+ * \param[in]      steady     true=solve the steady-state of each equation
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      n_eqs      number of equations to build and solve
+ * \param[in]      field_ids  id of the variable field related to each equation
+ * \param[in]      eqps       pointers to cs_equation_param_t structures
+ * \param[in, out] eqbs       pointers to cs_equation_builder_t structures
+ * \param[in, out] contexts   pointers to cs_cdovb_scaleq_t structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_solve_group(bool                         cur2prev,
+                            bool                         steady,
+                            const cs_mesh_t             *mesh,
+                            int                          n_eqs,
+                            const int                    field_ids[],
+                            const cs_equation_param_t   *eqps[],
+                            cs_equation_builder_t       *eqbs[],
+                            void                        *contexts[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build and solve the linear system arising from a scalar unsteady
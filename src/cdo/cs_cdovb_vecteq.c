@@ -852,6 +852,7 @@ cs_cdovb_vecteq_init_context(const cs_equation_param_t   *eqp,
   /* Diffusion term */
   eqc->get_stiffness_matrix = NULL;
   eqc->get_stiffness_matrix = NULL;
+  eqc->stiffness_cache = NULL;  /* Not used for vector-valued eq. */
 
   if (cs_equation_param_has_diffusion(eqp)) {
 
@@ -1067,6 +1068,7 @@ cs_cdovb_vecteq_init_context(const cs_equation_param_t   *eqp,
 
   /* Set the function pointer */
   eqc->get_mass_matrix = cs_hodge_get_func(__func__, eqc->mass_hodgep);
+  eqc->mass_cache = NULL;  /* Not used for vector-valued eq. */
 
   /* Assembly process */
   eqc->assemble = cs_equation_assemble_set(CS_SPACE_SCHEME_CDOVB,
@@ -1378,7 +1380,7 @@ cs_cdovb_vecteq_solve_steady_state(bool                        cur2prev,
       /* ASSEMBLY PROCESS
        * ================ */
 
-      eqc->assemble(csys->mat, csys->dof_ids, rs, eqa, mav);
+      eqc->assemble(csys->mat, csys->c_id, csys->dof_ids, rs, eqa, mav);
 
 #     pragma omp critical
       {
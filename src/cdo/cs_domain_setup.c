@@ -48,6 +48,7 @@
 #include "cs_equation_param.h"
 #include "cs_gwf.h"
 #include "cs_hodge.h"
+#include "cs_hodge_cache.h"
 #include "cs_log.h"
 #include "cs_log_iteration.h"
 #include "cs_maxwell.h"
@@ -61,6 +62,7 @@
 #include "cs_thermal_system.h"
 #include "cs_time_step.h"
 #include "cs_walldistance.h"
+#include "cs_xdef_cache.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -614,6 +616,13 @@ cs_domain_init_cdo_structures(cs_domain_t                 *domain)
   cs_advection_field_set_shared_pointers(domain->cdo_quantities,
                                          domain->connect);
 
+  /* Caches of evaluation points rely on the previous connectivity if
+     these structures are rebuilt (for instance after a mesh modification) */
+  cs_xdef_cache_reset_all(domain->connect);
+
+  /* Cell-wise local matrices stored in caches depend on the mesh */
+  cs_hodge_cache_reset_all();
+
   /* Allocate common structures for solving equations */
   cs_equation_common_init(domain->connect,
                           domain->cdo_quantities,
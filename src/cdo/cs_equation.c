@@ -61,11 +61,14 @@
 #include "cs_hho_scaleq.h"
 #include "cs_hho_vecteq.h"
 #include "cs_log.h"
+#include "cs_multigrid.h"
 #include "cs_parall.h"
 #include "cs_post.h"
 #include "cs_prototypes.h"
 #include "cs_range_set.h"
 #include "cs_sles.h"
+#include "cs_sles_it.h"
+#include "cs_sles_pc.h"
 #include "cs_timer_stats.h"
 
 #if defined(DEBUG) && !defined(NDEBUG)
@@ -101,6 +104,9 @@ static int  _n_predef_equations = 0;
 static int  _n_user_equations = 0;
 static cs_equation_t  **_equations = NULL;
 
+/* Build the systems of several equations within a single loop on cells */
+static bool  _shared_cell_sweep = false;
+
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
 /*============================================================================
@@ -237,6 +243,76 @@ _prepare_fb_solving(void              *eq_to_cast,
   *p_rhs = b;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the first coarsening of an in-house multigrid solver or
+ *         preconditioner for a scalar-valued CDO face-based equation: the
+ *         (owned) faces of each cell are merged into one coarse DoF.
+ *         This geometric step is followed by an algebraic coarsening.
+ *
+ * \param[in]  eq        pointer to a cs_equation_t structure
+ * \param[in]  connect   pointer to a cs_cdo_connect_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_set_fb_multigrid_row_groups(const cs_equation_t       *eq,
+                             const cs_cdo_connect_t    *connect)
+{
+  const cs_param_sles_t  slesp = eq->param->sles_param;
+
+  if (slesp.solver_class != CS_PARAM_SLES_CLASS_CS)
+    return;
+  if (   slesp.solver != CS_PARAM_ITSOL_AMG
+      && slesp.precond != CS_PARAM_PRECOND_AMG)
+    return;
+
+  cs_sles_t  *sles = cs_sles_find(slesp.field_id, NULL);
+  if (sles == NULL)
+    return;
+
+  cs_multigrid_t  *mg = NULL;
+  if (slesp.solver == CS_PARAM_ITSOL_AMG)
+    mg = cs_sles_get_context(sles);
+  else {
+    cs_sles_pc_t  *pc = cs_sles_it_get_pc(cs_sles_get_context(sles));
+    if (pc != NULL)
+      mg = cs_sles_pc_get_context(pc);
+  }
+
+  if (mg == NULL)
+    return;
+
+  const cs_range_set_t  *rset = eq->rset;
+  const cs_adjacency_t  *c2f = connect->c2f;
+  const cs_lnum_t  n_cells = connect->n_cells;
+  const cs_lnum_t  n_rows = rset->l_range[1] - rset->l_range[0];
+
+  cs_lnum_t  *group_idx = NULL, *group_ids = NULL;
+  BFT_MALLOC(group_idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(group_ids, c2f->idx[n_cells], cs_lnum_t);
+
+  /* Only faces owned by the local rank define a row of the system */
+
+  group_idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    cs_lnum_t  shift = group_idx[c_id];
+    for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++) {
+      const cs_gnum_t  g_id = rset->g_id[c2f->ids[j]];
+      if (g_id >= rset->l_range[0] && g_id < rset->l_range[1])
+        group_ids[shift++] = (cs_lnum_t)(g_id - rset->l_range[0]);
+    }
+    group_idx[c_id+1] = shift;
+
+  }
+
+  cs_multigrid_set_row_groups(mg, n_rows, n_cells, group_idx, group_ids);
+
+  BFT_FREE(group_idx);
+  BFT_FREE(group_ids);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Set the pointers of function for the given equation.
@@ -318,6 +394,32 @@ _set_vect_hho_function_pointers(cs_equation_t  *eq)
   eq->update_field = cs_hho_vecteq_update_field;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the build of the algebraic system of an equation can be
+ *         performed in a loop on cells shared with other equations
+ *
+ * \param[in]  eq         pointer to a cs_equation_t structure
+ * \param[in]  steady     true=steady-state solve
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_can_share_cell_sweep(const cs_equation_t    *eq,
+                      bool                    steady)
+{
+  if (eq->param->space_scheme != CS_SPACE_SCHEME_CDOVB || eq->param->dim != 1)
+    return false;
+
+  if (steady)
+    return (eq->solve_steady_state == cs_cdovb_scaleq_solve_steady_state);
+  else
+    return (eq->solve == cs_cdovb_scaleq_solve_steady_state ||
+            eq->solve == cs_cdovb_scaleq_solve_implicit);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1837,6 +1939,10 @@ cs_equation_set_range_set(const cs_cdo_connect_t   *connect)
     if (cs_glob_n_ranks > 1)
       eq->n_sles_gather_elts = eq->rset->n_elts[0];
 
+    /* Geometric first coarsening for face-based schemes */
+    if (eqp->space_scheme == CS_SPACE_SCHEME_CDOFB && eqp->dim == 1)
+      _set_fb_multigrid_row_groups(eq, connect);
+
     if (eq->main_ts_id > -1)
       cs_timer_stats_stop(eq->main_ts_id);
 
@@ -2624,6 +2730,146 @@ cs_equation_solve(bool                        cur2prev,
     cs_timer_stats_stop(eq->main_ts_id);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or not the build of the algebraic systems of several
+ *         equations within a single loop on cells (see
+ *         \ref cs_equation_solve_group).
+ *
+ *         Equations are still solved in the same order, but consecutive
+ *         equations sharing a loop on cells are all built before any of
+ *         them is solved: the build of one of them does not see the
+ *         values computed by the previous ones in this sequence. This
+ *         option should only be activated when such equations are not
+ *         coupled.
+ *
+ * \param[in]  status     true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_set_shared_cell_sweep(bool    status)
+{
+  _shared_cell_sweep = status;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the algebraic systems of several equations are built
+ *         within a single loop on cells
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_equation_has_shared_cell_sweep(void)
+{
+  return _shared_cell_sweep;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build and then solve the linear systems related to a set of
+ *         equations, in the given order. When the shared cell sweep is
+ *         activated, each sequence of consecutive equations which can be
+ *         grouped (scalar-valued CDO-Vb equations which are steady or with
+ *         an implicit Euler time scheme) is built within a single loop on
+ *         cells: the cellwise view of the mesh is built once per cell for
+ *         all the equations of the sequence. Other equations are solved one
+ *         after the other.
+ *
+ * \param[in]      steady     true=find the steady state of each equation
+ * \param[in]      cur2prev   true="current to previous" operation is performed
+ *                            (not used if steady is true)
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      n_eqs      number of equations
+ * \param[in, out] eqs        pointers to cs_equation_t structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_solve_group(bool                   steady,
+                        bool                   cur2prev,
+                        const cs_mesh_t       *mesh,
+                        int                    n_eqs,
+                        cs_equation_t         *eqs[])
+{
+  if (n_eqs < 1)
+    return;
+
+  for (int i = 0; i < n_eqs; i++)
+    if (eqs[i] == NULL)
+      bft_error(__FILE__, __LINE__, 0, "%s: Empty equation structure",
+                __func__);
+
+  int  *field_ids = NULL;
+  const cs_equation_param_t  **eqps = NULL;
+  cs_equation_builder_t  **eqbs = NULL;
+  void  **contexts = NULL;
+
+  if (_shared_cell_sweep) {
+    BFT_MALLOC(field_ids, n_eqs, int);
+    BFT_MALLOC(eqps, n_eqs, const cs_equation_param_t *);
+    BFT_MALLOC(eqbs, n_eqs, cs_equation_builder_t *);
+    BFT_MALLOC(contexts, n_eqs, void *);
+  }
+
+  int  s_id = 0;
+  while (s_id < n_eqs) {
+
+    /* Sequence of consecutive equations which can share the loop on cells */
+    int  e_id = s_id;
+    if (_shared_cell_sweep)
+      while (e_id < n_eqs && _can_share_cell_sweep(eqs[e_id], steady))
+        e_id++;
+
+    if (e_id - s_id > 1) {
+
+      const int  n_grouped = e_id - s_id;
+
+      for (int i = 0; i < n_grouped; i++) {
+        cs_equation_t  *eq = eqs[s_id + i];
+        field_ids[i] = eq->field_id;
+        eqps[i] = eq->param;
+        eqbs[i] = eq->builder;
+        contexts[i] = eq->scheme_context;
+      }
+
+      /* Timer statistics of each equation are not updated since the build
+         step is shared. The time spent in the build and the resolution
+         steps is still reported in the builder structure of each
+         equation. */
+      cs_cdovb_scaleq_solve_group((steady) ? false : cur2prev,
+                                  steady,
+                                  mesh,
+                                  n_grouped,
+                                  field_ids,
+                                  eqps,
+                                  eqbs,
+                                  contexts);
+
+    }
+    else {
+
+      e_id = s_id + 1;
+      if (steady)
+        cs_equation_solve_steady_state(mesh, eqs[s_id]);
+      else
+        cs_equation_solve(cur2prev, mesh, eqs[s_id]);
+
+    }
+
+    s_id = e_id;
+
+  } /* Loop on sequences of equations */
+
+  BFT_FREE(field_ids);
+  BFT_FREE(eqps);
+  BFT_FREE(eqbs);
+  BFT_FREE(contexts);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Apply the current to previous to all fields (and potentially arrays)
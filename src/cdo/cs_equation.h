@@ -582,6 +582,65 @@ cs_equation_solve(bool                        cur2prev,
                   const cs_mesh_t            *mesh,
                   cs_equation_t              *eq);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or not the build of the algebraic systems of several
+ *         equations within a single loop on cells (see
+ *         \ref cs_equation_solve_group).
+ *
+ *         Equations are still solved in the same order, but consecutive
+ *         equations sharing a loop on cells are all built before any of
+ *         them is solved: the build of one of them does not see the
+ *         values computed by the previous ones in this sequence. This
+ *         option should only be activated when such equations are not
+ *         coupled.
+ *
+ * \param[in]  status     true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_set_shared_cell_sweep(bool    status);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the algebraic systems of several equations are built
+ *         within a single loop on cells
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_equation_has_shared_cell_sweep(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build and then solve the linear systems related to a set of
+ *         equations, in the given order. When the shared cell sweep is
+ *         activated, each sequence of consecutive equations which can be
+ *         grouped (scalar-valued CDO-Vb equations which are steady or with
+ *         an implicit Euler time scheme) is built within a single loop on
+ *         cells: the cellwise view of the mesh is built once per cell for
+ *         all the equations of the sequence. Other equations are solved one
+ *         after the other.
+ *
+ * \param[in]      steady     true=find the steady state of each equation
+ * \param[in]      cur2prev   true="current to previous" operation is performed
+ *                            (not used if steady is true)
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      n_eqs      number of equations
+ * \param[in, out] eqs        pointers to cs_equation_t structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_solve_group(bool                   steady,
+                        bool                   cur2prev,
+                        const cs_mesh_t       *mesh,
+                        int                    n_eqs,
+                        cs_equation_t         *eqs[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build the linear system for this equation
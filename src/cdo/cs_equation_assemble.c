@@ -78,6 +78,11 @@ BEGIN_C_DECLS
   behavior in order to get a more optimzed version of the standard assembly
   process.
 
+  For scalar-valued systems, the position of each entry of a cellwise matrix
+  in the coefficients of the global matrix is computed once for all at the
+  initialization step. The assembly of local rows then relies on direct
+  indexed additions instead of searches in the matrix structure.
+
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -126,6 +131,27 @@ typedef struct {
 
 } cs_equation_assemble_row_t;
 
+/* Precomputed positions in the matrix coefficients of the entries of
+   cellwise matrices (scalar-valued case). Cellwise DoFs are ordered as in
+   the cell --> DoFs adjacency (as in cs_cell_mesh_t structures) */
+
+typedef struct {
+
+  const cs_matrix_assembler_t  *ma;   /* Related matrix assembler */
+  const cs_adjacency_t         *c2x;  /* Cell --> DoFs adjacency */
+
+  cs_lnum_t   *idx;   /* Index on slots (size n_cells + 1) */
+  cs_lnum_t   *ids;   /* For each cell, n_dofs*n_dofs slots. For the entry
+                         (i,j): position in the diagonal array if i == j,
+                         in the extra-diagonal array otherwise. -1 if the
+                         row does not belong to the local rank */
+
+} cs_equation_assemble_slots_t;
+
+/* Precomputed positions for each family of space discretizations (only
+   scalar-valued matrix structures) */
+static cs_equation_assemble_slots_t  **cs_equation_assemble_slots = NULL;
+
 struct _cs_equation_assemble_t {
 
   int         ddim;         /* Number of real values related to each diagonal
@@ -467,6 +493,158 @@ _add_scal_values_critical(const cs_equation_assemble_row_t   *row,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Retrieve the precomputed positions of the entries of a cellwise
+ *        matrix in the coefficients of matrices related to a given matrix
+ *        assembler (scalar-valued case)
+ *
+ * \param[in]  ma        pointer to a matrix assembler structure
+ * \param[in]  c_id      id of the related cell
+ * \param[in]  dof_ids   local DoF numbering
+ * \param[in]  n_dofs    number of cellwise DoFs
+ *
+ * \return  a pointer to the slots of the cell or NULL if not available
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline const cs_lnum_t *
+_get_cell_slots(const cs_matrix_assembler_t    *ma,
+                cs_lnum_t                       c_id,
+                const cs_lnum_t                *dof_ids,
+                int                             n_dofs)
+{
+  if (cs_equation_assemble_slots == NULL || c_id < 0)
+    return NULL;
+
+  for (int k = 0; k < CS_CDO_CONNECT_N_CASES; k++) {
+
+    const cs_equation_assemble_slots_t  *s = cs_equation_assemble_slots[k];
+
+    if (s == NULL)
+      continue;
+    if (s->ma != ma)
+      continue;
+
+    const cs_lnum_t  *x_ids = s->c2x->ids + s->c2x->idx[c_id];
+
+    /* Cellwise DoFs should be ordered as in the c2x adjacency. Otherwise,
+       positions are searched for (this check is linear in the number of
+       DoFs whereas the assembly is quadratic) */
+    if (s->c2x->idx[c_id+1] - s->c2x->idx[c_id] != n_dofs)
+      return NULL;
+    for (int i = 0; i < n_dofs; i++)
+      if (x_ids[i] != dof_ids[i])
+        return NULL;
+
+    return s->ids + s->idx[c_id];
+
+  }
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a MSR matrix using precomputed positions.
+ *
+ *  Specific case:
+ *        CDO schemes with no openMP and scalar-valued quantities
+ *
+ * \param[in]      row         pointer to a cs_equation_assemble_row_t type
+ * \param[in]      slots       positions of the row entries
+ * \param[in, out] matrix_p    untyped pointer to matrix description structure
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static void
+_add_scal_slots_single(const cs_equation_assemble_row_t   *row,
+                       const cs_lnum_t                    *slots,
+                       void                               *matrix_p)
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  /* Update the diagonal value */
+  mc->_d_val[slots[row->i]] += row->val[row->i];
+
+  /* Update the extra-diagonal values */
+  cs_real_t  *xvals = mc->_x_val;
+  for (int j = 0; j < row->i; j++) /* Lower part */
+    xvals[slots[j]] += row->val[j];
+  for (int j = row->i+1; j < row->n_cols; j++) /* Upper part */
+    xvals[slots[j]] += row->val[j];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a MSR matrix using precomputed positions.
+ *
+ *  Specific case:
+ *        CDO schemes with openMP atomic section and scalar-valued quantities
+ *
+ * \param[in]      row         pointer to a cs_equation_assemble_row_t type
+ * \param[in]      slots       positions of the row entries
+ * \param[in, out] matrix_p    untyped pointer to matrix description structure
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static void
+_add_scal_slots_atomic(const cs_equation_assemble_row_t   *row,
+                       const cs_lnum_t                    *slots,
+                       void                               *matrix_p)
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  /* Update the diagonal value */
+# pragma omp atomic
+  mc->_d_val[slots[row->i]] += row->val[row->i];
+
+  /* Update the extra-diagonal values */
+  cs_real_t  *xvals = mc->_x_val;
+  for (int j = 0; j < row->n_cols; j++) {
+    if (j != row->i) {
+#     pragma omp atomic
+      xvals[slots[j]] += row->val[j];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a MSR matrix using precomputed positions.
+ *
+ *  Specific case:
+ *        CDO schemes with openMP critical section and scalar-valued quantities
+ *
+ * \param[in]      row         pointer to a cs_equation_assemble_row_t type
+ * \param[in]      slots       positions of the row entries
+ * \param[in, out] matrix_p    untyped pointer to matrix description structure
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static void
+_add_scal_slots_critical(const cs_equation_assemble_row_t   *row,
+                         const cs_lnum_t                    *slots,
+                         void                               *matrix_p)
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+# pragma omp critical
+  {
+    /* Update the diagonal value */
+    mc->_d_val[slots[row->i]] += row->val[row->i];
+
+    /* Update the extra-diagonal values */
+    cs_real_t  *xvals = mc->_x_val;
+    for (int j = 0; j < row->n_cols; j++)
+      if (j != row->i)
+        xvals[slots[j]] += row->val[j];
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add values to a matrix assembler values structure using global
@@ -908,6 +1086,127 @@ _build_matrix_assembler(cs_lnum_t                n_elts,
   return ma;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate and define the positions of the entries of all cellwise
+ *         matrices in the coefficients of a (scalar-valued) MSR matrix
+ *         related to a given matrix assembler
+ *
+ * \param[in]  ma     pointer to a cs_matrix_assembler_t structure
+ * \param[in]  c2x    cell --> DoFs adjacency
+ * \param[in]  rs     pointer to a range set structure
+ *
+ * \return a pointer to a new allocated cs_equation_assemble_slots_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_equation_assemble_slots_t *
+_build_slots(const cs_matrix_assembler_t    *ma,
+             const cs_adjacency_t           *c2x,
+             const cs_range_set_t           *rs)
+{
+  const cs_lnum_t  n_cells = c2x->n_elts;
+
+  cs_equation_assemble_slots_t  *s = NULL;
+
+  BFT_MALLOC(s, 1, cs_equation_assemble_slots_t);
+
+  s->ma = ma;
+  s->c2x = c2x;
+
+  BFT_MALLOC(s->idx, n_cells + 1, cs_lnum_t);
+
+  s->idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_lnum_t  n_xc = c2x->idx[c_id+1] - c2x->idx[c_id];
+    s->idx[c_id+1] = s->idx[c_id] + n_xc*n_xc;
+  }
+
+  BFT_MALLOC(s->ids, s->idx[n_cells], cs_lnum_t);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    const cs_lnum_t  *x_ids = c2x->ids + c2x->idx[c_id];
+    const int  n_xc = c2x->idx[c_id+1] - c2x->idx[c_id];
+
+    for (int i = 0; i < n_xc; i++) {
+
+      cs_lnum_t  *slots = s->ids + s->idx[c_id] + i*n_xc;
+
+      const cs_gnum_t  g_r_id = rs->g_id[x_ids[i]];
+      const cs_lnum_t  l_r_id = g_r_id - rs->l_range[0];
+
+      if (l_r_id < 0 || l_r_id >= rs->n_elts[0]) { /* Distant row */
+        for (int j = 0; j < n_xc; j++)
+          slots[j] = -1;
+        continue;
+      }
+
+      const cs_lnum_t  l_start = ma->r_idx[l_r_id];
+      const cs_lnum_t  l_end = ma->r_idx[l_r_id+1];
+      cs_lnum_t  d_start = 0, n_d_cols = 0;
+      if (ma->d_r_idx != NULL) {
+        d_start = ma->d_r_idx[l_r_id];
+        n_d_cols = ma->d_r_idx[l_r_id+1] - d_start;
+      }
+      const int  n_l_cols = l_end - l_start - n_d_cols;
+
+      for (int j = 0; j < n_xc; j++) {
+
+        if (j == i) {
+          slots[j] = l_r_id;    /* Position in the diagonal array */
+          continue;
+        }
+
+        const cs_gnum_t  g_c_id = rs->g_id[x_ids[j]];
+
+        int  col_idx = -1;
+        if (g_c_id >= ma->l_range[0] && g_c_id < ma->l_range[1])
+          col_idx = _l_binary_search(0,
+                                     n_l_cols,
+                                     g_c_id - ma->l_range[0], /* l_c_id */
+                                     ma->c_id + l_start);
+        else
+          col_idx = n_l_cols + _g_binary_search(n_d_cols,
+                                                g_c_id,
+                                                ma->d_g_c_id + d_start);
+        assert(col_idx > -1);
+
+        slots[j] = l_start + col_idx;
+
+      }
+
+    } /* Loop on cellwise rows */
+
+  } /* Loop on cells */
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_equation_assemble_slots_t structure
+ *
+ * \param[in, out]  p_s    pointer to a structure pointer to be freed
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_slots(cs_equation_assemble_slots_t  **p_s)
+{
+  cs_equation_assemble_slots_t  *s = *p_s;
+
+  if (s == NULL)
+    return;
+
+  BFT_FREE(s->idx);
+  BFT_FREE(s->ids);
+  BFT_FREE(s);
+
+  *p_s = NULL;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -999,6 +1298,11 @@ cs_equation_assemble_init(const cs_cdo_connect_t       *connect,
   for (int i = 0; i < CS_CDO_CONNECT_N_CASES; i++)
     cs_equation_assemble_ms[i] = NULL;
 
+  BFT_MALLOC(cs_equation_assemble_slots,
+             CS_CDO_CONNECT_N_CASES, cs_equation_assemble_slots_t *);
+  for (int i = 0; i < CS_CDO_CONNECT_N_CASES; i++)
+    cs_equation_assemble_slots[i] = NULL;
+
   const cs_lnum_t  n_faces = connect->n_faces[CS_ALL_FACES];
   const cs_lnum_t  n_vertices = connect->n_vertices;
   const cs_lnum_t  n_edges = connect->n_edges;
@@ -1032,6 +1336,8 @@ cs_equation_assemble_init(const cs_cdo_connect_t       *connect,
 
       cs_equation_assemble_ma[CS_CDO_CONNECT_VTX_SCAL] = ma;
       cs_equation_assemble_ms[CS_CDO_CONNECT_VTX_SCAL] = ms;
+      cs_equation_assemble_slots[CS_CDO_CONNECT_VTX_SCAL]
+        = _build_slots(ma, connect->c2v, rs);
 
       t1 = cs_timer_time();
       cs_timer_counter_add_diff(&cs_equation_ms_time, &t0, &t1);
@@ -1083,6 +1389,8 @@ cs_equation_assemble_init(const cs_cdo_connect_t       *connect,
 
       cs_equation_assemble_ma[CS_CDO_CONNECT_EDGE_SCAL] = ma;
       cs_equation_assemble_ms[CS_CDO_CONNECT_EDGE_SCAL] = ms;
+      cs_equation_assemble_slots[CS_CDO_CONNECT_EDGE_SCAL]
+        = _build_slots(ma, connect->c2e, rs);
 
       t1 = cs_timer_time();
       cs_timer_counter_add_diff(&cs_equation_ms_time, &t0, &t1);
@@ -1112,6 +1420,8 @@ cs_equation_assemble_init(const cs_cdo_connect_t       *connect,
 
       cs_equation_assemble_ma[CS_CDO_CONNECT_FACE_SP0] = ma0;
       cs_equation_assemble_ms[CS_CDO_CONNECT_FACE_SP0] = ms0;
+      cs_equation_assemble_slots[CS_CDO_CONNECT_FACE_SP0]
+        = _build_slots(ma0, connect->c2f, rs);
 
       t1 = cs_timer_time();
       cs_timer_counter_add_diff(&cs_equation_ms_time, &t0, &t1);
@@ -1264,6 +1574,11 @@ cs_equation_assemble_finalize(void)
 #endif
   BFT_FREE(cs_equation_assemble);
 
+  /* Free precomputed positions */
+  for (int i = 0; i < CS_CDO_CONNECT_N_CASES; i++)
+    _free_slots(&(cs_equation_assemble_slots[i]));
+  BFT_FREE(cs_equation_assemble_slots);
+
   /* Free matrix structures */
   for (int i = 0; i < CS_CDO_CONNECT_N_CASES; i++)
     cs_matrix_structure_destroy(&(cs_equation_assemble_ms[i]));
@@ -1340,6 +1655,7 @@ cs_equation_assemble_set(cs_param_space_scheme_t    scheme,
  *         Scalar-valued case. Parallel and with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to a matrix assembler buffers
@@ -1349,6 +1665,7 @@ cs_equation_assemble_set(cs_param_space_scheme_t    scheme,
 
 void
 cs_equation_assemble_matrix_mpit(const cs_sdm_t                   *m,
+                                 cs_lnum_t                        c_id,
                                  const cs_lnum_t                  *dof_ids,
                                  const cs_range_set_t             *rset,
                                  cs_equation_assemble_t           *eqa,
@@ -1360,6 +1677,9 @@ cs_equation_assemble_matrix_mpit(const cs_sdm_t                   *m,
 
   row->n_cols = m->n_rows;
 
+  /* Precomputed positions of the local entries (if available) */
+  const cs_lnum_t  *slots = _get_cell_slots(ma, c_id, dof_ids, row->n_cols);
+
   /* Switch to the global numbering */
   for (int i = 0; i < row->n_cols; i++)
     row->col_g_id[i] = rset->g_id[dof_ids[i]];
@@ -1375,6 +1695,15 @@ cs_equation_assemble_matrix_mpit(const cs_sdm_t                   *m,
     if (row->l_id < 0 || row->l_id >= rset->n_elts[0])
       _assemble_row_scal_dt(mav, ma, row);
 
+    else if (slots != NULL) {
+
+#if CS_CDO_OMP_SYNC_SECTIONS > 0 /* OpenMP with critical section */
+      _add_scal_slots_critical(row, slots + i*row->n_cols, mav->matrix);
+#else
+      _add_scal_slots_atomic(row, slots + i*row->n_cols, mav->matrix);
+#endif
+
+    }
     else {
 
       _assemble_row_scal_ld(ma, row);
@@ -1397,6 +1726,7 @@ cs_equation_assemble_matrix_mpit(const cs_sdm_t                   *m,
  *         Scalar-valued case. Parallel without openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to a matrix assembler buffers
@@ -1406,6 +1736,7 @@ cs_equation_assemble_matrix_mpit(const cs_sdm_t                   *m,
 
 void
 cs_equation_assemble_matrix_mpis(const cs_sdm_t                   *m,
+                                 cs_lnum_t                        c_id,
                                  const cs_lnum_t                  *dof_ids,
                                  const cs_range_set_t             *rset,
                                  cs_equation_assemble_t           *eqa,
@@ -1417,6 +1748,9 @@ cs_equation_assemble_matrix_mpis(const cs_sdm_t                   *m,
 
   row->n_cols = m->n_rows;
 
+  /* Precomputed positions of the local entries (if available) */
+  const cs_lnum_t  *slots = _get_cell_slots(ma, c_id, dof_ids, row->n_cols);
+
   /* Switch to the global numbering */
   for (int i = 0; i < row->n_cols; i++)
     row->col_g_id[i] = rset->g_id[dof_ids[i]];
@@ -1432,6 +1766,9 @@ cs_equation_assemble_matrix_mpis(const cs_sdm_t                   *m,
     if (row->l_id < 0 || row->l_id >= rset->n_elts[0])
       _assemble_row_scal_ds(mav, ma, row);
 
+    else if (slots != NULL)
+      _add_scal_slots_single(row, slots + i*row->n_cols, mav->matrix);
+
     else {
 
       _assemble_row_scal_ld(ma, row);
@@ -1451,6 +1788,7 @@ cs_equation_assemble_matrix_mpis(const cs_sdm_t                   *m,
  *         Scalar-valued case. Sequential and with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to a matrix assembler buffers
@@ -1460,6 +1798,7 @@ cs_equation_assemble_matrix_mpis(const cs_sdm_t                   *m,
 
 void
 cs_equation_assemble_matrix_seqt(const cs_sdm_t                  *m,
+                                 cs_lnum_t                       c_id,
                                  const cs_lnum_t                 *dof_ids,
                                  const cs_range_set_t            *rset,
                                  cs_equation_assemble_t          *eqa,
@@ -1471,6 +1810,27 @@ cs_equation_assemble_matrix_seqt(const cs_sdm_t                  *m,
 
   row->n_cols = m->n_rows;
 
+  /* Precomputed positions of the entries (if available) */
+  const cs_lnum_t  *slots = _get_cell_slots(ma, c_id, dof_ids, row->n_cols);
+
+  if (slots != NULL) {
+
+    for (int i = 0; i < row->n_cols; i++) {
+
+      row->i = i;                               /* cellwise numbering */
+      row->val = m->val + i*row->n_cols;
+
+#if CS_CDO_OMP_SYNC_SECTIONS > 0 /* OpenMP with critical section */
+      _add_scal_slots_critical(row, slots + i*row->n_cols, mav->matrix);
+#else
+      _add_scal_slots_atomic(row, slots + i*row->n_cols, mav->matrix);
+#endif
+
+    }
+
+    return;
+  }
+
   /* Switch to the global numbering */
   for (int i = 0; i < row->n_cols; i++)
     row->col_g_id[i] = rset->g_id[dof_ids[i]];
@@ -1501,6 +1861,7 @@ cs_equation_assemble_matrix_seqt(const cs_sdm_t                  *m,
  *         Scalar-valued case. Sequential and without openMP.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to a matrix assembler buffers
@@ -1510,6 +1871,7 @@ cs_equation_assemble_matrix_seqt(const cs_sdm_t                  *m,
 
 void
 cs_equation_assemble_matrix_seqs(const cs_sdm_t                  *m,
+                                 cs_lnum_t                       c_id,
                                  const cs_lnum_t                 *dof_ids,
                                  const cs_range_set_t            *rset,
                                  cs_equation_assemble_t          *eqa,
@@ -1521,6 +1883,23 @@ cs_equation_assemble_matrix_seqs(const cs_sdm_t                  *m,
 
   row->n_cols = m->n_rows;
 
+  /* Precomputed positions of the entries (if available) */
+  const cs_lnum_t  *slots = _get_cell_slots(ma, c_id, dof_ids, row->n_cols);
+
+  if (slots != NULL) {
+
+    for (int i = 0; i < row->n_cols; i++) {
+
+      row->i = i;                               /* cellwise numbering */
+      row->val = m->val + i*row->n_cols;
+
+      _add_scal_slots_single(row, slots + i*row->n_cols, mav->matrix);
+
+    }
+
+    return;
+  }
+
   /* Switch to the global numbering */
   for (int i = 0; i < row->n_cols; i++)
     row->col_g_id[i] = rset->g_id[dof_ids[i]];
@@ -1547,6 +1926,7 @@ cs_equation_assemble_matrix_seqs(const cs_sdm_t                  *m,
  *         Sequential run without openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -1556,11 +1936,14 @@ cs_equation_assemble_matrix_seqs(const cs_sdm_t                  *m,
 
 void
 cs_equation_assemble_eblock33_matrix_seqs(const cs_sdm_t               *m,
+                                          cs_lnum_t                    c_id,
                                           const cs_lnum_t              *dof_ids,
                                           const cs_range_set_t         *rset,
                                           cs_equation_assemble_t       *eqa,
                                           cs_matrix_assembler_values_t *mav)
 {
+  CS_UNUSED(c_id);
+
   const cs_sdm_block_t  *bd = m->block_desc;
   const cs_matrix_assembler_t  *ma = mav->ma;
 
@@ -1624,6 +2007,7 @@ cs_equation_assemble_eblock33_matrix_seqs(const cs_sdm_t               *m,
  *         Sequential run with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -1633,11 +2017,14 @@ cs_equation_assemble_eblock33_matrix_seqs(const cs_sdm_t               *m,
 
 void
 cs_equation_assemble_eblock33_matrix_seqt(const cs_sdm_t                *m,
+                                          cs_lnum_t                     c_id,
                                           const cs_lnum_t               *dof_ids,
                                           const cs_range_set_t          *rset,
                                           cs_equation_assemble_t        *eqa,
                                           cs_matrix_assembler_values_t  *mav)
 {
+  CS_UNUSED(c_id);
+
   const cs_sdm_block_t  *bd = m->block_desc;
   const cs_matrix_assembler_t  *ma = mav->ma;
 
@@ -1707,6 +2094,7 @@ cs_equation_assemble_eblock33_matrix_seqt(const cs_sdm_t                *m,
  *         Parallel run without openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -1716,11 +2104,14 @@ cs_equation_assemble_eblock33_matrix_seqt(const cs_sdm_t                *m,
 
 void
 cs_equation_assemble_eblock33_matrix_mpis(const cs_sdm_t                *m,
+                                          cs_lnum_t                     c_id,
                                           const cs_lnum_t               *dof_ids,
                                           const cs_range_set_t          *rset,
                                           cs_equation_assemble_t        *eqa,
                                           cs_matrix_assembler_values_t  *mav)
 {
+  CS_UNUSED(c_id);
+
   const cs_sdm_block_t  *bd = m->block_desc;
   const cs_matrix_assembler_t  *ma = mav->ma;
 
@@ -1791,6 +2182,7 @@ cs_equation_assemble_eblock33_matrix_mpis(const cs_sdm_t                *m,
  *         Parallel run with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -1800,11 +2192,14 @@ cs_equation_assemble_eblock33_matrix_mpis(const cs_sdm_t                *m,
 
 void
 cs_equation_assemble_eblock33_matrix_mpit(const cs_sdm_t               *m,
+                                          cs_lnum_t                    c_id,
                                           const cs_lnum_t              *dof_ids,
                                           const cs_range_set_t         *rset,
                                           cs_equation_assemble_t       *eqa,
                                           cs_matrix_assembler_values_t *mav)
 {
+  CS_UNUSED(c_id);
+
   const cs_sdm_block_t  *bd = m->block_desc;
   const cs_matrix_assembler_t  *ma = mav->ma;
 
@@ -1882,6 +2277,7 @@ cs_equation_assemble_eblock33_matrix_mpit(const cs_sdm_t               *m,
  *         Sequential run without openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -1891,11 +2287,14 @@ cs_equation_assemble_eblock33_matrix_mpit(const cs_sdm_t               *m,
 
 void
 cs_equation_assemble_eblock_matrix_seqs(const cs_sdm_t                *m,
+                                        cs_lnum_t                     c_id,
                                         const cs_lnum_t               *dof_ids,
                                         const cs_range_set_t          *rset,
                                         cs_equation_assemble_t        *eqa,
                                         cs_matrix_assembler_values_t  *mav)
 {
+  CS_UNUSED(c_id);
+
   const cs_sdm_block_t  *bd = m->block_desc;
   const cs_matrix_assembler_t  *ma = mav->ma;
 
@@ -1962,6 +2361,7 @@ cs_equation_assemble_eblock_matrix_seqs(const cs_sdm_t                *m,
  *         Sequential run with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -1971,11 +2371,14 @@ cs_equation_assemble_eblock_matrix_seqs(const cs_sdm_t                *m,
 
 void
 cs_equation_assemble_eblock_matrix_seqt(const cs_sdm_t                *m,
+                                        cs_lnum_t                     c_id,
                                         const cs_lnum_t               *dof_ids,
                                         const cs_range_set_t          *rset,
                                         cs_equation_assemble_t        *eqa,
                                         cs_matrix_assembler_values_t  *mav)
 {
+  CS_UNUSED(c_id);
+
   const cs_sdm_block_t  *bd = m->block_desc;
   const cs_matrix_assembler_t  *ma = mav->ma;
 
@@ -2049,6 +2452,7 @@ cs_equation_assemble_eblock_matrix_seqt(const cs_sdm_t                *m,
  *         Parallel run without openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -2058,11 +2462,14 @@ cs_equation_assemble_eblock_matrix_seqt(const cs_sdm_t                *m,
 
 void
 cs_equation_assemble_eblock_matrix_mpis(const cs_sdm_t                *m,
+                                        cs_lnum_t                     c_id,
                                         const cs_lnum_t               *dof_ids,
                                         const cs_range_set_t          *rset,
                                         cs_equation_assemble_t        *eqa,
                                         cs_matrix_assembler_values_t  *mav)
 {
+  CS_UNUSED(c_id);
+
   const cs_sdm_block_t  *bd = m->block_desc;
   const cs_matrix_assembler_t  *ma = mav->ma;
 
@@ -2138,6 +2545,7 @@ cs_equation_assemble_eblock_matrix_mpis(const cs_sdm_t                *m,
  *         Parallel run with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -2147,11 +2555,14 @@ cs_equation_assemble_eblock_matrix_mpis(const cs_sdm_t                *m,
 
 void
 cs_equation_assemble_eblock_matrix_mpit(const cs_sdm_t                *m,
+                                        cs_lnum_t                     c_id,
                                         const cs_lnum_t               *dof_ids,
                                         const cs_range_set_t          *rset,
                                         cs_equation_assemble_t        *eqa,
                                         cs_matrix_assembler_values_t  *mav)
 {
+  CS_UNUSED(c_id);
+
   const cs_sdm_block_t  *bd = m->block_desc;
   const cs_matrix_assembler_t  *ma = mav->ma;
 
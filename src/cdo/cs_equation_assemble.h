@@ -61,6 +61,7 @@ typedef struct _cs_equation_assemble_t  cs_equation_assemble_t;
  *         Block or no block versions are handled
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -70,6 +71,7 @@ typedef struct _cs_equation_assemble_t  cs_equation_assemble_t;
 
 typedef void
 (cs_equation_assembly_t)(const cs_sdm_t                         *m,
+                         cs_lnum_t                              c_id,
                          const cs_lnum_t                        *dof_ids,
                          const cs_range_set_t                   *rset,
                          cs_equation_assemble_t                 *eqa,
@@ -163,6 +165,7 @@ cs_equation_assemble_set(cs_param_space_scheme_t    scheme,
  *         Scalar-valued case. Parallel and with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to a matrix assembler buffers
@@ -172,6 +175,7 @@ cs_equation_assemble_set(cs_param_space_scheme_t    scheme,
 
 void
 cs_equation_assemble_matrix_mpit(const cs_sdm_t                   *m,
+                                 cs_lnum_t                        c_id,
                                  const cs_lnum_t                  *dof_ids,
                                  const cs_range_set_t             *rset,
                                  cs_equation_assemble_t           *eqa,
@@ -183,6 +187,7 @@ cs_equation_assemble_matrix_mpit(const cs_sdm_t                   *m,
  *         Scalar-valued case. Parallel without openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to a matrix assembler buffers
@@ -192,6 +197,7 @@ cs_equation_assemble_matrix_mpit(const cs_sdm_t                   *m,
 
 void
 cs_equation_assemble_matrix_mpis(const cs_sdm_t                   *m,
+                                 cs_lnum_t                        c_id,
                                  const cs_lnum_t                  *dof_ids,
                                  const cs_range_set_t             *rset,
                                  cs_equation_assemble_t           *eqa,
@@ -205,6 +211,7 @@ cs_equation_assemble_matrix_mpis(const cs_sdm_t                   *m,
  *         Scalar-valued case. Sequential and with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to a matrix assembler buffers
@@ -214,6 +221,7 @@ cs_equation_assemble_matrix_mpis(const cs_sdm_t                   *m,
 
 void
 cs_equation_assemble_matrix_seqt(const cs_sdm_t                  *m,
+                                 cs_lnum_t                       c_id,
                                  const cs_lnum_t                 *dof_ids,
                                  const cs_range_set_t            *rset,
                                  cs_equation_assemble_t          *eqa,
@@ -225,6 +233,7 @@ cs_equation_assemble_matrix_seqt(const cs_sdm_t                  *m,
  *         Scalar-valued case. Sequential and without openMP.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to a matrix assembler buffers
@@ -234,6 +243,7 @@ cs_equation_assemble_matrix_seqt(const cs_sdm_t                  *m,
 
 void
 cs_equation_assemble_matrix_seqs(const cs_sdm_t                  *m,
+                                 cs_lnum_t                       c_id,
                                  const cs_lnum_t                 *dof_ids,
                                  const cs_range_set_t            *rset,
                                  cs_equation_assemble_t          *eqa,
@@ -246,6 +256,7 @@ cs_equation_assemble_matrix_seqs(const cs_sdm_t                  *m,
  *         Sequential run without openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -255,6 +266,7 @@ cs_equation_assemble_matrix_seqs(const cs_sdm_t                  *m,
 
 void
 cs_equation_assemble_eblock33_matrix_seqs(const cs_sdm_t               *m,
+                                          cs_lnum_t                    c_id,
                                           const cs_lnum_t              *dof_ids,
                                           const cs_range_set_t         *rset,
                                           cs_equation_assemble_t       *eqa,
@@ -267,6 +279,7 @@ cs_equation_assemble_eblock33_matrix_seqs(const cs_sdm_t               *m,
  *         Sequential run with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -276,6 +289,7 @@ cs_equation_assemble_eblock33_matrix_seqs(const cs_sdm_t               *m,
 
 void
 cs_equation_assemble_eblock33_matrix_seqt(const cs_sdm_t                *m,
+                                          cs_lnum_t                     c_id,
                                           const cs_lnum_t               *dof_ids,
                                           const cs_range_set_t          *rset,
                                           cs_equation_assemble_t        *eqa,
@@ -290,6 +304,7 @@ cs_equation_assemble_eblock33_matrix_seqt(const cs_sdm_t                *m,
  *         Parallel run without openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -299,6 +314,7 @@ cs_equation_assemble_eblock33_matrix_seqt(const cs_sdm_t                *m,
 
 void
 cs_equation_assemble_eblock33_matrix_mpis(const cs_sdm_t                *m,
+                                          cs_lnum_t                     c_id,
                                           const cs_lnum_t               *dof_ids,
                                           const cs_range_set_t          *rset,
                                           cs_equation_assemble_t        *eqa,
@@ -311,6 +327,7 @@ cs_equation_assemble_eblock33_matrix_mpis(const cs_sdm_t                *m,
  *         Parallel run with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -320,6 +337,7 @@ cs_equation_assemble_eblock33_matrix_mpis(const cs_sdm_t                *m,
 
 void
 cs_equation_assemble_eblock33_matrix_mpit(const cs_sdm_t               *m,
+                                          cs_lnum_t                    c_id,
                                           const cs_lnum_t              *dof_ids,
                                           const cs_range_set_t         *rset,
                                           cs_equation_assemble_t       *eqa,
@@ -334,6 +352,7 @@ cs_equation_assemble_eblock33_matrix_mpit(const cs_sdm_t               *m,
  *         Sequential run without openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -343,6 +362,7 @@ cs_equation_assemble_eblock33_matrix_mpit(const cs_sdm_t               *m,
 
 void
 cs_equation_assemble_eblock_matrix_seqs(const cs_sdm_t                *m,
+                                        cs_lnum_t                     c_id,
                                         const cs_lnum_t               *dof_ids,
                                         const cs_range_set_t          *rset,
                                         cs_equation_assemble_t        *eqa,
@@ -355,6 +375,7 @@ cs_equation_assemble_eblock_matrix_seqs(const cs_sdm_t                *m,
  *         Sequential run with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -364,6 +385,7 @@ cs_equation_assemble_eblock_matrix_seqs(const cs_sdm_t                *m,
 
 void
 cs_equation_assemble_eblock_matrix_seqt(const cs_sdm_t                *m,
+                                        cs_lnum_t                     c_id,
                                         const cs_lnum_t               *dof_ids,
                                         const cs_range_set_t          *rset,
                                         cs_equation_assemble_t        *eqa,
@@ -378,6 +400,7 @@ cs_equation_assemble_eblock_matrix_seqt(const cs_sdm_t                *m,
  *         Parallel run without openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -387,6 +410,7 @@ cs_equation_assemble_eblock_matrix_seqt(const cs_sdm_t                *m,
 
 void
 cs_equation_assemble_eblock_matrix_mpis(const cs_sdm_t                *m,
+                                        cs_lnum_t                     c_id,
                                         const cs_lnum_t               *dof_ids,
                                         const cs_range_set_t          *rset,
                                         cs_equation_assemble_t        *eqa,
@@ -399,6 +423,7 @@ cs_equation_assemble_eblock_matrix_mpis(const cs_sdm_t                *m,
  *         Parallel run with openMP threading.
  *
  * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      c_id     id of the related cell
  * \param[in]      dof_ids  local DoF numbering
  * \param[in]      rset     pointer to a cs_range_set_t structure
  * \param[in, out] eqa      pointer to an equation assembly structure
@@ -408,6 +433,7 @@ cs_equation_assemble_eblock_matrix_mpis(const cs_sdm_t                *m,
 
 void
 cs_equation_assemble_eblock_matrix_mpit(const cs_sdm_t                *m,
+                                        cs_lnum_t                     c_id,
                                         const cs_lnum_t               *dof_ids,
                                         const cs_range_set_t          *rset,
                                         cs_equation_assemble_t        *eqa,
@@ -0,0 +1,618 @@
+/*============================================================================
+ * Matrix-free application of operators arising from CDO schemes
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_interface.h"
+#include "cs_matrix_priv.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_equation_mfree.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_equation_mfree.c
+
+  \brief Matrix-free application of operators arising from CDO schemes.
+
+  The cellwise matrices are not assembled into a global matrix. When the
+  cellwise matrix of a cell only differs from a cached local matrix (for
+  instance a stiffness matrix related to a steady property) by its diagonal
+  terms, only these diagonal terms are kept (summed by DoF). Otherwise, the
+  full cellwise matrix is stored. The matrix-vector product loops on DoFs
+  and gathers the contributions of the surrounding cells, so that no
+  synchronization between threads is needed. Only the diagonal of the
+  operator is stored in the related matrix structure (for diagonal or
+  polynomial preconditioning).
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+struct _cs_equation_mfree_t {
+
+  const cs_adjacency_t    *c2x;       /* cell -> DoFs adjacency (shared) */
+  const cs_range_set_t    *rset;      /* range set related to DoFs (shared) */
+  const cs_hodge_cache_t  *cache;     /* cached local matrices or NULL */
+
+  cs_lnum_t                n_x;       /* number of DoFs (scatter view) */
+  cs_lnum_t               *x2c_idx;   /* DoF -> cells index (size n_x + 1) */
+  cs_lnum_t               *x2c_ids;   /* DoF -> cells ids */
+  short int               *x2c_pos;   /* position of the DoF in the cell */
+
+  bool                    *use_cache; /* is the cellwise matrix equal to the
+                                         cached one up to its diagonal */
+  cs_real_t              **cell_mat;  /* cellwise matrices not related to the
+                                         cache (NULL otherwise) */
+
+  cs_real_t               *d_extra;   /* diagonal terms added to the cached
+                                         matrices (scatter view) */
+  cs_real_t               *d_scat;    /* diagonal of the operator (scatter
+                                         view, local contributions) */
+
+  cs_real_t               *x_scat;    /* buffers for the product in parallel */
+  cs_real_t               *y_scat;
+
+  const cs_matrix_t       *matrix;    /* associated matrix or NULL */
+
+};
+
+/*============================================================================
+ * Local private variables
+ *============================================================================*/
+
+/* Operators currently associated to a matrix */
+
+static int                    _n_active = 0;
+static cs_equation_mfree_t  **_active = NULL;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute y = A.x for DoFs in the scatter view
+ *
+ * \param[in]      mf      pointer to a cs_equation_mfree_t structure
+ * \param[in]      x       multiplying vector values
+ * \param[in, out] y       resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cellwise_product(const cs_equation_mfree_t    *mf,
+                  const cs_real_t              *restrict x,
+                  cs_real_t                    *restrict y)
+{
+  const cs_adjacency_t  *c2x = mf->c2x;
+  const cs_hodge_cache_t  *cache = mf->cache;
+
+# pragma omp parallel for if (mf->n_x > CS_THR_MIN)
+  for (cs_lnum_t v = 0; v < mf->n_x; v++) {
+
+    cs_real_t  yv = mf->d_extra[v]*x[v];
+
+    for (cs_lnum_t k = mf->x2c_idx[v]; k < mf->x2c_idx[v+1]; k++) {
+
+      const cs_lnum_t  c_id = mf->x2c_ids[k];
+      const short int  i = mf->x2c_pos[k];
+      const cs_lnum_t  *x_ids = c2x->ids + c2x->idx[c_id];
+      const short int  n = c2x->idx[c_id+1] - c2x->idx[c_id];
+
+      if (mf->use_cache[c_id]) {
+
+        /* Row i of a packed upper triangular matrix: entries (j,i) with j < i
+           then entries (i,j) with j >= i */
+        const cs_real_t  *s = cache->val + cache->idx[c_id];
+
+        cs_lnum_t  shift = i;
+        for (short int j = 0; j < i; j++) {
+          yv += s[shift]*x[x_ids[j]];
+          shift += n - j - 1;
+        }
+        for (short int j = i; j < n; j++)
+          yv += s[shift + j - i]*x[x_ids[j]];
+
+      }
+      else {
+
+        const cs_real_t  *m_i = mf->cell_mat[c_id] + i*n;
+        for (short int j = 0; j < n; j++)
+          yv += m_i[j]*x[x_ids[j]];
+
+      }
+
+    } /* Loop on cells sharing this DoF */
+
+    y[v] = yv;
+
+  } /* Loop on DoFs */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Local matrix.vector product y = A.x with a matrix-free operator
+ *         (function with the signature of cs_matrix_vector_product_t)
+ *
+ * \param[in]      exclude_diag  exclude diagonal if true
+ * \param[in]      matrix        pointer to the matrix structure
+ * \param[in]      x             multiplying vector values
+ * \param[in, out] y             resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_mfree_vector_multiply(bool                exclude_diag,
+                       const cs_matrix_t  *matrix,
+                       const cs_real_t    *restrict x,
+                       cs_real_t          *restrict y)
+{
+  cs_equation_mfree_t  *mf = NULL;
+  for (int i = 0; i < _n_active; i++) {
+    if (_active[i]->matrix == matrix) {
+      mf = _active[i];
+      break;
+    }
+  }
+
+  if (mf == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: No matrix-free operator is associated to this matrix.",
+              __func__);
+
+  const cs_lnum_t  n_rows = matrix->n_rows;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (cs_glob_n_ranks > 1) {
+
+    /* Contributions of local cells to the DoFs shared with other ranks are
+       summed before switching back to the gathered view */
+    cs_range_set_scatter(mf->rset, CS_REAL_TYPE, 1, x, mf->x_scat);
+
+    _cellwise_product(mf, mf->x_scat, mf->y_scat);
+
+    cs_interface_set_sum(mf->rset->ifs,
+                         mf->n_x, 1, false, CS_REAL_TYPE,
+                         mf->y_scat);
+
+    cs_range_set_gather(mf->rset, CS_REAL_TYPE, 1, mf->y_scat, y);
+
+  }
+  else {
+
+    assert(n_rows == mf->n_x);
+    _cellwise_product(mf, x, y);
+
+  }
+
+  if (exclude_diag) {
+#   pragma omp parallel for if (n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      y[i] -= mc->d_val[i]*x[i];
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the resolution of a linear system can rely on a
+ *         matrix-free operator with the given set of parameters
+ *
+ * \param[in]  slesp     set of parameters for the linear algebra
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_equation_mfree_is_compatible(const cs_param_sles_t    slesp)
+{
+  if (slesp.solver_class != CS_PARAM_SLES_CLASS_CS)
+    return false;
+
+  /* Only the matrix-vector product and the diagonal are available */
+  switch (slesp.solver) {
+
+  case CS_PARAM_ITSOL_BICG:
+  case CS_PARAM_ITSOL_BICGSTAB2:
+  case CS_PARAM_ITSOL_CG:
+  case CS_PARAM_ITSOL_CR3:
+  case CS_PARAM_ITSOL_FCG:
+  case CS_PARAM_ITSOL_GMRES:
+  case CS_PARAM_ITSOL_JACOBI:
+    break;
+
+  default:
+    return false;
+
+  }
+
+  switch (slesp.precond) {
+
+  case CS_PARAM_PRECOND_NONE:
+  case CS_PARAM_PRECOND_DIAG:
+  case CS_PARAM_PRECOND_POLY1:
+  case CS_PARAM_PRECOND_POLY2:
+    return true;
+
+  default:
+    return false;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a structure to apply an operator without assembling it.
+ *         Cellwise matrices matching a cached matrix up to diagonal terms
+ *         are applied from the cache.
+ *
+ * \param[in]  c2x       cell -> DoFs adjacency
+ * \param[in]  rset      pointer to the related cs_range_set_t structure
+ * \param[in]  cache     pointer to a cache of local matrices or NULL
+ *
+ * \return a pointer to a new allocated cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_equation_mfree_t *
+cs_equation_mfree_create(const cs_adjacency_t     *c2x,
+                         const cs_range_set_t     *rset,
+                         const cs_hodge_cache_t   *cache)
+{
+  assert(c2x != NULL && rset != NULL);
+
+  if (cache != NULL && (cache->c2x != c2x || cache->n_extra != 0))
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Cache of local matrices not consistent with the DoFs.",
+              __func__);
+
+  cs_equation_mfree_t  *mf = NULL;
+
+  BFT_MALLOC(mf, 1, cs_equation_mfree_t);
+
+  const cs_lnum_t  n_cells = c2x->n_elts;
+  const cs_lnum_t  n_x = rset->n_elts[1];
+
+  mf->c2x = c2x;
+  mf->rset = rset;
+  mf->cache = cache;
+  mf->n_x = n_x;
+  mf->matrix = NULL;
+
+  /* Build the DoF -> cells adjacency with the local position of the DoF in
+     each cell */
+  BFT_MALLOC(mf->x2c_idx, n_x + 1, cs_lnum_t);
+  memset(mf->x2c_idx, 0, (n_x + 1)*sizeof(cs_lnum_t));
+
+  for (cs_lnum_t j = 0; j < c2x->idx[n_cells]; j++)
+    mf->x2c_idx[c2x->ids[j] + 1] += 1;
+  for (cs_lnum_t i = 0; i < n_x; i++)
+    mf->x2c_idx[i+1] += mf->x2c_idx[i];
+
+  cs_lnum_t  *count = NULL;
+  BFT_MALLOC(count, n_x, cs_lnum_t);
+  memset(count, 0, n_x*sizeof(cs_lnum_t));
+
+  BFT_MALLOC(mf->x2c_ids, mf->x2c_idx[n_x], cs_lnum_t);
+  BFT_MALLOC(mf->x2c_pos, mf->x2c_idx[n_x], short int);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (cs_lnum_t j = c2x->idx[c_id]; j < c2x->idx[c_id+1]; j++) {
+      const cs_lnum_t  x_id = c2x->ids[j];
+      const cs_lnum_t  shift = mf->x2c_idx[x_id] + count[x_id];
+      mf->x2c_ids[shift] = c_id;
+      mf->x2c_pos[shift] = j - c2x->idx[c_id];
+      count[x_id] += 1;
+    }
+  }
+
+  BFT_FREE(count);
+
+  BFT_MALLOC(mf->use_cache, n_cells, bool);
+  BFT_MALLOC(mf->cell_mat, n_cells, cs_real_t *);
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    mf->use_cache[c_id] = false;
+    mf->cell_mat[c_id] = NULL;
+  }
+
+  BFT_MALLOC(mf->d_extra, n_x, cs_real_t);
+  BFT_MALLOC(mf->d_scat, n_x, cs_real_t);
+
+  mf->x_scat = NULL, mf->y_scat = NULL;
+  if (cs_glob_n_ranks > 1) {
+    BFT_MALLOC(mf->x_scat, n_x, cs_real_t);
+    BFT_MALLOC(mf->y_scat, n_x, cs_real_t);
+  }
+
+  cs_equation_mfree_reset(mf);
+
+  return mf;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_equation_mfree_t structure
+ *
+ * \param[in, out]  p_mf    pointer to the structure pointer to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_free(cs_equation_mfree_t   **p_mf)
+{
+  cs_equation_mfree_t  *mf = *p_mf;
+
+  if (mf == NULL)
+    return;
+
+  cs_equation_mfree_release_matrix(mf);
+
+  BFT_FREE(mf->x2c_idx);
+  BFT_FREE(mf->x2c_ids);
+  BFT_FREE(mf->x2c_pos);
+
+  for (cs_lnum_t c_id = 0; c_id < mf->c2x->n_elts; c_id++)
+    BFT_FREE(mf->cell_mat[c_id]);
+  BFT_FREE(mf->cell_mat);
+  BFT_FREE(mf->use_cache);
+
+  BFT_FREE(mf->d_extra);
+  BFT_FREE(mf->d_scat);
+  BFT_FREE(mf->x_scat);
+  BFT_FREE(mf->y_scat);
+
+  BFT_FREE(mf);
+  *p_mf = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Reset the operator before a new cellwise build
+ *
+ * \param[in, out]  mf     pointer to a cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_reset(cs_equation_mfree_t   *mf)
+{
+  assert(mf != NULL);
+
+# pragma omp parallel for if (mf->n_x > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < mf->n_x; i++) {
+    mf->d_extra[i] = 0.;
+    mf->d_scat[i] = 0.;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Add the contribution of a cellwise matrix to the operator.
+ *         This function may be called concurrently for different cells.
+ *
+ * \param[in]      m        cellwise matrix
+ * \param[in]      c_id     id of the related cell
+ * \param[in, out] mf       pointer to a cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_add_cw(const cs_sdm_t          *m,
+                         cs_lnum_t                c_id,
+                         cs_equation_mfree_t     *mf)
+{
+  const cs_hodge_cache_t  *cache = mf->cache;
+  const cs_lnum_t  *x_ids = mf->c2x->ids + mf->c2x->idx[c_id];
+  const short int  n = m->n_rows;
+
+  assert(n == mf->c2x->idx[c_id+1] - mf->c2x->idx[c_id]);
+
+  /* Check if the extra-diagonal entries are those of the cached matrix */
+  bool  use_cache = (cache == NULL) ? false : cache->is_set[c_id];
+
+  if (use_cache) {
+
+    const cs_real_t  *s = cache->val + cache->idx[c_id];
+
+    for (short int i = 0; i < n && use_cache; i++) {
+
+      const cs_real_t  *m_i = m->val + i*n;
+
+      s++; /* Skip the diagonal entry */
+      for (short int j = i+1; j < n; j++, s++) {
+        if (fabs(m_i[j] - *s) > 0 || fabs(m->val[j*n+i] - *s) > 0) {
+          use_cache = false;
+          break;
+        }
+      }
+
+    }
+
+  }
+
+  mf->use_cache[c_id] = use_cache;
+
+  if (use_cache) {
+
+    BFT_FREE(mf->cell_mat[c_id]);
+
+    const cs_real_t  *s = cache->val + cache->idx[c_id];
+    for (short int i = 0; i < n; i++) {
+#     pragma omp atomic
+      mf->d_extra[x_ids[i]] += m->val[i*(n+1)] - s[0];
+      s += n - i;
+    }
+
+  }
+  else {
+
+    if (mf->cell_mat[c_id] == NULL)
+      BFT_MALLOC(mf->cell_mat[c_id], n*n, cs_real_t);
+    memcpy(mf->cell_mat[c_id], m->val, n*n*sizeof(cs_real_t));
+
+  }
+
+  for (short int i = 0; i < n; i++)
+#   pragma omp atomic
+    mf->d_scat[x_ids[i]] += m->val[i*(n+1)];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Attach the operator to a matrix sharing the structure of the
+ *         assembled matrix. Only the diagonal is stored in the matrix and
+ *         the matrix-vector product is performed cellwise.
+ *         The operator must remain available while the matrix is used.
+ *
+ * \param[in, out]  mf       pointer to a cs_equation_mfree_t structure
+ * \param[in, out]  matrix   pointer to a cs_matrix_t structure (MSR)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_set_matrix(cs_equation_mfree_t   *mf,
+                             cs_matrix_t           *matrix)
+{
+  assert(mf != NULL && matrix != NULL);
+
+  if (matrix->type != CS_MATRIX_MSR)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Only the MSR matrix format is handled.", __func__);
+
+  cs_equation_mfree_release_matrix(mf);
+
+  const cs_lnum_t  n_rows = matrix->n_rows;
+
+  /* Set fill type (scalar-valued and possibly non-symmetric) */
+  matrix->symmetric = false;
+  for (int i = 0; i < 4; i++) {
+    matrix->db_size[i] = 1;
+    matrix->eb_size[i] = 1;
+  }
+  matrix->fill_type = cs_matrix_get_fill_type(false, NULL, NULL);
+
+  /* Only the diagonal is stored */
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  BFT_REALLOC(mc->_d_val, n_rows, cs_real_t);
+  mc->max_db_size = 1;
+
+  if (cs_glob_n_ranks > 1) {
+
+    memcpy(mf->y_scat, mf->d_scat, mf->n_x*sizeof(cs_real_t));
+    cs_interface_set_sum(mf->rset->ifs,
+                         mf->n_x, 1, false, CS_REAL_TYPE,
+                         mf->y_scat);
+    cs_range_set_gather(mf->rset, CS_REAL_TYPE, 1, mf->y_scat, mc->_d_val);
+
+  }
+  else {
+
+    assert(n_rows == mf->n_x);
+    memcpy(mc->_d_val, mf->d_scat, n_rows*sizeof(cs_real_t));
+
+  }
+
+  mc->d_val = mc->_d_val;
+  mc->x_val = NULL;
+
+  matrix->vector_multiply[matrix->fill_type][0] = _mfree_vector_multiply;
+  matrix->vector_multiply[matrix->fill_type][1] = _mfree_vector_multiply;
+
+  /* Register the operator */
+  mf->matrix = matrix;
+
+  BFT_REALLOC(_active, _n_active + 1, cs_equation_mfree_t *);
+  _active[_n_active] = mf;
+  _n_active += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Detach the operator from its matrix (to call before the matrix is
+ *         destroyed)
+ *
+ * \param[in, out]  mf       pointer to a cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_release_matrix(cs_equation_mfree_t   *mf)
+{
+  if (mf == NULL || mf->matrix == NULL)
+    return;
+
+  int j = 0;
+  for (int i = 0; i < _n_active; i++) {
+    if (_active[i] != mf)
+      _active[j++] = _active[i];
+  }
+  _n_active = j;
+
+  if (_n_active == 0)
+    BFT_FREE(_active);
+
+  mf->matrix = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
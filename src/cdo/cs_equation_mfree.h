@@ -0,0 +1,164 @@
+#ifndef __CS_EQUATION_MFREE_H__
+#define __CS_EQUATION_MFREE_H__
+
+/*============================================================================
+ * Matrix-free application of operators arising from CDO schemes
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_hodge_cache.h"
+#include "cs_matrix.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_param_types.h"
+#include "cs_range_set.h"
+#include "cs_sdm.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+typedef struct _cs_equation_mfree_t  cs_equation_mfree_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the resolution of a linear system can rely on a
+ *         matrix-free operator with the given set of parameters
+ *
+ * \param[in]  slesp     set of parameters for the linear algebra
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_equation_mfree_is_compatible(const cs_param_sles_t    slesp);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a structure to apply an operator without assembling it.
+ *         Cellwise matrices matching a cached matrix up to diagonal terms
+ *         are applied from the cache.
+ *
+ * \param[in]  c2x       cell -> DoFs adjacency
+ * \param[in]  rset      pointer to the related cs_range_set_t structure
+ * \param[in]  cache     pointer to a cache of local matrices or NULL
+ *
+ * \return a pointer to a new allocated cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_equation_mfree_t *
+cs_equation_mfree_create(const cs_adjacency_t     *c2x,
+                         const cs_range_set_t     *rset,
+                         const cs_hodge_cache_t   *cache);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_equation_mfree_t structure
+ *
+ * \param[in, out]  p_mf    pointer to the structure pointer to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_free(cs_equation_mfree_t   **p_mf);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Reset the operator before a new cellwise build
+ *
+ * \param[in, out]  mf     pointer to a cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_reset(cs_equation_mfree_t   *mf);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Add the contribution of a cellwise matrix to the operator.
+ *         This function may be called concurrently for different cells.
+ *
+ * \param[in]      m        cellwise matrix
+ * \param[in]      c_id     id of the related cell
+ * \param[in, out] mf       pointer to a cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_add_cw(const cs_sdm_t          *m,
+                         cs_lnum_t                c_id,
+                         cs_equation_mfree_t     *mf);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Attach the operator to a matrix sharing the structure of the
+ *         assembled matrix. Only the diagonal is stored in the matrix and
+ *         the matrix-vector product is performed cellwise.
+ *         The operator must remain available while the matrix is used.
+ *
+ * \param[in, out]  mf       pointer to a cs_equation_mfree_t structure
+ * \param[in, out]  matrix   pointer to a cs_matrix_t structure (MSR)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_set_matrix(cs_equation_mfree_t   *mf,
+                             cs_matrix_t           *matrix);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Detach the operator from its matrix (to call before the matrix is
+ *         destroyed)
+ *
+ * \param[in, out]  mf       pointer to a cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_release_matrix(cs_equation_mfree_t   *mf);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_EQUATION_MFREE_H__ */
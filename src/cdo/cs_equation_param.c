@@ -54,6 +54,7 @@
 #include "cs_mesh_location.h"
 #include "cs_multigrid.h"
 #include "cs_sles.h"
+#include "cs_sles_ldlt.h"
 #include "cs_source_term.h"
 #include "cs_volume_zone.h"
 
@@ -899,6 +900,78 @@ _petsc_block_jacobi_hook(void     *context,
 }
 #endif /* defined(HAVE_PETSC) */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt the settings of an in-house multigrid to CDO vertex-based
+ *        and face-based schemes. Extra-diagonal entries of these systems
+ *        are not all negative, so that the aggregation relies on the
+ *        strength of connection between DoFs. With a K-cycle, smoothers are
+ *        single symmetric Gauss-Seidel sweeps (the outer Krylov iterations
+ *        compensate for a lighter smoothing). For face-based schemes, the
+ *        first coarsening merges the faces of each cell (see
+ *        \ref cs_equation_set_range_set).
+ *
+ * \param[in]       eqp      pointer to a \ref cs_equation_param_t structure
+ * \param[in]       slesp    set of parameters for the linear algebra
+ * \param[in, out]  mg       pointer to a cs_multigrid_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_set_cdo_multigrid(const cs_equation_param_t   *eqp,
+                   const cs_param_sles_t        slesp,
+                   cs_multigrid_t              *mg)
+{
+  if (mg == NULL)
+    return;
+
+  if (   eqp->space_scheme != CS_SPACE_SCHEME_CDOVB
+      && eqp->space_scheme != CS_SPACE_SCHEME_CDOVCB
+      && eqp->space_scheme != CS_SPACE_SCHEME_CDOFB)
+    return;
+
+  const bool  is_k_cycle = (slesp.amg_type == CS_PARAM_AMG_HOUSE_K);
+
+  cs_multigrid_set_coarsening_options(mg,
+                                      (is_k_cycle) ? 8 : 4, /* aggr. limit */
+                                      CS_GRID_COARSENING_SPD_SOC,
+                                      (is_k_cycle) ? 10 : 25, /* n_max_levels */
+                                      50,  /* min_g_cells */
+                                      0.,  /* P0P1 relaxation */
+                                      0);  /* postprocess */
+
+  /* Without advection and with a symmetric enforcement of the boundary
+     conditions, systems are symmetric: the coarsest level is then solved
+     with a sparse direct solver when it has at most 5000 rows. This level
+     is gathered on a single rank, which factorizes it alone, so this
+     threshold is the scaling limit of the direct coarse solve (beyond it,
+     the default iterative coarse solver is kept) */
+  if (!cs_equation_param_has_convection(eqp) &&
+      eqp->default_enforcement != CS_PARAM_BC_ENFORCE_WEAK_NITSCHE)
+    cs_multigrid_set_coarse_direct_solver(mg, 5000);
+
+  /* The V-cycle keeps its default smoothers which are more robust, for
+     instance when boundary conditions are weakly enforced */
+  if (!is_k_cycle)
+    return;
+
+  cs_multigrid_set_solver_options
+    (mg,
+     CS_SLES_P_SYM_GAUSS_SEIDEL, /* descent smoother */
+     CS_SLES_P_SYM_GAUSS_SEIDEL, /* ascent smoother */
+     CS_SLES_PCG,                /* coarse solver */
+     slesp.n_max_iter,           /* n_max_cycles */
+     1,                          /* n_max_iter_descent, */
+     1,                          /* n_max_iter_ascent */
+     200,                        /* n_max_iter_coarse */
+     0,                          /* poly_degree_descent */
+     0,                          /* poly_degree_ascent */
+     0,                          /* poly_degree_coarse */
+     -1.0,                       /* precision_mult_descent */
+     -1.0,                       /* precision_mult_ascent */
+     1.0);                       /* precision_mult_coarse */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set parameters for initializing SLES structures used for the
@@ -1124,6 +1197,12 @@ _set_saturne_sles(cs_equation_param_t   *eqp)
                            slesp.n_max_iter);
     break;
 
+  case CS_PARAM_ITSOL_SPARSE_LDLT:
+    cs_sles_ldlt_define(slesp.field_id,
+                        NULL,
+                        slesp.verbosity);
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0,
               " %s: Invalid iterative solver for solving equation %s.\n"
@@ -1170,8 +1249,11 @@ _set_saturne_sles(cs_equation_param_t   *eqp)
 
   } /* AMG as preconditioner */
 
+  /* Settings related to the location of the DoFs for CDO schemes */
+  _set_cdo_multigrid(eqp, slesp, mg);
+
   /* Define the level of verbosity for SLES structure */
-  if (slesp.verbosity > 3) {
+  if (slesp.verbosity > 3 && it != NULL) {
 
     cs_sles_t  *sles = cs_sles_find_or_add(slesp.field_id, NULL);
     cs_sles_it_t  *sles_it = (cs_sles_it_t *)cs_sles_get_context(sles);
@@ -1519,6 +1601,11 @@ _set_key(cs_equation_param_t   *eqp,
              eqp->sles_param.solver_class != CS_PARAM_SLES_CLASS_HYPRE);
 
     }
+    else if (strcmp(keyval, "ldlt") == 0) {
+      eqp->sles_param.solver = CS_PARAM_ITSOL_SPARSE_LDLT;
+      eqp->sles_param.precond = CS_PARAM_PRECOND_NONE;
+      eqp->sles_param.solver_class = CS_PARAM_SLES_CLASS_CS;
+    }
     else if (strcmp(keyval, "none") == 0)
       eqp->sles_param.solver = CS_PARAM_ITSOL_NONE;
     else {
@@ -1555,6 +1642,13 @@ _set_key(cs_equation_param_t   *eqp,
     }
     break;
 
+  case CS_EQKEY_MATRIX_FREE:
+    if (strcmp(keyval, "true") == 0 || strcmp(keyval, "1") == 0)
+      eqp->matrix_free = true;
+    else
+      eqp->matrix_free = false;  /* Should be the default behavior */
+    break;
+
   case CS_EQKEY_OMP_ASSEMBLY_STRATEGY:
     if (strcmp(keyval, "critical") == 0)
       eqp->omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_CRITICAL;
@@ -1983,6 +2077,7 @@ cs_equation_create_param(const char            *name,
 
   /* Settings for the OpenMP strategy */
   eqp->omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_CRITICAL;
+  eqp->matrix_free = false;
 
   return eqp;
 }
@@ -2161,6 +2256,7 @@ cs_equation_param_update_from(const cs_equation_param_t   *ref,
 
   /* Settings for performance */
   dst->omp_assembly_choice = ref->omp_assembly_choice;
+  dst->matrix_free = ref->matrix_free;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2551,6 +2647,8 @@ cs_equation_summary_param(const cs_equation_param_t   *eqp)
       cs_log_printf(CS_LOG_SETUP, "  * %s | OpenMP.Assembly.Choice:  %s\n",
                     eqname, "atomic");
   }
+  cs_log_printf(CS_LOG_SETUP, "  * %s | Matrix-free:        %s\n",
+                eqname, cs_base_strtf(eqp->matrix_free));
 
   /* Boundary conditions */
   cs_log_printf(CS_LOG_SETUP, "\n### %s | Boundary condition settings\n",
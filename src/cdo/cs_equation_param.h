@@ -796,9 +796,15 @@ typedef struct {
    *
    * \var omp_assembly_choice
    * When OpenMP is active, choice of parallel reduction for the assembly
+   *
+   * \var matrix_free
+   * Apply the operator cellwise instead of assembling a global matrix (only
+   * with some discretizations and iterative solvers). See
+   * \ref CS_EQKEY_MATRIX_FREE for more details.
    */
 
   cs_param_assemble_omp_strategy_t     omp_assembly_choice;
+  bool                                 matrix_free;
 
   /*! @} */
 
@@ -971,6 +977,9 @@ typedef struct {
  *                          via PETSc only. LU factorization.
  * - "mumps_ldlt"       --> Direct solver (very robust but memory consumming)
  *                          via PETSc only. LDLT factorization.
+ * - "ldlt"             --> Built-in sparse direct solver (LDLT factorization
+ *                          after a nested dissection ordering) for small to
+ *                          medium size symmetric systems
  *
  * \var CS_EQKEY_ITSOL_EPS
  * Tolerance factor for stopping the iterative processus for solving the
@@ -994,6 +1003,15 @@ typedef struct {
  * "weighted_rhs" or "weighted"
  * "filtered_rhs" or "fieltered_rhs"
  *
+ * \var CS_EQKEY_MATRIX_FREE
+ * Do not assemble the global matrix of the linear system. The matrix-vector
+ * product is performed cell by cell from the local matrices (cached local
+ * stiffness matrices when available) and only the diagonal is assembled.
+ * This is only available with scalar-valued CDO vertex-based schemes and
+ * with Krylov solvers of the "cs" family using a "none", "jacobi", "poly1"
+ * or "poly2" preconditioner. Otherwise, the global matrix is assembled.
+ * - "false" (default) or "true"
+ *
  * \var CS_EQKEY_OMP_ASSEMBLY_STRATEGY
  * Choice of the way to perform the assembly when OpenMP is active
  * Available choices are:
@@ -1070,6 +1088,7 @@ typedef enum {
   CS_EQKEY_ITSOL_EPS,
   CS_EQKEY_ITSOL_MAX_ITER,
   CS_EQKEY_ITSOL_RESNORM_TYPE,
+  CS_EQKEY_MATRIX_FREE,
   CS_EQKEY_OMP_ASSEMBLY_STRATEGY,
   CS_EQKEY_PRECOND,
   CS_EQKEY_SLES_VERBOSITY,
@@ -567,6 +567,84 @@ _gwf_create(void)
   return gw;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve the tracer equations which are steady (or unsteady according
+ *         to the given flag) in the same order as without grouping.
+ *         Consecutive tracer equations relying on the new mechanism are
+ *         solved together so that they may share the same loop on cells.
+ *         A sequence ends with a tracer having a precipitation model, so
+ *         that the precipitation is updated right after the tracer is
+ *         solved.
+ *
+ * \param[in]      steady     true=steady tracer equations are considered
+ * \param[in]      cur2prev   true="current to previous" operation is performed
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      time_step  pointer to a cs_time_step_t structure
+ * \param[in]      connect    pointer to a cs_cdo_connect_t structure
+ * \param[in]      cdoq       pointer to a cs_cdo_quantities_t structure
+ * \param[in, out] gw         pointer to a cs_gwf_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_solve_tracer_group(bool                          steady,
+                    bool                          cur2prev,
+                    const cs_mesh_t              *mesh,
+                    const cs_time_step_t         *time_step,
+                    const cs_cdo_connect_t       *connect,
+                    const cs_cdo_quantities_t    *cdoq,
+                    cs_gwf_t                     *gw)
+{
+  int  n_group_eqs = 0;
+  cs_equation_t  **group_eqs = NULL;
+
+  BFT_MALLOC(group_eqs, gw->n_tracers, cs_equation_t *);
+
+  for (int i = 0; i < gw->n_tracers; i++) {
+
+    cs_gwf_tracer_t  *tracer = gw->tracers[i];
+
+    if (cs_equation_is_steady(tracer->eq) != steady)
+      continue;
+
+    if (cs_equation_uses_new_mechanism(tracer->eq)) {
+
+      group_eqs[n_group_eqs++] = tracer->eq;
+
+      if (tracer->update_precipitation == NULL)
+        continue; /* The sequence may go on with the next tracer */
+
+      cs_equation_solve_group(steady, cur2prev, mesh, n_group_eqs, group_eqs);
+      n_group_eqs = 0;
+
+    }
+    else { /* Deprecated */
+
+      /* Solve first the previous tracers to keep the same order */
+      cs_equation_solve_group(steady, cur2prev, mesh, n_group_eqs, group_eqs);
+      n_group_eqs = 0;
+
+      /* Define the algebraic system */
+      cs_equation_build_system(mesh, tracer->eq);
+
+      /* Solve the algebraic system */
+      cs_equation_solve_deprecated(tracer->eq);
+
+    }
+
+    if (tracer->update_precipitation != NULL)
+      tracer->update_precipitation(tracer,
+                                   time_step->t_cur,
+                                   mesh, connect, cdoq);
+
+  } /* Loop on tracer equations */
+
+  cs_equation_solve_group(steady, cur2prev, mesh, n_group_eqs, group_eqs);
+
+  BFT_FREE(group_eqs);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1383,6 +1461,11 @@ cs_gwf_compute_steady_state(const cs_mesh_t              *mesh,
 
   }
 
+  if (cs_equation_has_shared_cell_sweep()) {
+    _solve_tracer_group(true, false, mesh, time_step, connect, cdoq, gw);
+    return;
+  }
+
   for (int i = 0; i < gw->n_tracers; i++) {
 
     cs_gwf_tracer_t  *tracer = gw->tracers[i];
@@ -1462,6 +1545,11 @@ cs_gwf_compute(const cs_mesh_t              *mesh,
 
   }
 
+  if (cs_equation_has_shared_cell_sweep()) {
+    _solve_tracer_group(false, cur2prev, mesh, time_step, connect, cdoq, gw);
+    return;
+  }
+
   for (int i = 0; i < gw->n_tracers; i++) {
 
     cs_gwf_tracer_t  *tracer = gw->tracers[i];
@@ -0,0 +1,253 @@
+/*============================================================================
+ * Cache of cell-wise local matrices related to discrete Hodge operators
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_log.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_hodge_cache.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_hodge_cache.c
+
+  \brief Cache of cell-wise local matrices (discrete Hodge operators or
+  related operators such as stiffness matrices) for CDO schemes relying on
+  steady properties.
+
+  Caches are shared between equations using the same set of Hodge
+  parameters and the same property. The mesh is assumed to be fixed
+  (see \ref cs_hodge_cache_reset_all otherwise).
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local private variables
+ *============================================================================*/
+
+static int                 _n_caches = 0;
+static cs_hodge_cache_t  **_caches = NULL;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a new cache of cell-wise local matrices.
+ *
+ * \param[in]  hodgep     set of parameters of the Hodge operator
+ * \param[in]  property   pointer to the associated property (NULL = unity)
+ * \param[in]  c2x        cell -> local entities adjacency
+ * \param[in]  n_extra    number of extra local entities in each cell
+ *
+ * \return a pointer to a new allocated cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_hodge_cache_t *
+_create_cache(const cs_hodge_param_t    hodgep,
+              const cs_property_t      *property,
+              const cs_adjacency_t     *c2x,
+              int                       n_extra)
+{
+  cs_hodge_cache_t  *cache = NULL;
+
+  BFT_MALLOC(cache, 1, cs_hodge_cache_t);
+
+  cache->hodgep = hodgep;
+  cache->property = property;
+  cache->c2x = c2x;
+  cache->n_extra = n_extra;
+  cache->n_refs = 0;
+
+  const cs_lnum_t  n_cells = c2x->n_elts;
+
+  cache->n_cells = n_cells;
+
+  BFT_MALLOC(cache->idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(cache->is_set, n_cells, bool);
+
+  /* Size of the packed upper triangular part of each local matrix */
+
+  cache->idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_lnum_t  n = c2x->idx[c_id+1] - c2x->idx[c_id] + n_extra;
+    cache->idx[c_id+1] = cache->idx[c_id] + n*(n+1)/2;
+  }
+
+  memset(cache->is_set, 0, n_cells*sizeof(bool));
+
+  BFT_MALLOC(cache->val, cache->idx[n_cells], cs_real_t);
+
+  return cache;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get a cache of cell-wise local matrices for the given set of
+ *         parameters. If a cache with the same parameters already exists,
+ *         it is shared. Otherwise, a new cache is created.
+ *
+ * \param[in]  hodgep     set of parameters of the Hodge operator
+ * \param[in]  property   pointer to the associated property (NULL = unity)
+ * \param[in]  c2x        cell -> local entities adjacency
+ * \param[in]  n_extra    number of extra local entities in each cell
+ *
+ * \return a pointer to a cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hodge_cache_t *
+cs_hodge_cache_acquire(const cs_hodge_param_t    hodgep,
+                       const cs_property_t      *property,
+                       const cs_adjacency_t     *c2x,
+                       int                       n_extra)
+{
+  assert(c2x != NULL);
+
+  cs_hodge_cache_t  *cache = NULL;
+
+  for (int i = 0; i < _n_caches; i++) {
+
+    cs_hodge_cache_t  *_c = _caches[i];
+
+    if (   _c->property == property
+        && _c->c2x == c2x
+        && _c->n_extra == n_extra
+        && _c->hodgep.inv_pty == hodgep.inv_pty
+        && cs_hodge_param_is_similar(_c->hodgep, hodgep)) {
+      cache = _c;
+      break;
+    }
+
+  }
+
+  if (cache == NULL) {
+
+    cache = _create_cache(hodgep, property, c2x, n_extra);
+
+    BFT_REALLOC(_caches, _n_caches + 1, cs_hodge_cache_t *);
+    _caches[_n_caches] = cache;
+    _n_caches += 1;
+
+  }
+
+  cache->n_refs += 1;
+
+  return cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Release a cache of cell-wise local matrices. The cache is freed
+ *         when it is not used anymore.
+ *
+ * \param[in, out]  p_cache   pointer to the cs_hodge_cache_t structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_release(cs_hodge_cache_t   **p_cache)
+{
+  cs_hodge_cache_t  *cache = *p_cache;
+
+  if (cache == NULL)
+    return;
+
+  cache->n_refs -= 1;
+
+  if (cache->n_refs < 1) {
+
+    int j = 0;
+    for (int i = 0; i < _n_caches; i++) {
+      if (_caches[i] != cache)
+        _caches[j++] = _caches[i];
+    }
+    _n_caches = j;
+
+    if (_n_caches == 0)
+      BFT_FREE(_caches);
+
+    BFT_FREE(cache->idx);
+    BFT_FREE(cache->is_set);
+    BFT_FREE(cache->val);
+    BFT_FREE(cache);
+
+  }
+
+  *p_cache = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the content of all caches of cell-wise local matrices
+ *         (for instance after a mesh modification).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_reset_all(void)
+{
+  for (int i = 0; i < _n_caches; i++)
+    memset(_caches[i]->is_set, 0, _caches[i]->n_cells*sizeof(bool));
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
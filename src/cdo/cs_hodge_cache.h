@@ -0,0 +1,214 @@
+#ifndef __CS_HODGE_CACHE_H__
+#define __CS_HODGE_CACHE_H__
+
+/*============================================================================
+ * Cache of cell-wise local matrices related to discrete Hodge operators
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_hodge.h"
+#include "cs_property.h"
+#include "cs_sdm.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! \struct cs_hodge_cache_t
+ *  \brief Storage of cell-wise (symmetric) local matrices
+ *
+ *  Local matrices built from a discrete Hodge operator (the Hodge operator
+ *  itself or a related operator such as a stiffness matrix) only depend on
+ *  the mesh and on the associated property. When the property is steady,
+ *  they can be computed once and re-used at each time step and by each
+ *  equation sharing the same set of parameters. Only the upper triangular
+ *  part of each matrix is stored (row by row).
+ *
+ *  A cache is filled on the fly: the matrix of a cell is stored the first
+ *  time it is computed.
+ */
+
+typedef struct {
+
+  cs_hodge_param_t        hodgep;     /*!< Hodge parameters (key) */
+  const cs_property_t    *property;   /*!< associated property (key) */
+  const cs_adjacency_t   *c2x;        /*!< cell -> local entities (key) */
+  int                     n_extra;    /*!< number of extra local entities
+                                           (e.g. the cell for CDO-Fb) (key) */
+
+  int                     n_refs;     /*!< number of users of this cache */
+
+  cs_lnum_t               n_cells;    /*!< number of cells */
+  cs_lnum_t              *idx;        /*!< index on values (size n_cells+1) */
+  bool                   *is_set;     /*!< is the matrix of a cell stored */
+  cs_real_t              *val;        /*!< packed upper triangular parts */
+
+} cs_hodge_cache_t;
+
+/*============================================================================
+ * Static inline public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the cached local matrix of a cell if available.
+ *
+ * \param[in]      cache     pointer to a cs_hodge_cache_t structure or NULL
+ * \param[in]      c_id      cell id
+ * \param[in, out] m         local matrix to set
+ *
+ * \return true if the matrix was set from the cache, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+cs_hodge_cache_load(const cs_hodge_cache_t   *cache,
+                    cs_lnum_t                 c_id,
+                    cs_sdm_t                 *m)
+{
+  if (cache == NULL)
+    return false;
+  if (!cache->is_set[c_id])
+    return false;
+
+  const cs_lnum_t  n = cache->c2x->idx[c_id+1] - cache->c2x->idx[c_id]
+                     + cache->n_extra;
+  const cs_real_t  *v = cache->val + cache->idx[c_id];
+
+  m->n_rows = n, m->n_cols = n;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    cs_real_t  *m_i = m->val + i*n;
+    m_i[i] = *v++;
+    for (cs_lnum_t j = i+1; j < n; j++) {
+      m_i[j] = *v;
+      m->val[j*n + i] = *v++;
+    }
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Store the local matrix of a cell in the cache if not already done.
+ *         The matrix is assumed to be symmetric.
+ *
+ * \param[in, out] cache     pointer to a cs_hodge_cache_t structure or NULL
+ * \param[in]      c_id      cell id
+ * \param[in]      m         local matrix to store
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+cs_hodge_cache_store(cs_hodge_cache_t   *cache,
+                     cs_lnum_t           c_id,
+                     const cs_sdm_t     *m)
+{
+  if (cache == NULL)
+    return;
+  if (cache->is_set[c_id])
+    return;
+
+  const cs_lnum_t  n = m->n_rows;
+  cs_real_t  *v = cache->val + cache->idx[c_id];
+
+  assert(n == cache->c2x->idx[c_id+1] - cache->c2x->idx[c_id]
+         + cache->n_extra);
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    const cs_real_t  *m_i = m->val + i*n;
+    for (cs_lnum_t j = i; j < n; j++)
+      *v++ = m_i[j];
+  }
+
+  cache->is_set[c_id] = true;
+}
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get a cache of cell-wise local matrices for the given set of
+ *         parameters. If a cache with the same parameters already exists,
+ *         it is shared. Otherwise, a new cache is created.
+ *
+ * \param[in]  hodgep     set of parameters of the Hodge operator
+ * \param[in]  property   pointer to the associated property (NULL = unity)
+ * \param[in]  c2x        cell -> local entities adjacency
+ * \param[in]  n_extra    number of extra local entities in each cell
+ *
+ * \return a pointer to a cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hodge_cache_t *
+cs_hodge_cache_acquire(const cs_hodge_param_t    hodgep,
+                       const cs_property_t      *property,
+                       const cs_adjacency_t     *c2x,
+                       int                       n_extra);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Release a cache of cell-wise local matrices. The cache is freed
+ *         when it is not used anymore.
+ *
+ * \param[in, out]  p_cache   pointer to the cs_hodge_cache_t structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_release(cs_hodge_cache_t   **p_cache);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the content of all caches of cell-wise local matrices
+ *         (for instance after a mesh modification).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_reset_all(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_HODGE_CACHE_H__ */
@@ -293,6 +293,7 @@ cs_navsto_param_create(const cs_boundary_t             *boundaries,
 
   /* Resolution parameters (inner linear system then the non-linear system )*/
   param->sles_param.strategy = CS_NAVSTO_SLES_EQ_WITHOUT_BLOCK;
+  param->sles_param.schur_approximation = CS_NAVSTO_SCHUR_MASS_SCALED;
   param->sles_param.n_max_il_algo_iter = 100;
   param->sles_param.il_algo_rtol = 1e-08;
   param->sles_param.il_algo_atol = 1e-08;
@@ -662,6 +663,20 @@ cs_navsto_param_set(cs_navsto_param_t    *nsp,
     }
     break; /* Quadrature */
 
+  case CS_NSKEY_SCHUR_APPROX:
+    if (strcmp(val, "mass_scaled") == 0)
+      nsp->sles_param.schur_approximation = CS_NAVSTO_SCHUR_MASS_SCALED;
+    else if (strcmp(val, "diag_inverse") == 0)
+      nsp->sles_param.schur_approximation = CS_NAVSTO_SCHUR_DIAG_INVERSE;
+    else {
+      const char *_val = val;
+      bft_error(__FILE__, __LINE__, 0,
+                _(" %s: Invalid value \"%s\" for key CS_NSKEY_SCHUR_APPROX\n"
+                  " Valid choices are \"mass_scaled\" and \"diag_inverse\"."),
+                __func__, _val);
+    }
+    break;
+
   case CS_NSKEY_SLES_STRATEGY:
     if (strcmp(val, "no_block") == 0)
       nsp->sles_param.strategy = CS_NAVSTO_SLES_EQ_WITHOUT_BLOCK;
@@ -669,6 +684,8 @@ cs_navsto_param_set(cs_navsto_param_t    *nsp,
       nsp->sles_param.strategy = CS_NAVSTO_SLES_BY_BLOCKS;
     else if (strcmp(val, "block_amg_cg") == 0)
       nsp->sles_param.strategy = CS_NAVSTO_SLES_BLOCK_MULTIGRID_CG;
+    else if (strcmp(val, "block_fgmres") == 0)
+      nsp->sles_param.strategy = CS_NAVSTO_SLES_BLOCK_FGMRES;
     else if (strcmp(val, "gkb_saturne") == 0 ||
              strcmp(val, "gkb") == 0)
       nsp->sles_param.strategy = CS_NAVSTO_SLES_GKB_SATURNE;
@@ -721,6 +738,7 @@ cs_navsto_param_set(cs_navsto_param_t    *nsp,
       bft_error(__FILE__, __LINE__, 0,
                 " %s: Invalid val %s related to key CS_NSKEY_SLES_STRATEGY\n"
                 " Choice between: no_block, by_locks, block_amg_cg,\n"
+                " block_fgmres,\n"
                 " {additive,multiplicative}_gmres, {diag,upper}_schur_gmres,\n"
                 " gkb, gkb_petsc, gkb_gmres, gkb_saturne,\n"
                 " mumps, uzawa_al or alu", __func__, _val);
@@ -941,6 +959,16 @@ cs_navsto_param_log(const cs_navsto_param_t    *nsp)
   case CS_NAVSTO_SLES_BLOCK_MULTIGRID_CG:
     cs_log_printf(CS_LOG_SETUP, "Block AMG + CG\n");
     break;
+  case CS_NAVSTO_SLES_BLOCK_FGMRES:
+    cs_log_printf(CS_LOG_SETUP, "Upper block preconditioner with Schur approx."
+                  " + FGMRES (In-House)\n");
+    if (nslesp.schur_approximation == CS_NAVSTO_SCHUR_DIAG_INVERSE)
+      cs_log_printf(CS_LOG_SETUP, "  * NavSto | Schur approx.: "
+                    "B.diag(A)^-1.Bt\n");
+    else
+      cs_log_printf(CS_LOG_SETUP, "  * NavSto | Schur approx.: "
+                    "scaled mass matrix\n");
+    break;
   case CS_NAVSTO_SLES_ADDITIVE_GMRES_BY_BLOCK:
     cs_log_printf(CS_LOG_SETUP, "Additive block preconditioner + GMRES\n");
     break;
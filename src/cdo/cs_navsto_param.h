@@ -178,6 +178,18 @@ typedef enum {
  * This option is only available with the support to the PETSc library up to now.
  *
  *
+ * \var CS_NAVSTO_SLES_BLOCK_FGMRES
+ * Associated keyword: "block_fgmres"
+ *
+ * Available choice when a monolithic approach is used (i.e. with the parameter
+ * CS_NAVSTO_COUPLING_MONOLITHIC is set as coupling algorithm). The
+ * Navier-Stokes system of equations is solved using an in-house flexible
+ * GMRES preconditioned by an upper block triangular matrix. The block 00 is
+ * A_{00} approximately inverted with a Krylov solver preconditioned by the
+ * in-house multigrid. The block 11 is an approximation of the Schur complement
+ * (cf. \ref cs_navsto_schur_approx_t). No external library is needed.
+ *
+ *
  * \var CS_NAVSTO_SLES_BY_BLOCKS
  * Associated keyword: "blocks"
  *
@@ -301,6 +313,7 @@ typedef enum {
 typedef enum {
 
   CS_NAVSTO_SLES_ADDITIVE_GMRES_BY_BLOCK,
+  CS_NAVSTO_SLES_BLOCK_FGMRES,
   CS_NAVSTO_SLES_BLOCK_MULTIGRID_CG,
   CS_NAVSTO_SLES_BY_BLOCKS,
   CS_NAVSTO_SLES_DIAG_SCHUR_GMRES,
@@ -317,6 +330,42 @@ typedef enum {
 
 } cs_navsto_sles_t;
 
+/*! \enum cs_navsto_schur_approx_t
+ *
+ *  \brief Approximation of the Schur complement S = -B.A_{00}^-1.B^t used in
+ *  a block preconditioner when the Navier-Stokes system is solved with the
+ *  in-house strategy \ref CS_NAVSTO_SLES_BLOCK_FGMRES
+ *
+ * \var CS_NAVSTO_SCHUR_MASS_SCALED
+ * Associated keyword: "mass_scaled"
+ *
+ * The Schur complement is approximated by the (diagonal) pressure mass matrix
+ * scaled by the reciprocal of the laminar viscosity (and of the grad-div
+ * coefficient if any). For unsteady systems, the Cahouet-Chabard combination
+ * is used: the inverse of the Schur complement is approximated by
+ * (nu + gamma).Mp^-1 + rho/dt.Lp^-1 where Lp is the pressure Laplacian built
+ * with the lumped velocity mass matrix, so that the approximation remains
+ * accurate when the time step decreases. This is the default choice.
+ *
+ * \var CS_NAVSTO_SCHUR_DIAG_INVERSE
+ * Associated keyword: "diag_inverse"
+ *
+ * The Schur complement is approximated by the pressure Laplacian scaled by the
+ * inverse of the diagonal of A_{00}, i.e. B.diag(A_{00})^-1.B^t. This
+ * operator is applied without assembly and inverted with a few iterations of
+ * a Jacobi-preconditioned conjugate gradient. Well-suited to systems in which
+ * the unsteady or the advection term is dominant.
+ */
+
+typedef enum {
+
+  CS_NAVSTO_SCHUR_MASS_SCALED,
+  CS_NAVSTO_SCHUR_DIAG_INVERSE,
+
+  CS_NAVSTO_SCHUR_N_TYPES
+
+} cs_navsto_schur_approx_t;
+
 /*! \enum cs_navsto_nl_algo_t
  *
  *  \brief Type of algorithm used to tackle the non-linearity arising from
@@ -347,6 +396,12 @@ typedef struct {
    */
   cs_navsto_sles_t              strategy;
 
+  /*! \var schur_approximation
+   *  Choice of approximation of the Schur complement when a block
+   *  preconditioner is built in-house
+   */
+  cs_navsto_schur_approx_t      schur_approximation;
+
   /*!
    * @name Inner and linear algorithm
    * Set of parameters to drive the resolution of the (inner) linear system
@@ -785,6 +840,10 @@ typedef struct {
  * Set the type to use in all routines involving quadrature (similar to \ref
  * CS_EQKEY_BC_QUADRATURE)
  *
+ * \var CS_NSKEY_SCHUR_APPROX
+ * Approximation of the Schur complement used in the in-house block
+ * preconditioner (cf. \ref cs_navsto_schur_approx_t)
+ *
  * \var CS_NSKEY_SLES_STRATEGY
  * Strategy for solving the SLES arising from the discretization of the
  * Navier-Stokes system
@@ -824,6 +883,7 @@ typedef enum {
   CS_NSKEY_NL_ALGO_RTOL,
   CS_NSKEY_NL_ALGO_VERBOSITY,
   CS_NSKEY_QUADRATURE,
+  CS_NSKEY_SCHUR_APPROX,
   CS_NSKEY_SLES_STRATEGY,
   CS_NSKEY_SPACE_SCHEME,
   CS_NSKEY_TIME_SCHEME,
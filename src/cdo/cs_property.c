@@ -647,6 +647,41 @@ cs_property_get_n_properties(void)
   return _n_properties;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Returns true if the values of the property do not change in time,
+ *         i.e. all its definitions (or those of the properties it relies
+ *         on) are steady, otherwise false
+ *
+ * \param[in]    pty    pointer to a property to test
+ *
+ * \return  true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_property_is_steady(const cs_property_t   *pty)
+{
+  if (pty == NULL)
+    return true; /* Treated as the "unity" property */
+
+  if (pty->type & CS_PROPERTY_BY_PRODUCT) {
+    for (int i = 0; i < pty->n_related_properties; i++)
+      if (!cs_property_is_steady(pty->related_properties[i]))
+        return false;
+    return true;
+  }
+
+  if (pty->n_definitions < 1)
+    return false;
+
+  for (int i = 0; i < pty->n_definitions; i++)
+    if (!(pty->defs[i]->state & CS_FLAG_STATE_STEADY))
+      return false;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Create and initialize a new property structure
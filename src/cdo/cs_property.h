@@ -306,6 +306,21 @@ cs_property_set_shared_pointers(const cs_cdo_quantities_t    *quant,
 int
 cs_property_get_n_properties(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Returns true if the values of the property do not change in time,
+ *         i.e. all its definitions (or those of the properties it relies
+ *         on) are steady, otherwise false
+ *
+ * \param[in]    pty    pointer to a property to test
+ *
+ * \return  true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_property_is_steady(const cs_property_t   *pty);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Create and initialize a new property structure
@@ -48,6 +48,7 @@
 #include "cs_math.h"
 #include "cs_scheme_geometry.h"
 #include "cs_volume_zone.h"
+#include "cs_xdef_cache.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -154,6 +155,52 @@ _set_mask(const cs_xdef_t     *st,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Attach a cache of evaluation points and values to a source term
+ *         defined by an analytic function when the cellwise function used
+ *         to compute it allows it
+ *
+ * \param[in, out] st          pointer to a cs_xdef_t structure
+ * \param[in]      compute     function used to compute the source term
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_set_analytic_cache(cs_xdef_t                   *st,
+                    cs_source_term_cellwise_t   *compute)
+{
+  if (st->type != CS_XDEF_BY_ANALYTIC_FUNCTION)
+    return;
+
+  /* Number of evaluation points by vertex, edge, face and cell */
+  int  n_pts[4] = {0, 0, 0, 0};
+
+  if (compute == cs_source_term_pvsp_by_analytic ||
+      compute == cs_source_term_dcsd_bary_by_analytic)
+    n_pts[0] = 1;
+  else if (compute == cs_source_term_vcsp_by_analytic)
+    n_pts[0] = 1, n_pts[3] = 1;
+  else if (compute == cs_source_term_dcsd_q1o1_by_analytic)
+    n_pts[1] = 4;
+  else if (compute == cs_source_term_dcsd_q10o2_by_analytic)
+    n_pts[0] = 2, n_pts[1] = 8, n_pts[2] = 2, n_pts[3] = 1;
+  else if (compute == cs_source_term_pcsd_bary_by_analytic ||
+           compute == cs_source_term_pcvd_bary_by_analytic)
+    n_pts[3] = 1;
+  else
+    return; /* Evaluations are not cached (too many points or evaluations
+               performed inside a quadrature rule) */
+
+  cs_xdef_analytic_input_t  *anai = (cs_xdef_analytic_input_t *)st->input;
+
+  if (anai->cache != NULL)
+    cs_xdef_cache_free(&(anai->cache));
+
+  anai->cache = cs_xdef_cache_create(st, cs_cdo_connect,
+                                     n_pts[0], n_pts[1], n_pts[2], n_pts[3]);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the reduction onto the cell polynomial space of a function
@@ -803,6 +850,9 @@ cs_source_term_init(cs_param_space_scheme_t       space_scheme,
 
     } /* Switch on space scheme */
 
+    /* Cache the evaluation points of analytic functions */
+    _set_analytic_cache(source_terms[st_id], compute_source[st_id]);
+
   } /* Loop on source terms */
 
   if (need_mask) {
@@ -981,13 +1031,12 @@ cs_source_term_pvsp_by_analytic(const cs_xdef_t           *source,
   assert(mass_hodge->matrix != NULL);
 
   cs_xdef_analytic_input_t  *anai = (cs_xdef_analytic_input_t *)source->input;
+  int  shift = 0; /* position in the cached sequence of points */
 
   /* Retrieve the values of the potential at each cell vertices */
   double  *eval = cb->values;
-  anai->func(time_eval, cm->n_vc, NULL, cm->xv,
-             true, /* compacted output ? */
-             anai->input,
-             eval);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval, cm->n_vc, cm->xv,
+                              &shift, eval);
 
   /* Multiply these values by a cellwise Hodge operator previously computed */
   double  *hdg_eval = cb->values + cm->n_vc;
@@ -1210,6 +1259,7 @@ cs_source_term_dcsd_bary_by_analytic(const cs_xdef_t           *source,
                        CS_FLAG_COMP_PEQ | CS_FLAG_COMP_PEC));
 
   cs_xdef_analytic_input_t  *anai = (cs_xdef_analytic_input_t *)source->input;
+  int  shift = 0; /* position in the cached sequence of points */
 
   /* Compute the barycenter of each portion of dual cells */
   double  *vol_vc = cb->values;
@@ -1267,10 +1317,9 @@ cs_source_term_dcsd_bary_by_analytic(const cs_xdef_t           *source,
 
   /* Call the analytic function to evaluate the function at xgv */
   double  *eval_xgv = vol_vc + cm->n_vc;
-  anai->func(time_eval, cm->n_vc, NULL, (const cs_real_t *)xgv,
-             true, /* compacted output ? */
-             anai->input,
-             eval_xgv);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval,
+                              cm->n_vc, (const cs_real_t *)xgv,
+                              &shift, eval_xgv);
 
   for (short int v = 0; v < cm->n_vc; v++)
     values[v] = vol_vc[v] * eval_xgv[v];
@@ -1315,6 +1364,7 @@ cs_source_term_dcsd_q1o1_by_analytic(const cs_xdef_t           *source,
                        CS_FLAG_COMP_FEQ | CS_FLAG_COMP_EV));
 
   cs_xdef_analytic_input_t  *anai = (cs_xdef_analytic_input_t *)source->input;
+  int  shift = 0; /* position in the cached sequence of points */
 
   for (short int f = 0; f < cm->n_fc; f++) {
 
@@ -1341,10 +1391,9 @@ cs_source_term_dcsd_q1o1_by_analytic(const cs_xdef_t           *source,
       for (int k = 0; k < 3; k++)
         xg[1][k] = xfc[k] + 0.375*xv2[k] + 0.125*xv1[k];
 
-      anai->func(time_eval, 2, NULL, (const cs_real_t *)xg,
-                 true, /* compacted output ? */
-                 anai->input,
-                 eval_xg);
+      cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval,
+                                  2, (const cs_real_t *)xg,
+                                  &shift, eval_xg);
 
       const double  half_pef_vol = cm->tef[i]*hf_coef;
       values[v1] += half_pef_vol * eval_xg[0];
@@ -1396,6 +1445,7 @@ cs_source_term_dcsd_q10o2_by_analytic(const cs_xdef_t           *source,
                        CS_FLAG_COMP_PEQ));
 
   cs_xdef_analytic_input_t  *anai = (cs_xdef_analytic_input_t *)source->input;
+  int  shift = 0; /* position in the cached sequence of points */
 
   /* Temporary buffers */
   double  *contrib = cb->values; /* size n_vc */
@@ -1404,17 +1454,13 @@ cs_source_term_dcsd_q10o2_by_analytic(const cs_xdef_t           *source,
 
   /* Cell evaluation */
   double  eval_c;
-  anai->func(time_eval, 1, NULL, cm->xc,
-             true, /* compacted output ? */
-             anai->input,
-             &eval_c);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval, 1, cm->xc,
+                              &shift, &eval_c);
 
   /* Contributions related to vertices */
   double  *eval_v = cb->values + cm->n_vc; /* size n_vc */
-  anai->func(time_eval, cm->n_vc, NULL, cm->xv,
-             true,  /* compacted output ? */
-             anai->input,
-             eval_v);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval, cm->n_vc, cm->xv,
+                              &shift, eval_v);
 
   cs_real_3_t  *xvc = cb->vectors;
   for (short int v = 0; v < cm->n_vc; v++) {
@@ -1423,10 +1469,9 @@ cs_source_term_dcsd_q10o2_by_analytic(const cs_xdef_t           *source,
   }
 
   double  *eval_vc = cb->values + 2*cm->n_vc; /* size n_vc */
-  anai->func(time_eval, cm->n_vc, NULL, (const cs_real_t *)xvc,
-             true,  /* compacted output ? */
-             anai->input,
-             eval_vc);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval,
+                              cm->n_vc, (const cs_real_t *)xvc,
+                              &shift, eval_vc);
 
   for (short int v = 0; v < cm->n_vc; v++) {
 
@@ -1452,10 +1497,9 @@ cs_source_term_dcsd_q10o2_by_analytic(const cs_xdef_t           *source,
   /* Evaluate the analytic function at xe and xec */
   double  *eval_e = cb->values + cm->n_vc; /* size=n_ec (overwrite eval_v) */
   double  *eval_ec = eval_e + cm->n_ec;    /* size=n_ec (overwrite eval_vc) */
-  anai->func(time_eval, 2*cm->n_ec, NULL, (const cs_real_t *)cb->vectors,
-             true,  /* compacted output ? */
-             anai->input,
-             eval_e);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval,
+                              2*cm->n_ec, (const cs_real_t *)cb->vectors,
+                              &shift, eval_e);
 
   /* xev (size = 2*n_ec) */
   cs_real_3_t  *xve = cb->vectors; /* size=2*n_ec (overwrite xe and xec) */
@@ -1475,10 +1519,9 @@ cs_source_term_dcsd_q10o2_by_analytic(const cs_xdef_t           *source,
   } /* Loop on edges */
 
   double  *eval_ve = eval_ec + cm->n_ec; /* size = 2*n_ec */
-  anai->func(time_eval, 2*cm->n_ec, NULL, (const cs_real_t *)cb->vectors,
-             true,  /* compacted output ? */
-             anai->input,
-             eval_ve);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval,
+                              2*cm->n_ec, (const cs_real_t *)cb->vectors,
+                              &shift, eval_ve);
 
   /* 3) Main loop on faces */
   double  *pvf_vol = eval_ve + 2*cm->n_ec;  /* size n_vc */
@@ -1504,10 +1547,8 @@ cs_source_term_dcsd_q10o2_by_analytic(const cs_xdef_t           *source,
       cs_real_3_t  xef;
       cs_real_t  eval_ef;
       for (int k = 0; k < 3; k++) xef[k] = 0.5*(cm->edge[e].center[k] + xf[k]);
-      anai->func(time_eval, 1, NULL, xef,
-                 true,  /* compacted output ? */
-                 anai->input,
-                 &eval_ef);
+      cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval, 1, xef,
+                                  &shift, &eval_ef);
 
       /* 1/5 (EF + EC) -1/20 * (E) */
       const double  common_ef_contrib =
@@ -1536,10 +1577,9 @@ cs_source_term_dcsd_q10o2_by_analytic(const cs_xdef_t           *source,
     }
 
     double  *eval_vfc = pvf_vol + cm->n_vc; /* size=n_vf + 2 */
-    anai->func(time_eval, 2+n_vf, NULL, (const cs_real_t *)xvfc,
-               true,  /* compacted output ? */
-               anai->input,
-               eval_vfc);
+    cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval,
+                                2+n_vf, (const cs_real_t *)xvfc,
+                                &shift, eval_vfc);
 
     for (short int i = 0; i < n_vf; i++) {
       short int  v = cb->ids[i];
@@ -1746,19 +1786,16 @@ cs_source_term_vcsp_by_analytic(const cs_xdef_t           *source,
   assert(mass_hodge->matrix != NULL);
 
   cs_xdef_analytic_input_t  *anai = (cs_xdef_analytic_input_t *)source->input;
+  int  shift = 0; /* position in the cached sequence of points */
 
   /* Retrieve the values of the potential at each cell vertices */
   double  *eval = cb->values;
 
-  anai->func(time_eval, cm->n_vc, NULL, cm->xv,
-             true,  /* compacted output ? */
-             anai->input,
-             eval);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval, cm->n_vc, cm->xv,
+                              &shift, eval);
 
-  anai->func(time_eval, 1, NULL, cm->xc,
-             true,  /* compacted output ? */
-             anai->input,
-             eval + cm->n_vc);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval, 1, cm->xc,
+                              &shift, eval + cm->n_vc);
 
   /* Multiply these values by a cellwise Hodge operator previously computed */
   double  *hdg_eval = cb->values + cm->n_vc + 1;
@@ -1981,13 +2018,13 @@ cs_source_term_pcsd_bary_by_analytic(const cs_xdef_t           *source,
   assert(values != NULL && cm != NULL);
 
   cs_xdef_analytic_input_t  *anai = (cs_xdef_analytic_input_t *)source->input;
+  int  shift = 0; /* position in the cached sequence of points */
 
   /* Call the analytic function to evaluate the function at xc */
   double  eval_xc;
-  anai->func(time_eval, 1, NULL, (const cs_real_t *)cm->xc,
-             true,  /* compacted output ? */
-             anai->input,
-             &eval_xc);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval,
+                              1, (const cs_real_t *)cm->xc,
+                              &shift, &eval_xc);
 
   values[cm->n_fc] += cm->vol_c * eval_xc;
 }
@@ -2196,13 +2233,13 @@ cs_source_term_pcvd_bary_by_analytic(const cs_xdef_t           *source,
   assert(source->dim == 3);
 
   cs_xdef_analytic_input_t  *anai = (cs_xdef_analytic_input_t *)source->input;
+  int  shift = 0; /* position in the cached sequence of points */
 
   /* Call the analytic function to evaluate the function at xc */
   double  eval_xc[3];
-  anai->func(time_eval, 1, NULL, (const cs_real_t *)cm->xc,
-             true,  /* compacted output ? */
-             anai->input,
-             eval_xc);
+  cs_xdef_cache_eval_analytic(anai, cm->c_id, time_eval,
+                              1, (const cs_real_t *)cm->xc,
+                              &shift, eval_xc);
 
   cs_real_t  *c_val = values + 3*cm->n_fc;
   for (int k = 0; k < source->dim; k++)
@@ -43,6 +43,7 @@
 #include "cs_flag.h"
 #include "cs_log.h"
 #include "cs_mesh_location.h"
+#include "cs_xdef_cache.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -131,6 +132,7 @@ cs_xdef_volume_create(cs_xdef_type_t    type,
       BFT_MALLOC(b, 1, cs_xdef_analytic_input_t);
       b->func = a->func;
       b->input = a->input;
+      b->cache = NULL;
 
       d->input = b;
     }
@@ -287,6 +289,7 @@ cs_xdef_boundary_create(cs_xdef_type_t    type,
       BFT_MALLOC(b, 1, cs_xdef_analytic_input_t);
       b->func = a->func;
       b->input = a->input;
+      b->cache = NULL;
 
       d->input = b;
     }
@@ -446,10 +449,16 @@ cs_xdef_free(cs_xdef_t     *d)
       BFT_FREE(a->values);
     BFT_FREE(d->input);
 
+  }
+  else if (d->type == CS_XDEF_BY_ANALYTIC_FUNCTION) {
+
+    cs_xdef_analytic_input_t  *a = (cs_xdef_analytic_input_t *)d->input;
+    cs_xdef_cache_free(&(a->cache));
+    BFT_FREE(d->input);
+
   }
   else if (d->type == CS_XDEF_BY_TIME_FUNCTION     ||
            d->type == CS_XDEF_BY_VALUE             ||
-           d->type == CS_XDEF_BY_ANALYTIC_FUNCTION ||
            d->type == CS_XDEF_BY_DOF_FUNCTION      ||
            d->type == CS_XDEF_BY_QOV)
     BFT_FREE(d->input);
@@ -127,6 +127,13 @@ typedef enum {
 
 } cs_xdef_support_t;
 
+/*! \struct cs_xdef_cache_t
+ *  \brief Cache of evaluation points and values attached to a definition
+ *         (see \ref cs_xdef_cache.h)
+ */
+
+typedef struct _cs_xdef_cache_t  cs_xdef_cache_t;
+
 /*!
  * \struct cs_xdef_t
  *  \brief Structure storing medata for defining a quantity in a very flexible
@@ -234,6 +241,13 @@ typedef struct {
    */
   cs_analytic_func_t  *func;
 
+  /*! \var cache
+   * NULL or pointer to a cache of evaluation points and values used to
+   * avoid calling the function cell by cell (managed by the cs_xdef_t
+   * structure)
+   */
+  cs_xdef_cache_t     *cache;
+
 } cs_xdef_analytic_input_t;
 
 /*!
@@ -0,0 +1,551 @@
+/*============================================================================
+ * Cache of evaluation points and values related to a cs_xdef_t structure
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_flag.h"
+#include "cs_volume_zone.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_xdef_cache.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_xdef_cache.c
+
+  \brief Cache of the evaluation points of a definition by analytic function
+  and of the related values.
+
+  User-defined analytic functions are called with a few points at a time
+  when a quantity is integrated cell by cell. Caching the points makes it
+  possible to call the function only once for all the points of the zone if
+  the definition is steady.
+
+  Values of a non-steady definition are cached only on request (see
+  \ref cs_xdef_cache_set_time_values) since they are keyed on the time of
+  evaluation: a function reading other quantities through its input (fields
+  updated during non-linear iterations for instance) would return stale
+  values. In this case, the function is called once for all the points of
+  the zone at each new time of evaluation and values related to the last two
+  times of evaluation are kept, since a theta time scheme evaluates a source
+  term at two different times in each cell.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local private variables
+ *============================================================================*/
+
+static int                _n_caches = 0;
+static cs_xdef_cache_t  **_caches = NULL;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if values evaluated at time t_eval can be used at time
+ *         time_eval
+ *
+ * \param[in]  cache      pointer to a cs_xdef_cache_t structure
+ * \param[in]  t_eval     time of the evaluation
+ * \param[in]  time_eval  requested time of evaluation
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_values_are_valid(const cs_xdef_cache_t   *cache,
+                  cs_real_t                t_eval,
+                  cs_real_t                time_eval)
+{
+  if (t_eval < -0.5*DBL_MAX) /* Never evaluated */
+    return false;
+
+  if (cache->steady)
+    return true;
+
+  return (fabs(t_eval - time_eval) > 0) ? false : true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Find the slot storing values which can be used at time time_eval
+ *
+ * \param[in]  cache      pointer to a cs_xdef_cache_t structure
+ * \param[in]  time_eval  requested time of evaluation
+ *
+ * \return the id of the slot or -1 if not found
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline int
+_find_slot(const cs_xdef_cache_t   *cache,
+           cs_real_t                time_eval)
+{
+  for (int k = 0; k < CS_XDEF_CACHE_N_SLOTS; k++) {
+
+    cs_real_t  t_eval;
+#   pragma omp atomic read
+    t_eval = cache->t_eval[k];
+
+    if (_values_are_valid(cache, t_eval, time_eval))
+      return k;
+
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the index on points and allocate the related buffers.
+ *         The content of the cache is reset.
+ *
+ * \param[in, out]  cache     pointer to a cs_xdef_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_build_index(cs_xdef_cache_t   *cache)
+{
+  const cs_cdo_connect_t  *connect = cache->connect;
+  const cs_lnum_t  n_cells = connect->n_cells;
+  const cs_zone_t  *z = cs_volume_zone_by_id(cache->z_id);
+  const int  *n_pts_by = cache->n_pts_by;
+
+  assert(n_pts_by[0] == 0 || connect->c2v != NULL);
+  assert(n_pts_by[1] == 0 || connect->c2e != NULL);
+  assert(n_pts_by[2] == 0 || connect->c2f != NULL);
+
+  cache->n_cells = n_cells;
+
+  BFT_REALLOC(cache->idx, n_cells + 1, cs_lnum_t);
+  BFT_REALLOC(cache->is_set, n_cells, bool);
+
+  cs_lnum_t  *n_c_pts = cache->idx + 1;
+
+  memset(cache->idx, 0, (n_cells + 1)*sizeof(cs_lnum_t));
+  memset(cache->is_set, 0, n_cells*sizeof(bool));
+
+  const bool  full_loc = (z->elt_ids == NULL || z->n_elts == n_cells);
+  const cs_lnum_t  n_zone_cells = (full_loc) ? n_cells : z->n_elts;
+
+  for (cs_lnum_t i = 0; i < n_zone_cells; i++) {
+
+    const cs_lnum_t  c_id = (full_loc) ? i : z->elt_ids[i];
+
+    cs_lnum_t  n = n_pts_by[3];
+    if (n_pts_by[0] > 0)
+      n += n_pts_by[0]*(connect->c2v->idx[c_id+1] - connect->c2v->idx[c_id]);
+    if (n_pts_by[1] > 0)
+      n += n_pts_by[1]*(connect->c2e->idx[c_id+1] - connect->c2e->idx[c_id]);
+    if (n_pts_by[2] > 0)
+      n += n_pts_by[2]*(connect->c2f->idx[c_id+1] - connect->c2f->idx[c_id]);
+
+    n_c_pts[c_id] = n;
+
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    cache->idx[c_id+1] += cache->idx[c_id];
+
+  const cs_lnum_t  n_pts = cache->idx[n_cells];
+
+  BFT_REALLOC(cache->coords, 3*n_pts, cs_real_t);
+
+  cache->n_zone_cells = n_zone_cells;
+  cache->n_set = 0;
+
+  /* Only one slot is needed for a steady definition and none if values are
+     not cached */
+
+  cache->last_slot = 0;
+  for (int k = 0; k < CS_XDEF_CACHE_N_SLOTS; k++) {
+    cache->t_eval[k] = -DBL_MAX;
+    cache->n_readers[k] = 0;
+    if (cache->steady ? k == 0 : cache->time_values)
+      BFT_REALLOC(cache->values[k], cache->dim*n_pts, cs_real_t);
+    else
+      BFT_FREE(cache->values[k]);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate the analytic function at all the recorded points if no
+ *         cached values are related to the given time. Values are stored in
+ *         the slot of the oldest evaluation, once no thread copies values
+ *         from it. Only one thread performs the evaluation.
+ *
+ * \param[in]      anai       pointer to a cs_xdef_analytic_input_t structure
+ * \param[in]      time_eval  physical time at which one evaluates the term
+ * \param[in, out] cache      pointer to a cs_xdef_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_values(const cs_xdef_analytic_input_t  *anai,
+               cs_real_t                        time_eval,
+               cs_xdef_cache_t                 *cache)
+{
+# pragma omp critical (cs_xdef_cache_update)
+  {
+    if (_find_slot(cache, time_eval) < 0) {
+
+      const int  k = (cache->steady) ?
+        0 : (cache->last_slot + 1) % CS_XDEF_CACHE_N_SLOTS;
+
+      /* Invalidate the slot, then wait for threads still copying from it */
+
+#     pragma omp atomic write
+      cache->t_eval[k] = -DBL_MAX;
+#     pragma omp flush
+
+      int  n_readers = 1;
+      while (n_readers > 0) {
+#       pragma omp flush
+#       pragma omp atomic read
+        n_readers = cache->n_readers[k];
+      }
+
+      /* One call for all the points of the zone */
+
+      anai->func(time_eval, cache->idx[cache->n_cells], NULL, cache->coords,
+                 true, /* compacted output ? */
+                 anai->input,
+                 cache->values[k]);
+
+      cache->last_slot = k;
+
+#     pragma omp flush
+#     pragma omp atomic write
+      cache->t_eval[k] = time_eval;
+
+    }
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a cache of evaluation points and values for a definition
+ *         by analytic function on a volume zone. The number of points
+ *         used in a cell c is n_v_pts*|V_c| + n_e_pts*|E_c| + n_f_pts*|F_c|
+ *         + n_c_pts.
+ *
+ * \param[in]  def       pointer to the related cs_xdef_t structure
+ * \param[in]  connect   pointer to a cs_cdo_connect_t structure
+ * \param[in]  n_v_pts   number of points per cell vertex
+ * \param[in]  n_e_pts   number of points per cell edge
+ * \param[in]  n_f_pts   number of points per cell face
+ * \param[in]  n_c_pts   number of additional points per cell
+ *
+ * \return a pointer to a new allocated cs_xdef_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_xdef_cache_t *
+cs_xdef_cache_create(const cs_xdef_t          *def,
+                     const cs_cdo_connect_t   *connect,
+                     int                       n_v_pts,
+                     int                       n_e_pts,
+                     int                       n_f_pts,
+                     int                       n_c_pts)
+{
+  assert(def != NULL && connect != NULL);
+
+  if (def->type != CS_XDEF_BY_ANALYTIC_FUNCTION ||
+      def->support != CS_XDEF_SUPPORT_VOLUME)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Only definitions by analytic function on a volume zone"
+              " can be cached.", __func__);
+
+  cs_xdef_cache_t  *cache = NULL;
+
+  BFT_MALLOC(cache, 1, cs_xdef_cache_t);
+
+  cache->dim = def->dim;
+  cache->z_id = def->z_id;
+  cache->steady = (def->state & CS_FLAG_STATE_STEADY) ? true : false;
+  cache->time_values = false;
+
+  cache->connect = connect;
+  cache->n_pts_by[0] = n_v_pts;
+  cache->n_pts_by[1] = n_e_pts;
+  cache->n_pts_by[2] = n_f_pts;
+  cache->n_pts_by[3] = n_c_pts;
+
+  cache->idx = NULL;
+  cache->is_set = NULL;
+  cache->coords = NULL;
+  for (int k = 0; k < CS_XDEF_CACHE_N_SLOTS; k++)
+    cache->values[k] = NULL;
+
+  _build_index(cache);
+
+  BFT_REALLOC(_caches, _n_caches + 1, cs_xdef_cache_t *);
+  _caches[_n_caches] = cache;
+  _n_caches += 1;
+
+  return cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set if the values of a non-steady definition are cached for each
+ *         time of evaluation. This is only valid if the analytic function
+ *         depends on the time and on the coordinates only. Otherwise (by
+ *         default), the function is called at each evaluation.
+ *         The content of the cache is reset if the status changes.
+ *
+ * \param[in, out]  cache    pointer to a cs_xdef_cache_t structure
+ * \param[in]       status   true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_cache_set_time_values(cs_xdef_cache_t   *cache,
+                              bool               status)
+{
+  if (cache == NULL)
+    return;
+
+  if (cache->time_values != status) {
+    cache->time_values = status;
+    _build_index(cache);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_xdef_cache_t structure
+ *
+ * \param[in, out]  p_cache   pointer to the cs_xdef_cache_t structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_cache_free(cs_xdef_cache_t   **p_cache)
+{
+  cs_xdef_cache_t  *cache = *p_cache;
+
+  if (cache == NULL)
+    return;
+
+  int j = 0;
+  for (int i = 0; i < _n_caches; i++) {
+    if (_caches[i] != cache)
+      _caches[j++] = _caches[i];
+  }
+  _n_caches = j;
+
+  if (_n_caches == 0)
+    BFT_FREE(_caches);
+
+  BFT_FREE(cache->idx);
+  BFT_FREE(cache->is_set);
+  BFT_FREE(cache->coords);
+  for (int k = 0; k < CS_XDEF_CACHE_N_SLOTS; k++)
+    BFT_FREE(cache->values[k]);
+  BFT_FREE(cache);
+
+  *p_cache = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the content of all caches of evaluation points and
+ *         values (for instance after a mesh modification).
+ *
+ * \param[in]  connect   pointer to the (new) cs_cdo_connect_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_cache_reset_all(const cs_cdo_connect_t   *connect)
+{
+  for (int i = 0; i < _n_caches; i++) {
+    _caches[i]->connect = connect;
+    _build_index(_caches[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate an analytic function at a set of points in a cell relying
+ *         on the cache attached to the definition when available.
+ *         Successive calls for the same cell have to be done with the same
+ *         sequence of points. The shift is incremented at each call and
+ *         should be set to 0 before the first call in a cell.
+ *         This function may be called concurrently for different cells.
+ *
+ * \param[in]      anai       pointer to a cs_xdef_analytic_input_t structure
+ * \param[in]      c_id       id of the current cell
+ * \param[in]      time_eval  physical time at which one evaluates the term
+ * \param[in]      n_pts      number of points
+ * \param[in]      xyz        coordinates of the points (size 3*n_pts)
+ * \param[in, out] shift      position of the points in the cell sequence
+ * \param[in, out] eval       values at the points (size dim*n_pts)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_cache_eval_analytic(const cs_xdef_analytic_input_t  *anai,
+                            cs_lnum_t                        c_id,
+                            cs_real_t                        time_eval,
+                            int                              n_pts,
+                            const cs_real_t                 *xyz,
+                            int                             *shift,
+                            cs_real_t                       *eval)
+{
+  cs_xdef_cache_t  *cache = anai->cache;
+
+  /* Values of a non-steady definition are only cached on request */
+
+  if (cache == NULL || !(cache->steady || cache->time_values)) {
+    anai->func(time_eval, n_pts, NULL, xyz,
+               true, /* compacted output ? */
+               anai->input,
+               eval);
+    return;
+  }
+
+  const int  dim = cache->dim;
+  const cs_lnum_t  s = cache->idx[c_id] + *shift;
+
+  *shift += n_pts;
+
+  cs_lnum_t  n_set;
+# pragma omp atomic read
+  n_set = cache->n_set;
+
+  if (n_set < cache->n_zone_cells) { /* Record the points of this cell */
+
+    anai->func(time_eval, n_pts, NULL, xyz,
+               true, /* compacted output ? */
+               anai->input,
+               eval);
+
+    /* The cell-wise sequence of points should match the index. Otherwise,
+       this cell is never marked and the function is always called cell by
+       cell. */
+
+    if (s + n_pts > cache->idx[c_id+1] || cache->is_set[c_id])
+      return;
+
+    memcpy(cache->coords + 3*s, xyz, 3*n_pts*sizeof(cs_real_t));
+
+    if (s + n_pts == cache->idx[c_id+1]) {
+      cache->is_set[c_id] = true;
+#     pragma omp atomic
+      cache->n_set += 1;
+    }
+
+  }
+  else { /* All the points are known */
+
+    assert(s + n_pts <= cache->idx[c_id+1]);
+
+    int  k = _find_slot(cache, time_eval);
+
+    if (k < 0) {
+      _update_values(anai, time_eval, cache);
+      k = _find_slot(cache, time_eval);
+    }
+
+    /* Register as a reader of the slot, then check that the slot was not
+       invalidated in the meantime (values are only overwritten once there
+       is no reader) */
+
+    bool  is_valid = false;
+
+    if (k > -1) {
+
+#     pragma omp atomic
+      cache->n_readers[k] += 1;
+#     pragma omp flush
+
+      cs_real_t  t_eval;
+#     pragma omp atomic read
+      t_eval = cache->t_eval[k];
+
+      is_valid = _values_are_valid(cache, t_eval, time_eval);
+      if (is_valid)
+        memcpy(eval, cache->values[k] + dim*s, dim*n_pts*sizeof(cs_real_t));
+
+#     pragma omp flush
+#     pragma omp atomic
+      cache->n_readers[k] -= 1;
+
+    }
+
+    if (!is_valid) /* Slot reused for another time in the meantime */
+      anai->func(time_eval, n_pts, NULL, xyz,
+                 true, /* compacted output ? */
+                 anai->input,
+                 eval);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,210 @@
+#ifndef __CS_XDEF_CACHE_H__
+#define __CS_XDEF_CACHE_H__
+
+/*============================================================================
+ * Cache of evaluation points and values related to a cs_xdef_t structure
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_cdo_connect.h"
+#include "cs_xdef.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/* Number of times of evaluation for which values are kept (a theta scheme
+   evaluates a source term at two different times in each cell) */
+
+#define CS_XDEF_CACHE_N_SLOTS  2
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! \struct _cs_xdef_cache_t
+ *  \brief Storage of the evaluation points of a definition by analytic
+ *         function and of the related values
+ *
+ *  A cell-wise evaluation (for instance the quadrature of a source term)
+ *  always calls the analytic function with the same sequence of points in a
+ *  given cell. The number of points in a cell is given by a linear
+ *  combination of its number of vertices, edges and faces.
+ *
+ *  During a first pass on the cells of the zone, the points are recorded.
+ *  Once all the points are known, the function is evaluated once for all the
+ *  points and cell-wise evaluations only retrieve the cached values.
+ *
+ *  Values of a non-steady definition are cached only if time_values is set
+ *  (the function should then depend on the time and the coordinates only).
+ *  They are kept for the last CS_XDEF_CACHE_N_SLOTS times of evaluation, and
+ *  are evaluated again for a new time.
+ */
+
+struct _cs_xdef_cache_t {
+
+  int                      dim;          /*!< dimension of the values */
+  int                      z_id;         /*!< id of the related volume zone */
+  bool                     steady;       /*!< values do not depend on time */
+  bool                     time_values;  /*!< cache the values of a
+                                              non-steady definition for each
+                                              time of evaluation */
+
+  const cs_cdo_connect_t  *connect;      /*!< pointer to the connectivity */
+  int                      n_pts_by[4];  /*!< number of points per vertex,
+                                              edge, face and cell */
+
+  cs_lnum_t                n_cells;      /*!< number of cells */
+  cs_lnum_t                n_zone_cells; /*!< number of cells to record */
+  cs_lnum_t                n_set;        /*!< number of recorded cells */
+  cs_lnum_t               *idx;          /*!< index on points (n_cells+1) */
+  bool                    *is_set;       /*!< are the points of a cell set */
+  cs_real_t               *coords;       /*!< coordinates of the points */
+
+  int                      last_slot;    /*!< slot of the last evaluation */
+
+  cs_real_t   t_eval[CS_XDEF_CACHE_N_SLOTS];   /*!< time of evaluation of
+                                                    each slot (-DBL_MAX if
+                                                    none) */
+  int         n_readers[CS_XDEF_CACHE_N_SLOTS];/*!< number of threads
+                                                    copying values from
+                                                    each slot */
+  cs_real_t  *values[CS_XDEF_CACHE_N_SLOTS];   /*!< values at the points
+                                                    for each slot */
+
+};
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a cache of evaluation points and values for a definition
+ *         by analytic function on a volume zone. The number of points
+ *         used in a cell c is n_v_pts*|V_c| + n_e_pts*|E_c| + n_f_pts*|F_c|
+ *         + n_c_pts.
+ *
+ * \param[in]  def       pointer to the related cs_xdef_t structure
+ * \param[in]  connect   pointer to a cs_cdo_connect_t structure
+ * \param[in]  n_v_pts   number of points per cell vertex
+ * \param[in]  n_e_pts   number of points per cell edge
+ * \param[in]  n_f_pts   number of points per cell face
+ * \param[in]  n_c_pts   number of additional points per cell
+ *
+ * \return a pointer to a new allocated cs_xdef_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_xdef_cache_t *
+cs_xdef_cache_create(const cs_xdef_t          *def,
+                     const cs_cdo_connect_t   *connect,
+                     int                       n_v_pts,
+                     int                       n_e_pts,
+                     int                       n_f_pts,
+                     int                       n_c_pts);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set if the values of a non-steady definition are cached for each
+ *         time of evaluation. This is only valid if the analytic function
+ *         depends on the time and on the coordinates only. Otherwise (by
+ *         default), the function is called at each evaluation.
+ *         The content of the cache is reset if the status changes.
+ *
+ * \param[in, out]  cache    pointer to a cs_xdef_cache_t structure
+ * \param[in]       status   true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_cache_set_time_values(cs_xdef_cache_t   *cache,
+                              bool               status);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_xdef_cache_t structure
+ *
+ * \param[in, out]  p_cache   pointer to the cs_xdef_cache_t structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_cache_free(cs_xdef_cache_t   **p_cache);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the content of all caches of evaluation points and
+ *         values (for instance after a mesh modification).
+ *
+ * \param[in]  connect   pointer to the (new) cs_cdo_connect_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_cache_reset_all(const cs_cdo_connect_t   *connect);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate an analytic function at a set of points in a cell relying
+ *         on the cache attached to the definition when available.
+ *         Successive calls for the same cell have to be done with the same
+ *         sequence of points. The shift is incremented at each call and
+ *         should be set to 0 before the first call in a cell.
+ *         This function may be called concurrently for different cells.
+ *
+ * \param[in]      anai       pointer to a cs_xdef_analytic_input_t structure
+ * \param[in]      c_id       id of the current cell
+ * \param[in]      time_eval  physical time at which one evaluates the term
+ * \param[in]      n_pts      number of points
+ * \param[in]      xyz        coordinates of the points (size 3*n_pts)
+ * \param[in, out] shift      position of the points in the cell sequence
+ * \param[in, out] eval       values at the points (size dim*n_pts)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_cache_eval_analytic(const cs_xdef_analytic_input_t  *anai,
+                            cs_lnum_t                        c_id,
+                            cs_real_t                        time_eval,
+                            int                              n_pts,
+                            const cs_real_t                 *xyz,
+                            int                             *shift,
+                            cs_real_t                       *eval);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_XDEF_CACHE_H__ */
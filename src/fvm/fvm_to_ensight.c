@@ -94,6 +94,12 @@ typedef struct {
   bool         divide_polygons;    /* Option to tesselate polygonal elements */
   bool         divide_polyhedra;   /* Option to tesselate polyhedral elements */
 
+  bool         async;              /* Option to use non-blocking writes */
+  bool         pending_flushed;    /* true if files with pending writes
+                                      belong to a flushed output */
+  int          n_pending_files;    /* Number of files with pending writes */
+  cs_file_t  **pending_files;      /* Files with pending writes */
+
   fvm_to_ensight_case_t  *case_info;  /* Associated case structure */
 
 #if defined(HAVE_MPI)
@@ -150,19 +156,50 @@ static const int _ensight_c_order_6[6] = {0, 1, 2, 3, 5, 4};
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Complete pending writes for binary files, closing them.
+ *
+ * parameters:
+ *   this_writer <-> pointer to Ensight Gold writer structure.
+ *   filename    <-- name of file to complete, or NULL for all files.
+ *----------------------------------------------------------------------------*/
+
+static void
+_complete_pending_files(fvm_to_ensight_writer_t  *this_writer,
+                        const char               *filename)
+{
+  int j = 0;
+
+  for (int i = 0; i < this_writer->n_pending_files; i++) {
+    cs_file_t *bf = this_writer->pending_files[i];
+    if (   filename == NULL
+        || strcmp(cs_file_get_name(bf), filename) == 0)
+      cs_file_free(bf);
+    else
+      this_writer->pending_files[j++] = bf;
+  }
+
+  this_writer->n_pending_files = j;
+
+  if (j == 0) {
+    BFT_FREE(this_writer->pending_files);
+    this_writer->pending_flushed = false;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Open an EnSight Gold geometry or variable file
  *
  * parameters:
- *   this_writer <-- pointer to Ensight Gold writer structure.
+ *   this_writer <-> pointer to Ensight Gold writer structure.
  *   filename    <-- name of file to open.
  *   apend       <-- if true, append to file instead of overwriting
  *----------------------------------------------------------------------------*/
 
 static _ensight_file_t
-_open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
-                   const char                     *filename,
-                   bool                            append)
+_open_ensight_file(fvm_to_ensight_writer_t  *this_writer,
+                   const char               *filename,
+                   bool                      append)
 {
   _ensight_file_t f = {NULL, NULL};
 
@@ -183,6 +220,11 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
     cs_file_mode_t mode = append ? CS_FILE_MODE_APPEND : CS_FILE_MODE_WRITE;
     cs_file_access_t method;
 
+    /* A file with pending writes must be complete before being reopened */
+
+    if (this_writer->n_pending_files > 0)
+      _complete_pending_files(this_writer, filename);
+
 #if defined(HAVE_MPI)
 
     MPI_Info hints;
@@ -203,6 +245,9 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
 
     if (this_writer->swap_endian == true)
       cs_file_set_swap_endian(f.bf, 1);
+
+    if (this_writer->async)
+      cs_file_set_async(f.bf, true);
   }
 
   return f;
@@ -211,12 +256,17 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
 /*----------------------------------------------------------------------------
  * close an EnSight Gold geometry or variable file
  *
+ * Binary files with pending non-blocking writes are only closed once
+ * those writes are completed, at the next output following a flush.
+ *
  * parameters:
- *   f <-- pointer to file handler structure.
+ *   this_writer <-> pointer to Ensight Gold writer structure.
+ *   f           <-- pointer to file handler structure.
  *----------------------------------------------------------------------------*/
 
 static void
-_free_ensight_file(_ensight_file_t  *f)
+_free_ensight_file(fvm_to_ensight_writer_t  *this_writer,
+                   _ensight_file_t          *f)
 {
   if (f->tf != NULL) {
     if (fclose(f->tf) != 0)
@@ -226,8 +276,17 @@ _free_ensight_file(_ensight_file_t  *f)
     f->tf = NULL;
   }
 
-  else if (f->bf != NULL)
-    f->bf = cs_file_free(f->bf);
+  else if (f->bf != NULL) {
+    if (cs_file_get_async(f->bf)) {
+      int n = this_writer->n_pending_files;
+      BFT_REALLOC(this_writer->pending_files, n + 1, cs_file_t *);
+      this_writer->pending_files[n] = f->bf;
+      this_writer->n_pending_files += 1;
+      f->bf = NULL;
+    }
+    else
+      f->bf = cs_file_free(f->bf);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -2531,6 +2590,8 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   async               use non-blocking writes (binary output with
+ *                       MPI-IO only), completed at the next output
  *
  * parameters:
  *   name           <-- base output case name.
@@ -2573,6 +2634,11 @@ fvm_to_ensight_init_writer(const char             *name,
   this_writer->divide_polygons = false;
   this_writer->divide_polyhedra = false;
 
+  this_writer->async = false;
+  this_writer->pending_flushed = false;
+  this_writer->n_pending_files = 0;
+  this_writer->pending_files = NULL;
+
   this_writer->rank = 0;
   this_writer->n_ranks = 1;
 
@@ -2645,6 +2711,9 @@ fvm_to_ensight_init_writer(const char             *name,
                && (strncmp(options + i1, "divide_polyhedra", l_opt) == 0))
         this_writer->divide_polyhedra = true;
 
+      else if ((l_opt == 5) && (strncmp(options + i1, "async", l_opt) == 0))
+        this_writer->async = true;
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
     }
@@ -2676,6 +2745,8 @@ fvm_to_ensight_finalize_writer(void  *this_writer_p)
   fvm_to_ensight_writer_t  *this_writer
                              = (fvm_to_ensight_writer_t *)this_writer_p;
 
+  _complete_pending_files(this_writer, NULL);
+
   BFT_FREE(this_writer->name);
 
   fvm_to_ensight_case_destroy(this_writer->case_info);
@@ -2787,6 +2858,11 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
   fvm_to_ensight_case_file_info_t  file_info;
 
+  /* Complete writes pending from previous outputs */
+
+  if (this_writer->pending_flushed)
+    _complete_pending_files(this_writer, NULL);
+
   /* Get part number */
 
   part_num = fvm_to_ensight_case_get_part_num(this_writer->case_info,
@@ -2994,7 +3070,7 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
   /* Close geometry file and update case file */
   /*------------------------------------------*/
 
-  _free_ensight_file(&f);
+  _free_ensight_file(this_writer, &f);
 
   fvm_to_ensight_case_write_case(this_writer->case_info, rank);
 }
@@ -3053,6 +3129,11 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
   /* Initialization */
   /*----------------*/
 
+  /* Complete writes pending from previous outputs */
+
+  if (w->pending_flushed)
+    _complete_pending_files(w, NULL);
+
   /* Dimension */
 
   output_dim = dimension;
@@ -3249,11 +3330,31 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
   /* Close variable file and update case file */
   /*------------------------------------------*/
 
-  _free_ensight_file(&f);
+  _free_ensight_file(w, &f);
 
   fvm_to_ensight_case_write_case(w->case_info, rank);
 }
 
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * Files with pending non-blocking writes are not waited upon here, but
+ * are marked so as to be completed at the next output, so that writing
+ * may overlap computation in between.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_ensight_flush(void  *this_writer_p)
+{
+  fvm_to_ensight_writer_t  *w = (fvm_to_ensight_writer_t *)this_writer_p;
+
+  if (w->n_pending_files > 0)
+    w->pending_flushed = true;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -192,6 +192,20 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
                             double                 time_value,
                             const void      *const field_values[]);
 
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * Files with pending non-blocking writes are not waited upon here, but
+ * are marked so as to be completed at the next output, so that writing
+ * may overlap computation in between.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_ensight_flush(void  *this_writer_p);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -130,7 +130,7 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     fvm_to_ensight_needs_tesselation,  /* needs_tesselation_func */
     fvm_to_ensight_export_nodal,       /* export_nodal_func */
     fvm_to_ensight_export_field,       /* export_field_func */
-    NULL                               /* flush_func */
+    fvm_to_ensight_flush               /* flush_func */
   },
 
   /* MED writer */
@@ -95,6 +95,7 @@
 #include "cs_lagr_resuspension.h"
 #include "cs_lagr_stat.h"
 #include "cs_lagr_tracking.h"
+#include "cs_lagr_trajectory.h"
 #include "cs_lagr_print.h"
 #include "cs_lagr_poisson.h"
 #include "cs_lagr_post.h"
@@ -104,6 +105,7 @@
 #include "cs_lagr_prototypes.h"
 #include "cs_lagr_agglo.h"
 #include "cs_lagr_fragmentation.h"
+#include "cs_lagr_population.h"
 
 #include "cs_random.h"
 
@@ -270,6 +272,18 @@ static cs_lagr_consolidation_model_t _cs_glob_lagr_consolidation_model
 cs_lagr_consolidation_model_t *cs_glob_lagr_consolidation_model
   = &_cs_glob_lagr_consolidation_model;
 
+/* lagr parcel population control structure and associated pointer */
+static cs_lagr_population_model_t _cs_glob_lagr_population_model
+  = {
+    .interval = 0,
+    .n_min_per_cell = 0,
+    .n_max_per_cell = 0,
+    .min_stat_weight = 1.,
+    .merge_tolerance = 0.1};
+
+cs_lagr_population_model_t *cs_glob_lagr_population_model
+  = &_cs_glob_lagr_population_model;
+
 /*! current time step status */
 
 static cs_lagr_time_step_t _cs_glob_lagr_time_step
@@ -1205,6 +1219,8 @@ cs_lagr_finalize(void)
 
   cs_lagr_stat_finalize();
 
+  cs_lagr_trajectory_finalize();
+
   /* Also close log file (TODO move this) */
 
   cs_lagr_print_finalize();
@@ -1492,6 +1508,18 @@ cs_get_lagr_consolidation_model(void)
   return &_cs_glob_lagr_consolidation_model;
 }
 
+/*----------------------------------------------------------------------------
+ * Provide access to cs_lagr_population_model_t
+ *
+ * needed to initialize structure with GUI
+ *----------------------------------------------------------------------------*/
+
+cs_lagr_population_model_t *
+cs_get_lagr_population_model(void)
+{
+  return &_cs_glob_lagr_population_model;
+}
+
 /*----------------------------------------------------------------------------
  * Provide access to cs_lagr_time_step_t
  *
@@ -2055,6 +2083,20 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
   cs_lagr_injection(iprev, itypfb, vislen);
 
+  /* Optionally sort injected particles by cell
+     (others were sorted at the end of the previous tracking stage) */
+
+  {
+    int sort_interval = cs_lagr_get_cell_sort_interval();
+
+    if (sort_interval > 0 && ts->nt_cur % sort_interval == 0)
+      cs_lagr_particle_set_sort_by_cell(p_set,
+                                        p_set->n_particles - p_set->n_part_new,
+                                        p_set->n_particles,
+                                        cs_glob_mesh->n_cells,
+                                        NULL);
+  }
+
   /* Initialization for the agglomeration/fragmentation models
      --------------------------------------------------------- */
 
@@ -2514,6 +2556,12 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
       }
 
+      /* Parcel population control (merge and split parcels)
+         --------------------------------------------------- */
+
+      if (cs_glob_lagr_time_step->nor == cs_glob_lagr_time_scheme->t_order)
+        cs_lagr_population_control();
+
       /* Compute adhesion for reentrainement model
          ----------------------------------------- */
 
@@ -2554,6 +2602,11 @@ cs_lagr_solve_time_step(const int         itypfb[],
           && cs_glob_time_step->nt_cur >= cs_glob_lagr_stat_options->idstnt)
         cs_lagr_stat_update();
 
+      /* Streaming output of particle data */
+
+      if (cs_glob_lagr_time_step->nor == cs_glob_lagr_time_scheme->t_order)
+        cs_lagr_trajectory_write();
+
       /* Statistics for clogging */
 
       if (   cs_glob_lagr_time_step->nor == cs_glob_lagr_time_scheme->t_order
@@ -519,6 +519,33 @@ typedef struct {
 
 } cs_lagr_consolidation_model_t;
 
+/*! Parameters of the parcel population control */
+/* --------------------------------------------- */
+
+typedef struct {
+
+  int                interval;            /*!< apply population control
+                                               every interval time steps
+                                               (0: never) */
+
+  cs_lnum_t          n_min_per_cell;      /*!< split parcels in cells
+                                               containing fewer parcels
+                                               in flow (0: never) */
+
+  cs_lnum_t          n_max_per_cell;      /*!< merge parcels in cells
+                                               containing more parcels
+                                               in flow (0: never) */
+
+  cs_real_t          min_stat_weight;     /*!< parcels are not split if
+                                               their statistical weight would
+                                               fall below this value */
+
+  cs_real_t          merge_tolerance;     /*!< maximum relative difference
+                                               of diameters and velocities of
+                                               merged parcels */
+
+} cs_lagr_population_model_t;
+
 /*! Lagrangian time stepping status */
 /*----------------------------------*/
 
@@ -1058,6 +1085,7 @@ extern cs_lagr_agglomeration_model_t         *cs_glob_lagr_agglomeration_model;
 extern cs_lagr_fragmentation_model_t         *cs_glob_lagr_fragmentation_model;
 
 extern cs_lagr_consolidation_model_t         *cs_glob_lagr_consolidation_model;
+extern cs_lagr_population_model_t            *cs_glob_lagr_population_model;
 extern cs_lagr_time_step_t                   *cs_glob_lagr_time_step;
 extern cs_lagr_source_terms_t                *cs_glob_lagr_source_terms;
 extern cs_lagr_encrustation_t                *cs_glob_lagr_encrustation;
@@ -1198,6 +1226,15 @@ cs_get_lagr_agglomeration_model(void);
 cs_lagr_consolidation_model_t *
 cs_get_lagr_consolidation_model(void);
 
+/*----------------------------------------------------------------------------
+ * Provide access to cs_lagr_population_model_t
+ *
+ * needed to initialize structure with GUI
+ *----------------------------------------------------------------------------*/
+
+cs_lagr_population_model_t *
+cs_get_lagr_population_model(void);
+
 /*----------------------------------------------------------------------------
  * Provide access to cs_lagr_time_step_t
  *
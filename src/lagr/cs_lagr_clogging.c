@@ -236,6 +236,8 @@ cs_lagr_clogging_barrier(const void                     *particle,
   cs_real_t  value;
   cs_lnum_t  i;
 
+  cs_real_t  dist[101], udlvo[101];
+
   /* Computation of the number of particles in contact with */
   /* the depositing particle */
 
@@ -283,84 +285,67 @@ cs_lagr_clogging_barrier(const void                     *particle,
 
   if (contact_count[0] == 0) {
 
-    *energy_barrier = 0.0;
-
-    /* Computation of the energy barrier */
+    const cs_real_t  step = cs_lagr_clogging_param.debye_length[iel]/30.0;
 
-    for (i = 0; i < 101; i++) {
+    for (i = 0; i < 101; i++)
+      dist[i] = _d_cut_off + i*step;
 
-      cs_real_t  step = cs_lagr_clogging_param.debye_length[iel]/30.0;
+    cs_lagr_dlvo_sphere_plane(101,
+                              dist,
+                              depositing_radius,
+                              cs_lagr_clogging_param.lambda_vdw,
+                              cs_lagr_clogging_param.cstham,
+                              cs_lagr_clogging_param.valen,
+                              cs_lagr_clogging_param.phi_p,
+                              cs_lagr_clogging_param.phi_s,
+                              cs_lagr_clogging_param.temperature[iel],
+                              cs_lagr_clogging_param.debye_length[iel],
+                              cs_lagr_clogging_param.water_permit,
+                              udlvo);
 
-      cs_real_t distp = _d_cut_off + i*step;
+  }
 
-      cs_real_t var1
-        = cs_lagr_van_der_waals_sphere_plane(distp,
-                                             depositing_radius,
-                                             cs_lagr_clogging_param.lambda_vdw,
-                                             cs_lagr_clogging_param.cstham);
+  else if (contact_count[0] > 0) {
 
-      cs_real_t var2
-        = cs_lagr_edl_sphere_plane(distp,
-                                   depositing_radius,
-                                   cs_lagr_clogging_param.valen,
-                                   cs_lagr_clogging_param.phi_p,
-                                   cs_lagr_clogging_param.phi_s,
-                                   cs_lagr_clogging_param.temperature[iel],
-                                   cs_lagr_clogging_param.debye_length[iel],
-                                   cs_lagr_clogging_param.water_permit);
+    const cs_real_t  step = cs_lagr_clogging_param.debye_length[iel]/30.0;
 
-      cs_real_t var = var1 + var2;
+    for (i = 0; i < 101; i++)
+      dist[i] = _d_cut_off + i*step + depositing_radius + deposited_radius;
 
-      if (var > *energy_barrier)
-        *energy_barrier = var;
-      if (var < 0.)
-        *energy_barrier = 0.;
+    cs_lagr_dlvo_sphere_sphere(101,
+                               dist,
+                               deposited_radius,
+                               depositing_radius,
+                               cs_lagr_clogging_param.lambda_vdw,
+                               cs_lagr_clogging_param.csthpp,
+                               cs_lagr_clogging_param.valen,
+                               cs_lagr_clogging_param.phi_p,
+                               cs_lagr_clogging_param.phi_p,
+                               cs_lagr_clogging_param.temperature[iel],
+                               cs_lagr_clogging_param.debye_length[iel],
+                               cs_lagr_clogging_param.water_permit,
+                               udlvo);
 
-    }
+    for (i = 0; i < 101; i++)
+      udlvo[i] *= contact_count[0];
 
-    *energy_barrier =  *energy_barrier / (0.5 * p_diameter);
   }
 
-  else if (contact_count[0] > 0) {
+  /* Computation of the energy barrier */
+
+  if (contact_count[0] >= 0) {
 
     *energy_barrier = 0.0;
 
-    /* Computation of the energy barrier */
     for (i = 0; i < 101; i++) {
-
-      cs_real_t  step = cs_lagr_clogging_param.debye_length[iel]/30.0;
-
-      cs_real_t distcc =   _d_cut_off + i*step
-                         + depositing_radius + deposited_radius;
-
-      cs_real_t var1
-        = cs_lagr_van_der_waals_sphere_sphere(distcc,
-                                              deposited_radius,
-                                              depositing_radius,
-                                              cs_lagr_clogging_param.lambda_vdw,
-                                              cs_lagr_clogging_param.csthpp);
-
-      cs_real_t var2
-        = cs_lagr_edl_sphere_sphere(distcc,
-                                    deposited_radius,
-                                    depositing_radius,
-                                    cs_lagr_clogging_param.valen,
-                                    cs_lagr_clogging_param.phi_p,
-                                    cs_lagr_clogging_param.phi_p,
-                                    cs_lagr_clogging_param.temperature[iel],
-                                    cs_lagr_clogging_param.debye_length[iel],
-                                    cs_lagr_clogging_param.water_permit);
-
-      cs_real_t var = contact_count[0] * (var1 + var2);
-
-      if (var > *energy_barrier)
-        *energy_barrier = var;
-      if (var < 0.)
+      if (udlvo[i] > *energy_barrier)
+        *energy_barrier = udlvo[i];
+      if (udlvo[i] < 0.)
         *energy_barrier = 0.;
-
     }
 
     *energy_barrier =  *energy_barrier / (0.5 * p_diameter);
+
   }
 
   *limit = cs_lagr_clogging_param.jamming_limit;
@@ -188,6 +188,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
   /* Finalization of external forces (if the particle interacts with a
      domain boundary, revert to order 1). */
 
+# pragma omp parallel for if (nbpart > CS_THR_MIN)
   for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
     cs_real_t aux1 = dtp / taup[npt];
@@ -203,6 +204,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
 
   }
 
+# pragma omp parallel for if (nbpart > CS_THR_MIN)
   for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
     cs_real_t  p_stat_w = cs_lagr_particles_get_real(p_set, npt,
@@ -239,6 +241,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
         t_st_vel[i][j] = 0;
     }
 
+#   pragma omp parallel for if (nbpart > CS_THR_MIN)
     for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
       unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
@@ -256,13 +259,19 @@ cs_lagr_coupling(const cs_real_t  taup[],
       cs_lnum_t iel = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_CELL_ID);
 
       /* Volume and mass of particles in cell */
+#     pragma omp atomic
       volp[iel] += p_stat_w * cs_math_pi * pow(prev_p_diam, 3) / 6.0;
+#     pragma omp atomic
       volm[iel] += p_stat_w * prev_p_mass;
 
       /* Momentum source term */
+#     pragma omp atomic
       t_st_vel[iel][0] += - auxl1[npt];
+#     pragma omp atomic
       t_st_vel[iel][1] += - auxl2[npt];
+#     pragma omp atomic
       t_st_vel[iel][2] += - auxl3[npt];
+#     pragma omp atomic
       tslag[iel + (lag_st->itsli-1) * ncelet]
         += - 2.0 * p_stat_w * p_mass / taup[npt];
 
@@ -277,6 +286,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
          (difficult to write something for v2, which loses its meaning as
          "Rij comonent") */
 
+#     pragma omp parallel for if (nbpart > CS_THR_MIN)
       for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
         unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
@@ -292,6 +302,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
         cs_real_t vvf = 0.5 * (prev_f_vel[1] + f_vel[1]);
         cs_real_t wwf = 0.5 * (prev_f_vel[2] + f_vel[2]);
 
+#       pragma omp atomic
         tslag[iel + (lag_st->itske-1) * ncelet] += - uuf * auxl1[npt]
                                                    - vvf * auxl2[npt]
                                                    - wwf * auxl3[npt];
@@ -317,6 +328,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
           t_st_rij[i][j] = 0;
       }
 
+#     pragma omp parallel for if (nbpart > CS_THR_MIN)
       for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
         unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
@@ -333,11 +345,17 @@ cs_lagr_coupling(const cs_real_t  taup[],
         cs_real_t vvf = 0.5 * (prev_f_vel[1] + f_vel[1]);
         cs_real_t wwf = 0.5 * (prev_f_vel[2] + f_vel[2]);
 
+#       pragma omp atomic
         t_st_rij[iel][0] += - 2.0 * uuf * auxl1[npt];
+#       pragma omp atomic
         t_st_rij[iel][1] += - 2.0 * vvf * auxl2[npt];
+#       pragma omp atomic
         t_st_rij[iel][2] += - 2.0 * wwf * auxl3[npt];
+#       pragma omp atomic
         t_st_rij[iel][3] += - uuf * auxl2[npt] - vvf * auxl1[npt];
+#       pragma omp atomic
         t_st_rij[iel][4] += - vvf * auxl3[npt] - wwf * auxl2[npt];
+#       pragma omp atomic
         t_st_rij[iel][5] += - uuf * auxl3[npt] - wwf * auxl1[npt];
 
       }
@@ -374,6 +392,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
       && (   cs_glob_lagr_specific_physics->impvar == 1
           || cs_glob_lagr_specific_physics->idpvar == 1)) {
 
+#   pragma omp parallel for if (nbpart > CS_THR_MIN)
     for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
       unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
@@ -389,6 +408,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
       cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
                                                     CS_LAGR_CELL_ID);
 
+#     pragma omp atomic
       tslag[cell_id + (lag_st->itsmas-1) * ncelet]
         += - p_stat_w * (p_mass - prev_p_mass) / dtp;
 
@@ -404,6 +424,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
     if (   cs_glob_lagr_model->physical_model == CS_LAGR_PHYS_HEAT
         && cs_glob_lagr_specific_physics->itpvar == 1) {
 
+#     pragma omp parallel for if (nbpart > CS_THR_MIN)
       for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
         unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
@@ -424,15 +445,18 @@ cs_lagr_coupling(const cs_real_t  taup[],
         cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am,
                                                         CS_LAGR_STAT_WEIGHT);
 
+#       pragma omp atomic
         tslag[iel + (lag_st->itste-1) * ncelet]
           += - (p_mass * p_tmp * p_cp
              - prev_p_mass * prev_p_tmp * prev_p_cp) / dtp * p_stat_w;
+#       pragma omp atomic
         tslag[iel + (lag_st->itsti-1) * ncelet]
           += tempct[nbpart + npt] * p_stat_w;
 
       }
       if (extra->radiative_model > 0) {
 
+#       pragma omp parallel for if (nbpart > CS_THR_MIN)
         for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
           unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
@@ -451,6 +475,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
                           * (extra->luminance->val[iel]
                              - 4.0 * _c_stephan * cs_math_pow4(p_tmp));
 
+#         pragma omp atomic
           tslag[iel + (lag_st->itste-1) * ncelet] += aux1 * p_stat_w;
 
         }
@@ -465,6 +490,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
 
       else {
 
+#       pragma omp parallel for if (nbpart > CS_THR_MIN)
         for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
           unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
@@ -491,17 +517,23 @@ cs_lagr_coupling(const cs_real_t  taup[],
           cs_real_t  p_stat_w = cs_lagr_particle_get_real
                                   (particle, p_am, CS_LAGR_STAT_WEIGHT);
 
+#         pragma omp atomic
           tslag[iel + (lag_st->itste-1) * ncelet]
             += - (  p_mass * p_tmp * p_cp
                - prev_p_mass * prev_p_tmp * prev_p_cp) / dtp * p_stat_w;
+#         pragma omp atomic
           tslag[iel + (lag_st->itsti-1) * ncelet]
             += tempct[nbpart + npt] * p_stat_w;
+#         pragma omp atomic
           tslag[iel + (lag_st->itsmv1[icha]-1) * ncelet]
             += p_stat_w * cpgd1[npt];
+#         pragma omp atomic
           tslag[iel + (lag_st->itsmv2[icha]-1) * ncelet]
             += p_stat_w * cpgd2[npt];
+#         pragma omp atomic
           tslag[iel + (lag_st->itsco-1) * ncelet]
             += p_stat_w * cpght[npt];
+#         pragma omp atomic write
           tslag[iel + (lag_st->itsfp4-1) * ncelet] = 0.0;
 
         }
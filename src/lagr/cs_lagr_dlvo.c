@@ -79,6 +79,10 @@ BEGIN_C_DECLS
 
 #define PG_CST 8.314  /* Ideal gas constant */
 
+/* Number of separation distances sampled for the energy barrier */
+
+#define _N_BARRIER_STEPS 1001
+
 /*============================================================================
  * Local structure declarations
  *============================================================================*/
@@ -103,6 +107,60 @@ static const cs_real_t _free_space_permit = 8.854e-12;
 /* Faraday constant */
 static const cs_real_t _faraday_cst = 9.648e4;
 
+/* Elementary charge (as used in EDL formulas) */
+static const cs_real_t _e_charge = 1.6e-19;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Extended reduced zeta potential of a sphere
+ * (following the work from Ohshima et al, 1982, JCIS, 90, 17-26).
+ *
+ * parameters:
+ *   lphi  <-- reduced zeta potential
+ *   tau   <-- sphere radius to Debye length ratio
+ *
+ * returns:
+ *   extended reduced zeta potential
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_extended_zeta_sphere(cs_real_t  lphi,
+                      cs_real_t  tau)
+{
+  cs_real_t th = tanh(lphi / 4.);
+
+  return 8. * th / (1. + sqrt(1. - (2. * tau + 1.) / ((tau + 1) * (tau + 1))
+                                   * th * th));
+}
+
+/*----------------------------------------------------------------------------
+ * Return the maximum of an array of values, or 0 if all are negative.
+ *
+ * parameters:
+ *   n  <-- number of values
+ *   u  <-- values
+ *
+ * returns:
+ *   max(0, max(u))
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_max_positive(cs_lnum_t        n,
+              const cs_real_t  u[])
+{
+  cs_real_t u_max = 0.;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    if (u[i] > u_max)
+      u_max = u[i];
+  }
+
+  return u_max;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -203,50 +261,34 @@ cs_lagr_barrier(const void                     *particle,
                 cs_lnum_t                       iel,
                 cs_real_t                      *energy_barrier)
 {
-  cs_lnum_t i;
   cs_real_t rpart = cs_lagr_particle_get_real(particle, attr_map,
                                               CS_LAGR_DIAMETER) * 0.5;
 
-  *energy_barrier = 0.;
-
-  cs_real_t barr = 0.;
-  cs_real_t distp = 0.;
+  cs_real_t distp[_N_BARRIER_STEPS], udlvo[_N_BARRIER_STEPS];
 
   /* Computation of the energy barrier */
 
-  for (i = 0; i < 1001; i++) {
-
-    cs_real_t  step = cs_lagr_dlvo_param.debye_length[iel]/30.0;
-
-    /* Interaction between the sphere and the plate */
-
-    distp = _d_cut_off + i * step;
+  const cs_real_t step = cs_lagr_dlvo_param.debye_length[iel]/30.0;
 
-    cs_real_t var1
-      = cs_lagr_van_der_waals_sphere_plane(distp,
-                                           rpart,
-                                           cs_lagr_dlvo_param.lambda_vdw,
-                                           cs_lagr_dlvo_param.cstham);
+  for (int i = 0; i < _N_BARRIER_STEPS; i++)
+    distp[i] = _d_cut_off + i * step;
 
-    cs_real_t var2
-      = cs_lagr_edl_sphere_plane(distp,
-                                 rpart,
-                                 cs_lagr_dlvo_param.valen,
-                                 cs_lagr_dlvo_param.phi_p,
-                                 cs_lagr_dlvo_param.phi_s,
-                                 cs_lagr_dlvo_param.temperature[iel],
-                                 cs_lagr_dlvo_param.debye_length[iel],
-                                 cs_lagr_dlvo_param.water_permit);
+  /* Interaction between the sphere and the plate */
 
-    barr = (var1 + var2);
+  cs_lagr_dlvo_sphere_plane(_N_BARRIER_STEPS,
+                            distp,
+                            rpart,
+                            cs_lagr_dlvo_param.lambda_vdw,
+                            cs_lagr_dlvo_param.cstham,
+                            cs_lagr_dlvo_param.valen,
+                            cs_lagr_dlvo_param.phi_p,
+                            cs_lagr_dlvo_param.phi_s,
+                            cs_lagr_dlvo_param.temperature[iel],
+                            cs_lagr_dlvo_param.debye_length[iel],
+                            cs_lagr_dlvo_param.water_permit,
+                            udlvo);
 
-    if (barr >  *energy_barrier)
-      *energy_barrier = barr;
-    if ( *energy_barrier < 0)
-      *energy_barrier = 0;
-   }
-
-  *energy_barrier = *energy_barrier / rpart;
+  *energy_barrier = _max_positive(_N_BARRIER_STEPS, udlvo) / rpart;
 }
 
 /*----------------------------------------------------------------------------
@@ -260,45 +302,32 @@ cs_lagr_barrier_pp(cs_real_t                       dpart,
 {
   cs_real_t rpart = dpart * 0.5;
 
-  *energy_barrier = 0.;
+  cs_real_t distcc[_N_BARRIER_STEPS], udlvo[_N_BARRIER_STEPS];
 
   /* Computation of the energy barrier */
 
-  for (int i = 0; i < 1001; i++) {
-
-    cs_real_t step = cs_lagr_dlvo_param.debye_length[iel] / 30.0;
-
-    /* Interaction between two spheres */
+  const cs_real_t step = cs_lagr_dlvo_param.debye_length[iel] / 30.0;
 
-    cs_real_t distcc = _d_cut_off + i * step + 2.0 * rpart;
+  for (int i = 0; i < _N_BARRIER_STEPS; i++)
+    distcc[i] = _d_cut_off + i * step + 2.0 * rpart;
 
-    cs_real_t var1
-      = cs_lagr_van_der_waals_sphere_sphere(distcc,
-                                            rpart,
-                                            rpart,
-                                            cs_lagr_dlvo_param.lambda_vdw,
-                                            cs_lagr_dlvo_param.csthpp);
+  /* Interaction between two spheres */
 
-    cs_real_t var2
-      = cs_lagr_edl_sphere_sphere(distcc,
-                                  rpart,
-                                  rpart,
-                                  cs_lagr_dlvo_param.valen,
-                                  cs_lagr_dlvo_param.phi_p,
-                                  cs_lagr_dlvo_param.phi_p,
-                                  cs_lagr_dlvo_param.temperature[iel],
-                                  cs_lagr_dlvo_param.debye_length[iel],
-                                  cs_lagr_dlvo_param.water_permit);
+  cs_lagr_dlvo_sphere_sphere(_N_BARRIER_STEPS,
+                             distcc,
+                             rpart,
+                             rpart,
+                             cs_lagr_dlvo_param.lambda_vdw,
+                             cs_lagr_dlvo_param.csthpp,
+                             cs_lagr_dlvo_param.valen,
+                             cs_lagr_dlvo_param.phi_p,
+                             cs_lagr_dlvo_param.phi_p,
+                             cs_lagr_dlvo_param.temperature[iel],
+                             cs_lagr_dlvo_param.debye_length[iel],
+                             cs_lagr_dlvo_param.water_permit,
+                             udlvo);
 
-    cs_real_t barr = (var1 + var2);
-
-    if (barr >  *energy_barrier)
-      *energy_barrier = barr;
-    if (*energy_barrier < 0)
-      *energy_barrier = 0;
-   }
-
-  *energy_barrier = *energy_barrier / rpart;
+  *energy_barrier = _max_positive(_N_BARRIER_STEPS, udlvo) / rpart;
 }
 
 /*----------------------------------------------------------------------------
@@ -460,6 +489,160 @@ cs_lagr_edl_sphere_sphere(cs_real_t  distcc,
   return var;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute the DLVO (Van der Waals + EDL) interaction energy between a sphere
+ * and a plane for a series of separation distances.
+ *
+ * This is equivalent to calling cs_lagr_van_der_waals_sphere_plane and
+ * cs_lagr_edl_sphere_plane for each distance, but terms which do not
+ * depend on the distance are computed only once, and the loop
+ * on distances may be vectorized.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_dlvo_sphere_plane(cs_lnum_t        n,
+                          const cs_real_t  distp[],
+                          cs_real_t        rpart,
+                          cs_real_t        lambda_vdw,
+                          cs_real_t        cstham,
+                          cs_real_t        valen,
+                          cs_real_t        phi1,
+                          cs_real_t        phi2,
+                          cs_real_t        temp,
+                          cs_real_t        debye_length,
+                          cs_real_t        water_permit,
+                          cs_real_t        udlvo[])
+{
+  /* Van der Waals terms */
+
+  const cs_real_t d_switch = lambda_vdw / 2 / _pi;
+  const cs_real_t c_s0 = -cstham * rpart / 6;
+  const cs_real_t c_s1 = 14 / lambda_vdw;
+  const cs_real_t c_s3 = 5 * _pi/4.9 / lambda_vdw / (rpart*rpart);
+  const cs_real_t c_l1 = (2.45 * lambda_vdw) / (60. * _pi);
+  const cs_real_t c_l2 = 2.17 / 720. / (_pi*_pi) * (lambda_vdw*lambda_vdw);
+  const cs_real_t c_l3 = 0.59 / 5040. / (_pi*_pi*_pi)
+                         * (lambda_vdw*lambda_vdw*lambda_vdw);
+
+  /* EDL terms (reduced and extended reduced zeta potentials) */
+
+  const cs_real_t lphi1
+    = _extended_zeta_sphere(valen * _e_charge * phi1 / _k_boltzmann / temp,
+                            rpart / debye_length);
+  const cs_real_t lphi2
+    = 4. * tanh(valen * _e_charge * phi2 / _k_boltzmann / temp / 4.);
+
+  const cs_real_t kt_ze = _k_boltzmann * temp / (1. * valen) / _e_charge;
+  const cs_real_t c_edl = 2 * _pi * _free_space_permit * water_permit
+                          * kt_ze * kt_ze * rpart;
+  const cs_real_t lphi_sq = lphi1*lphi1 + lphi2*lphi2;
+  const cs_real_t lphi_12 = lphi1 * lphi2;
+  const cs_real_t inv_debye = 1. / debye_length;
+
+# pragma omp simd
+  for (cs_lnum_t i = 0; i < n; i++) {
+
+    const cs_real_t d = distp[i];
+
+    cs_real_t u_vdw;
+
+    if (d < d_switch)
+      u_vdw = c_s0 / d / (1 + c_s1*d + c_s3*d*d*d);
+    else {
+      const cs_real_t d2 = d + 2.*rpart;
+      const cs_real_t i_d = 1./d, i_d2 = 1./d2;
+      u_vdw = cstham
+        * (  c_l1 * ((d - rpart)*i_d*i_d - (d + 3.*rpart)*i_d2*i_d2)
+           - c_l2 * (  (d - 2.*rpart)*i_d*i_d*i_d
+                     - (d + 4.*rpart)*i_d2*i_d2*i_d2)
+           + c_l3 * (  (d - 3.*rpart)*i_d*i_d*i_d*i_d
+                     - (d + 5.*rpart)*i_d2*i_d2*i_d2*i_d2));
+    }
+
+    const cs_real_t s = sqrt(rpart / (d + rpart));
+    const cs_real_t alpha = 1./s + s;
+    const cs_real_t omega1 = lphi_sq + alpha * lphi_12;
+    const cs_real_t omega2 = lphi_sq - alpha * lphi_12;
+    const cs_real_t gamma = s * exp(-inv_debye * d);
+
+    const cs_real_t u_edl = c_edl * (d + rpart) / (d + 2 * rpart)
+                            * (omega1 * log(1 + gamma) + omega2 * log(1 - gamma));
+
+    udlvo[i] = u_vdw + u_edl;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the DLVO (Van der Waals + EDL) interaction energy between two
+ * spheres for a series of center-to-center distances.
+ *
+ * This is equivalent to calling cs_lagr_van_der_waals_sphere_sphere and
+ * cs_lagr_edl_sphere_sphere for each distance, but terms which do not
+ * depend on the distance are computed only once, and the loop
+ * on distances may be vectorized.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_dlvo_sphere_sphere(cs_lnum_t        n,
+                           const cs_real_t  distcc[],
+                           cs_real_t        rpart1,
+                           cs_real_t        rpart2,
+                           cs_real_t        lambda_vdw,
+                           cs_real_t        cstham,
+                           cs_real_t        valen,
+                           cs_real_t        phi1,
+                           cs_real_t        phi2,
+                           cs_real_t        temp,
+                           cs_real_t        debye_length,
+                           cs_real_t        water_permit,
+                           cs_real_t        udlvo[])
+{
+  /* Van der Waals terms */
+
+  const cs_real_t c_vdw = - cstham * rpart1 * rpart2 / (6 * (rpart1 + rpart2));
+  const cs_real_t c_ret = 5.32 / lambda_vdw;
+
+  /* EDL terms (extended reduced zeta potentials) */
+
+  const cs_real_t lphi1
+    = _extended_zeta_sphere(valen * _e_charge * phi1 / _k_boltzmann / temp,
+                            rpart1 / debye_length);
+  const cs_real_t lphi2
+    = _extended_zeta_sphere(valen * _e_charge * phi2 / _k_boltzmann / temp,
+                            rpart2 / debye_length);
+
+  const cs_real_t kt_e = _k_boltzmann * temp / _e_charge;
+  const cs_real_t c_edl = 2 * _pi * _free_space_permit * water_permit
+                          * kt_e * kt_e * rpart1 * rpart2;
+  const cs_real_t lphi_sq = lphi1*lphi1 + lphi2*lphi2;
+  const cs_real_t lphi_12 = lphi1 * lphi2;
+  const cs_real_t r_sum = rpart1 + rpart2;
+  const cs_real_t r_sq = rpart1*rpart1 + rpart2*rpart2;
+  const cs_real_t inv_debye = 1. / debye_length;
+
+# pragma omp simd
+  for (cs_lnum_t i = 0; i < n; i++) {
+
+    const cs_real_t d = distcc[i];
+    const cs_real_t h = d - r_sum;
+
+    const cs_real_t u_vdw = c_vdw / h * (1 - c_ret * h * log(1 + 1./(c_ret*h)));
+
+    const cs_real_t d1 = d - rpart1, d2 = d - rpart2;
+    const cs_real_t a = sqrt(rpart2 * d2 / (rpart1 * d1));
+    const cs_real_t alpha = a + 1./a;
+    const cs_real_t omega1 = lphi_sq + alpha * lphi_12;
+    const cs_real_t omega2 = lphi_sq - alpha * lphi_12;
+    const cs_real_t gamma = sqrt(rpart1 * rpart2 / d1 / d2)
+                            * exp(inv_debye * (r_sum - d));
+
+    const cs_real_t u_edl = c_edl * d1 * d2 / (d * (d * r_sum - r_sq))
+                            * (omega1 * log(1 + gamma) + omega2 * log(1 - gamma));
+
+    udlvo[i] = u_vdw + u_edl;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
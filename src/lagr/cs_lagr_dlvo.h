@@ -160,6 +160,55 @@ cs_lagr_edl_sphere_sphere(cs_real_t  distcc,
                           cs_real_t  debye_length,
                           cs_real_t  water_permit);
 
+/*----------------------------------------------------------------------------
+ * Compute the DLVO (Van der Waals + EDL) interaction energy between a sphere
+ * and a plane for a series of separation distances.
+ *
+ * This is equivalent to calling cs_lagr_van_der_waals_sphere_plane and
+ * cs_lagr_edl_sphere_plane for each distance, but terms which do not
+ * depend on the distance are computed only once, and the loop
+ * on distances may be vectorized.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_dlvo_sphere_plane(cs_lnum_t        n,
+                          const cs_real_t  distp[],
+                          cs_real_t        rpart,
+                          cs_real_t        lambda_vdw,
+                          cs_real_t        cstham,
+                          cs_real_t        valen,
+                          cs_real_t        phi1,
+                          cs_real_t        phi2,
+                          cs_real_t        temp,
+                          cs_real_t        debye_length,
+                          cs_real_t        water_permit,
+                          cs_real_t        udlvo[]);
+
+/*----------------------------------------------------------------------------
+ * Compute the DLVO (Van der Waals + EDL) interaction energy between two
+ * spheres for a series of center-to-center distances.
+ *
+ * This is equivalent to calling cs_lagr_van_der_waals_sphere_sphere and
+ * cs_lagr_edl_sphere_sphere for each distance, but terms which do not
+ * depend on the distance are computed only once, and the loop
+ * on distances may be vectorized.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_dlvo_sphere_sphere(cs_lnum_t        n,
+                           const cs_real_t  distcc[],
+                           cs_real_t        rpart1,
+                           cs_real_t        rpart2,
+                           cs_real_t        lambda_vdw,
+                           cs_real_t        cstham,
+                           cs_real_t        valen,
+                           cs_real_t        phi1,
+                           cs_real_t        phi2,
+                           cs_real_t        temp,
+                           cs_real_t        debye_length,
+                           cs_real_t        water_permit,
+                           cs_real_t        udlvo[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -47,6 +47,7 @@
 #include "cs_lagr_options.h"
 #include "cs_lagr_particle.h"
 #include "cs_lagr_poisson.h"
+#include "cs_lagr_population.h"
 #include "cs_lagr_post.h"
 #include "cs_lagr_precipitation_model.h"
 #include "cs_lagr_print.h"
@@ -59,6 +60,7 @@
 #include "cs_lagr_sde_model.h"
 #include "cs_lagr_stat.h"
 #include "cs_lagr_tracking.h"
+#include "cs_lagr_trajectory.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -225,6 +225,27 @@ const char *cs_lagr_attribute_name[] = {
   "user",
   "<none>"};
 
+/* Attributes accessed by most per-particle loops (tracking, SDE
+   integration, statistics, coupling); these are placed first in each
+   time value block of the (interleaved) particle record, so that they
+   share as few cache lines as possible.
+   As alignment padding is added each time the source array changes,
+   the cell id and flag (from different integer arrays) may each be
+   followed by 4 bytes of padding: the extents of a particle grow by at
+   most 8 bytes compared to an ordering by array only. */
+
+static const cs_lagr_attribute_t _hot_attrs[] = {CS_LAGR_COORDS,
+                                                 CS_LAGR_VELOCITY,
+                                                 CS_LAGR_VELOCITY_SEEN,
+                                                 CS_LAGR_MASS,
+                                                 CS_LAGR_DIAMETER,
+                                                 CS_LAGR_STAT_WEIGHT,
+                                                 CS_LAGR_RESIDENCE_TIME,
+                                                 CS_LAGR_CELL_ID,
+                                                 CS_LAGR_P_FLAG};
+
+static const int _n_hot_attrs = sizeof(_hot_attrs) / sizeof(_hot_attrs[0]);
+
 /* Global particle attributes map */
 
 static cs_lagr_attribute_map_t  *_p_attr_map = NULL;
@@ -234,6 +255,10 @@ static cs_lagr_attribute_map_t  *_p_attr_map = NULL;
 static  double              _reallocation_factor = 2.0;
 static  unsigned long long  _n_g_max_particles = ULLONG_MAX;
 
+/* Interval at which particles are sorted by cell after injection */
+
+static  int                 _cell_sort_interval = 0;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -337,6 +362,33 @@ _create_attr_map(cs_lnum_t attr_keys[CS_LAGR_N_ATTRIBUTES][3])
                             order,
                             CS_LAGR_N_ATTRIBUTES);
 
+  /* Move frequently accessed attributes to the front, keeping the
+     relative order of others (the layout is otherwise not significant,
+     as all accesses go through the map) */
+
+  {
+    cs_lnum_t *_order;
+    bool is_hot[CS_LAGR_N_ATTRIBUTES];
+
+    BFT_MALLOC(_order, CS_LAGR_N_ATTRIBUTES, cs_lnum_t);
+
+    for (int i = 0; i < CS_LAGR_N_ATTRIBUTES; i++)
+      is_hot[i] = false;
+
+    int j = 0;
+    for (int i = 0; i < _n_hot_attrs; i++) {
+      _order[j++] = _hot_attrs[i];
+      is_hot[_hot_attrs[i]] = true;
+    }
+    for (int i = 0; i < CS_LAGR_N_ATTRIBUTES; i++) {
+      if (is_hot[order[i]] == false)
+        _order[j++] = order[i];
+    }
+
+    BFT_FREE(order);
+    order = _order;
+  }
+
   /* Loop on available times */
 
   for (int time_id = 0; time_id < p_am->n_time_vals; time_id++) {
@@ -1179,12 +1231,36 @@ cs_lagr_particle_set_resize(cs_lnum_t  n_min_particles)
     if (_n_g_min_particles > _n_g_max_particles)
       retval = -1;
   }
-  else
+
+  if (retval == 0)
     retval = _particle_set_resize(cs_glob_lagr_particle_set, n_min_particles);
 
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Resize a particle set's buffers if needed, with no global check.
+ *
+ * Contrary to \ref cs_lagr_particle_set_resize, this function is local
+ * to each rank, so it may be called a different number of times on
+ * different ranks. It is intended for operations which do not change
+ * the global number of particles, such as particle migration.
+ *
+ * \param[in, out]  particle_set     pointer to particle set
+ * \param[in]       n_min_particles  minimum number of particles required
+ *
+ * \return  1 if resizing was required, 0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_lagr_particle_set_resize_local(cs_lagr_particle_set_t  *particle_set,
+                                  cs_lnum_t                n_min_particles)
+{
+  return _particle_set_resize(particle_set, n_min_particles);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set reallocation factor for particle sets.
@@ -1238,6 +1314,139 @@ cs_lagr_set_n_g_particles_max(unsigned long long  n_g_particles_max)
   _n_g_max_particles = n_g_particles_max;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get interval (in time steps) at which the particle set is sorted
+ *        by cell after injection.
+ *
+ * \return  sort interval, or 0 if this sort is not activated
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_lagr_get_cell_sort_interval(void)
+{
+  return _cell_sort_interval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set interval (in time steps) at which the particle set is sorted
+ *        by cell after injection.
+ *
+ * Particles are always sorted by cell after tracking, so this only
+ * affects the order of particles injected at the current time step,
+ * for the fluid interpolation and integration stages which precede
+ * tracking. By default, this sort is not activated (0).
+ *
+ * \param[in]  interval  sort interval, or 0 to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_set_cell_sort_interval(int  interval)
+{
+  _cell_sort_interval = CS_MAX(interval, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sort a range of particles of a set by cell id, and optionally
+ *        build the matching cell to particles index.
+ *
+ * The sort is stable (counting sort), and particle data is only moved
+ * if particles are not already sorted. Particles of cell i are then
+ * in the range cell_particle_idx[i] to cell_particle_idx[i+1] - 1
+ * (with cell_particle_idx[0] = s_id).
+ *
+ * \param[in, out]  particles          associated particle set
+ * \param[in]       s_id               id of first particle in range
+ * \param[in]       e_id               id of past-the-last particle in range
+ * \param[in]       n_cells            number of cells
+ * \param[out]      cell_particle_idx  cell to particles index
+ *                                     (size: n_cells + 1), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles,
+                                  cs_lnum_t                s_id,
+                                  cs_lnum_t                e_id,
+                                  cs_lnum_t                n_cells,
+                                  cs_lnum_t                cell_particle_idx[])
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+  const size_t p_extents = p_am->extents;
+  const ptrdiff_t cell_id_displ = p_am->displ[0][CS_LAGR_CELL_ID];
+  const cs_lnum_t n_particles = e_id - s_id;
+
+  unsigned char *p_buffer = particles->p_buffer + p_extents*s_id;
+
+  cs_lnum_t *cell_idx = cell_particle_idx;
+  if (cell_idx == NULL)
+    BFT_MALLOC(cell_idx, n_cells+1, cs_lnum_t);
+
+  /* Count particles per cell, and check if already sorted */
+
+  for (cs_lnum_t i = 0; i < n_cells+1; i++)
+    cell_idx[i] = 0;
+
+  bool sorted = true;
+  cs_lnum_t prev_cell_id = -1;
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_lnum_t cell_id
+      = *((const cs_lnum_t *)(p_buffer + p_extents*i + cell_id_displ));
+    assert(cell_id > -1 && cell_id < n_cells);
+    if (cell_id < prev_cell_id)
+      sorted = false;
+    prev_cell_id = cell_id;
+    cell_idx[cell_id+1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_idx[i+1] += cell_idx[i];
+
+  assert(n_particles == cell_idx[n_cells]);
+
+  /* Move particle data if needed */
+
+  if (sorted == false) {
+
+    unsigned char *swap_buffer;
+    BFT_MALLOC(swap_buffer, p_extents*n_particles, unsigned char);
+
+    memcpy(swap_buffer, p_buffer, p_extents*n_particles);
+
+    for (cs_lnum_t i = 0; i < n_particles; i++) {
+      cs_lnum_t cell_id
+        = *((const cs_lnum_t *)(swap_buffer + p_extents*i + cell_id_displ));
+      cs_lnum_t particle_id = cell_idx[cell_id];
+      cell_idx[cell_id] += 1;
+      memcpy(p_buffer + p_extents*particle_id,
+             swap_buffer + p_extents*i,
+             p_extents);
+    }
+
+    BFT_FREE(swap_buffer);
+
+    /* Shift index back (the loop above moved each start to the next) */
+
+    for (cs_lnum_t i = n_cells; i > 0; i--)
+      cell_idx[i] = cell_idx[i-1];
+    cell_idx[0] = 0;
+
+  }
+
+  if (cell_idx != cell_particle_idx)
+    BFT_FREE(cell_idx);
+
+  else if (s_id > 0) {
+    for (cs_lnum_t i = 0; i < n_cells+1; i++)
+      cell_idx[i] += s_id;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Copy current attributes to previous attributes.
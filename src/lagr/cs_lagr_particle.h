@@ -1384,6 +1384,26 @@ cs_lagr_particle_source_term_const(void                           *particle,
 int
 cs_lagr_particle_set_resize(cs_lnum_t  n_min_particles);
 
+/*----------------------------------------------------------------------------
+ * Resize a particle set's buffers if needed, with no global check.
+ *
+ * Contrary to cs_lagr_particle_set_resize, this function is local to
+ * each rank, so it may be called a different number of times on different
+ * ranks (for operations such as particle migration, which do not change
+ * the global number of particles).
+ *
+ * parameters:
+ *   particle_set    <-> pointer to particle set
+ *   n_min_particles <-- minimum number of particles required
+ *
+ * returns:
+ *   1 if resizing was required, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+cs_lagr_particle_set_resize_local(cs_lagr_particle_set_t  *particle_set,
+                                  cs_lnum_t                n_min_particles);
+
 /*----------------------------------------------------------------------------
  * Set reallocation factor for particle sets.
  *
@@ -1426,6 +1446,61 @@ cs_lagr_get_n_g_particles_max(void);
 void
 cs_lagr_set_n_g_particles_max(unsigned long long  n_g_particles_max);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get interval (in time steps) at which the particle set is sorted
+ *        by cell after injection.
+ *
+ * \return  sort interval, or 0 if this sort is not activated
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_lagr_get_cell_sort_interval(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set interval (in time steps) at which the particle set is sorted
+ *        by cell after injection.
+ *
+ * Particles are always sorted by cell after tracking, so this only
+ * affects the order of particles injected at the current time step,
+ * for the fluid interpolation and integration stages which precede
+ * tracking. By default, this sort is not activated (0).
+ *
+ * \param[in]  interval  sort interval, or 0 to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_set_cell_sort_interval(int  interval);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sort a range of particles of a set by cell id, and optionally
+ *        build the matching cell to particles index.
+ *
+ * The sort is stable (counting sort), and particle data is only moved
+ * if particles are not already sorted. Particles of cell i are then
+ * in the range cell_particle_idx[i] to cell_particle_idx[i+1] - 1
+ * (with cell_particle_idx[0] = s_id).
+ *
+ * \param[in, out]  particles          associated particle set
+ * \param[in]       s_id               id of first particle in range
+ * \param[in]       e_id               id of past-the-last particle in range
+ * \param[in]       n_cells            number of cells
+ * \param[out]      cell_particle_idx  cell to particles index
+ *                                     (size: n_cells + 1), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles,
+                                  cs_lnum_t                s_id,
+                                  cs_lnum_t                e_id,
+                                  cs_lnum_t                n_cells,
+                                  cs_lnum_t                cell_particle_idx[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Copy current attributes to previous attributes.
@@ -0,0 +1,514 @@
+/*============================================================================
+ * Parcel population control (merging and splitting of parcels).
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_time_step.h"
+
+#include "cs_lagr.h"
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_population.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+/* Parcel status markers for the current pass */
+
+#define _KEEP   0
+#define _MERGED 1
+#define _SPLIT  2
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Sort key for parcels of a given cell */
+
+typedef struct {
+
+  cs_real_t  key;
+  cs_lnum_t  id;
+
+} _parcel_key_t;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compare sort keys of two parcels (for qsort).
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_keys(const void  *a,
+              const void  *b)
+{
+  const _parcel_key_t *k0 = a;
+  const _parcel_key_t *k1 = b;
+
+  if (k0->key < k1->key)
+    return -1;
+  else if (k0->key > k1->key)
+    return 1;
+  else
+    return (k0->id < k1->id) ? -1 : 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a particle is a parcel in flow which may be merged or split.
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_is_controlled(const cs_lagr_particle_set_t  *p_set,
+               cs_lnum_t                      p_id)
+{
+  if (cs_lagr_particles_get_flag(p_set, p_id, CS_LAGR_PART_DEPOSITION_FLAGS))
+    return false;
+
+  if (   cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_STAT_WEIGHT) <= 0.
+      || cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_MASS) <= 0.)
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if two parcels are similar enough to be merged.
+ *
+ * parameters:
+ *   p_set  <-- particle set
+ *   p0     <-- id of first parcel
+ *   p1     <-- id of second parcel
+ *   tol    <-- relative tolerance on diameter and velocity
+ *----------------------------------------------------------------------------*/
+
+static bool
+_mergeable(const cs_lagr_particle_set_t  *p_set,
+           cs_lnum_t                      p0,
+           cs_lnum_t                      p1,
+           cs_real_t                      tol)
+{
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+
+  if (p_am->count[0][CS_LAGR_STAT_CLASS] > 0) {
+    if (   cs_lagr_particles_get_lnum(p_set, p0, CS_LAGR_STAT_CLASS)
+        != cs_lagr_particles_get_lnum(p_set, p1, CS_LAGR_STAT_CLASS))
+      return false;
+  }
+
+  if (p_am->count[0][CS_LAGR_AGGLO_CLASS_ID] > 0) {
+    if (   cs_lagr_particles_get_lnum(p_set, p0, CS_LAGR_AGGLO_CLASS_ID)
+        != cs_lagr_particles_get_lnum(p_set, p1, CS_LAGR_AGGLO_CLASS_ID))
+      return false;
+  }
+
+  cs_real_t d0 = cs_lagr_particles_get_real(p_set, p0, CS_LAGR_DIAMETER);
+  cs_real_t d1 = cs_lagr_particles_get_real(p_set, p1, CS_LAGR_DIAMETER);
+
+  if (CS_ABS(d0 - d1) > tol*CS_MAX(d0, d1))
+    return false;
+
+  const cs_real_t *v0
+    = cs_lagr_particles_attr_const(p_set, p0, CS_LAGR_VELOCITY);
+  const cs_real_t *v1
+    = cs_lagr_particles_attr_const(p_set, p1, CS_LAGR_VELOCITY);
+
+  cs_real_t dv2 = 0, v02 = 0, v12 = 0;
+  for (int i = 0; i < 3; i++) {
+    dv2 += cs_math_sq(v0[i] - v1[i]);
+    v02 += cs_math_sq(v0[i]);
+    v12 += cs_math_sq(v1[i]);
+  }
+
+  if (dv2 > cs_math_sq(tol)*CS_MAX(v02, v12))
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Merge a parcel into another one.
+ *
+ * The statistical weight, mass, volume and momentum of the pair are
+ * conserved, as well as its thermal energy when the particle temperature
+ * is tracked. Other real-valued variables (velocity seen by the particles,
+ * residence time, user variables) are averaged using the appropriate
+ * (mass or statistical) weights.
+ *
+ * parameters:
+ *   p_set  <-> particle set
+ *   p0     <-- id of parcel kept
+ *   p1     <-- id of parcel merged into p0
+ *----------------------------------------------------------------------------*/
+
+static void
+_merge_parcels(cs_lagr_particle_set_t  *p_set,
+               cs_lnum_t                p0,
+               cs_lnum_t                p1)
+{
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+
+  cs_real_t w0 = cs_lagr_particles_get_real(p_set, p0, CS_LAGR_STAT_WEIGHT);
+  cs_real_t w1 = cs_lagr_particles_get_real(p_set, p1, CS_LAGR_STAT_WEIGHT);
+  cs_real_t m0 = cs_lagr_particles_get_real(p_set, p0, CS_LAGR_MASS);
+  cs_real_t m1 = cs_lagr_particles_get_real(p_set, p1, CS_LAGR_MASS);
+  cs_real_t d0 = cs_lagr_particles_get_real(p_set, p0, CS_LAGR_DIAMETER);
+  cs_real_t d1 = cs_lagr_particles_get_real(p_set, p1, CS_LAGR_DIAMETER);
+
+  const cs_real_t w = w0 + w1;
+  const cs_real_t wm0 = w0*m0, wm1 = w1*m1;
+  const cs_real_t wm = wm0 + wm1;
+
+  /* Thermal energy (uses the mass before update) */
+
+  if (   p_am->count[0][CS_LAGR_TEMPERATURE] > 0
+      && p_am->count[0][CS_LAGR_CP] > 0) {
+
+    cs_real_t cp0 = cs_lagr_particles_get_real(p_set, p0, CS_LAGR_CP);
+    cs_real_t cp1 = cs_lagr_particles_get_real(p_set, p1, CS_LAGR_CP);
+    cs_real_t cp = (wm0*cp0 + wm1*cp1) / wm;
+
+    cs_real_t *t0 = cs_lagr_particles_attr(p_set, p0, CS_LAGR_TEMPERATURE);
+    cs_real_t *t1 = cs_lagr_particles_attr(p_set, p1, CS_LAGR_TEMPERATURE);
+
+    for (int i = 0; i < p_am->count[0][CS_LAGR_TEMPERATURE]; i++)
+      t0[i] = (wm0*cp0*t0[i] + wm1*cp1*t1[i]) / (wm*cp);
+
+    cs_lagr_particles_set_real(p_set, p0, CS_LAGR_CP, cp);
+
+  }
+
+  /* Momentum and velocity seen */
+
+  cs_real_t *v0 = cs_lagr_particles_attr(p_set, p0, CS_LAGR_VELOCITY);
+  cs_real_t *v1 = cs_lagr_particles_attr(p_set, p1, CS_LAGR_VELOCITY);
+  cs_real_t *vs0 = cs_lagr_particles_attr(p_set, p0, CS_LAGR_VELOCITY_SEEN);
+  cs_real_t *vs1 = cs_lagr_particles_attr(p_set, p1, CS_LAGR_VELOCITY_SEEN);
+
+  for (int i = 0; i < 3; i++) {
+    v0[i] = (wm0*v0[i] + wm1*v1[i]) / wm;
+    vs0[i] = (wm0*vs0[i] + wm1*vs1[i]) / wm;
+  }
+
+  /* Mass and volume */
+
+  cs_real_t d3 = (w0*d0*d0*d0 + w1*d1*d1*d1) / w;
+
+  cs_lagr_particles_set_real(p_set, p0, CS_LAGR_MASS, wm / w);
+  cs_lagr_particles_set_real(p_set, p0, CS_LAGR_DIAMETER, cbrt(d3));
+
+  /* Other variables */
+
+  cs_real_t r0 = cs_lagr_particles_get_real(p_set, p0, CS_LAGR_RESIDENCE_TIME);
+  cs_real_t r1 = cs_lagr_particles_get_real(p_set, p1, CS_LAGR_RESIDENCE_TIME);
+
+  cs_lagr_particles_set_real(p_set, p0, CS_LAGR_RESIDENCE_TIME,
+                             (w0*r0 + w1*r1) / w);
+
+  if (p_am->count[0][CS_LAGR_USER] > 0) {
+    cs_real_t *u0 = cs_lagr_particles_attr(p_set, p0, CS_LAGR_USER);
+    cs_real_t *u1 = cs_lagr_particles_attr(p_set, p1, CS_LAGR_USER);
+    for (int i = 0; i < p_am->count[0][CS_LAGR_USER]; i++)
+      u0[i] = (w0*u0[i] + w1*u1[i]) / w;
+  }
+
+  cs_lagr_particles_set_real(p_set, p0, CS_LAGR_STAT_WEIGHT, w);
+  cs_lagr_particles_set_real(p_set, p1, CS_LAGR_STAT_WEIGHT, 0.);
+}
+
+/*----------------------------------------------------------------------------
+ * Merge or mark for splitting parcels of a given cell.
+ *
+ * parameters:
+ *   p_set        <-> particle set
+ *   pm           <-- population control parameters
+ *   allow_merge  <-- are parcels of this set mergeable ?
+ *   s_id         <-- id of first particle of this cell
+ *   e_id         <-- id of past-the-last particle of this cell
+ *   keys         --- work array (size: e_id - s_id)
+ *   status       <-> parcel status markers
+ *
+ * returns:
+ *   number of parcels marked for splitting
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_control_cell(cs_lagr_particle_set_t            *p_set,
+              const cs_lagr_population_model_t  *pm,
+              bool                               allow_merge,
+              cs_lnum_t                          s_id,
+              cs_lnum_t                          e_id,
+              _parcel_key_t                      keys[],
+              char                               status[])
+{
+  cs_lnum_t n_split = 0;
+  cs_lnum_t n_parcels = 0;
+
+  for (cs_lnum_t p_id = s_id; p_id < e_id; p_id++) {
+    if (_is_controlled(p_set, p_id)) {
+      keys[n_parcels].id = p_id;
+      n_parcels++;
+    }
+  }
+
+  /* Merge pairs of parcels with neighboring diameters */
+
+  if (allow_merge && n_parcels > pm->n_max_per_cell) {
+
+    for (cs_lnum_t i = 0; i < n_parcels; i++)
+      keys[i].key = cs_lagr_particles_get_real(p_set, keys[i].id,
+                                               CS_LAGR_DIAMETER);
+
+    qsort(keys, n_parcels, sizeof(_parcel_key_t), _compare_keys);
+
+    cs_lnum_t n_excess = n_parcels - pm->n_max_per_cell;
+
+    for (cs_lnum_t i = 0; i < n_parcels - 1 && n_excess > 0; i++) {
+      cs_lnum_t p0 = keys[i].id, p1 = keys[i+1].id;
+      if (_mergeable(p_set, p0, p1, pm->merge_tolerance)) {
+        _merge_parcels(p_set, p0, p1);
+        status[p1] = _MERGED;
+        n_excess -= 1;
+        i++;
+      }
+    }
+
+  }
+
+  /* Split heaviest parcels */
+
+  else if (n_parcels < pm->n_min_per_cell) {
+
+    for (cs_lnum_t i = 0; i < n_parcels; i++)
+      keys[i].key = - cs_lagr_particles_get_real(p_set, keys[i].id,
+                                                 CS_LAGR_STAT_WEIGHT);
+
+    qsort(keys, n_parcels, sizeof(_parcel_key_t), _compare_keys);
+
+    cs_lnum_t n_missing = pm->n_min_per_cell - n_parcels;
+
+    for (cs_lnum_t i = 0; i < n_parcels && n_split < n_missing; i++) {
+      if (- keys[i].key < 2.*pm->min_stat_weight)
+        break;
+      status[keys[i].id] = _SPLIT;
+      n_split++;
+    }
+
+  }
+
+  return n_split;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Control the number of parcels per cell.
+ *
+ * Depending on the settings of \ref cs_glob_lagr_population_model,
+ * parcels in flow are merged by pairs in cells containing too many
+ * parcels, and split in two in cells containing too few parcels.
+ *
+ * Merging is restricted to parcels of the same statistical and
+ * agglomeration class with similar diameters and velocities; the resulting
+ * parcel conserves the statistical weight, mass, volume, momentum and
+ * thermal energy of the merged pair. Splitting halves the statistical
+ * weight of a parcel and appends a copy to the particle set, so it is
+ * exactly conservative.
+ *
+ * The particle set is sorted by cell as a side effect, except for the
+ * parcels resulting from splits, which are appended at its end.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_population_control(void)
+{
+  const cs_lagr_population_model_t  *pm = cs_glob_lagr_population_model;
+  const cs_lagr_model_t  *lagr_model = cs_glob_lagr_model;
+
+  if (   pm->interval < 1
+      || cs_glob_time_step->nt_cur % pm->interval != 0)
+    return;
+
+  /* Merging is not handled for parcels with composition (coal)
+     or orientation (non-spherical) variables */
+
+  bool allow_merge = (   pm->n_max_per_cell > 0
+                      && lagr_model->physical_model != CS_LAGR_PHYS_COAL
+                      && lagr_model->shape == 0);
+
+  if (allow_merge == false && pm->n_min_per_cell < 1)
+    return;
+
+  cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
+  const cs_lnum_t  n_cells = cs_glob_mesh->n_cells;
+
+  /* Build cell -> parcels index */
+
+  cs_lnum_t  *cell_particle_idx;
+  BFT_MALLOC(cell_particle_idx, n_cells + 1, cs_lnum_t);
+
+  cs_lagr_particle_set_sort_by_cell(p_set,
+                                    0,
+                                    p_set->n_particles,
+                                    n_cells,
+                                    cell_particle_idx);
+
+  cs_lnum_t  n_max_cell_parcels = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    n_max_cell_parcels = CS_MAX(n_max_cell_parcels,
+                                  cell_particle_idx[c_id+1]
+                                - cell_particle_idx[c_id]);
+
+  char  *status;
+  BFT_MALLOC(status, p_set->n_particles, char);
+  memset(status, _KEEP, p_set->n_particles);
+
+  /* Merge or mark parcels cell by cell */
+
+  cs_lnum_t  n_split = 0;
+
+# pragma omp parallel if (p_set->n_particles > CS_THR_MIN) \
+                      reduction(+:n_split)
+  {
+    _parcel_key_t  *keys;
+    BFT_MALLOC(keys, n_max_cell_parcels, _parcel_key_t);
+
+#   pragma omp for schedule(dynamic, CS_CL_SIZE)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      if (cell_particle_idx[c_id+1] > cell_particle_idx[c_id])
+        n_split += _control_cell(p_set,
+                                 pm,
+                                 allow_merge,
+                                 cell_particle_idx[c_id],
+                                 cell_particle_idx[c_id+1],
+                                 keys,
+                                 status);
+    }
+
+    BFT_FREE(keys);
+  }
+
+  BFT_FREE(cell_particle_idx);
+
+  /* Remove merged parcels (keeping the set sorted) */
+
+  const size_t  p_extents = p_set->p_am->extents;
+  unsigned char  *p_buffer = p_set->p_buffer;
+
+  cs_lnum_t  n_kept = 0;
+
+  for (cs_lnum_t p_id = 0; p_id < p_set->n_particles; p_id++) {
+    if (status[p_id] != _MERGED) {
+      if (n_kept < p_id) {
+        memcpy(p_buffer + p_extents*n_kept,
+               p_buffer + p_extents*p_id,
+               p_extents);
+        status[n_kept] = status[p_id];
+      }
+      n_kept++;
+    }
+  }
+
+  p_set->n_particles = n_kept;
+
+  /* Split marked parcels, appending copies to the particle set;
+     resizing may be collective, so it is called on all ranks */
+
+  if (pm->n_min_per_cell > 0) {
+
+    if (   cs_lagr_particle_set_resize(n_kept + n_split) < 0
+        || p_set->n_particles_max < n_kept + n_split)
+      n_split = 0;
+
+    p_buffer = p_set->p_buffer;
+
+    cs_lnum_t  n_new = 0;
+
+    for (cs_lnum_t p_id = 0; p_id < n_kept && n_new < n_split; p_id++) {
+      if (status[p_id] == _SPLIT) {
+        cs_lnum_t  c_id = n_kept + n_new;
+        cs_real_t  w = 0.5 * cs_lagr_particles_get_real(p_set, p_id,
+                                                        CS_LAGR_STAT_WEIGHT);
+        cs_lagr_particles_set_real(p_set, p_id, CS_LAGR_STAT_WEIGHT, w);
+        memcpy(p_buffer + p_extents*c_id,
+               p_buffer + p_extents*p_id,
+               p_extents);
+        n_new++;
+      }
+    }
+
+    p_set->n_particles += n_new;
+
+  }
+
+  BFT_FREE(status);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
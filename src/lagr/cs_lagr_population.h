@@ -0,0 +1,71 @@
+#ifndef __CS_LAGR_POPULATION_H__
+#define __CS_LAGR_POPULATION_H__
+
+/*============================================================================
+ * Parcel population control (merging and splitting of parcels).
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Control the number of parcels per cell.
+ *
+ * Depending on the settings of \ref cs_glob_lagr_population_model,
+ * parcels in flow are merged by pairs in cells containing too many
+ * parcels, and split in two in cells containing too few parcels.
+ *
+ * Merging is restricted to parcels of the same statistical and
+ * agglomeration class with similar diameters and velocities; the resulting
+ * parcel conserves the statistical weight, mass, volume, momentum and
+ * thermal energy of the merged pair. Splitting halves the statistical
+ * weight of a parcel and appends a copy to the particle set, so it is
+ * exactly conservative.
+ *
+ * The particle set is sorted by cell as a side effect, except for the
+ * parcels resulting from splits, which are appended at its end.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_population_control(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LAGR_POPULATION_H__ */
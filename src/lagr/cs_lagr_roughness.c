@@ -372,63 +372,60 @@ cs_lagr_roughness_barrier(const void                     *particle,
 
    /* Calculation of the energy barrier */
 
-   /* Loop on the separation distance */
-  for (np = 0; np <  500; np++) {
-    udlvor[np] = 0.;
-    cs_real_t distp =   dismin + (np + 1)
-                      * cs_lagr_roughness_param->debye_length[iel]/30.0;
-
-    /* DLVO between the particle and the rough plate */
-
-    /* Sum of the interaction {particle-plate} and {particule-asperity} */
-
-    /* Sphere-plate interaction */
-    cs_real_t var1
-      = cs_lagr_van_der_waals_sphere_plane(distp,
-                                           rpart,
-                                           cs_lagr_roughness_param->cstham,
-                                           cs_lagr_roughness_param->lambda_vdw);
-
-    cs_real_t var2
-      = cs_lagr_edl_sphere_plane(distp,
-                                 rpart,
-                                 cs_lagr_roughness_param->valen,
-                                 cs_lagr_roughness_param->phi_p,
-                                 cs_lagr_roughness_param->phi_s,
-                                 cs_lagr_roughness_param->temperature[iel],
-                                 cs_lagr_roughness_param->debye_length[iel],
-                                 cs_lagr_roughness_param->water_permit);
-
-    udlvor[np] = (var1 + var2) * (1. - scovtot);
-
-    /* Sphere-asperity interactions */
-
-    for (iasp = 0; iasp <  nasptot; iasp++) {
-      cs_real_t distcc = sqrt(  pow(distp + rpart- posasp3[iasp], 2)
-                              + pow(posasp1[iasp],2));
-
-      var1
-        = cs_lagr_van_der_waals_sphere_sphere(distcc,
-                                              rpart,
-                                              posasp4[iasp],
-                                              cs_lagr_roughness_param->cstham,
-                                              cs_lagr_roughness_param->lambda_vdw);
-
-      var2 = cs_lagr_edl_sphere_sphere(distcc,
-                                       rpart,
-                                       posasp4[iasp],
-                                       cs_lagr_roughness_param->valen,
-                                       cs_lagr_roughness_param->phi_p,
-                                       cs_lagr_roughness_param->phi_s,
-                                       cs_lagr_roughness_param->temperature[iel],
-                                       cs_lagr_roughness_param->debye_length[iel],
-                                       cs_lagr_roughness_param->water_permit);
-
-      udlvor[np] =   udlvor[np] + (var1 + var2)
-                   * (distp + rpart - posasp3[iasp]) / distcc;
-    }
+  cs_real_t distp[500], distcc[500], uasp[500];
+
+  for (np = 0; np <  500; np++)
+    distp[np] =   dismin + (np + 1)
+                * cs_lagr_roughness_param->debye_length[iel]/30.0;
+
+  /* DLVO between the particle and the rough plate */
+
+  /* Sum of the interaction {particle-plate} and {particule-asperity} */
+
+  /* Sphere-plate interaction */
+
+  cs_lagr_dlvo_sphere_plane(500,
+                            distp,
+                            rpart,
+                            cs_lagr_roughness_param->cstham,
+                            cs_lagr_roughness_param->lambda_vdw,
+                            cs_lagr_roughness_param->valen,
+                            cs_lagr_roughness_param->phi_p,
+                            cs_lagr_roughness_param->phi_s,
+                            cs_lagr_roughness_param->temperature[iel],
+                            cs_lagr_roughness_param->debye_length[iel],
+                            cs_lagr_roughness_param->water_permit,
+                            udlvor);
+
+  for (np = 0; np <  500; np++)
+    udlvor[np] *= (1. - scovtot);
+
+  /* Sphere-asperity interactions */
+
+  for (iasp = 0; iasp <  nasptot; iasp++) {
+
+    for (np = 0; np <  500; np++)
+      distcc[np] = sqrt(  pow(distp[np] + rpart- posasp3[iasp], 2)
+                        + pow(posasp1[iasp],2));
+
+    cs_lagr_dlvo_sphere_sphere(500,
+                               distcc,
+                               rpart,
+                               posasp4[iasp],
+                               cs_lagr_roughness_param->cstham,
+                               cs_lagr_roughness_param->lambda_vdw,
+                               cs_lagr_roughness_param->valen,
+                               cs_lagr_roughness_param->phi_p,
+                               cs_lagr_roughness_param->phi_s,
+                               cs_lagr_roughness_param->temperature[iel],
+                               cs_lagr_roughness_param->debye_length[iel],
+                               cs_lagr_roughness_param->water_permit,
+                               uasp);
+
+    for (np = 0; np <  500; np++)
+      udlvor[np] += uasp[np] * (distp[np] + rpart - posasp3[iasp]) / distcc[np];
 
-  } /* End of the loop on the separation distance */
+  }
 
   /* Tracking of the energy barrier */
   cs_real_t barren = 0.;
@@ -52,6 +52,7 @@
 #include "cs_prototypes.h"
 #include "cs_random.h"
 #include "cs_thermal_model.h"
+#include "cs_time_step.h"
 
 #include "cs_lagr.h"
 #include "cs_lagr_adh.h"
@@ -2647,7 +2648,12 @@ cs_lagr_sde(cs_real_t           dt_p,
   cs_real_33_t *vagaus;
   BFT_MALLOC(vagaus, p_set->n_particles, cs_real_33_t);
 
-  /* Random values */
+  /* Random values, using one counter-based stream per particle, so that
+     they may be drawn in parallel; streams are keyed by rank and local
+     particle id, and by time step number */
+
+  const uint64_t p_id_shift = (uint64_t)(CS_MAX(cs_glob_rank_id, 0)) << 32;
+  const uint64_t nt_sub_id = (uint64_t)(cs_glob_time_step->nt_cur) << 2;
 
   if (cs_glob_lagr_model->idistu == 1) {
     if (cs_glob_lagr_time_step->nor > 1) {
@@ -2661,10 +2667,10 @@ cs_lagr_sde(cs_real_t           dt_p,
         }
       }
     }
-    else {
-      for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
-        cs_random_normal(9, &(vagaus[ip][0][0]));
-    }
+    else
+      cs_random_stream_normal_set(p_set->n_particles, NULL,
+                                  p_id_shift, nt_sub_id,
+                                  9, (cs_real_t *)vagaus);
   }
 
   else {
@@ -2690,10 +2696,10 @@ cs_lagr_sde(cs_real_t           dt_p,
           brgaus[ip*6 + id] = _br_gauss[id];
       }
     }
-    else {
-      for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
-        cs_random_normal(6, &(brgaus[6 * ip]));
-    }
+    else
+      cs_random_stream_normal_set(p_set->n_particles, NULL,
+                                  p_id_shift, nt_sub_id + 1,
+                                  6, brgaus);
   }
 
   /* Computation of particle density */
@@ -2816,252 +2816,454 @@ _location_attr(int location_id)
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Update all particle-based moment and time moment accumulators.
+ * \brief Build a cell -> particles index for particles located in cells.
+ *
+ * Particle ids are binned by cell in increasing order, so that for a given
+ * cell, particles are visited in the same order as in the particle set.
+ *
+ * \param[in]   p_set            particle set
+ * \param[in]   n_cells          number of cells
+ * \param[out]  cell_p_idx       cell -> particles index (size: n_cells + 1)
+ * \param[out]  cell_p_ids       cell -> particles ids (allocated here)
+ * \param[out]  n_cell_p_max     maximum number of particles in a cell
  */
 /*----------------------------------------------------------------------------*/
 
 static void
-_cs_lagr_stat_update_all(void)
+_bin_particles_by_cell(const cs_lagr_particle_set_t  *p_set,
+                       cs_lnum_t                      n_cells,
+                       cs_lnum_t                      cell_p_idx[],
+                       cs_lnum_t                    **cell_p_ids,
+                       cs_lnum_t                     *n_cell_p_max)
 {
-  const cs_time_step_t  *ts = cs_glob_time_step;
-  cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
-  const cs_real_t *dt_val = _dt_val();
-  cs_lnum_t dt_mult = (cs_glob_time_step->is_local) ? 1 : 0;
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    cell_p_idx[i] = 0;
+
+  for (cs_lnum_t p_id = 0; p_id < p_set->n_particles; p_id++) {
+    cs_lnum_t cell_id
+      = cs_lagr_particle_get_lnum(p_set->p_buffer + p_am->extents*p_id,
+                                  p_am,
+                                  CS_LAGR_CELL_ID);
+    if (cell_id >= 0)
+      cell_p_idx[cell_id + 1] += 1;
+  }
 
-  /* First, update mesh-based statistics */
+  cs_lnum_t n_max = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    n_max = CS_MAX(n_max, cell_p_idx[i+1]);
+    cell_p_idx[i+1] += cell_p_idx[i];
+  }
 
-  _cs_lagr_stat_update_mesh_stats(ts);
+  cs_lnum_t *p_ids;
+  BFT_MALLOC(p_ids, cell_p_idx[n_cells], cs_lnum_t);
+
+  for (cs_lnum_t p_id = 0; p_id < p_set->n_particles; p_id++) {
+    cs_lnum_t cell_id
+      = cs_lagr_particle_get_lnum(p_set->p_buffer + p_am->extents*p_id,
+                                  p_am,
+                                  CS_LAGR_CELL_ID);
+    if (cell_id >= 0) {
+      p_ids[cell_p_idx[cell_id]] = p_id;
+      cell_p_idx[cell_id] += 1;
+    }
+  }
 
-  /* Outer loop in weight accumulators, to avoid recomputing weights
-     too many times */
+  for (cs_lnum_t i = n_cells; i > 0; i--)
+    cell_p_idx[i] = cell_p_idx[i-1];
+  cell_p_idx[0] = 0;
 
-  for (int wa_id = 0; wa_id < _n_lagr_moments_wa; wa_id++) {
+  *cell_p_ids = p_ids;
+  *n_cell_p_max = n_max;
+}
 
-    cs_lagr_moment_wa_t *mwa = _lagr_moments_wa + wa_id;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update a particle-based moment with the particles of a given cell.
+ *
+ * \param[in, out]  mt        moment
+ * \param[in]       p_set     particle set
+ * \param[in]       cell_id   cell id
+ * \param[in]       n_c_p     number of particles in cell
+ * \param[in]       c_p_ids   ids of particles in cell
+ * \param[in]       c_p_w     weight of particles in cell
+ * \param[in]       c_p_class class of particles in cell
+ * \param[in]       w_sum_0   accumulated weight in cell before update
+ * \param[in, out]  pval_buf  buffer for particle data values
+ *
+ * \return  accumulated weight in cell after update
+ */
+/*----------------------------------------------------------------------------*/
 
-    /* Check if accumulator and associated moments are active here */
+static cs_real_t
+_update_particle_moment_cell(cs_lagr_moment_t              *mt,
+                             const cs_lagr_particle_set_t  *p_set,
+                             cs_lnum_t                      cell_id,
+                             cs_lnum_t                      n_c_p,
+                             const cs_lnum_t                c_p_ids[],
+                             const cs_real_t                c_p_w[],
+                             const int                      c_p_class[],
+                             cs_real_t                      w_sum_0,
+                             cs_real_t                      pval_buf[])
+{
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+  const int attr_id = cs_lagr_stat_type_to_attr_id(mt->stat_type);
 
-    if (   mwa->group != CS_LAGR_STAT_GROUP_PARTICLE
-        || mwa->nt_start > ts->nt_cur)
+  cs_real_t *restrict val = cs_field_by_id(mt->f_id)->val;
+  cs_real_t *restrict mean_val = NULL;
+
+  if (mt->m_type == CS_LAGR_MOMENT_VARIANCE)
+    mean_val = cs_field_by_id(_lagr_moments[mt->l_id].f_id)->val;
+
+  cs_real_t l_wa_sum = w_sum_0;
+
+  for (cs_lnum_t k = 0; k < n_c_p; k++) {
+
+    if (c_p_class[k] != mt->class && mt->class != 0)
       continue;
 
-    /* Here, only active accumulators are considered */
+    const unsigned char *particle
+      = p_set->p_buffer + p_am->extents * c_p_ids[k];
 
-    _ensure_init_wa(mwa);
-    cs_real_t *g_wa_sum = _mwa_val(mwa);
+    /* weight associated to current particle */
 
-    const cs_lnum_t n_w_elts = cs_mesh_location_get_n_elts(mwa->location_id)[0];
+    const cs_real_t p_weight = c_p_w[k];
 
-    /* Local weight array allocation */
+    const cs_real_t *pval;
+    if (mt->p_data_func == NULL)
+      pval = cs_lagr_particle_attr_const(particle, p_am, attr_id);
+    else {
+      mt->p_data_func(mt->data_input, particle, p_am, pval_buf);
+      pval = pval_buf;
+    }
 
-    cs_real_t *restrict l_wa_sum = NULL;
+    /* update weight sum with new particle weight */
+    const cs_real_t wa_sum_n = CS_MAX(p_weight + l_wa_sum, 1e-100);
 
-    /* Compute mesh-based weight now if applicable
-       (possibly sharing it across moments) */
+    if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
 
-    cs_real_t m_w0[1];
-    cs_real_t *restrict m_weight = _compute_current_weight_m(mwa, dt_val, m_w0);
+      if (mt->dim == 6) { /* variance-covariance matrix */
 
-    /* Loop on variances first, then means */
+        assert(mt->data_dim == 3);
 
-    for (int m_type = CS_LAGR_MOMENT_VARIANCE;
-         m_type >= (int)CS_LAGR_MOMENT_MEAN;
-         m_type--) {
+        double delta[3], delta_n[3], r[3], m_n[3];
 
-      for (int i = 0; i < _n_lagr_moments; i++) {
+        for (int l = 0; l < 3; l++) {
 
-        cs_lagr_moment_t *mt = _lagr_moments + i;
+          cs_lnum_t jl = cell_id*6 + l;
+          cs_lnum_t jml = cell_id*3 + l;
+          delta[l]   = pval[l] - mean_val[jml];
+          r[l] = delta[l] * (p_weight / wa_sum_n);
+          m_n[l] = mean_val[jml] + r[l];
+          delta_n[l] = pval[l] - m_n[l];
+          val[jl] = (  val[jl]*l_wa_sum
+                     + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
 
-        if (   (int)mt->m_type == m_type
-            && mt->wa_id == wa_id
-            && mwa->nt_start > -1
-            && mwa->nt_start <= ts->nt_cur
-            && mt->nt_cur < ts->nt_cur) {
+        }
 
-          int attr_id = cs_lagr_stat_type_to_attr_id(mt->stat_type);
+        /* Covariance terms.
+           Note we could have a symmetric formula using
+           0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+           instead of
+           delta[i]*delta_n[j]
+           but unit tests in cs_moment_test.c do not seem to favor
+           one variant over the other; we use the simplest one.  */
 
-          _ensure_init_moment(mt);
+        cs_lnum_t j3 = cell_id*6 + 3,
+                  j4 = cell_id*6 + 4,
+                  j5 = cell_id*6 + 5;
 
-          /* Copy weight sum content to a local array
-             for every new moment inside the current class */
+        val[j3] = (  val[j3]*l_wa_sum
+                   + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
+        val[j4] = (  val[j4]*l_wa_sum
+                   + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
+        val[j5] = (  val[j5]*l_wa_sum
+                   + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
 
-          if (m_weight == NULL && l_wa_sum == NULL)
-            BFT_MALLOC(l_wa_sum, n_w_elts, cs_real_t);
+        /* update mean value */
 
-          for (cs_lnum_t j = 0; j < n_w_elts; j++)
-            l_wa_sum[j] = g_wa_sum[j];
+        for (cs_lnum_t l = 0; l < 3; l++)
+          mean_val[cell_id*3 + l] += r[l];
 
-          /* Case where data is particle-based */
-          /*-----------------------------------*/
+      }
 
-          if (mt->m_data_func == NULL) {
+      else { /* simple variance */
 
-            cs_field_t *f = cs_field_by_id(mt->f_id);
-            cs_real_t *restrict val = f->val;
+        /* new weight for the cell: weight attached to
+           current particle (=dt*weight) plus old weight */
 
-            /* prepare submoment definition */
+        const cs_lnum_t dim = mt->dim;
 
-            cs_lagr_moment_t *mt_mean = NULL;
-            cs_real_t *restrict mean_val = NULL;
+        for (cs_lnum_t l = 0; l < dim; l++) {
 
-            /* Check if lower moment is defined and attached */
+          double delta = pval[l] - mean_val[cell_id*dim+l];
+          double r = delta * (p_weight / wa_sum_n);
+          double m_n = mean_val[cell_id*dim+l] + r;
 
-            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
-              assert(mt->l_id > -1);
-              mt_mean = _lagr_moments + mt->l_id;
-              _ensure_init_moment(mt_mean);
+          val[cell_id*dim+l]
+            = (  val[cell_id*dim+l]*l_wa_sum
+               + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
 
-              cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
-              mean_val = f_mean->val;
-            }
+          /* update mean value */
 
-            cs_real_t *pval = NULL;
-            if (mt->p_data_func != NULL)
-              BFT_MALLOC(pval, mt->data_dim, cs_real_t);
+          mean_val[cell_id*dim+l] += r;
 
-            for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
+        }
 
-              unsigned char *particle
-                = p_set->p_buffer + p_set->p_am->extents * part;
+      }
 
-              cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_set->p_am,
-                                                            CS_LAGR_CELL_ID);
+    }
 
-              int p_class = 0;
-              if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-                p_class = cs_lagr_particle_get_lnum(particle,
-                                                    p_set->p_am,
-                                                    CS_LAGR_STAT_CLASS);
+    else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
 
-              if (cell_id >= 0 && (p_class == mt->class || mt->class == 0)) {
+      const cs_lnum_t dim = mt->dim;
 
-                /* weight associated to current particle */
+      for (cs_lnum_t l = 0; l < dim; l++)
+        val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
+                              * p_weight / wa_sum_n;
 
-                cs_real_t p_weight;
+    } /* End of test if moment is a variance or a mean */
 
-                if (mwa->p_data_func == NULL)
-                  p_weight = cs_lagr_particle_get_real(particle,
-                                                       p_set->p_am,
-                                                       CS_LAGR_STAT_WEIGHT);
-                else
-                  mwa->p_data_func(mwa->data_input,
-                                   particle,
-                                   p_set->p_am,
-                                   &p_weight);
-                p_weight *= dt_val[cell_id*dt_mult];
-
-                if (mt->p_data_func == NULL)
-                  pval = cs_lagr_particle_attr(particle, p_set->p_am, attr_id);
-                else
-                  mt->p_data_func(mt->data_input, particle, p_set->p_am, pval);
-
-                /* update weight sum with new particle weight */
-                const cs_real_t wa_sum_n = CS_MAX(p_weight + l_wa_sum[cell_id],
-                                                  1e-100);
-
-                if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
-
-                  if (mt->dim == 6) { /* variance-covariance matrix */
-
-                    assert(mt->data_dim == 3);
-
-                    double delta[3], delta_n[3], r[3], m_n[3];
-
-                    for (int l = 0; l < 3; l++) {
-
-                      cs_lnum_t jl = cell_id*6 + l;
-                      cs_lnum_t jml = cell_id*3 + l;
-                      delta[l]   = pval[l] - mean_val[jml];
-                      r[l] = delta[l] * (p_weight / wa_sum_n);
-                      m_n[l] = mean_val[jml] + r[l];
-                      delta_n[l] = pval[l] - m_n[l];
-                      val[jl] = (  val[jl]*l_wa_sum[cell_id]
-                                 + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
-
-                    }
-
-                    /* Covariance terms.
-                       Note we could have a symmetric formula using
-                       0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                       instead of
-                       delta[i]*delta_n[j]
-                       but unit tests in cs_moment_test.c do not seem to favor
-                       one variant over the other; we use the simplest one.  */
-
-                    cs_lnum_t j3 = cell_id*6 + 3,
-                              j4 = cell_id*6 + 4,
-                              j5 = cell_id*6 + 5;
-
-                    val[j3] = (  val[j3]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
-                    val[j4] = (  val[j4]*l_wa_sum[cell_id]
-                               + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
-                    val[j5] = (  val[j5]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
+    /* update local weight associated to current moment and class */
 
-                    /* update mean value */
+    l_wa_sum += p_weight;
 
-                    for (cs_lnum_t l = 0; l < 3; l++)
-                      mean_val[cell_id*3 + l] += r[l];
+  } /* end of loop on cell particles */
 
-                  }
+  return l_wa_sum;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update a particle-based weight accumulator and its associated
+ *        particle-based moments, in a single pass on cell-binned particles.
+ *
+ * Cells are distributed among threads, so that each cell's values are
+ * updated by a single thread, and particles of a cell are handled in
+ * the same order as in the particle set, so that results do not depend
+ * on the number of threads.
+ *
+ * User-defined particle data functions are not required to be thread-safe,
+ * so the update is done by a single thread when the accumulator or one of
+ * its moments uses such a function.
+ *
+ * \param[in, out]  mwa           moment weight accumulator
+ * \param[in]       n_moments     number of associated moments to update
+ * \param[in]       moment_ids    ids of moments to update, in update order
+ * \param[in]       p_set         particle set
+ * \param[in]       n_cells       number of cells
+ * \param[in]       cell_p_idx    cell -> particles index
+ * \param[in]       cell_p_ids    cell -> particles ids
+ * \param[in]       n_cell_p_max  maximum number of particles in a cell
+ * \param[in]       dt_val        time step values
+ * \param[in]       dt_mult       time step multiplier (1 for local, 0 for
+ *                                uniform time step)
+ */
+/*----------------------------------------------------------------------------*/
 
-                  else { /* simple variance */
+static void
+_update_particle_wa_binned(cs_lagr_moment_wa_t           *mwa,
+                           int                            n_moments,
+                           const int                      moment_ids[],
+                           const cs_lagr_particle_set_t  *p_set,
+                           cs_lnum_t                      n_cells,
+                           const cs_lnum_t                cell_p_idx[],
+                           const cs_lnum_t                cell_p_ids[],
+                           cs_lnum_t                      n_cell_p_max,
+                           const cs_real_t                dt_val[],
+                           cs_lnum_t                      dt_mult)
+{
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+  const bool have_class = (p_am->displ[0][CS_LAGR_STAT_CLASS] > 0);
+
+  cs_real_t *g_wa_sum = _mwa_val(mwa);
+
+  int data_dim_max = 1;
+  bool have_user_func = (mwa->p_data_func != NULL);
+  for (int i = 0; i < n_moments; i++) {
+    data_dim_max = CS_MAX(data_dim_max,
+                          _lagr_moments[moment_ids[i]].data_dim);
+    if (_lagr_moments[moment_ids[i]].p_data_func != NULL)
+      have_user_func = true;
+  }
 
-                    /* new weight for the cell: weight attached to
-                       current particle (=dt*weight) plus old weight */
+# pragma omp parallel if (   cell_p_idx[n_cells] > CS_THR_MIN \
+                            && !have_user_func)
+  {
+    cs_real_t *c_p_w, *pval_buf;
+    int *c_p_class;
+    BFT_MALLOC(c_p_w, n_cell_p_max, cs_real_t);
+    BFT_MALLOC(c_p_class, n_cell_p_max, int);
+    BFT_MALLOC(pval_buf, data_dim_max, cs_real_t);
 
-                    const cs_lnum_t dim = mt->dim;
+#   pragma omp for schedule(dynamic, CS_CL_SIZE)
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
 
-                    for (cs_lnum_t l = 0; l < dim; l++) {
+      const cs_lnum_t n_c_p = cell_p_idx[cell_id+1] - cell_p_idx[cell_id];
+      if (n_c_p == 0)
+        continue;
 
-                      double delta = pval[l] - mean_val[cell_id*dim+l];
-                      double r = delta * (p_weight / wa_sum_n);
-                      double m_n = mean_val[cell_id*dim+l] + r;
+      const cs_lnum_t *c_p_ids = cell_p_ids + cell_p_idx[cell_id];
 
-                      val[cell_id*dim+l]
-                        = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
-                           + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
+      /* Class and weight of particles in cell, shared by all moments */
 
-                      /* update mean value */
+      for (cs_lnum_t k = 0; k < n_c_p; k++) {
 
-                      mean_val[cell_id*dim+l] += r;
+        const unsigned char *particle
+          = p_set->p_buffer + p_am->extents * c_p_ids[k];
 
-                    }
+        c_p_class[k] = 0;
+        if (have_class)
+          c_p_class[k] = cs_lagr_particle_get_lnum(particle,
+                                                   p_am,
+                                                   CS_LAGR_STAT_CLASS);
 
-                  }
+        cs_real_t p_weight;
+        if (mwa->p_data_func == NULL)
+          p_weight = cs_lagr_particle_get_real(particle,
+                                               p_am,
+                                               CS_LAGR_STAT_WEIGHT);
+        else
+          mwa->p_data_func(mwa->data_input, particle, p_am, &p_weight);
 
-                }
+        c_p_w[k] = p_weight * dt_val[cell_id*dt_mult];
 
-                else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
+      }
 
-                  const cs_lnum_t dim = mt->dim;
+      /* Case where accumulator has no moments */
 
-                  for (cs_lnum_t l = 0; l < dim; l++)
-                    val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
-                                          * p_weight / wa_sum_n;
+      if (n_moments == 0) {
+        for (cs_lnum_t k = 0; k < n_c_p; k++) {
+          if (   (c_p_class[k] == mwa->class || mwa->class == 0)
+              && c_p_w[k] > 1e-100)
+            g_wa_sum[cell_id] += c_p_w[k];
+        }
+        continue;
+      }
 
-                } /* End of test if moment is a variance or a mean */
+      /* Each moment restarts from the accumulator's previous weight */
 
-                /* update local weight associated to current moment and class */
+      cs_real_t w_sum = g_wa_sum[cell_id];
 
-                l_wa_sum[cell_id] += p_weight;
+      for (int i = 0; i < n_moments; i++)
+        w_sum = _update_particle_moment_cell(_lagr_moments + moment_ids[i],
+                                             p_set,
+                                             cell_id,
+                                             n_c_p,
+                                             c_p_ids,
+                                             c_p_w,
+                                             c_p_class,
+                                             g_wa_sum[cell_id],
+                                             pval_buf);
 
-              } /* End of test if particle is in a cell
-                   and if particle class corresponds to moment class */
+      g_wa_sum[cell_id] = w_sum;
 
-            } /* end of loop on particles */
+    } /* End of loop on cells */
 
-            if (mt->p_data_func != NULL)
-              BFT_FREE(pval);
+    BFT_FREE(pval_buf);
+    BFT_FREE(c_p_class);
+    BFT_FREE(c_p_w);
+  }
+}
 
-            mt->nt_cur = ts->nt_cur;
-            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE)
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update all particle-based moment and time moment accumulators.
+ *
+ * Particles are binned by cell once, and all particle-based moments
+ * associated with a given weight accumulator are then updated in a
+ * single pass over cells.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_lagr_stat_update_all(void)
+{
+  const cs_time_step_t  *ts = cs_glob_time_step;
+  cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
+  const cs_real_t *dt_val = _dt_val();
+  cs_lnum_t dt_mult = (cs_glob_time_step->is_local) ? 1 : 0;
+
+  /* First, update mesh-based statistics */
+
+  _cs_lagr_stat_update_mesh_stats(ts);
+
+  /* Cell -> particles index, built when first needed */
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  cs_lnum_t *cell_p_idx = NULL, *cell_p_ids = NULL;
+  cs_lnum_t n_cell_p_max = 0;
+
+  int *moment_ids = NULL;
+  BFT_MALLOC(moment_ids, _n_lagr_moments, int);
+
+  /* Outer loop in weight accumulators, to avoid recomputing weights
+     too many times */
+
+  for (int wa_id = 0; wa_id < _n_lagr_moments_wa; wa_id++) {
+
+    cs_lagr_moment_wa_t *mwa = _lagr_moments_wa + wa_id;
+
+    /* Check if accumulator and associated moments are active here */
+
+    if (   mwa->group != CS_LAGR_STAT_GROUP_PARTICLE
+        || mwa->nt_start > ts->nt_cur)
+      continue;
+
+    /* Here, only active accumulators are considered */
+
+    _ensure_init_wa(mwa);
+
+    const cs_lnum_t n_w_elts = cs_mesh_location_get_n_elts(mwa->location_id)[0];
+
+    /* Compute mesh-based weight now if applicable
+       (possibly sharing it across moments) */
+
+    cs_real_t m_w0[1];
+    cs_real_t *restrict m_weight = _compute_current_weight_m(mwa, dt_val, m_w0);
+
+    /* Select active moments, variances first, then means
+       (as variances also update the associated means) */
+
+    int n_active_moments = 0, n_p_moments = 0;
+
+    for (int m_type = CS_LAGR_MOMENT_VARIANCE;
+         m_type >= (int)CS_LAGR_MOMENT_MEAN;
+         m_type--) {
+
+      for (int i = 0; i < _n_lagr_moments; i++) {
+
+        cs_lagr_moment_t *mt = _lagr_moments + i;
+
+        if (   (int)mt->m_type == m_type
+            && mt->wa_id == wa_id
+            && mwa->nt_start > -1
+            && mwa->nt_start <= ts->nt_cur
+            && mt->nt_cur < ts->nt_cur) {
+
+          _ensure_init_moment(mt);
+
+          n_active_moments++;
+
+          /* Case where data is particle-based */
+
+          if (mt->m_data_func == NULL) {
+
+            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+              assert(mt->l_id > -1);
+              cs_lagr_moment_t *mt_mean = _lagr_moments + mt->l_id;
+              _ensure_init_moment(mt_mean);
               mt_mean->nt_cur = ts->nt_cur;
+            }
+
+            moment_ids[n_p_moments++] = i;
+            mt->nt_cur = ts->nt_cur;
+
           }
 
           /* Case where data is mesh-based */
-          /*-------------------------------*/
 
           else
             _cs_lagr_stat_update_mesh_moment(mt,
@@ -3071,68 +3273,45 @@ _cs_lagr_stat_update_all(void)
 
         } /* end of test if moment is for the current class */
 
-      } /* End of loop on moment types */
+      } /* End of loop on moments */
 
-    } /* End of loop on moments */
+    } /* End of loop on moment types */
 
-    /* At end of loop on moments inside a class, update
-       global class weight array */
+    /* Update particle-based moments and weight accumulator */
 
-    if (l_wa_sum != NULL) {
-      for (cs_lnum_t i = 0; i < n_w_elts; i++)
-        g_wa_sum[i] = l_wa_sum[i];
-      BFT_FREE(l_wa_sum);
-    }
-    else if (m_weight != NULL) {
+    if (m_weight != NULL) {
       _update_wa_m(mwa, m_weight);
       if (m_weight != m_w0)
         BFT_FREE(m_weight);
     }
-    else if (n_w_elts > 0) { /* Case where accumulator has no moments */
-
-      for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
-
-        unsigned char *particle
-          = p_set->p_buffer + p_set->p_am->extents * part;
-
-        cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_set->p_am,
-                                                      CS_LAGR_CELL_ID);
-
-        int p_class = 0;
-        if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-          p_class = cs_lagr_particle_get_lnum(particle,
-                                              p_set->p_am,
-                                              CS_LAGR_STAT_CLASS);
 
-        if (cell_id >= 0 && (p_class == mwa->class || mwa->class == 0)) {
+    else if (   n_w_elts > 0
+             && (n_p_moments > 0 || n_active_moments == 0)) {
 
-          /* weight associated to current particle */
-
-          cs_real_t p_weight;
-
-          if (mwa->p_data_func == NULL)
-            p_weight = cs_lagr_particle_get_real(particle,
-                                                 p_set->p_am,
-                                                 CS_LAGR_STAT_WEIGHT);
-          else
-            mwa->p_data_func(mwa->data_input,
-                             particle,
-                             p_set->p_am,
-                             &p_weight);
-          p_weight *= dt_val[cell_id*dt_mult];
-
-          /* update accumulator weight */
-
-          if (p_weight > 1e-100)
-            g_wa_sum[cell_id] += p_weight;
-
-        }
+      if (cell_p_idx == NULL) {
+        BFT_MALLOC(cell_p_idx, n_cells + 1, cs_lnum_t);
+        _bin_particles_by_cell(p_set, n_cells,
+                               cell_p_idx, &cell_p_ids, &n_cell_p_max);
+      }
 
-      } /* end of loop on particles */
+      _update_particle_wa_binned(mwa,
+                                 n_p_moments,
+                                 moment_ids,
+                                 p_set,
+                                 n_cells,
+                                 cell_p_idx,
+                                 cell_p_ids,
+                                 n_cell_p_max,
+                                 dt_val,
+                                 dt_mult);
 
     }
 
   } /* End of loop on active weight accumulators */
+
+  BFT_FREE(moment_ids);
+  BFT_FREE(cell_p_ids);
+  BFT_FREE(cell_p_idx);
 }
 
 /*----------------------------------------------------------------------------*/
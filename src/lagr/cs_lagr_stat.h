@@ -129,6 +129,9 @@ typedef enum {
  * when the selection function is called, so that value or structure should
  * not be temporary (i.e. local);
  *
+ * Such functions are always called from a single thread, so they do not
+ * need to be thread-safe.
+ *
  * parameters:
  *   input    <-- pointer to optional (untyped) value or structure.
  *   particle <-- pointer to particle data
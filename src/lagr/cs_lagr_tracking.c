@@ -175,11 +175,10 @@ typedef struct {
 
   cs_lnum_t  *send_count;     /* number of particles to send to
                                  each communicating rank */
-  cs_lnum_t  *recv_count;     /* number of particles to receive from
+  cs_lnum_t  *recv_count;     /* number of particles received from
                                  each communicating rank */
 
   cs_lnum_t  *send_shift;
-  cs_lnum_t  *recv_shift;
 
   unsigned char  *send_buf;
 
@@ -203,6 +202,10 @@ typedef struct {
   cs_lnum_t  *cell_face_idx;
   cs_lnum_t  *cell_face_lst;
 
+  cs_real_4_t  *cell_face_sphere;  /* Bounding sphere (center, squared
+                                      radius) of each face, in cell -> face
+                                      connectivity order */
+
   cs_lagr_halo_t      *halo;   /* Lagrangian halo structure */
 
   cs_interface_set_t  *face_ifs;
@@ -490,7 +493,6 @@ _create_lagr_halo(size_t  extents)
 
   BFT_MALLOC(lagr_halo->send_shift, halo->n_c_domains, cs_lnum_t);
   BFT_MALLOC(lagr_halo->send_count, halo->n_c_domains, cs_lnum_t);
-  BFT_MALLOC(lagr_halo->recv_shift, halo->n_c_domains, cs_lnum_t);
   BFT_MALLOC(lagr_halo->recv_count, halo->n_c_domains, cs_lnum_t);
 
   lagr_halo->send_buf_size = CS_LAGR_MIN_COMM_BUF_SIZE;
@@ -601,7 +603,6 @@ _delete_lagr_halo(cs_lagr_halo_t   **halo)
 
     BFT_FREE(h->send_shift);
     BFT_FREE(h->send_count);
-    BFT_FREE(h->recv_shift);
     BFT_FREE(h->recv_count);
 
 #if defined(HAVE_MPI)
@@ -737,6 +738,114 @@ _define_cell_face_connect(cs_lagr_track_builder_t   *builder)
   BFT_FREE(counter);
 }
 
+/*----------------------------------------------------------------------------
+ * Define bounding spheres of faces, in cell -> face connectivity order.
+ *
+ * Spheres are centered on the face center of gravity, and enclose all
+ * the face's vertices (and thus all sub-triangles used for intersection
+ * tests), with a safety margin.
+ *
+ * parameters:
+ *   builder   <->  pointer to a cs_lagr_track_builder_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_cell_face_spheres(cs_lagr_track_builder_t   *builder)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_real_3_t *vtx_coord = (const cs_real_3_t *)mesh->vtx_coord;
+  const cs_real_3_t *i_face_cog = (const cs_real_3_t *)fvq->i_face_cog;
+  const cs_real_3_t *b_face_cog = (const cs_real_3_t *)fvq->b_face_cog;
+
+  const cs_lnum_t  *cell_face_idx = builder->cell_face_idx;
+  const cs_lnum_t  *cell_face_lst = builder->cell_face_lst;
+
+  BFT_MALLOC(builder->cell_face_sphere,
+             cell_face_idx[mesh->n_cells],
+             cs_real_4_t);
+
+  cs_real_4_t *cell_face_sphere = builder->cell_face_sphere;
+
+# pragma omp parallel for if (mesh->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < mesh->n_cells; c_id++) {
+
+    for (cs_lnum_t i = cell_face_idx[c_id]; i < cell_face_idx[c_id+1]; i++) {
+
+      const cs_lnum_t face_num = cell_face_lst[i];
+      const cs_lnum_t *face_connect;
+      const cs_real_t *face_cog;
+      cs_lnum_t n_vertices;
+
+      if (face_num > 0) {
+        cs_lnum_t face_id = face_num - 1;
+        cs_lnum_t s_id = mesh->i_face_vtx_idx[face_id];
+        n_vertices = mesh->i_face_vtx_idx[face_id+1] - s_id;
+        face_connect = mesh->i_face_vtx_lst + s_id;
+        face_cog = i_face_cog[face_id];
+      }
+      else {
+        cs_lnum_t face_id = -face_num - 1;
+        cs_lnum_t s_id = mesh->b_face_vtx_idx[face_id];
+        n_vertices = mesh->b_face_vtx_idx[face_id+1] - s_id;
+        face_connect = mesh->b_face_vtx_lst + s_id;
+        face_cog = b_face_cog[face_id];
+      }
+
+      cs_real_t r2 = 0.;
+      for (cs_lnum_t j = 0; j < n_vertices; j++) {
+        cs_real_t d2 = cs_math_3_square_distance(face_cog,
+                                                 vtx_coord[face_connect[j]]);
+        if (d2 > r2)
+          r2 = d2;
+      }
+
+      for (int k = 0; k < 3; k++)
+        cell_face_sphere[i][k] = face_cog[k];
+
+      /* Add a 1% margin on the radius, so that rejection tests
+         are not sensitive to truncation errors */
+
+      cell_face_sphere[i][3] = r2 * 1.0201;
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check if the line through 2 points misses a sphere.
+ *
+ * parameters:
+ *   x0      <-- first point
+ *   d       <-- displacement from first point to second point
+ *   d2      <-- squared norm of displacement (> 0)
+ *   sphere  <-- sphere center and squared radius
+ *
+ * returns:
+ *   true if the line does not intersect the sphere
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_line_misses_sphere(const cs_real_t  x0[3],
+                    const cs_real_t  d[3],
+                    cs_real_t        d2,
+                    const cs_real_t  sphere[4])
+{
+  const cs_real_t w[3] = {sphere[0] - x0[0],
+                          sphere[1] - x0[1],
+                          sphere[2] - x0[2]};
+
+  /* Squared distance of center to line: |w ^ d|^2 / |d|^2 */
+
+  const cs_real_t p[3] = {w[1]*d[2] - w[2]*d[1],
+                          w[2]*d[0] - w[0]*d[2],
+                          w[0]*d[1] - w[1]*d[0]};
+
+  return (cs_math_3_square_norm(p) > sphere[3]*d2);
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a cs_lagr_track_builder_t structure.
  *
@@ -764,6 +873,7 @@ _init_track_builder(cs_lnum_t  n_particles_max,
   /* Define a cell->face connectivity */
 
   _define_cell_face_connect(builder);
+  _define_cell_face_spheres(builder);
 
   /* Define a cs_lagr_halo_t structure to deal with parallelism and
      periodicity */
@@ -814,6 +924,7 @@ _destroy_track_builder(cs_lagr_track_builder_t  *builder)
 
   BFT_FREE(builder->cell_face_idx);
   BFT_FREE(builder->cell_face_lst);
+  BFT_FREE(builder->cell_face_sphere);
 
   /* Destroy the cs_lagr_halo_t structure */
 
@@ -827,6 +938,48 @@ _destroy_track_builder(cs_lagr_track_builder_t  *builder)
   return NULL;
 }
 
+/*----------------------------------------------------------------------------
+ * Update deposited or fouled particle counters.
+ *
+ * Particles may be tracked by several threads, so updates are atomic.
+ *
+ * parameters:
+ *   n_part      <-> number of particles counter
+ *   weight      <-> particles weight counter
+ *   p_weight    <-- particle statistical weight
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_update_part_counters(cs_lnum_t  *n_part,
+                      cs_real_t  *weight,
+                      cs_real_t   p_weight)
+{
+# pragma omp atomic
+  *n_part += 1;
+# pragma omp atomic
+  *weight += p_weight;
+}
+
+/*----------------------------------------------------------------------------
+ * Flush an event set to statistics.
+ *
+ * Event sets may be thread-local, but statistics are shared, so this is
+ * done in a critical section.
+ *
+ * parameters:
+ *   events <-> pointer to events structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_flush_events(cs_lagr_event_set_t  *events)
+{
+# pragma omp critical(_lagr_tracking_events)
+  cs_lagr_stat_update_event(events,
+                            CS_LAGR_STAT_GROUP_TRACKING_EVENT);
+
+  events->n_events = 0;
+}
+
 /*----------------------------------------------------------------------------
  * Manage detected errors
  *
@@ -1006,12 +1159,14 @@ _internal_treatment(cs_lagr_particle_set_t  *particles,
 
       particle_state = CS_LAGR_PART_TREATED;
 
-      particles->n_part_dep += 1;
-      particles->weight_dep += particle_stat_weight;
+      _update_part_counters(&(particles->n_part_dep),
+                            &(particles->weight_dep),
+                            particle_stat_weight);
 
     }
   }
   else if (internal_conditions->i_face_zone_id[face_id] == CS_LAGR_BC_USER)
+#   pragma omp critical(_lagr_tracking_user_interaction)
     cs_lagr_user_internal_interaction(particles,
                                       p_id,
                                       face_id,
@@ -1052,9 +1207,7 @@ _roll_off_event(cs_lagr_particle_set_t    *particles,
 
   cs_lnum_t event_id = events->n_events;
   if (event_id >= events->n_events_max) {
-    cs_lagr_stat_update_event(events,
-                              CS_LAGR_STAT_GROUP_TRACKING_EVENT);
-    events->n_events = 0;
+    _flush_events(events);
     event_id = 0;
   }
   events->n_events += 1;
@@ -1185,10 +1338,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
     event_id = events->n_events;
     if (event_id >= events->n_events_max) {
-      /* flush events */
-      cs_lagr_stat_update_event(events,
-                                CS_LAGR_STAT_GROUP_TRACKING_EVENT);
-      events->n_events = 0;
+      _flush_events(events);
       event_id = 0;
     }
 
@@ -1215,8 +1365,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     particle_state = CS_LAGR_PART_OUT;
 
     if (b_type == CS_LAGR_DEPO1) {
-      particles->n_part_dep += 1;
-      particles->weight_dep += particle_stat_weight;
+      _update_part_counters(&(particles->n_part_dep),
+                            &(particles->weight_dep),
+                            particle_stat_weight);
       cs_lagr_particles_set_flag(particles, p_id, CS_LAGR_PART_DEPOSITED);
       event_flag = event_flag | CS_EVENT_DEPOSITION;
     }
@@ -1237,8 +1388,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       particle_coord[k] = intersect_pt[k] + bc_epsilon * vect_cen[k];
     }
 
-    particles->n_part_dep += 1;
-    particles->weight_dep += particle_stat_weight;
+    _update_part_counters(&(particles->n_part_dep),
+                          &(particles->weight_dep),
+                          particle_stat_weight);
 
     /* Specific treatment in case of particle resuspension modeling */
 
@@ -1330,8 +1482,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       if (!cs_glob_lagr_model->clogging && !cs_glob_lagr_model->resuspension) {
         cs_lagr_particles_set_flag(particles, p_id, CS_LAGR_PART_DEPOSITED);
 
-        particles->n_part_dep += 1;
-        particles->weight_dep += particle_stat_weight;
+        _update_part_counters(&(particles->n_part_dep),
+                              &(particles->weight_dep),
+                              particle_stat_weight);
 
         cs_lagr_particles_set_flag(particles, p_id, CS_LAGR_PART_FIXED);
         particle_state = CS_LAGR_PART_STUCK;
@@ -1349,8 +1502,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           particle_velocity[k] = 0.0;
           particle_coord[k] = intersect_pt[k] + bc_epsilon * vect_cen[k];
         }
-        particles->n_part_dep += 1;
-        particles->weight_dep += particle_stat_weight;
+        _update_part_counters(&(particles->n_part_dep),
+                              &(particles->weight_dep),
+                              particle_stat_weight);
         particle_state = CS_LAGR_PART_TREATED;
 
       }
@@ -1397,8 +1551,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           cs_lagr_particle_set_lnum(particle, p_am, CS_LAGR_NEIGHBOR_FACE_ID,
                                     face_id);
 
-          particles->n_part_dep += 1;
-          particles->weight_dep += particle_stat_weight;
+          _update_part_counters(&(particles->n_part_dep),
+                                &(particles->weight_dep),
+                                particle_stat_weight);
           particle_state = CS_LAGR_PART_TREATED;
         }
         else {
@@ -1542,8 +1697,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
                                     * particle_stat_weight / cur_part_stat_weight);
 
           particle_state = CS_LAGR_PART_OUT;
-          particles->n_part_dep += 1;
-          particles->weight_dep += particle_stat_weight;
+          _update_part_counters(&(particles->n_part_dep),
+                                &(particles->weight_dep),
+                                particle_stat_weight);
 
           cur_part_height   = cs_lagr_particle_get_real(cur_part, p_am,
                                                         CS_LAGR_HEIGHT);
@@ -1695,8 +1851,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
         particle_state = CS_LAGR_PART_OUT;
 
         /* Recording for log/lagrangian.log */
-        particles->n_part_fou += 1;
-        particles->weight_fou += particle_stat_weight;
+        _update_part_counters(&(particles->n_part_fou),
+                              &(particles->weight_fou),
+                              particle_stat_weight);
 
         /* Recording for statistics */
         /* FIXME: For post-processing by trajectory purpose */
@@ -1749,6 +1906,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
   }
 
   else if (b_type == CS_LAGR_BC_USER)
+#   pragma omp critical(_lagr_tracking_user_interaction)
     cs_lagr_user_boundary_interaction(particles,
                                       p_id,
                                       face_id,
@@ -1805,12 +1963,14 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     cs_real_t fr =   particle_stat_weight
                    * cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
 
+#   pragma omp atomic
     bdy_conditions->particle_flow_rate[b_z_id*n_stats] -= fr;
 
     if (n_stats > 1) {
       int class_id
         = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_STAT_CLASS);
       if (class_id > 0 && class_id < n_stats)
+#       pragma omp atomic
         bdy_conditions->particle_flow_rate[  b_z_id*n_stats
                                            + class_id] -= fr;
     }
@@ -1824,6 +1984,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
     /* Number of particle-boundary interactions  */
     if (cs_glob_lagr_boundary_interactions->has_part_impact_nbr > 0)
+#     pragma omp atomic
       bound_stat[cs_glob_lagr_boundary_interactions->inbr * n_b_faces + face_id]
         += particle_stat_weight;
 
@@ -1880,6 +2041,8 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
 
   cs_lnum_t  *cell_face_idx = builder->cell_face_idx;
   cs_lnum_t  *cell_face_lst = builder->cell_face_lst;
+  const cs_real_4_t  *cell_face_sphere
+    = (const cs_real_4_t *)builder->cell_face_sphere;
 
   const cs_lagr_attribute_map_t  *p_am = particles->p_am;
   unsigned char *particle = particles->p_buffer + p_am->extents * p_id;
@@ -2011,11 +2174,26 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
     const cs_real_t  *next_location
       = cs_lagr_particle_attr_const(particle, p_am, CS_LAGR_COORDS);
 
+    const cs_real_t  traj[3] = {next_location[0] - prev_location[0],
+                                next_location[1] - prev_location[1],
+                                next_location[2] - prev_location[2]};
+    const cs_real_t  traj2 = cs_math_3_square_norm(traj);
+
     /* Loop on faces to see if the particle trajectory crosses it*/
     for (i = cell_face_idx[cell_id];
          i < cell_face_idx[cell_id+1] && particle_state == CS_LAGR_PART_TO_SYNC;
          i++) {
 
+      /* Faces whose bounding sphere is not crossed by the trajectory's
+         line contain no sub-triangle crossed by that line, so they
+         contribute neither to intersections nor to in/out counts */
+
+      if (traj2 > 0. && _line_misses_sphere(prev_location,
+                                            traj,
+                                            traj2,
+                                            cell_face_sphere[i]))
+        continue;
+
       cs_lnum_t face_id, vtx_start, vtx_end, n_vertices;
       const cs_lnum_t *face_connect;
       const cs_real_t *face_cog;
@@ -2270,201 +2448,155 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
 }
 
 /*----------------------------------------------------------------------------
- * Exchange counters on the number of particles to send and to receive
+ * Exchange particles
  *
  * parameters:
- *  halo        <--  pointer to a cs_halo_t structure
- *  lag_halo    <--  pointer to a cs_lagr_halo_t structure
+ *  halo      <-- pointer to a cs_halo_t structure
+ *  lag_halo  <-> pointer to a cs_lagr_halo_t structure
+ *  particles <-- set of particles to update
  *----------------------------------------------------------------------------*/
 
+#if defined(__INTEL_COMPILER)
+#if __INTEL_COMPILER < 1800
+#pragma optimization_level 1 /* Bug with O2 or above with icc 17.0.0 20160721 */
+#endif
+#endif
+
 static void
-_exchange_counter(const cs_halo_t  *halo,
-                  cs_lagr_halo_t   *lag_halo)
+_exchange_particles(const cs_halo_t         *halo,
+                    cs_lagr_halo_t          *lag_halo,
+                    cs_lagr_particle_set_t  *particles)
 {
   int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
 
+  const size_t tot_extents = lag_halo->extents;
+
+  cs_lnum_t  n_recv_particles = 0;
+
+  for (int rank = 0; rank < halo->n_c_domains; rank++)
+    lag_halo->recv_count[rank] = 0;
+
 #if defined(HAVE_MPI)
+
+  int  request_count = 0;
+
   if (cs_glob_n_ranks > 1) {
 
     int  rank;
-    int  request_count = 0;
     const int  local_rank = cs_glob_rank_id;
 
-    /* Receive data from distant ranks */
+    /* Send data to distant ranks; a message is sent to each
+       neighbor, even if empty, so that receive sizes may be
+       determined by probing, with no separate counts exchange */
 
     for (rank = 0; rank < halo->n_c_domains; rank++) {
 
-      if (halo->c_domain_rank[rank] != local_rank)
-        MPI_Irecv(&(lag_halo->recv_count[rank]),
-                  1,
-                  CS_MPI_LNUM,
-                  halo->c_domain_rank[rank],
+      if (halo->c_domain_rank[rank] != local_rank) {
+        cs_lnum_t shift = lag_halo->send_shift[rank];
+        void  *send_buf = lag_halo->send_buf + tot_extents*shift;
+        MPI_Isend(send_buf,
+                  lag_halo->send_count[rank],
+                  _cs_mpi_particle_type,
                   halo->c_domain_rank[rank],
+                  local_rank,
                   cs_glob_mpi_comm,
                   &(lag_halo->request[request_count++]));
+      }
       else
         local_rank_id = rank;
 
     }
 
-    /* We wait for posting all receives
-       (often recommended in the past, apparently not anymore) */
-
-#if 0
-    MPI_Barrier(cs_glob_mpi_comm)
-#endif
-
-    /* Send data to distant ranks */
+    /* Probe incoming message sizes */
 
     for (rank = 0; rank < halo->n_c_domains; rank++) {
 
-      /* If this is not the local rank */
+      if (halo->c_domain_rank[rank] == local_rank)
+        continue;
 
-      if (halo->c_domain_rank[rank] != local_rank)
-        MPI_Isend(&(lag_halo->send_count[rank]),
-                  1,
-                  CS_MPI_LNUM,
-                  halo->c_domain_rank[rank],
-                  local_rank,
-                  cs_glob_mpi_comm,
-                  &(lag_halo->request[request_count++]));
+      MPI_Status status;
+      int count = 0;
 
-    }
+      MPI_Probe(halo->c_domain_rank[rank],
+                halo->c_domain_rank[rank],
+                cs_glob_mpi_comm,
+                &status);
+      MPI_Get_count(&status, _cs_mpi_particle_type, &count);
 
-    /* Wait for all exchanges */
+      lag_halo->recv_count[rank] = count;
 
-    MPI_Waitall(request_count, lag_halo->request, lag_halo->status);
+    }
 
   }
-#endif /* defined(HAVE_MPI) */
-
-  /* Copy local values in case of periodicity */
 
-  if (halo->n_transforms > 0)
-    if (local_rank_id > -1)
-      lag_halo->recv_count[local_rank_id] = lag_halo->send_count[local_rank_id];
+#endif /* defined(HAVE_MPI) */
 
-}
+  if (halo->n_transforms > 0 && local_rank_id > -1)
+    lag_halo->recv_count[local_rank_id] = lag_halo->send_count[local_rank_id];
 
-/*----------------------------------------------------------------------------
- * Exchange particles
- *
- * parameters:
- *  halo      <-- pointer to a cs_halo_t structure
- *  lag_halo  <-> pointer to a cs_lagr_halo_t structure
- *  particles <-- set of particles to update
- *----------------------------------------------------------------------------*/
+  /* Resize particle set once for all received particles; migration does
+     not change the global number of particles, so no global check
+     (which would be collective) is needed here */
 
-#if defined(__INTEL_COMPILER)
-#if __INTEL_COMPILER < 1800
-#pragma optimization_level 1 /* Bug with O2 or above with icc 17.0.0 20160721 */
-#endif
-#endif
+  for (int rank = 0; rank < halo->n_c_domains; rank++)
+    n_recv_particles += lag_halo->recv_count[rank];
 
-static void
-_exchange_particles(const cs_halo_t         *halo,
-                    cs_lagr_halo_t          *lag_halo,
-                    cs_lagr_particle_set_t  *particles)
-{
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+  cs_lagr_particle_set_resize_local(particles,
+                                    particles->n_particles + n_recv_particles);
 
-  const size_t tot_extents = lag_halo->extents;
+  /* Post receives from distant ranks, appending data to the particle set */
 
-  cs_lnum_t  n_recv_particles = 0;
+  cs_lnum_t  recv_shift = particles->n_particles;
 
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {
 
-    int  rank;
-    int  request_count = 0;
-    const int  local_rank = cs_glob_rank_id;
+    for (int rank = 0; rank < halo->n_c_domains; rank++) {
 
-    /* Receive data from distant ranks */
+      if (rank == local_rank_id)
+        continue;
 
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
+      void  *recv_buf = particles->p_buffer + tot_extents*recv_shift;
 
-      cs_lnum_t shift =   particles->n_particles
-                        + lag_halo->recv_shift[rank];
-
-      if (lag_halo->recv_count[rank] > 0) {
-
-        if (halo->c_domain_rank[rank] != local_rank) {
-          void  *recv_buf = particles->p_buffer + tot_extents*shift;
-          n_recv_particles += lag_halo->recv_count[rank];
-          MPI_Irecv(recv_buf,
-                    lag_halo->recv_count[rank],
-                    _cs_mpi_particle_type,
-                    halo->c_domain_rank[rank],
-                    halo->c_domain_rank[rank],
-                    cs_glob_mpi_comm,
-                    &(lag_halo->request[request_count++]));
-        }
-        else
-          local_rank_id = rank;
+      MPI_Irecv(recv_buf,
+                lag_halo->recv_count[rank],
+                _cs_mpi_particle_type,
+                halo->c_domain_rank[rank],
+                halo->c_domain_rank[rank],
+                cs_glob_mpi_comm,
+                &(lag_halo->request[request_count++]));
 
-      }
+      recv_shift += lag_halo->recv_count[rank];
 
     }
 
-    /* We wait for posting all receives
-       (often recommended in the past, apparently not anymore) */
+  }
 
-#if 0
-    MPI_Barrier(cs_glob_mpi_comm);
-#endif
+#endif /* defined(HAVE_MPI) */
 
-    /* Send data to distant ranks */
+  /* Copy local values in case of periodicity
+     (while distant exchanges are in progress) */
 
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
+  if (halo->n_transforms > 0 && local_rank_id > -1) {
 
-      /* If this is not the local rank */
+    cs_lnum_t  send_shift = lag_halo->send_shift[local_rank_id];
 
-      if (   halo->c_domain_rank[rank] != local_rank
-          && lag_halo->send_count[rank] > 0) {
-        cs_lnum_t shift = lag_halo->send_shift[rank];
-        void  *send_buf = lag_halo->send_buf + tot_extents*shift;
-        MPI_Isend(send_buf,
-                  lag_halo->send_count[rank],
-                  _cs_mpi_particle_type,
-                  halo->c_domain_rank[rank],
-                  local_rank,
-                  cs_glob_mpi_comm,
-                  &(lag_halo->request[request_count++]));
+    memcpy(particles->p_buffer + tot_extents*recv_shift,
+           lag_halo->send_buf + tot_extents*send_shift,
+           tot_extents*lag_halo->send_count[local_rank_id]);
 
-      }
+  }
 
-    }
+#if defined(HAVE_MPI)
 
-    /* Wait for all exchanges */
+  /* Wait for all exchanges */
 
+  if (request_count > 0)
     MPI_Waitall(request_count, lag_halo->request, lag_halo->status);
 
-  }
 #endif /* defined(HAVE_MPI) */
 
-  /* Copy local values in case of periodicity */
-
-  if (halo->n_transforms > 0) {
-    if (local_rank_id > -1) {
-
-      cs_lnum_t  recv_shift =   particles->n_particles
-                              + lag_halo->recv_shift[local_rank_id];
-      cs_lnum_t  send_shift = lag_halo->send_shift[local_rank_id];
-
-      assert(   lag_halo->recv_count[local_rank_id]
-             == lag_halo->send_count[local_rank_id]);
-
-      n_recv_particles += lag_halo->send_count[local_rank_id];
-
-      for (cs_lnum_t i = 0; i < lag_halo->send_count[local_rank_id]; i++) {
-        memcpy(particles->p_buffer + tot_extents*(recv_shift + i),
-               lag_halo->send_buf + tot_extents*(send_shift + i),
-               tot_extents);
-      }
-    }
-  }
-
   /* Update particle count and weight */
 
   cs_real_t tot_weight = 0.;
@@ -2487,35 +2619,35 @@ _exchange_particles(const cs_halo_t         *halo,
 }
 
 /*----------------------------------------------------------------------------
- * Determine particle halo sizes
+ * Determine particle halo send sizes
  *
  * parameters:
  *   mesh      <-- pointer to associated mesh
  *   lag_halo  <-> pointer to particle halo structure to update
  *   particles <-- set of particles to update
+ *   s_id      <-- id of first particle to consider
  *----------------------------------------------------------------------------*/
 
 static void
 _lagr_halo_count(const cs_mesh_t               *mesh,
                  cs_lagr_halo_t                *lag_halo,
-                 const cs_lagr_particle_set_t  *particles)
+                 const cs_lagr_particle_set_t  *particles,
+                 cs_lnum_t                      s_id)
 {
   cs_lnum_t  i, ghost_id;
 
-  cs_lnum_t  n_recv_particles = 0, n_send_particles = 0;
+  cs_lnum_t  n_send_particles = 0;
 
   const cs_halo_t  *halo = mesh->halo;
 
   /* Initialization */
 
-  for (i = 0; i < halo->n_c_domains; i++) {
+  for (i = 0; i < halo->n_c_domains; i++)
     lag_halo->send_count[i] = 0;
-    lag_halo->recv_count[i] = 0;
-  }
 
   /* Loop on particles to count number of particles to send on each rank */
 
-  for (i = 0; i < particles->n_particles; i++) {
+  for (i = s_id; i < particles->n_particles; i++) {
 
     if (_get_tracking_info(particles, i)->state == CS_LAGR_PART_TO_SYNC_NEXT) {
 
@@ -2529,52 +2661,47 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 
   } /* End of loop on particles */
 
-  /* Exchange counters */
-
-  _exchange_counter(halo, lag_halo);
-
-  for (i = 0; i < halo->n_c_domains; i++) {
-    n_recv_particles += lag_halo->recv_count[i];
+  for (i = 0; i < halo->n_c_domains; i++)
     n_send_particles += lag_halo->send_count[i];
-  }
 
   lag_halo->send_shift[0] = 0;
-  lag_halo->recv_shift[0] = 0;
-
-  for (i = 1; i < halo->n_c_domains; i++) {
 
+  for (i = 1; i < halo->n_c_domains; i++)
     lag_halo->send_shift[i] =  lag_halo->send_shift[i-1]
                              + lag_halo->send_count[i-1];
 
-    lag_halo->recv_shift[i] =  lag_halo->recv_shift[i-1]
-                             + lag_halo->recv_count[i-1];
-
-  }
-
-  /* Resize particle set and/or halo only if needed */
+  /* Resize halo only if needed (the particle set is resized
+     upon reception) */
 
-  cs_lagr_particle_set_resize(particles->n_particles + n_recv_particles);
   _resize_lagr_halo(lag_halo, n_send_particles);
 }
 
 /*----------------------------------------------------------------------------
  * Update particle sets, including halo synchronization.
  *
+ * Particles with ids lower than n_resident have already been treated
+ * and compacted at a previous displacement step, so only the following
+ * particles (received at the previous step) are considered.
+ *
  * parameters:
- *   particles <-> set of particles to update
+ *   particles       <-> set of particles to update
+ *   n_resident      <-> number of treated particles kept locally
+ *   resident_weight <-> weight of treated particles kept locally
  *
  * returns:
- *   1 if displacement needs to continue, 0 if finished
+ *   1 if particles were sent to another domain, 0 otherwise
  *----------------------------------------------------------------------------*/
 
 static int
-_sync_particle_set(cs_lagr_particle_set_t  *particles)
+_sync_particle_set(cs_lagr_particle_set_t  *particles,
+                   cs_lnum_t               *n_resident,
+                   cs_real_t               *resident_weight)
 {
   cs_lnum_t  i, k, tr_id, rank, shift, ghost_id;
   cs_real_t matrix[3][4];
 
-  cs_lnum_t  n_recv_particles = 0;
-  cs_lnum_t  particle_count = 0;
+  cs_lnum_t  s_id = *n_resident;
+  cs_lnum_t  particle_count = s_id;
 
   cs_lnum_t  n_merged_particles = 0;
 
@@ -2584,7 +2711,7 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   cs_real_t  exit_weight = 0.0;
   cs_real_t  merged_weight = 0.0;
   cs_real_t  fail_weight = 0.0;
-  cs_real_t  tot_weight = 0.0;
+  cs_real_t  tot_weight = *resident_weight;
 
   cs_lagr_track_builder_t  *builder = _particle_track_builder;
   cs_lagr_halo_t  *lag_halo = builder->halo;
@@ -2601,18 +2728,16 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
   if (halo != NULL) {
 
-    _lagr_halo_count(mesh, lag_halo, particles);
+    _lagr_halo_count(mesh, lag_halo, particles, s_id);
 
-    for (i = 0; i < halo->n_c_domains; i++) {
-      n_recv_particles += lag_halo->recv_count[i];
+    for (i = 0; i < halo->n_c_domains; i++)
       lag_halo->send_count[i] = 0;
-    }
   }
 
   /* Loop on particles, transferring particles to synchronize to send_buf
      for particle set, and removing particles that otherwise exited the domain */
 
-  for (i = 0; i < particles->n_particles; i++) {
+  for (i = s_id; i < particles->n_particles; i++) {
 
     cs_lagr_tracking_state_t cur_part_state
       = _get_tracking_info(particles, i)->state;
@@ -2811,13 +2936,14 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   particles->n_part_merged += n_merged_particles;
   particles->weight_merged += merged_weight;
 
+  *n_resident = particle_count;
+  *resident_weight = tot_weight;
+
   /* Exchange particles, then update set */
 
   if (halo != NULL)
     _exchange_particles(halo, lag_halo, particles);
 
-  cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
-
   return continue_displacement;
 }
 
@@ -2859,6 +2985,7 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles)
 
   /* Prepare tracking info */
 
+# pragma omp parallel for if (particles->n_particles > CS_THR_MIN)
   for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
 
     cs_lnum_t cur_part_cell_id
@@ -2934,74 +3061,21 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles)
 static void
 _finalize_displacement(cs_lagr_particle_set_t  *particles)
 {
-  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
-  const cs_lnum_t  n_cells = cs_glob_mesh->n_cells;
-
-  const cs_lnum_t n_particles = particles->n_particles;
-
-  cs_lnum_t *cell_idx;
-  unsigned char *swap_buffer;
-  size_t swap_buffer_size = p_am->extents * ((size_t)n_particles);
-
-  BFT_MALLOC(cell_idx, n_cells+1, cs_lnum_t);
-  BFT_MALLOC(swap_buffer, swap_buffer_size, unsigned char);
-
-  /* Cell index (count first) */
-
-  for (cs_lnum_t i = 0; i < n_cells+1; i++)
-    cell_idx[i] = 0;
-
-  /* Copy unordered particle data to buffer */
-
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
-
+#if defined(DEBUG) && !defined(NDEBUG)
+  for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
     cs_lnum_t cur_part_state = _get_tracking_info(particles, i)->state;
-
     assert(   cur_part_state < CS_LAGR_PART_OUT
            && cur_part_state != CS_LAGR_PART_TO_SYNC);
-
-    cs_lnum_t cell_id = cs_lagr_particles_get_lnum(particles, i,
-                                                   CS_LAGR_CELL_ID);
-
-    memcpy(swap_buffer + p_am->extents*i,
-           particles->p_buffer + p_am->extents*i,
-           p_am->extents);
-
-    cell_idx[cell_id+1] += 1;
-
   }
+#endif
 
-  /* Convert count to index */
-
-  for (cs_lnum_t i = 1; i < n_cells; i++)
-    cell_idx[i+1] += cell_idx[i];
-
-  assert(n_particles == cell_idx[n_cells]);
-
-  /* Now copy particle data and update some statistics */
-
-  const cs_lnum_t p_extents = particles->p_am->extents;
-  const cs_lnum_t cell_num_displ = particles->p_am->displ[0][CS_LAGR_CELL_ID];
-
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
-
-    cs_lnum_t cell_id
-      = *((const cs_lnum_t *)(swap_buffer + p_extents*i + cell_num_displ));
-
-    assert(cell_id > -1);
-
-    cs_lnum_t particle_id = cell_idx[cell_id];
-
-    cell_idx[cell_id] += 1;
-
-    memcpy(particles->p_buffer + p_am->extents*particle_id,
-           swap_buffer + p_am->extents*i,
-           p_am->extents);
-
-  }
+  /* Sort particles by cell */
 
-  BFT_FREE(swap_buffer);
-  BFT_FREE(cell_idx);
+  cs_lagr_particle_set_sort_by_cell(particles,
+                                    0,
+                                    particles->n_particles,
+                                    cs_glob_mesh->n_cells,
+                                    NULL);
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
   bft_printf("\n Particle set after %s\n", __func__);
@@ -3066,7 +3140,7 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
   const cs_mesh_t  *mesh = cs_glob_mesh;
 
   int  displacement_step_id = 0;
-  int  continue_displacement = 1;
+  int  continue_displacement = 0;
 
   cs_lagr_particle_set_t  *particles = cs_glob_lagr_particle_set;
   cs_lagr_event_set_t     *events = NULL;
@@ -3100,60 +3174,165 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   _initialize_displacement(particles);
 
-  /* Main loop on particles: global propagation */
+  /* Particles are tracked independently, so the local propagation
+     may be threaded, using thread-local event sets. Models in which
+     boundary interactions access other particles or the global random
+     number generator state are handled serially. */
 
-  while (continue_displacement) {
+  int n_threads = cs_glob_n_threads;
 
-    /* Local propagation */
+  if (   lagr_model->clogging > 0
+      || lagr_model->roughness > 0
+      || lagr_model->fouling > 0)
+    n_threads = 1;
 
-    for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
+  cs_lagr_event_set_t  **t_events = NULL;
+
+  BFT_MALLOC(t_events, n_threads, cs_lagr_event_set_t *);
+
+  t_events[0] = events;
+  for (int t_id = 1; t_id < n_threads; t_id++)
+    t_events[t_id] = NULL;
+
+  /* Main loop on particles: global propagation.
 
-      /* Local copies of the current and previous particles state vectors
-         to be used in case of the first pass of _local_propagation fails */
+     At each displacement step, only particles not yet treated (all
+     particles at the first step, then particles received from other
+     domains) are tracked. The global check for particles still in
+     transit is started after each synchronization, and completed after
+     tracking received particles at the next step, so that its latency
+     may be overlapped by that tracking: if no particle was sent by any
+     rank, none was received, and the displacement is finished. */
 
-      cs_lagr_tracking_state_t cur_part_state
-        = _get_tracking_info(particles, i)->state;
+  cs_lnum_t  n_resident = 0;
+  cs_real_t  resident_weight = 0.;
 
-      if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+  int  continue_displacement_l = 0;
+  MPI_Request  continue_request = MPI_REQUEST_NULL;
+#endif
+
+  while (true) {
 
-        /* Main particle displacement stage */
+    /* Local propagation */
 
-        cur_part_state = _local_propagation(particles,
-                                            events,
-                                            i,
-                                            displacement_step_id,
-                                            failsafe_mode,
-                                            b_face_zone_id,
-                                            visc_length,
-                                            u);
+    const cs_lnum_t  s_id = n_resident;
+    const cs_lnum_t  n_to_track = particles->n_particles - s_id;
 
-        _tracking_info(particles, i)->state = cur_part_state;
+#   pragma omp parallel if (n_to_track > CS_THR_MIN) \
+                        num_threads(n_threads)
+    {
+#if defined(HAVE_OPENMP)
+      const int t_id = omp_get_thread_num();
+#else
+      const int t_id = 0;
+#endif
 
+      if (t_id > 0 && events != NULL && t_events[t_id] == NULL) {
+        t_events[t_id] = cs_lagr_event_set_create();
+        cs_lagr_event_set_resize(t_events[t_id],
+                                 events->n_events_max / n_threads + 1);
       }
 
-    } /* End of loop on particles */
+      cs_lagr_event_set_t  *_events = t_events[t_id];
+
+#     pragma omp for schedule(dynamic, CS_CL_SIZE)
+      for (cs_lnum_t i = s_id; i < particles->n_particles; i++) {
+
+        /* Local copies of the current and previous particles state vectors
+           to be used in case of the first pass of _local_propagation fails */
+
+        cs_lagr_tracking_state_t cur_part_state
+          = _get_tracking_info(particles, i)->state;
+
+        if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
+
+          /* Main particle displacement stage */
+
+          cur_part_state = _local_propagation(particles,
+                                              _events,
+                                              i,
+                                              displacement_step_id,
+                                              failsafe_mode,
+                                              b_face_zone_id,
+                                              visc_length,
+                                              u);
+
+          _tracking_info(particles, i)->state = cur_part_state;
+
+        }
+
+      } /* End of loop on particles */
+
+    } /* End of parallel section */
+
+    /* Complete check started at the previous step */
+
+    if (displacement_step_id > 0) {
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+      if (continue_request != MPI_REQUEST_NULL)
+        MPI_Wait(&continue_request, MPI_STATUS_IGNORE);
+#endif
+      if (continue_displacement == 0)
+        break;
+    }
 
     /* Update of the particle set structure. Delete exited particles,
        update for particles which change domain. */
 
-    continue_displacement = _sync_particle_set(particles);
+    continue_displacement = _sync_particle_set(particles,
+                                               &n_resident,
+                                               &resident_weight);
+
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+    if (cs_glob_n_ranks > 1) {
+      continue_displacement_l = continue_displacement;
+      MPI_Iallreduce(&continue_displacement_l, &continue_displacement, 1,
+                     MPI_INT, MPI_MAX, cs_glob_mpi_comm, &continue_request);
+    }
+#else
+    cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
+#endif
 
 #if 0
     bft_printf("\n Particle set after sync\n");
     cs_lagr_particle_set_dump(particles);
 #endif
 
-    /*  assert(j == -1);  After a loop on particles, next_id of the last
-        particle must not be defined */
-
     displacement_step_id++;
 
   } /* End of while (global displacement) */
 
+  /* Append thread-local events to main event set, in thread order */
+
+  for (int t_id = 1; t_id < n_threads; t_id++) {
+
+    cs_lagr_event_set_t  *_events = t_events[t_id];
+
+    if (_events == NULL)
+      continue;
+
+    cs_lnum_t n_events = events->n_events + _events->n_events;
+    if (n_events > events->n_events_max)
+      cs_lagr_event_set_resize(events, n_events);
+
+    memcpy(events->e_buffer + events->e_am->extents * events->n_events,
+           _events->e_buffer,
+           _events->e_am->extents * _events->n_events);
+
+    events->n_events = n_events;
+
+    cs_lagr_event_set_destroy(&_events);
+
+  }
+
+  BFT_FREE(t_events);
+
   /* Deposition sub-model additional loop */
 
   if (lagr_model->deposition > 0) {
 
+#   pragma omp parallel for if (particles->n_particles > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
 
       unsigned char *particle = particles->p_buffer + p_am->extents * i;
@@ -0,0 +1,539 @@
+/*============================================================================
+ * Streaming output of particle attributes in a compact binary format.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_log.h"
+#include "cs_parall.h"
+#include "cs_time_step.h"
+
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_trajectory.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Particle stream writer */
+
+typedef struct {
+
+  char                  *name;        /* Base name */
+  int                    interval;    /* Output interval */
+  int                    n_attrs;     /* Number of attributes */
+  cs_lagr_attribute_t   *attrs;       /* Attribute ids */
+  bool                   compress;    /* Compress chunks ? */
+
+  cs_file_t             *f;           /* Data file */
+  cs_file_t             *f_idx;       /* Index file */
+
+} cs_lagr_trajectory_writer_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char  _dir_name[] = "postprocessing";
+static const char  _magic_string[] = "Code_Saturne particle stream";
+
+/* Maximum size (in bytes) of record data written in a single call,
+   so that counts passed to the I/O layer fit in an int */
+
+static const cs_gnum_t  _max_write_size = 1 << 30;
+
+static cs_lagr_trajectory_writer_t  *_writer = NULL;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Open a file with the default access method on all ranks.
+ *
+ * Each rank writes its own chunk, so the file is opened on the full
+ * communicator (block rank step 1) rather than on the default I/O ranks.
+ *
+ * parameters:
+ *   path  <-- file path
+ *   mode  <-- file mode
+ *
+ * returns:
+ *   pointer to file descriptor
+ *----------------------------------------------------------------------------*/
+
+static cs_file_t *
+_open_file(const char      *path,
+           cs_file_mode_t   mode)
+{
+  cs_file_access_t method;
+
+#if defined(HAVE_MPI)
+  MPI_Info hints;
+  cs_file_get_default_access(mode, &method, &hints);
+  return cs_file_open(path, mode, method, hints,
+                      cs_glob_mpi_comm, cs_glob_mpi_comm);
+#else
+  cs_file_get_default_access(mode, &method);
+  return cs_file_open(path, mode, method);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Open writer files and write file header.
+ *
+ * On restart, records are appended to existing files.
+ *
+ * parameters:
+ *   w  <-> pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_open_files(cs_lagr_trajectory_writer_t  *w)
+{
+  const cs_lagr_attribute_map_t  *p_am = cs_lagr_particle_get_attr_map();
+
+  if (cs_glob_rank_id < 1)
+    cs_file_mkdir_default(_dir_name);
+
+  size_t l = strlen(_dir_name) + strlen(w->name) + 10;
+  char *path;
+  BFT_MALLOC(path, l, char);
+
+  snprintf(path, l, "%s/%s.trj", _dir_name, w->name);
+
+  int append = 0;
+  if (cs_glob_time_step->nt_prev > 0) {
+    if (cs_glob_rank_id < 1)
+      append = cs_file_isreg(path);
+    cs_parall_bcast(0, 1, CS_INT_TYPE, &append);
+  }
+
+  cs_file_mode_t mode = (append) ? CS_FILE_MODE_APPEND : CS_FILE_MODE_WRITE;
+
+  w->f = _open_file(path, mode);
+
+  snprintf(path, l, "%s/%s.trj.idx", _dir_name, w->name);
+  w->f_idx = _open_file(path, mode);
+
+  BFT_FREE(path);
+
+  if (append)
+    return;
+
+  /* File header */
+
+  char s[32];
+  memset(s, 0, 32);
+  strncpy(s, _magic_string, 31);
+  cs_file_write_global(w->f, s, 1, 32);
+
+  int64_t h[3] = {1, w->n_attrs, 0};
+#if defined(HAVE_ZLIB)
+  if (w->compress)
+    h[2] = 1;
+#endif
+  cs_file_write_global(w->f, h, sizeof(int64_t), 3);
+
+  for (int i = 0; i < w->n_attrs; i++) {
+    memset(s, 0, 32);
+    strncpy(s, cs_lagr_attribute_name[w->attrs[i]], 31);
+    cs_file_write_global(w->f, s, 1, 32);
+    int64_t n_comp = p_am->count[0][w->attrs[i]];
+    cs_file_write_global(w->f, &n_comp, sizeof(int64_t), 1);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build the local data chunk for the current particle set.
+ *
+ * parameters:
+ *   w          <-- pointer to writer structure
+ *   p_set      <-- particle set
+ *   chunk_size --> size of chunk in bytes
+ *
+ * returns:
+ *   pointer to allocated chunk
+ *----------------------------------------------------------------------------*/
+
+static unsigned char *
+_build_chunk(const cs_lagr_trajectory_writer_t  *w,
+             const cs_lagr_particle_set_t       *p_set,
+             size_t                             *chunk_size)
+{
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+  const cs_lnum_t n_particles = p_set->n_particles;
+
+  size_t n_vals = 0;
+  for (int i = 0; i < w->n_attrs; i++)
+    n_vals += (size_t)(p_am->count[0][w->attrs[i]]) * n_particles;
+
+  double *vals;
+  BFT_MALLOC(vals, n_vals, double);
+
+  size_t shift = 0;
+
+  for (int i = 0; i < w->n_attrs; i++) {
+
+    const cs_lagr_attribute_t attr = w->attrs[i];
+    const int n_comp = p_am->count[0][attr];
+    double *_vals = vals + shift;
+
+#   pragma omp parallel for if (n_particles > CS_THR_MIN)
+    for (cs_lnum_t j = 0; j < n_particles; j++) {
+      const cs_real_t *p_val
+        = cs_lagr_particles_attr_const(p_set, j, attr);
+      for (int k = 0; k < n_comp; k++)
+        _vals[j*n_comp + k] = p_val[k];
+    }
+
+    shift += (size_t)n_comp * n_particles;
+
+  }
+
+  *chunk_size = n_vals * sizeof(double);
+
+  return (unsigned char *)vals;
+}
+
+#if defined(HAVE_ZLIB)
+
+/*----------------------------------------------------------------------------
+ * Compress a data chunk of double-precision values.
+ *
+ * Bytes of equal significance are grouped prior to compression, as
+ * the sign and exponent bytes of neighboring values often vary slowly.
+ *
+ * parameters:
+ *   chunk      <-- chunk to compress
+ *   chunk_size <-- chunk size in bytes
+ *   z_size     --> compressed size in bytes
+ *
+ * returns:
+ *   pointer to allocated compressed chunk
+ *----------------------------------------------------------------------------*/
+
+static unsigned char *
+_compress_chunk(const unsigned char  *chunk,
+                size_t                chunk_size,
+                size_t               *z_size)
+{
+  const size_t type_size = sizeof(double);
+  const size_t n_vals = chunk_size / type_size;
+
+  unsigned char *s_buf, *z_buf;
+  BFT_MALLOC(s_buf, chunk_size, unsigned char);
+
+  for (size_t i = 0; i < n_vals; i++) {
+    for (size_t b = 0; b < type_size; b++)
+      s_buf[b*n_vals + i] = chunk[i*type_size + b];
+  }
+
+  uLongf z_len = compressBound(chunk_size);
+  BFT_MALLOC(z_buf, z_len, unsigned char);
+
+  int retval = compress2(z_buf, &z_len, s_buf, chunk_size, Z_BEST_SPEED);
+
+  if (retval != Z_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error compressing %llu bytes (zlib error code %d)."),
+              (unsigned long long)chunk_size, retval);
+
+  BFT_FREE(s_buf);
+
+  *z_size = z_len;
+
+  return z_buf;
+}
+
+#endif /* defined(HAVE_ZLIB) */
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define streaming output of particle attributes.
+ *
+ * Selected (real-valued) attributes of all particles are appended to
+ * the "postprocessing/<name>.trj" file every interval time steps,
+ * without building any postprocessing mesh. Each record contains
+ * one contiguous chunk per rank, written in parallel, and possibly
+ * compressed. The offset of each record is appended to the associated
+ * "postprocessing/<name>.trj.idx" index file. On restart, records are
+ * appended to existing files.
+ *
+ * The file format is described in cs_lagr_trajectory.h.
+ *
+ * \param[in]  name      base name of output files
+ * \param[in]  interval  output interval (in time steps)
+ * \param[in]  n_attrs   number of attributes to output
+ * \param[in]  attrs     ids of attributes to output
+ * \param[in]  compress  compress data if true (and zlib is available)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_define(const char                 *name,
+                          int                         interval,
+                          int                         n_attrs,
+                          const cs_lagr_attribute_t   attrs[],
+                          bool                        compress)
+{
+  if (_writer != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: particle stream output is already defined."),
+              __func__);
+
+  BFT_MALLOC(_writer, 1, cs_lagr_trajectory_writer_t);
+
+  cs_lagr_trajectory_writer_t *w = _writer;
+
+  BFT_MALLOC(w->name, strlen(name) + 1, char);
+  strcpy(w->name, name);
+
+  w->interval = CS_MAX(interval, 1);
+  w->n_attrs = n_attrs;
+  BFT_MALLOC(w->attrs, n_attrs, cs_lagr_attribute_t);
+  for (int i = 0; i < n_attrs; i++)
+    w->attrs[i] = attrs[i];
+
+#if defined(HAVE_ZLIB)
+  w->compress = compress;
+#else
+  w->compress = false;
+  if (compress)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n  Particle stream \"%s\": compression not available\n"
+                    "  (zlib support not built); data will be uncompressed.\n"),
+                  name);
+#endif
+
+  w->f = NULL;
+  w->f_idx = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append current particle data to streaming output if required
+ *        at the current time step.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_write(void)
+{
+  cs_lagr_trajectory_writer_t *w = _writer;
+
+  if (w == NULL)
+    return;
+
+  const cs_time_step_t *ts = cs_glob_time_step;
+
+  if (ts->nt_cur % w->interval != 0)
+    return;
+
+  const cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
+
+  /* Check attributes on first output, once particle attributes are mapped */
+
+  if (w->f == NULL) {
+    const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+    for (int i = 0; i < w->n_attrs; i++) {
+      cs_lagr_attribute_t attr = w->attrs[i];
+      if (p_am->count[0][attr] < 1 || p_am->datatype[attr] != CS_REAL_TYPE)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("%s: particle attribute \"%s\" is not active or not\n"
+                    "real-valued, so it cannot be output."),
+                  __func__, cs_lagr_attribute_name[attr]);
+    }
+    _open_files(w);
+  }
+
+  /* Build (and possibly compress) local chunk */
+
+  size_t raw_size = 0, stored_size = 0;
+  unsigned char *chunk = _build_chunk(w, p_set, &raw_size);
+
+  stored_size = raw_size;
+
+#if defined(HAVE_ZLIB)
+  if (w->compress && raw_size > 0) {
+    unsigned char *z_chunk = _compress_chunk(chunk, raw_size, &stored_size);
+    BFT_FREE(chunk);
+    chunk = z_chunk;
+  }
+#endif
+
+  /* Gather chunk descriptions and compute chunk positions */
+
+  const int n_ranks = cs_glob_n_ranks;
+
+  int64_t c_info[3] = {p_set->n_particles, raw_size, stored_size};
+  int64_t *r_info = NULL;
+
+  if (cs_glob_rank_id < 1)
+    BFT_MALLOC(r_info, 3*n_ranks, int64_t);
+
+  cs_gnum_t chunk_start = 0;
+  cs_gnum_t g_sizes[2] = {p_set->n_particles, stored_size};
+
+#if defined(HAVE_MPI)
+  if (n_ranks > 1) {
+    cs_gnum_t _stored_size = stored_size;
+    MPI_Gather(c_info, 3, MPI_INT64_T, r_info, 3, MPI_INT64_T,
+               0, cs_glob_mpi_comm);
+    MPI_Exscan(&_stored_size, &chunk_start, 1, CS_MPI_GNUM, MPI_SUM,
+               cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0)
+      chunk_start = 0;
+    cs_parall_counter(g_sizes, 2);
+  }
+#endif
+
+  const cs_gnum_t n_g_particles = g_sizes[0];
+  const cs_gnum_t g_stored_size = g_sizes[1];
+  const cs_gnum_t chunk_end = chunk_start + stored_size;
+
+  if (n_ranks == 1) {
+    for (int i = 0; i < 3; i++)
+      r_info[i] = c_info[i];
+  }
+
+  /* Record header */
+
+  cs_file_off_t rec_offset = cs_file_tell(w->f);
+
+  int64_t r_header[3] = {ts->nt_cur, n_ranks, n_g_particles};
+  double t_cur = ts->t_cur;
+
+  cs_file_write_global(w->f, r_header, sizeof(int64_t), 3);
+  cs_file_write_global(w->f, &t_cur, sizeof(double), 1);
+  cs_file_write_global(w->f, r_info, sizeof(int64_t), 3*n_ranks);
+
+  BFT_FREE(r_info);
+
+  /* Per-rank chunks, written in rank order by successive windows of
+     at most _max_write_size bytes */
+
+  for (cs_gnum_t w_start = 0;
+       w_start < g_stored_size;
+       w_start += _max_write_size) {
+
+    cs_gnum_t w_end = CS_MIN(w_start + _max_write_size, g_stored_size);
+    cs_gnum_t b_start = CS_MIN(CS_MAX(chunk_start, w_start), w_end);
+    cs_gnum_t b_end = CS_MIN(CS_MAX(chunk_end, w_start), w_end);
+
+    unsigned char *b_chunk = chunk;
+    if (b_end > b_start)
+      b_chunk += b_start - chunk_start;
+
+    cs_file_write_block_buffer(w->f,
+                               b_chunk,
+                               1,
+                               1,
+                               b_start - w_start + 1,
+                               b_end - w_start + 1);
+
+  }
+
+  BFT_FREE(chunk);
+
+  /* Index entry */
+
+  int64_t i_entry[2] = {ts->nt_cur, rec_offset};
+  int64_t n_g_entry = n_g_particles;
+
+  cs_file_write_global(w->f_idx, &(i_entry[0]), sizeof(int64_t), 1);
+  cs_file_write_global(w->f_idx, &t_cur, sizeof(double), 1);
+  cs_file_write_global(w->f_idx, &(i_entry[1]), sizeof(int64_t), 1);
+  cs_file_write_global(w->f_idx, &n_g_entry, sizeof(int64_t), 1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close streaming output and free associated structures.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_finalize(void)
+{
+  cs_lagr_trajectory_writer_t *w = _writer;
+
+  if (w == NULL)
+    return;
+
+  if (w->f != NULL)
+    cs_file_free(w->f);
+  if (w->f_idx != NULL)
+    cs_file_free(w->f_idx);
+
+  BFT_FREE(w->attrs);
+  BFT_FREE(w->name);
+  BFT_FREE(_writer);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,119 @@
+#ifndef __CS_LAGR_TRAJECTORY_H__
+#define __CS_LAGR_TRAJECTORY_H__
+
+/*============================================================================
+ * Streaming output of particle attributes in a compact binary format.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define streaming output of particle attributes.
+ *
+ * Selected (real-valued) attributes of all particles are appended to
+ * the "postprocessing/<name>.trj" file every interval time steps,
+ * without building any postprocessing mesh. Each record contains
+ * one contiguous chunk per rank, written in parallel, and possibly
+ * compressed. The offset of each record is appended to the associated
+ * "postprocessing/<name>.trj.idx" index file. On restart, records are
+ * appended to existing files.
+ *
+ * Data is written in native byte order. The file starts with:
+ *
+ * - char[32]: "Code_Saturne particle stream", padded with '\0';
+ * - int64: byte order check value (1);
+ * - int64: number of attributes (n_attrs);
+ * - int64: compression (0: none, 1: zlib with byte shuffling);
+ * - n_attrs times: char[32] attribute name, int64 number of components.
+ *
+ * Each record then contains:
+ *
+ * - int64[3]: time step number, number of ranks (n_ranks),
+ *             global number of particles;
+ * - double: physical time;
+ * - int64[n_ranks*3]: for each rank, number of particles, uncompressed
+ *                     chunk size, and stored chunk size (in bytes);
+ * - chunks of all ranks, in rank order; an uncompressed chunk contains
+ *   the values of each attribute in turn, as double-precision values
+ *   interlaced by particle. Compressed chunks are byte-shuffled
+ *   (bytes of equal significance grouped) prior to compression.
+ *
+ * Each index file entry contains: int64 time step number, double physical
+ * time, int64 record offset, and int64 global number of particles.
+ *
+ * \param[in]  name      base name of output files
+ * \param[in]  interval  output interval (in time steps)
+ * \param[in]  n_attrs   number of attributes to output
+ * \param[in]  attrs     ids of attributes to output
+ * \param[in]  compress  compress data if true (and zlib is available)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_define(const char                 *name,
+                          int                         interval,
+                          int                         n_attrs,
+                          const cs_lagr_attribute_t   attrs[],
+                          bool                        compress);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append current particle data to streaming output if required
+ *        at the current time step.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_write(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close streaming output and free associated structures.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LAGR_TRAJECTORY_H__ */
@@ -78,6 +78,11 @@ BEGIN_C_DECLS
  * Macro definitions
  *===========================================================================*/
 
+/* Number of visible edges above which the spatial hash is used to
+   filter edge-edge intersection candidates */
+
+#define _EDGE_HASH_THRESHOLD 64
+
 /*============================================================================
  * Structure and type definitions
  *===========================================================================*/
@@ -94,6 +99,19 @@ typedef struct {
 
 } exch_inter_t;
 
+/* Uniform spatial hash on edge bounding boxes, used to filter edge-edge
+   intersection candidates */
+
+typedef struct {
+
+  double      cell_size;   /* Size of hash grid cells */
+  double      origin[3];   /* Origin of hash grid */
+  cs_lnum_t   mask;        /* Number of buckets - 1 (power of 2) */
+  cs_lnum_t  *idx;         /* Index on bucket entries (size: mask + 2) */
+  cs_lnum_t  *lst;         /* Edge ids for each bucket */
+
+} edge_hash_t;
+
 /*============================================================================
  * Global variable definitions
  *===========================================================================*/
@@ -106,6 +124,38 @@ static const double  _cs_join_tol_eps_coef = 1.0001;
  * Private function definitions
  *===========================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compute array index bounds for a local thread.
+ *
+ * When called inside an OpenMP parallel section, this will return the
+ * start an past-the-end indexes for the array range assigned to that thread.
+ * In other cases, the start index is 0, and the past-the-end index is n;
+ *
+ * parameters:
+ *   n    <-- size of array
+ *   s_id --> start index for the current thread
+ *   e_id --> past-the-end index for the current thread
+ *----------------------------------------------------------------------------*/
+
+static void
+_thread_range(cs_lnum_t   n,
+              cs_lnum_t  *s_id,
+              cs_lnum_t  *e_id)
+{
+#if defined(HAVE_OPENMP)
+  int t_id = omp_get_thread_num();
+  int n_t = omp_get_num_threads();
+  cs_lnum_t t_n = (n + n_t - 1) / n_t;
+  *s_id =  t_id    * t_n;
+  *e_id = (t_id+1) * t_n;
+  if (*s_id > n) *s_id = n;
+  if (*e_id > n) *e_id = n;
+#else
+  *s_id = 0;
+  *e_id = n;
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Sort an array "a" and apply the sort to its associated array "b" (local
  * numbering)
@@ -272,6 +322,244 @@ _get_face_extents(const cs_lnum_t          face_start,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Compute the min/max coordinates of each edge, in taking into account
+ * the tolerance of its vertices.
+ *
+ * parameters:
+ *   mesh    <-- pointer to a cs_join_mesh_t structure
+ *   edges   <-- pointer to a cs_join_edges_t structure
+ *   extents --> min. and max coordinates of edge bounding boxes
+ *---------------------------------------------------------------------------*/
+
+static void
+_get_edge_extents(const cs_join_mesh_t   *mesh,
+                  const cs_join_edges_t  *edges,
+                  cs_coord_t              extents[])
+{
+  const cs_join_vertex_t  *vertices = mesh->vertices;
+
+# pragma omp parallel for if (edges->n_edges > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < edges->n_edges; i++) {
+
+    const cs_join_vertex_t  *v1 = vertices + edges->def[2*i] - 1;
+    const cs_join_vertex_t  *v2 = vertices + edges->def[2*i+1] - 1;
+    cs_coord_t  *_extents = extents + 6*i;
+
+    for (int j = 0; j < 3; j++) {
+      _extents[j] = CS_MIN(v1->coord[j] - v1->tolerance,
+                           v2->coord[j] - v2->tolerance);
+      _extents[3 + j] = CS_MAX(v1->coord[j] + v1->tolerance,
+                               v2->coord[j] + v2->tolerance);
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check if two bounding boxes intersect.
+ *
+ * parameters:
+ *   e1 <-- min. and max coordinates of first box
+ *   e2 <-- min. and max coordinates of second box
+ *
+ * returns:
+ *   true if boxes intersect, false otherwise
+ *---------------------------------------------------------------------------*/
+
+static inline bool
+_extents_intersect(const cs_coord_t  e1[6],
+                   const cs_coord_t  e2[6])
+{
+  for (int j = 0; j < 3; j++) {
+    if (e1[j] > e2[3 + j] || e2[j] > e1[3 + j])
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the range of hash grid cells covered by a bounding box.
+ *
+ * parameters:
+ *   h       <-- pointer to edge hash structure
+ *   extents <-- min. and max coordinates of bounding box
+ *   c_min   --> min. cell coordinates
+ *   c_max   --> max. cell coordinates
+ *---------------------------------------------------------------------------*/
+
+static inline void
+_edge_hash_cell_range(const edge_hash_t  *h,
+                      const cs_coord_t    extents[6],
+                      int64_t             c_min[3],
+                      int64_t             c_max[3])
+{
+  const double  inv_size = 1./h->cell_size;
+
+  for (int j = 0; j < 3; j++) {
+    c_min[j] = (int64_t)floor((extents[j] - h->origin[j]) * inv_size);
+    c_max[j] = (int64_t)floor((extents[3 + j] - h->origin[j]) * inv_size);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the bucket id associated with a hash grid cell.
+ *
+ * parameters:
+ *   h <-- pointer to edge hash structure
+ *   c <-- cell coordinates
+ *
+ * returns:
+ *   associated bucket id
+ *---------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_edge_hash_key(const edge_hash_t  *h,
+               const int64_t       c[3])
+{
+  uint64_t  k =   ((uint64_t)c[0] * 73856093u)
+                ^ ((uint64_t)c[1] * 19349663u)
+                ^ ((uint64_t)c[2] * 83492791u);
+
+  return (cs_lnum_t)(k & (uint64_t)(h->mask));
+}
+
+/*----------------------------------------------------------------------------
+ * Build a uniform spatial hash on edge bounding boxes.
+ *
+ * The cell size is based on the mean edge box size, and increased if
+ * needed so that the total number of entries remains proportional to
+ * the number of edges.
+ *
+ * parameters:
+ *   n_edges <-- number of edges
+ *   extents <-- min. and max coordinates of edge bounding boxes
+ *
+ * returns:
+ *   pointer to newly created edge hash structure
+ *---------------------------------------------------------------------------*/
+
+static edge_hash_t *
+_edge_hash_create(cs_lnum_t          n_edges,
+                  const cs_coord_t   extents[])
+{
+  cs_lnum_t  i;
+  int64_t  c[3], c_min[3], c_max[3];
+
+  edge_hash_t  *h = NULL;
+
+  BFT_MALLOC(h, 1, edge_hash_t);
+
+  /* Grid origin and cell size */
+
+  double  s_size = 0.;
+
+  for (int j = 0; j < 3; j++)
+    h->origin[j] = DBL_MAX;
+
+  for (i = 0; i < n_edges; i++) {
+    const cs_coord_t  *_extents = extents + 6*i;
+    double  e_size = 0.;
+    for (int j = 0; j < 3; j++) {
+      h->origin[j] = CS_MIN(h->origin[j], _extents[j]);
+      e_size = CS_MAX(e_size, _extents[3 + j] - _extents[j]);
+    }
+    s_size += e_size;
+  }
+
+  h->cell_size = (n_edges > 0) ? s_size / n_edges : 1.;
+  if (h->cell_size <= 0.)
+    h->cell_size = 1.;
+
+  for (;;) {
+
+    double  n_entries = 0;
+
+    for (i = 0; i < n_edges; i++) {
+      _edge_hash_cell_range(h, extents + 6*i, c_min, c_max);
+      n_entries +=   (double)(c_max[0] - c_min[0] + 1)
+                   * (double)(c_max[1] - c_min[1] + 1)
+                   * (double)(c_max[2] - c_min[2] + 1);
+    }
+
+    if (n_entries <= 8.*n_edges)
+      break;
+
+    h->cell_size *= 2.;
+
+  }
+
+  /* Number of buckets */
+
+  cs_lnum_t  n_buckets = 1;
+  while (n_buckets < n_edges)
+    n_buckets *= 2;
+
+  h->mask = n_buckets - 1;
+
+  /* Count then fill bucket entries */
+
+  BFT_MALLOC(h->idx, n_buckets + 1, cs_lnum_t);
+
+  for (i = 0; i < n_buckets + 1; i++)
+    h->idx[i] = 0;
+
+  for (i = 0; i < n_edges; i++) {
+    _edge_hash_cell_range(h, extents + 6*i, c_min, c_max);
+    for (c[0] = c_min[0]; c[0] <= c_max[0]; c[0]++) {
+      for (c[1] = c_min[1]; c[1] <= c_max[1]; c[1]++) {
+        for (c[2] = c_min[2]; c[2] <= c_max[2]; c[2]++)
+          h->idx[_edge_hash_key(h, c) + 1] += 1;
+      }
+    }
+  }
+
+  for (i = 0; i < n_buckets; i++)
+    h->idx[i+1] += h->idx[i];
+
+  cs_lnum_t  *count = NULL;
+  BFT_MALLOC(count, n_buckets, cs_lnum_t);
+  BFT_MALLOC(h->lst, h->idx[n_buckets], cs_lnum_t);
+
+  for (i = 0; i < n_buckets; i++)
+    count[i] = h->idx[i];
+
+  for (i = 0; i < n_edges; i++) {
+    _edge_hash_cell_range(h, extents + 6*i, c_min, c_max);
+    for (c[0] = c_min[0]; c[0] <= c_max[0]; c[0]++) {
+      for (c[1] = c_min[1]; c[1] <= c_max[1]; c[1]++) {
+        for (c[2] = c_min[2]; c[2] <= c_max[2]; c[2]++)
+          h->lst[count[_edge_hash_key(h, c)]++] = i;
+      }
+    }
+  }
+
+  BFT_FREE(count);
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy an edge hash structure.
+ *
+ * parameters:
+ *   h <-> pointer to edge hash structure
+ *---------------------------------------------------------------------------*/
+
+static void
+_edge_hash_destroy(edge_hash_t  **h)
+{
+  edge_hash_t  *_h = *h;
+
+  if (_h == NULL)
+    return;
+
+  BFT_FREE(_h->idx);
+  BFT_FREE(_h->lst);
+  BFT_FREE(*h);
+}
+
 /*----------------------------------------------------------------------------
  * Compute the length of a segment between two vertices.
  *
@@ -391,6 +679,7 @@ _check_equiv(const cs_join_edges_t  *edges,
     cs_lnum_t  v1e2_id = edges->def[2*e2_id]-1;
     cs_lnum_t  v2e2_id = edges->def[2*e2_id+1]-1;
 
+#   pragma omp atomic
     _n_inter_tolerance_warnings++;
 
     if (verbosity > 3) {
@@ -2264,6 +2553,147 @@ _face_bbox_search_stats(const fvm_neighborhood_t  *face_neighborhood,
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
+/*----------------------------------------------------------------------------
+ * Compute intersections between edges for a range of an edge visibility
+ * list.
+ *
+ * parameters:
+ *   param         <-- set of user-defined parameters for the joining
+ *   edge_edge_vis <-- a pointer to a cs_join_gset_t structure
+ *   edges         <-- pointer to a structure defining edges
+ *   mesh          <-- pointer to the cs_join_mesh_t structure
+ *                     which has the face connectivity
+ *   s_id          <-- start id in edge_edge_vis elements
+ *   e_id          <-- past-the-end id in edge_edge_vis elements
+ *   merge_limit   <-- curvilinear abscissa limit for trivial intersections
+ *   parall_eps2   <-- parallel edges criterion
+ *   logfile       <-- handle to log file
+ *   count         <-> number of detected and trivial intersections
+ *   vtx_eset      <-> pointer to a structure dealing with vertex
+ *                     equivalences
+ *   inter_set     <-> pointer to a structure including data on edge
+ *                     intersections
+ *---------------------------------------------------------------------------*/
+
+static void
+_intersect_edge_range(cs_join_param_t          param,
+                      const cs_join_gset_t    *edge_edge_vis,
+                      const cs_join_edges_t   *edges,
+                      const cs_join_mesh_t    *mesh,
+                      cs_lnum_t                s_id,
+                      cs_lnum_t                e_id,
+                      double                   merge_limit,
+                      double                   parall_eps2,
+                      FILE                    *logfile,
+                      cs_lnum_t                count[2],
+                      cs_join_eset_t          *vtx_eset,
+                      cs_join_inter_set_t     *inter_set)
+{
+  cs_lnum_t  i, j, k;
+  double  abs_e1[2], abs_e2[2];
+
+  cs_lnum_t  n_inter = 0;
+  cs_lnum_t  n_inter_detected = 0, n_trivial_inter = 0;
+
+  for (i = s_id; i < e_id; i++) {
+
+    int  e1 = edge_edge_vis->g_elts[i]; /* This is a local number */
+
+    for (j = edge_edge_vis->index[i]; j < edge_edge_vis->index[i+1]; j++) {
+
+      int  e2 = edge_edge_vis->g_list[j]; /* This is a local number */
+      int  e1_id = (e1 < e2 ? e1 - 1 : e2 - 1);
+      int  e2_id = (e1 < e2 ? e2 - 1 : e1 - 1);
+
+      assert(e1 != e2);
+
+      /* Get edge-edge intersection */
+
+      if (param.icm == 1)
+        _edge_edge_3d_inter(mesh,
+                            edges,
+                            param.fraction,
+                            e1_id, abs_e1,
+                            e2_id, abs_e2,
+                            parall_eps2,
+                            param.verbosity,
+                            logfile,
+                            &n_inter);
+
+      else if (param.icm == 2)
+        _new_edge_edge_3d_inter(mesh,
+                                edges,
+                                param.fraction,
+                                e1_id, abs_e1,
+                                e2_id, abs_e2,
+                                parall_eps2,
+                                param.verbosity,
+                                logfile,
+                                &n_inter);
+
+      n_inter_detected += n_inter;
+
+#if 0 && defined(DEBUG) && !defined(NDEBUG)
+      if (param.verbosity > 3 && n_inter > 0) {
+
+        cs_lnum_t  v1e1 = edges->def[2*e1_id] - 1;
+        cs_lnum_t  v2e1 = edges->def[2*e1_id+1] - 1;
+        cs_lnum_t  v1e2 = edges->def[2*e2_id] - 1;
+        cs_lnum_t  v2e2 = edges->def[2*e2_id+1] - 1;
+
+        fprintf(logfile,
+                "\n Intersection: "
+                "E1 (%llu) [%llu - %llu] / E2 (%llu) [%llu - %llu]\n",
+                (unsigned long long)edges->gnum[e1_id],
+                (unsigned long long)mesh->vertices[v1e1].gnum,
+                (unsigned long long)mesh->vertices[v2e1].gnum,
+                (unsigned long long)edges->gnum[e2_id],
+                (unsigned long long)mesh->vertices[v1e2].gnum,
+                (unsigned long long)mesh->vertices[v2e2].gnum);
+        fprintf(logfile, "  n_inter: %d ", n_inter);
+        for (k = 0; k < n_inter; k++)
+          fprintf(logfile,
+                  " (%d) - s_e1 = %g, s_e2 = %g", k, abs_e1[k], abs_e2[k]);
+        fflush(logfile);
+      }
+#endif
+
+      for (k = 0; k < n_inter; k++) {
+
+        bool  trivial = false;
+
+        if (abs_e1[k] <= merge_limit || abs_e1[k] >= 1.0 - merge_limit)
+          if (abs_e2[k] <= merge_limit || abs_e2[k] >= 1.0 - merge_limit)
+            trivial = true;
+
+        if (trivial) {
+
+          _add_trivial_equiv(e1_id,
+                             e2_id,
+                             abs_e1[k],
+                             abs_e2[k],
+                             edges,
+                             vtx_eset);
+
+          n_trivial_inter += 1;
+
+        }
+        else {
+
+          _add_inter(e1_id, e2_id, abs_e1[k], abs_e2[k], inter_set);
+
+        }
+
+      } /* End of loop on detected edge_edge_vis */
+
+    } /* End of loop on entities intersecting elements */
+
+  } /* End of loop on elements in intersection list */
+
+  count[0] = n_inter_detected;
+  count[1] = n_trivial_inter;
+}
+
 /*============================================================================
  * Public function definitions
  *===========================================================================*/
@@ -3459,11 +3889,9 @@ cs_join_intersect_edges(cs_join_param_t         param,
                         cs_join_eset_t        **vtx_eset,
                         cs_join_inter_set_t   **inter_set)
 {
-  cs_lnum_t  i, j, k;
-  double  abs_e1[2], abs_e2[2];
+  cs_lnum_t  i;
 
   cs_join_type_t  join_type = CS_JOIN_TYPE_CONFORMING;
-  cs_lnum_t  n_inter = 0;
   cs_lnum_t  n_inter_detected = 0, n_real_inter = 0, n_trivial_inter = 0;
   cs_gnum_t  n_g_inter[3] = {0, 0, 0};
   cs_join_inter_set_t  *_inter_set = NULL;
@@ -3490,111 +3918,109 @@ cs_join_intersect_edges(cs_join_param_t         param,
 
   _n_inter_tolerance_warnings = 0;
 
-  _inter_set = cs_join_inter_set_create(50);
-  _vtx_eset = cs_join_eset_create(30);
-
-  /* Loop on edges */
+  /* Loop on edges, using thread-local structures which are then
+     concatenated in thread order, so that results do not depend
+     on the number of threads (log output is serialized if verbose). */
 
-  for (i = 0; i < edge_edge_vis->n_elts; i++) {
+  int n_threads = cs_glob_n_threads;
+  if (param.verbosity > 3 || edge_edge_vis->n_elts < CS_THR_MIN)
+    n_threads = 1;
 
-    int  e1 = edge_edge_vis->g_elts[i]; /* This is a local number */
+  cs_join_inter_set_t  **t_inter_set = NULL;
+  cs_join_eset_t  **t_vtx_eset = NULL;
+  cs_lnum_t  *t_count = NULL;
 
-    for (j = edge_edge_vis->index[i]; j < edge_edge_vis->index[i+1]; j++) {
+  BFT_MALLOC(t_inter_set, n_threads, cs_join_inter_set_t *);
+  BFT_MALLOC(t_vtx_eset, n_threads, cs_join_eset_t *);
+  BFT_MALLOC(t_count, 2*n_threads, cs_lnum_t);
 
-      int  e2 = edge_edge_vis->g_list[j]; /* This is a local number */
-      int  e1_id = (e1 < e2 ? e1 - 1 : e2 - 1);
-      int  e2_id = (e1 < e2 ? e2 - 1 : e1 - 1);
-
-      assert(e1 != e2);
-
-      /* Get edge-edge intersection */
-
-      if (param.icm == 1)
-        _edge_edge_3d_inter(mesh,
-                            edges,
-                            param.fraction,
-                            e1_id, abs_e1,
-                            e2_id, abs_e2,
-                            parall_eps2,
-                            param.verbosity,
-                            logfile,
-                            &n_inter);
-
-      else if (param.icm == 2)
-        _new_edge_edge_3d_inter(mesh,
-                                edges,
-                                param.fraction,
-                                e1_id, abs_e1,
-                                e2_id, abs_e2,
-                                parall_eps2,
-                                param.verbosity,
-                                logfile,
-                                &n_inter);
-
-      n_inter_detected += n_inter;
-
-#if 0 && defined(DEBUG) && !defined(NDEBUG)
-      if (param.verbosity > 3 && n_inter > 0) {
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+    t_inter_set[t_id] = NULL;
+    t_vtx_eset[t_id] = NULL;
+    t_count[2*t_id] = 0;
+    t_count[2*t_id + 1] = 0;
+  }
 
-        cs_lnum_t  v1e1 = edges->def[2*e1_id] - 1;
-        cs_lnum_t  v2e1 = edges->def[2*e1_id+1] - 1;
-        cs_lnum_t  v1e2 = edges->def[2*e2_id] - 1;
-        cs_lnum_t  v2e2 = edges->def[2*e2_id+1] - 1;
+# pragma omp parallel num_threads(n_threads)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_range(edge_edge_vis->n_elts, &s_id, &e_id);
 
-        fprintf(logfile,
-                "\n Intersection: "
-                "E1 (%llu) [%llu - %llu] / E2 (%llu) [%llu - %llu]\n",
-                (unsigned long long)edges->gnum[e1_id],
-                (unsigned long long)mesh->vertices[v1e1].gnum,
-                (unsigned long long)mesh->vertices[v2e1].gnum,
-                (unsigned long long)edges->gnum[e2_id],
-                (unsigned long long)mesh->vertices[v1e2].gnum,
-                (unsigned long long)mesh->vertices[v2e2].gnum);
-        fprintf(logfile, "  n_inter: %d ", n_inter);
-        for (k = 0; k < n_inter; k++)
-          fprintf(logfile,
-                  " (%d) - s_e1 = %g, s_e2 = %g", k, abs_e1[k], abs_e2[k]);
-        fflush(logfile);
-      }
+#if defined(HAVE_OPENMP)
+    int t_id = omp_get_thread_num();
+#else
+    int t_id = 0;
 #endif
 
-      for (k = 0; k < n_inter; k++) {
-
-        bool  trivial = false;
-
-        if (abs_e1[k] <= merge_limit || abs_e1[k] >= 1.0 - merge_limit)
-          if (abs_e2[k] <= merge_limit || abs_e2[k] >= 1.0 - merge_limit)
-            trivial = true;
+    t_inter_set[t_id] = cs_join_inter_set_create(50);
+    t_vtx_eset[t_id] = cs_join_eset_create(30);
+
+    _intersect_edge_range(param,
+                          edge_edge_vis,
+                          edges,
+                          mesh,
+                          s_id,
+                          e_id,
+                          merge_limit,
+                          parall_eps2,
+                          logfile,
+                          t_count + 2*t_id,
+                          t_vtx_eset[t_id],
+                          t_inter_set[t_id]);
+  }
 
-        if (trivial) {
+  _inter_set = t_inter_set[0];
+  _vtx_eset = t_vtx_eset[0];
 
-          _add_trivial_equiv(e1_id,
-                             e2_id,
-                             abs_e1[k],
-                             abs_e2[k],
-                             edges,
-                             _vtx_eset);
+  for (int t_id = 0; t_id < n_threads; t_id++) {
 
-          n_trivial_inter += 1;
+    n_inter_detected += t_count[2*t_id];
+    n_trivial_inter += t_count[2*t_id + 1];
 
-        }
-        else {
+    if (t_id == 0 || t_inter_set[t_id] == NULL)
+      continue;
 
-          if (join_type == CS_JOIN_TYPE_CONFORMING)
-            join_type = CS_JOIN_TYPE_NON_CONFORMING;
+    cs_join_inter_set_t  *_t_inter_set = t_inter_set[t_id];
+    cs_join_eset_t  *_t_vtx_eset = t_vtx_eset[t_id];
 
-          _add_inter(e1_id, e2_id, abs_e1[k], abs_e2[k], _inter_set);
+    if (_t_inter_set->n_inter > 0) {
+      cs_lnum_t n = _inter_set->n_inter + _t_inter_set->n_inter;
+      if (n > _inter_set->n_max_inter) {
+        _inter_set->n_max_inter = n;
+        BFT_REALLOC(_inter_set->inter_lst, 2*n, cs_join_inter_t);
+      }
+      memcpy(_inter_set->inter_lst + 2*_inter_set->n_inter,
+             _t_inter_set->inter_lst,
+             2*_t_inter_set->n_inter*sizeof(cs_join_inter_t));
+      _inter_set->n_inter = n;
+    }
 
-        }
+    if (_t_vtx_eset->n_equiv > 0) {
+      cs_lnum_t n = _vtx_eset->n_equiv + _t_vtx_eset->n_equiv;
+      if (n > _vtx_eset->n_max_equiv) {
+        _vtx_eset->n_max_equiv = n;
+        BFT_REALLOC(_vtx_eset->equiv_couple, 2*n, cs_lnum_t);
+      }
+      memcpy(_vtx_eset->equiv_couple + 2*_vtx_eset->n_equiv,
+             _t_vtx_eset->equiv_couple,
+             2*_t_vtx_eset->n_equiv*sizeof(cs_lnum_t));
+      _vtx_eset->n_equiv = n;
+    }
 
-      } /* End of loop on detected edge_edge_vis */
+    cs_join_inter_set_destroy(&_t_inter_set);
+    cs_join_eset_destroy(&_t_vtx_eset);
 
-    } /* End of loop on entities intersecting elements */
+  }
 
-  } /* End of loop on elements in intersection list */
+  BFT_FREE(t_inter_set);
+  BFT_FREE(t_vtx_eset);
+  BFT_FREE(t_count);
 
   n_real_inter = n_inter_detected - n_trivial_inter;
 
+  if (_inter_set->n_inter > 0)
+    join_type = CS_JOIN_TYPE_NON_CONFORMING;
+
   if (n_inter_detected == 0)
     join_type = CS_JOIN_TYPE_NULL;
 
@@ -3879,7 +4305,9 @@ cs_join_intersect_face_to_edge(const cs_join_mesh_t   *mesh,
 
   } /* End of loop on bounding boxes */
 
-  /* Create edge_visib. Unfold face_visib */
+  /* Create edge_visib. Unfold face_visib, keeping only edge couples whose
+     bounding boxes intersect. For faces with many visible edges, candidates
+     are found through a uniform spatial hash on edge bounding boxes. */
 
   for (i = 0; i < face_visib->n_elts; i++) {
     j = face_visib->g_elts[i];
@@ -3888,89 +4316,123 @@ cs_join_intersect_face_to_edge(const cs_join_mesh_t   *mesh,
 
   edge_visib = cs_join_gset_create(size);
 
-  edge_id = 0;
-
-  for (i = 0; i < face_visib->n_elts; i++) {
+  size_max = CS_MAX(edges->n_edges, 1);
 
-    cs_lnum_t  face_id = face_visib->g_elts[i];
-    cs_lnum_t  start = face2edge_idx[face_id];
-    cs_lnum_t  end = face2edge_idx[face_id+1];
+  cs_lnum_t  list_size = 0, list_size_max = CS_MAX(4*size, 16);
+  cs_lnum_t  *tag = NULL, *stamp = NULL;
+  cs_coord_t  *edge_extents = NULL;
+  edge_hash_t  *edge_hash = NULL;
 
-    size = 0;
-    for (j = face_visib->index[i]; j < face_visib->index[i+1]; j++) {
+  BFT_MALLOC(edge_visib->g_list, list_size_max, cs_gnum_t);
+  BFT_MALLOC(tmp, size_max, cs_gnum_t);
+  BFT_MALLOC(tag, edges->n_edges, cs_lnum_t);
+  BFT_MALLOC(stamp, edges->n_edges, cs_lnum_t);
+  BFT_MALLOC(edge_extents, 6*edges->n_edges, cs_coord_t);
 
-      cs_lnum_t  adj_id = face_visib->g_list[j];
+  for (i = 0; i < edges->n_edges; i++) {
+    tag[i] = -1;
+    stamp[i] = -1;
+  }
 
-      size += face2edge_idx[adj_id+1] - face2edge_idx[adj_id];
+  _get_edge_extents(mesh, edges, edge_extents);
 
-    }
+  /* Build list */
 
-    size_max = CS_MAX(size, size_max);
+  edge_id = 0;
 
-    for (j = start; j < end; j++) {
+  for (i = 0; i < face_visib->n_elts; i++) {
 
-      edge_visib->g_elts[edge_id] = face2edge_lst[j];
-      edge_visib->index[edge_id+1] = size;
-      edge_id++;
+    cs_lnum_t  _count = 0;
+    cs_lnum_t  face_id = face_visib->g_elts[i];
+    cs_lnum_t  b_start = face_visib->index[i];
+    cs_lnum_t  b_end =  face_visib->index[i+1];
 
-    }
+    /* Unfold face->edge connectivity for the current list of bounding boxes,
+       tagging visible edges (each only once) */
 
-  } /* End of loop on bounding boxes */
+    for (j = b_start; j < b_end; j++) {
 
-  assert(edge_id == edge_visib->n_elts);
+      cs_lnum_t  adj_face_id = face_visib->g_list[j];
 
-  /* Build index */
+      for (k = face2edge_idx[adj_face_id];
+           k < face2edge_idx[adj_face_id+1];
+           k++) {
+        cs_lnum_t  adj_edge_id = face2edge_lst[k] - 1;
+        if (tag[adj_edge_id] != i) {
+          tag[adj_edge_id] = i;
+          tmp[_count++] = face2edge_lst[k];
+        }
+      }
 
-  for (i = 0; i < edge_visib->n_elts; i++)
-    edge_visib->index[i+1] += edge_visib->index[i];
+    }
 
-  BFT_MALLOC(edge_visib->g_list,
-             edge_visib->index[edge_visib->n_elts],
-             cs_gnum_t);
+    if (_count > _EDGE_HASH_THRESHOLD && edge_hash == NULL)
+      edge_hash = _edge_hash_create(edges->n_edges, edge_extents);
 
-  BFT_MALLOC(tmp, size_max, cs_gnum_t);
+    for (j = face2edge_idx[face_id];
+         j < face2edge_idx[face_id+1];
+         j++, edge_id++) {
 
-  /* Build list */
+      cs_lnum_t  e_id = face2edge_lst[j] - 1;
+      const cs_coord_t  *e_extents = edge_extents + 6*e_id;
 
-  edge_id = 0;
+      if (list_size + _count > list_size_max) {
+        while (list_size + _count > list_size_max)
+          list_size_max *= 2;
+        BFT_REALLOC(edge_visib->g_list, list_size_max, cs_gnum_t);
+      }
 
-  for (i = 0; i < face_visib->n_elts; i++) {
+      edge_visib->g_elts[edge_id] = face2edge_lst[j];
 
-    cs_lnum_t  _count = 0;
-    cs_lnum_t  face_id = face_visib->g_elts[i];
-    cs_lnum_t  n_edges = face2edge_idx[face_id+1] - face2edge_idx[face_id];
-    cs_lnum_t  b_start = face_visib->index[i];
-    cs_lnum_t  b_end =  face_visib->index[i+1];
+      if (_count <= _EDGE_HASH_THRESHOLD) {
 
-    /* Unfold face->edge connectivity for the current list of bounding boxes */
+        for (k = 0; k < _count; k++) {
+          if (_extents_intersect(e_extents, edge_extents + 6*(tmp[k]-1)))
+            edge_visib->g_list[list_size++] = tmp[k];
+        }
 
-    for (j = b_start; j < b_end; j++) {
+      }
+      else {
 
-      cs_lnum_t  adj_face_id = face_visib->g_list[j];
-      cs_lnum_t  n_adj_edges =  face2edge_idx[adj_face_id+1]
-                              - face2edge_idx[adj_face_id];
+        int64_t  c[3], c_min[3], c_max[3];
 
-      shift = face2edge_idx[adj_face_id];
+        _edge_hash_cell_range(edge_hash, e_extents, c_min, c_max);
 
-      for (k = 0; k < n_adj_edges; k++)
-        tmp[_count + k] = face2edge_lst[shift + k];
-      _count += n_adj_edges;
+        for (c[0] = c_min[0]; c[0] <= c_max[0]; c[0]++) {
+          for (c[1] = c_min[1]; c[1] <= c_max[1]; c[1]++) {
+            for (c[2] = c_min[2]; c[2] <= c_max[2]; c[2]++) {
 
-    }
+              cs_lnum_t  b_id = _edge_hash_key(edge_hash, c);
 
-    for (j = 0; j < n_edges; j++, edge_id++) {
+              for (k = edge_hash->idx[b_id]; k < edge_hash->idx[b_id+1]; k++) {
+                cs_lnum_t  c_id = edge_hash->lst[k];
+                if (   tag[c_id] == i && stamp[c_id] != edge_id
+                    && _extents_intersect(e_extents, edge_extents + 6*c_id)) {
+                  stamp[c_id] = edge_id;
+                  edge_visib->g_list[list_size++] = c_id + 1;
+                }
+              }
 
-      assert(_count == edge_visib->index[edge_id+1]-edge_visib->index[edge_id]);
+            }
+          }
+        }
 
-      shift = edge_visib->index[edge_id];
+      }
 
-      for (k = 0; k < _count; k++)
-        edge_visib->g_list[shift + k] = tmp[k];
+      edge_visib->index[edge_id+1] = list_size;
 
     } /* End of loop on edges */
 
   } /* End of loop on bounding boxes */
 
+  assert(edge_id == edge_visib->n_elts);
+
+  _edge_hash_destroy(&edge_hash);
+
+  BFT_FREE(tag);
+  BFT_FREE(stamp);
+  BFT_FREE(edge_extents);
+
   /* Free memory */
 
   BFT_FREE(face2edge_idx);
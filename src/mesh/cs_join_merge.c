@@ -1807,20 +1807,15 @@ _merge_vertices(cs_join_param_t    param,
                 cs_lnum_t          n_vertices,
                 cs_join_vertex_t   vertices[])
 {
-  cs_lnum_t  i, j, k, list_size;
-  cs_join_vertex_t  merged_vertex;
-  bool  ok;
+  cs_lnum_t  i;
 
   cs_lnum_t  max_list_size = 0, vv_max_list_size = 0;
   cs_lnum_t  n_transitivity = 0;
-  int        n_loops = 0, n_max_loops = 0;
+  int        n_max_loops = 0;
 
   cs_join_gset_t  *equiv_gnum = NULL;
-  cs_real_t  *rbuf = NULL;
-  cs_lnum_t  *merge_index = NULL, *ibuf = NULL;
+  cs_lnum_t  *merge_index = NULL;
   cs_gnum_t  *merge_list = NULL, *merge_ref_elts = NULL;
-  cs_gnum_t  *list = NULL;
-  cs_join_vertex_t  *set = NULL, *vbuf = NULL;
   FILE  *logfile = cs_glob_join_log;
 
   const int  verbosity = param.verbosity;
@@ -1867,7 +1862,7 @@ _merge_vertices(cs_join_param_t    param,
   merge_ref_elts = merge_set->g_elts;
 
   for (i = 0; i < merge_set->n_elts; i++) {
-    list_size = merge_index[i+1] - merge_index[i];
+    cs_lnum_t  list_size = merge_index[i+1] - merge_index[i];
     max_list_size = CS_MAX(max_list_size, list_size);
   }
   vv_max_list_size = ((max_list_size-1)*max_list_size)/2;
@@ -1887,96 +1882,121 @@ _merge_vertices(cs_join_param_t    param,
                  (unsigned long long)g_max_list_size);
   }
 
-  /* Temporary buffers allocation */
+  /* Merge set of vertices; sets are disjoint, so they may be handled
+     by different threads (log output is only done in serial mode) */
 
-  BFT_MALLOC(ibuf, 4*max_list_size + vv_max_list_size, cs_lnum_t);
-  BFT_MALLOC(rbuf, vv_max_list_size, cs_real_t);
-  BFT_MALLOC(vbuf, 2*max_list_size, cs_join_vertex_t);
-  BFT_MALLOC(list, max_list_size, cs_gnum_t);
-  BFT_MALLOC(set, max_list_size, cs_join_vertex_t);
+  const int  n_threads = (verbosity > 3) ? 1 : cs_glob_n_threads;
 
-  /* Merge set of vertices */
+# pragma omp parallel if (merge_set->n_elts > CS_THR_MIN) \
+                      num_threads(n_threads)                 \
+                      reduction(+:n_transitivity) reduction(max:n_max_loops)
+  {
+    /* Temporary buffers allocation */
 
-  for (i = 0; i < merge_set->n_elts; i++) {
+    cs_real_t  *rbuf = NULL;
+    cs_lnum_t  *ibuf = NULL;
+    cs_gnum_t  *list = NULL;
+    cs_join_vertex_t  *set = NULL, *vbuf = NULL;
 
-    list_size = merge_index[i+1] - merge_index[i];
+    BFT_MALLOC(ibuf, 4*max_list_size + vv_max_list_size, cs_lnum_t);
+    BFT_MALLOC(rbuf, vv_max_list_size, cs_real_t);
+    BFT_MALLOC(vbuf, 2*max_list_size, cs_join_vertex_t);
+    BFT_MALLOC(list, max_list_size, cs_gnum_t);
+    BFT_MALLOC(set, max_list_size, cs_join_vertex_t);
 
-    if (list_size > 1) {
+#   pragma omp for schedule(dynamic, CS_CL_SIZE)
+    for (i = 0; i < merge_set->n_elts; i++) {
 
-      for (j = 0, k = merge_index[i]; k < merge_index[i+1]; k++, j++) {
-        list[j] = merge_list[k];
-        set[j] = vertices[list[j]];
-      }
+      cs_lnum_t  list_size = merge_index[i+1] - merge_index[i];
 
-      /* Define the resulting cs_join_vertex_t structure of the merge */
+      if (list_size > 1) {
+
+        cs_lnum_t  j, k;
+
+        for (j = 0, k = merge_index[i]; k < merge_index[i+1]; k++, j++) {
+          list[j] = merge_list[k];
+          set[j] = vertices[list[j]];
+        }
 
-      merged_vertex = _compute_merged_vertex(list_size, set);
+        /* Define the resulting cs_join_vertex_t structure of the merge */
 
-      /* Check if the vertex resulting of the merge is in the tolerance
-         for each vertex of the list */
+        cs_join_vertex_t  merged_vertex
+          = _compute_merged_vertex(list_size, set);
 
-      ok = _is_in_tolerance(list_size, set, merged_vertex);
+        /* Check if the vertex resulting of the merge is in the tolerance
+           for each vertex of the list */
+
+        bool  ok = _is_in_tolerance(list_size, set, merged_vertex);
 
 #if CS_JOIN_MERGE_TOL_REDUC
-      if (ok == false) { /*
-                            The merged vertex is not in the tolerance of
-                            each vertex. This is a transitivity problem.
-                            We have to split the initial set into several
-                            subsets.
-                         */
-
-        n_transitivity++;
-
-        /* Display information on vertices to merge */
-        if (verbosity > 3) {
-          fprintf(logfile,
-                  "\n Begin merge for ref. elt: %llu - list_size: %ld\n",
-                  (unsigned long long)merge_ref_elts[i],
-                  (long)(merge_index[i+1] - merge_index[i]));
-          for (j = 0; j < list_size; j++) {
-            fprintf(logfile, "%9llu -", (unsigned long long)list[j]);
-            cs_join_mesh_dump_vertex(logfile, set[j]);
+        if (ok == false) { /*
+                              The merged vertex is not in the tolerance of
+                              each vertex. This is a transitivity problem.
+                              We have to split the initial set into several
+                              subsets.
+                           */
+
+          n_transitivity++;
+
+          /* Display information on vertices to merge */
+          if (verbosity > 3) {
+            fprintf(logfile,
+                    "\n Begin merge for ref. elt: %llu - list_size: %ld\n",
+                    (unsigned long long)merge_ref_elts[i],
+                    (long)(merge_index[i+1] - merge_index[i]));
+            for (j = 0; j < list_size; j++) {
+              fprintf(logfile, "%9llu -", (unsigned long long)list[j]);
+              cs_join_mesh_dump_vertex(logfile, set[j]);
+            }
+            fprintf(logfile, "\nMerged vertex rejected:\n");
+            cs_join_mesh_dump_vertex(logfile, merged_vertex);
           }
-          fprintf(logfile, "\nMerged vertex rejected:\n");
-          cs_join_mesh_dump_vertex(logfile, merged_vertex);
-        }
 
-        n_loops = _solve_transitivity(param,
-                                      list_size,
-                                      set,
-                                      vbuf,
-                                      rbuf,
-                                      ibuf);
-
-        for (j = 0; j < list_size; j++)
-          vertices[list[j]] = set[j];
-
-        n_max_loops = CS_MAX(n_max_loops, n_loops);
-
-        if (verbosity > 3) { /* Display information */
-          fprintf(logfile, "\n  %3d loop(s) to get consistent subsets\n",
-                  n_loops);
-          fprintf(logfile, "\n End merge for ref. elt: %llu - list_size: %ld\n",
-                  (unsigned long long)merge_ref_elts[i],
-                  (long)(merge_index[i+1] - merge_index[i]));
-          for (j = 0; j < list_size; j++) {
-            fprintf(logfile, "%7llu -", (unsigned long long)list[j]);
-            cs_join_mesh_dump_vertex(logfile, vertices[list[j]]);
+          int  n_loops = _solve_transitivity(param,
+                                        list_size,
+                                        set,
+                                        vbuf,
+                                        rbuf,
+                                        ibuf);
+
+          for (j = 0; j < list_size; j++)
+            vertices[list[j]] = set[j];
+
+          n_max_loops = CS_MAX(n_max_loops, n_loops);
+
+          if (verbosity > 3) { /* Display information */
+            fprintf(logfile, "\n  %3d loop(s) to get consistent subsets\n",
+                    n_loops);
+            fprintf(logfile,
+                    "\n End merge for ref. elt: %llu - list_size: %ld\n",
+                    (unsigned long long)merge_ref_elts[i],
+                    (long)(merge_index[i+1] - merge_index[i]));
+            for (j = 0; j < list_size; j++) {
+              fprintf(logfile, "%7llu -", (unsigned long long)list[j]);
+              cs_join_mesh_dump_vertex(logfile, vertices[list[j]]);
+            }
+            fprintf(logfile, "\n");
           }
-          fprintf(logfile, "\n");
-        }
 
-      }
-      else /* New vertex data for the sub-elements */
+        }
+        else /* New vertex data for the sub-elements */
 
 #endif /* CS_JOIN_MERGE_TOL_REDUC */
 
-        for (j = 0; j < list_size; j++)
-          vertices[list[j]] = merged_vertex;
+          for (j = 0; j < list_size; j++)
+            vertices[list[j]] = merged_vertex;
 
-    } /* list_size > 1 */
+      } /* list_size > 1 */
 
-  } /* End of loop on potential merges */
+    } /* End of loop on potential merges */
+
+    BFT_FREE(ibuf);
+    BFT_FREE(rbuf);
+    BFT_FREE(vbuf);
+    BFT_FREE(list);
+    BFT_FREE(set);
+
+  } /* End of parallel section */
 
   /* Apply merge to vertex initially identical */
 
@@ -2008,7 +2028,7 @@ _merge_vertices(cs_join_param_t    param,
       cs_lnum_t  end = equiv_gnum->index[i+1];
       cs_lnum_t  ref_id = equiv_gnum->g_elts[i];
 
-      for (j = start; j < end; j++)
+      for (cs_lnum_t j = start; j < end; j++)
         vertices[equiv_gnum->g_list[j]] = vertices[ref_id];
 
     }
@@ -2032,12 +2052,6 @@ _merge_vertices(cs_join_param_t    param,
 
   /* Free memory */
 
-  BFT_FREE(ibuf);
-  BFT_FREE(vbuf);
-  BFT_FREE(rbuf);
-  BFT_FREE(set);
-  BFT_FREE(list);
-
   cs_join_gset_destroy(&equiv_gnum);
 }
 
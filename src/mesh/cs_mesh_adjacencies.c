@@ -331,6 +331,74 @@ _update_v2v_lst(int               n_vf,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the range of positions related to an element in an adjacency
+ *        relying either on a stride or on an index
+ *
+ * \param[in]  adj      pointer to a cs_adjacency_t structure
+ * \param[in]  id       id of the element
+ * \param[out] start    position of the first related entry
+ * \param[out] end      position after the last related entry
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_adjacency_range(const cs_adjacency_t   *adj,
+                 cs_lnum_t               id,
+                 cs_lnum_t              *start,
+                 cs_lnum_t              *end)
+{
+  if (adj->stride > 0)
+    *start = adj->stride*id, *end = adj->stride*(id+1);
+  else
+    *start = adj->idx[id], *end = adj->idx[id+1];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Gather the C elements reached from an A element through the
+ *        adjacencies A -> B and B -> C. The list is sorted and duplicated
+ *        entries are removed.
+ *
+ * \param[in]      a_id    id of the A element
+ * \param[in]      a2b     adjacency A -> B
+ * \param[in]      b2c     adjacency B -> C
+ * \param[in, out] buf     buffer large enough to store all the candidates
+ *
+ * \return the number of distinct C elements stored in buf
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_compose_row(cs_lnum_t               a_id,
+             const cs_adjacency_t   *a2b,
+             const cs_adjacency_t   *b2c,
+             cs_lnum_t               buf[])
+{
+  cs_lnum_t  sa, ea, sb, eb;
+  cs_lnum_t  n = 0;
+
+  _adjacency_range(a2b, a_id, &sa, &ea);
+  for (cs_lnum_t ja = sa; ja < ea; ja++) {
+    _adjacency_range(b2c, a2b->ids[ja], &sb, &eb);
+    for (cs_lnum_t jb = sb; jb < eb; jb++)
+      buf[n++] = b2c->ids[jb];
+  }
+
+  if (n < 2)
+    return n;
+
+  cs_sort_shell(0, n, buf);
+
+  cs_lnum_t  n_u = 1;
+  for (cs_lnum_t j = 1; j < n; j++)
+    if (buf[j] != buf[n_u-1])
+      buf[n_u++] = buf[j];
+
+  return n_u;
+}
+
 /*----------------------------------------------------------------------------
  * Update cells -> vertices connectivity
  *
@@ -765,7 +833,8 @@ cs_adjacency_destroy(cs_adjacency_t   **p_adj)
  * \brief   Create a new cs_adjacency_t structure from the composition of
  *          two cs_adjacency_t structures: (1) A -> B and (2) B -> C
  *          The resulting structure describes A -> C. It does not rely on a
- *          stride and has no sgn member.
+ *          stride and has no sgn member. The list of C elements related to
+ *          each A element is sorted.
  *
  * \param[in]  n_c_elts  number of elements in C set
  * \param[in]  a2b       adjacency A -> B
@@ -780,206 +849,87 @@ cs_adjacency_compose(int                      n_c_elts,
                      const cs_adjacency_t    *a2b,
                      const cs_adjacency_t    *b2c)
 {
-  cs_lnum_t  *ctag = NULL;
-  cs_adjacency_t  *a2c = cs_adjacency_create(0, -1, a2b->n_elts);
-
-  BFT_MALLOC(ctag, n_c_elts, cs_lnum_t);
-# pragma omp parallel for if (n_c_elts > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_c_elts; i++) ctag[i] = -1;
-
-  /* Build index */
-  /* ----------- */
-
-  if (a2b->stride < 1 && b2c->stride < 1) {
-
-    /* The two adjacencies rely on an indexed array */
-    for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
-
-      for (cs_lnum_t ja = a2b->idx[a_id]; ja < a2b->idx[a_id+1]; ja++) {
-
-        const cs_lnum_t  b_id = a2b->ids[ja];
-        for (cs_lnum_t jb = b2c->idx[b_id]; jb < b2c->idx[b_id+1]; jb++) {
-
-          const cs_lnum_t  c_id = b2c->ids[jb];
-          if (ctag[c_id] != a_id) { /* Not tagged yet */
-            ctag[c_id] = a_id;
-            a2c->idx[a_id+1] += 1;
-          }
-
-        } /* End of loop on C elements */
-      } /* End of loop on B elements */
-    } /* End of loop on A elements */
-
-  }
-  else if (a2b->stride > 0 && b2c->stride < 1) {
-
-    for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
-
-      for (int ka = 0; ka < a2b->stride; ka++) {
-
-        const cs_lnum_t  b_id = a2b->ids[a2b->stride*a_id + ka];
-        for (cs_lnum_t jb = b2c->idx[b_id]; jb < b2c->idx[b_id+1]; jb++) {
-
-          const cs_lnum_t  c_id = b2c->ids[jb];
-          if (ctag[c_id] != a_id) { /* Not tagged yet */
-            ctag[c_id] = a_id;
-            a2c->idx[a_id+1] += 1;
-          }
+  CS_UNUSED(n_c_elts); /* Only a thread-local buffer is used */
 
-        } /* End of loop on C elements */
-      } /* End of loop on B elements */
-    } /* End of loop on A elements */
+  const cs_lnum_t  n_a_elts = a2b->n_elts;
 
-  }
-  else if (a2b->stride < 1 && b2c->stride > 0) {
-
-    for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
+  cs_adjacency_t  *a2c = cs_adjacency_create(0, -1, n_a_elts);
 
-      for (cs_lnum_t ja = a2b->idx[a_id]; ja < a2b->idx[a_id+1]; ja++) {
+  /* Max. number of candidates related to an A element. This is the size of
+     the thread-local buffers (no array of size n_c_elts is needed) */
 
-        const cs_lnum_t  b_id = a2b->ids[ja];
-        for (int kb = 0; kb < b2c->stride; kb++) {
+  cs_lnum_t  n_max_cands = 0;
 
-          const cs_lnum_t  c_id = b2c->ids[b2c->stride*b_id + kb];
-          if (ctag[c_id] != a_id) { /* Not tagged yet */
-            ctag[c_id] = a_id;
-            a2c->idx[a_id+1] += 1;
-          }
+# pragma omp parallel for reduction(max:n_max_cands) \
+  if (n_a_elts > CS_THR_MIN)
+  for (cs_lnum_t a_id = 0; a_id < n_a_elts; a_id++) {
 
-        } /* End of loop on C elements */
-      } /* End of loop on B elements */
-    } /* End of loop on A elements */
+    cs_lnum_t  sa, ea, sb, eb;
+    cs_lnum_t  n_cands = 0;
 
-  }
-  else {
+    _adjacency_range(a2b, a_id, &sa, &ea);
+    for (cs_lnum_t ja = sa; ja < ea; ja++) {
+      _adjacency_range(b2c, a2b->ids[ja], &sb, &eb);
+      n_cands += eb - sb;
+    }
 
-    assert(a2b->stride > 0 && b2c->stride > 0);
-    for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
+    if (n_cands > n_max_cands) n_max_cands = n_cands;
 
-      for (int ka = 0; ka < a2b->stride; ka++) {
+  } /* Loop on A elements */
 
-        const cs_lnum_t  b_id = a2b->ids[a2b->stride*a_id + ka];
-        for (int kb = 0; kb < b2c->stride; kb++) {
+  /* Build index */
+  /* ----------- */
 
-          const cs_lnum_t  c_id = b2c->ids[b2c->stride*b_id + kb];
-          if (ctag[c_id] != a_id) { /* Not tagged yet */
-            ctag[c_id] = a_id;
-            a2c->idx[a_id+1] += 1;
-          }
+# pragma omp parallel if (n_a_elts > CS_THR_MIN)
+  {
+    cs_lnum_t  *buf = NULL;
+    BFT_MALLOC(buf, n_max_cands, cs_lnum_t);
 
-        } /* End of loop on C elements */
-      } /* End of loop on B elements */
-    } /* End of loop on A elements */
+#   pragma omp for
+    for (cs_lnum_t a_id = 0; a_id < n_a_elts; a_id++)
+      a2c->idx[a_id+1] = _compose_row(a_id, a2b, b2c, buf);
 
+    BFT_FREE(buf);
   }
 
-  for (cs_lnum_t i = 0; i < a2c->n_elts; i++)
+  for (cs_lnum_t i = 0; i < n_a_elts; i++)
     a2c->idx[i+1] += a2c->idx[i];
 
-  BFT_MALLOC(a2c->ids, a2c->idx[a2c->n_elts], cs_lnum_t);
-
-  /* Reset ctag */
-# pragma omp parallel for if (n_c_elts > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_c_elts; i++) ctag[i] = -1;
+  BFT_MALLOC(a2c->ids, a2c->idx[n_a_elts], cs_lnum_t);
 
   /* Fill ids */
   /* -------- */
 
-  cs_lnum_t  shift = 0;
-  if (a2b->stride < 1 && b2c->stride < 1) {
-
-    /* The two adjacencies rely on an indexed array */
-    for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
-
-      for (cs_lnum_t ja = a2b->idx[a_id]; ja < a2b->idx[a_id+1]; ja++) {
+# pragma omp parallel if (n_a_elts > CS_THR_MIN)
+  {
+    cs_lnum_t  *buf = NULL;
+    BFT_MALLOC(buf, n_max_cands, cs_lnum_t);
 
-        const cs_lnum_t  b_id = a2b->ids[ja];
-        for (cs_lnum_t jb = b2c->idx[b_id]; jb < b2c->idx[b_id+1]; jb++) {
+#   pragma omp for
+    for (cs_lnum_t a_id = 0; a_id < n_a_elts; a_id++) {
 
-          const cs_lnum_t  c_id = b2c->ids[jb];
-          if (ctag[c_id] != a_id) { /* Not tagged yet */
-            ctag[c_id] = a_id;
-            a2c->ids[shift++] = c_id;
-          }
-
-        } /* End of loop on C elements */
-      } /* End of loop on B elements */
-    } /* End of loop on A elements */
-
-  }
-  else if (a2b->stride > 0 && b2c->stride < 1) {
+      const cs_lnum_t  n_c = _compose_row(a_id, a2b, b2c, buf);
+      cs_lnum_t  *c_ids = a2c->ids + a2c->idx[a_id];
 
-    for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
-
-      for (int ka = 0; ka < a2b->stride; ka++) {
-
-        const cs_lnum_t  b_id = a2b->ids[a2b->stride*a_id + ka];
-        for (cs_lnum_t jb = b2c->idx[b_id]; jb < b2c->idx[b_id+1]; jb++) {
-
-          const cs_lnum_t  c_id = b2c->ids[jb];
-          if (ctag[c_id] != a_id) { /* Not tagged yet */
-            ctag[c_id] = a_id;
-            a2c->ids[shift++] = c_id;
-          }
-
-        } /* End of loop on C elements */
-      } /* End of loop on B elements */
-    } /* End of loop on A elements */
-
-  }
-  else if (a2b->stride < 1 && b2c->stride > 0) {
-
-    for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
-
-      for (cs_lnum_t ja = a2b->idx[a_id]; ja < a2b->idx[a_id+1]; ja++) {
-
-        const cs_lnum_t  b_id = a2b->ids[ja];
-        for (int kb = 0; kb < b2c->stride; kb++) {
-
-          const cs_lnum_t  c_id = b2c->ids[b2c->stride*b_id + kb];
-          if (ctag[c_id] != a_id) { /* Not tagged yet */
-            ctag[c_id] = a_id;
-            a2c->ids[shift++] = c_id;
-          }
-
-        } /* End of loop on C elements */
-      } /* End of loop on B elements */
-    } /* End of loop on A elements */
-
-  }
-  else {
-
-    assert(a2b->stride > 0 && b2c->stride > 0);
-    for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
-
-      for (int ka = 0; ka < a2b->stride; ka++) {
-
-        const cs_lnum_t  b_id = a2b->ids[a2b->stride*a_id + ka];
-        for (int kb = 0; kb < b2c->stride; kb++) {
-
-          const cs_lnum_t  c_id = b2c->ids[b2c->stride*b_id + kb];
-          if (ctag[c_id] != a_id) { /* Not tagged yet */
-            ctag[c_id] = a_id;
-            a2c->ids[shift++] = c_id;
-          }
+      assert(n_c == a2c->idx[a_id+1] - a2c->idx[a_id]);
+      for (cs_lnum_t j = 0; j < n_c; j++) {
+        assert(buf[j] < n_c_elts);
+        c_ids[j] = buf[j];
+      }
 
-        } /* End of loop on C elements */
-      } /* End of loop on B elements */
-    } /* End of loop on A elements */
+    }
 
+    BFT_FREE(buf);
   }
 
-  assert(shift == a2c->idx[a2c->n_elts]);
-
-  BFT_FREE(ctag);
-
   return a2c;
 }
 
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Create a new cs_adjacency_t structure from a one corresponding to
- *          A -> B. The resulting structure deals with B -> A.
+ *          A -> B. The resulting structure deals with B -> A. The list of A
+ *          elements related to each B element is sorted.
  *
  *
  * \param[in]  n_b_elts    size of the set of B elements
@@ -1003,21 +953,21 @@ cs_adjacency_transpose(int                     n_b_elts,
   if (n_b_elts == 0)
     return b2a;
 
+  const cs_lnum_t  n_a_elts = a2b->n_elts;
+
   /* Build idx */
   /* --------- */
 
-  if (a2b->flag & CS_ADJACENCY_STRIDE) {
+# pragma omp parallel for if (n_a_elts > CS_THR_MIN)
+  for (cs_lnum_t a_id = 0; a_id < n_a_elts; a_id++) {
 
-    for (cs_lnum_t i = 0; i < a2b->n_elts; i++)
-      for (int j = 0; j < a2b->stride; j++)
-        b2a->idx[a2b->ids[a2b->stride*i + j]+1] += 1;
+    cs_lnum_t  s, e;
+    _adjacency_range(a2b, a_id, &s, &e);
 
-  }
-  else {
-
-    for (cs_lnum_t i = 0; i < a2b->n_elts; i++)
-      for (cs_lnum_t j = a2b->idx[i]; j < a2b->idx[i+1]; j++)
-        b2a->idx[a2b->ids[j]+1] += 1;
+    for (cs_lnum_t j = s; j < e; j++) {
+#     pragma omp atomic
+      b2a->idx[a2b->ids[j]+1] += 1;
+    }
 
   }
 
@@ -1025,8 +975,8 @@ cs_adjacency_transpose(int                     n_b_elts,
     b2a->idx[i+1] += b2a->idx[i];
 
   /* Allocate and initialize temporary buffer */
-  int  *count = NULL;
-  BFT_MALLOC(count, n_b_elts, int);
+  cs_lnum_t  *count = NULL;
+  BFT_MALLOC(count, n_b_elts, cs_lnum_t);
 # pragma omp parallel for if (n_b_elts > CS_THR_MIN)
   for (cs_lnum_t i = 0; i < n_b_elts; i++) count[i] = 0;
 
@@ -1037,74 +987,38 @@ cs_adjacency_transpose(int                     n_b_elts,
   if (b2a->flag & CS_ADJACENCY_SIGNED)
     BFT_MALLOC(b2a->sgn, b2a->idx[b2a->n_elts], short int);
 
-  if (a2b->flag & CS_ADJACENCY_STRIDE) {
-    if (b2a->flag & CS_ADJACENCY_SIGNED) {
+# pragma omp parallel for if (n_a_elts > CS_THR_MIN)
+  for (cs_lnum_t a_id = 0; a_id < n_a_elts; a_id++) {
 
-      for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
-        for (int j = 0; j < a2b->stride; j++) {
+    cs_lnum_t  s, e;
+    _adjacency_range(a2b, a_id, &s, &e);
 
-          const cs_lnum_t  b_id = a2b->ids[a2b->stride*a_id + j];
-          const cs_lnum_t  shift = count[b_id] + b2a->idx[b_id];
+    for (cs_lnum_t j = s; j < e; j++) {
 
-          b2a->ids[shift] = a_id;
-          b2a->sgn[shift] = a2b->sgn[a2b->stride*a_id + j];
-          count[b_id] += 1;
+      const cs_lnum_t  b_id = a2b->ids[j];
 
-        }
-      }
-
-    }
-    else { /* Do not build sgn */
-
-      for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
-        for (int j = 0; j < a2b->stride; j++) {
+      cs_lnum_t  shift;
+#     pragma omp atomic capture
+      shift = count[b_id]++;
 
-          const cs_lnum_t  b_id = a2b->ids[a2b->stride*a_id + j];
-
-          b2a->ids[count[b_id] + b2a->idx[b_id]] = a_id;
-          count[b_id] += 1;
-
-        }
-      }
+      shift += b2a->idx[b_id];
+      b2a->ids[shift] = a_id;
+      if (b2a->sgn != NULL)
+        b2a->sgn[shift] = a2b->sgn[j];
 
     }
-  }
-  else {
-    if (b2a->flag & CS_ADJACENCY_SIGNED) {
-
-      for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
-        for (cs_lnum_t j = a2b->idx[a_id]; j < a2b->idx[a_id+1]; j++) {
 
-          const cs_lnum_t  b_id = a2b->ids[j];
-          const cs_lnum_t  shift = count[b_id] + b2a->idx[b_id];
-
-          b2a->ids[shift] = a_id;
-          b2a->sgn[shift] = a2b->sgn[j];
-          count[b_id] += 1;
-
-        }
-      }
-
-    }
-    else { /* Do not build sgn */
-
-      for (cs_lnum_t a_id = 0; a_id < a2b->n_elts; a_id++) {
-        for (cs_lnum_t j = a2b->idx[a_id]; j < a2b->idx[a_id+1]; j++) {
-
-          const cs_lnum_t  b_id = a2b->ids[j];
-
-          b2a->ids[count[b_id] + b2a->idx[b_id]] = a_id;
-          count[b_id] += 1;
-
-        }
-      }
-
-    }
-  }
+  } /* Loop on A elements */
 
   /* Free temporary buffer */
   BFT_FREE(count);
 
+  /* With several threads, entries are not filled following the order of the
+     A elements. Sort each list to get the same result as a sequential
+     build. */
+  if (cs_glob_n_threads > 1)
+    cs_adjacency_sort(b2a);
+
   return b2a;
 }
 
@@ -47,6 +47,7 @@
 #include "cs_sort.h"
 
 #include "fvm_defs.h"
+#include "fvm_io_num.h"
 #include "fvm_nodal.h"
 #include "fvm_nodal_from_desc.h"
 #include "fvm_nodal_order.h"
@@ -783,6 +784,167 @@ cs_mesh_connect_faces_to_nodal(const cs_mesh_t  *mesh,
   return extr_mesh;
 }
 
+/*----------------------------------------------------------------------------
+ * Build a nodal connectivity structure from agglomerated (coarse) cells.
+ *
+ * Each coarse cell is defined as the union of the main mesh cells sharing
+ * the same coarse cell id, and is bounded by the faces separating it from
+ * other coarse cells, unselected cells, or other ranks, and by boundary
+ * faces. Coarse cells are only local to a given rank.
+ *
+ * The parent numbering of the extracted mesh's cells is relative to the
+ * coarse cells (1 to n_c_cells), not to the main mesh.
+ *
+ * parameters:
+ *   mesh       <-- base mesh
+ *   name       <-- extracted mesh name
+ *   n_c_cells  <-- number of local coarse cells
+ *   c_cell_id  <-- coarse cell id (0 to n_c_cells-1) of each main mesh
+ *                  cell, or -1 for cells not extracted (size: n_cells)
+ *
+ * returns:
+ *   pointer to extracted nodal mesh
+ *----------------------------------------------------------------------------*/
+
+fvm_nodal_t *
+cs_mesh_connect_coarse_cells_to_nodal(const cs_mesh_t  *mesh,
+                                      const char       *name,
+                                      cs_lnum_t         n_c_cells,
+                                      const cs_lnum_t   c_cell_id[])
+{
+  cs_lnum_t  *cell_face_idx = NULL, *cell_face_num = NULL;
+  cs_lnum_t  *cell_face_count = NULL;
+  cs_lnum_t  *polyhedra_faces = NULL;
+
+  cs_lnum_t  face_num_shift[3];
+  cs_lnum_t  *face_vertices_idx[2];
+  cs_lnum_t  *face_vertices_num[2];
+
+  cs_gnum_t  *c_cell_gnum = NULL;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  fvm_nodal_t  *extr_mesh;
+
+  /* Check that the mesh contains face -> vertices connectivity */
+
+  if (mesh->b_face_vtx_idx == NULL || mesh->i_face_vtx_idx == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The main mesh does not contain any face -> vertices\n"
+                "connectivity, necessary for the nodal connectivity\n"
+                "reconstruction (%s)."), __func__);
+
+  /* Build "coarse cells -> faces" connectivity; faces interior to
+     a coarse cell are skipped, and ghost cells are ignored */
+
+  BFT_MALLOC(cell_face_idx, n_c_cells + 1, cs_lnum_t);
+  BFT_MALLOC(cell_face_count, n_c_cells, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_c_cells + 1; i++)
+    cell_face_idx[i] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_b_faces; f_id++) {
+    cs_lnum_t c_id = c_cell_id[mesh->b_face_cells[f_id]];
+    if (c_id > -1)
+      cell_face_idx[c_id + 1] += 1;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+    cs_lnum_t c_id0 = mesh->i_face_cells[f_id][0];
+    cs_lnum_t c_id1 = mesh->i_face_cells[f_id][1];
+    c_id0 = (c_id0 < n_cells) ? c_cell_id[c_id0] : -1;
+    c_id1 = (c_id1 < n_cells) ? c_cell_id[c_id1] : -1;
+    if (c_id0 != c_id1) {
+      if (c_id0 > -1)
+        cell_face_idx[c_id0 + 1] += 1;
+      if (c_id1 > -1)
+        cell_face_idx[c_id1 + 1] += 1;
+    }
+  }
+
+  cell_face_idx[0] = 1;
+  for (cs_lnum_t i = 0; i < n_c_cells; i++) {
+    cell_face_idx[i + 1] += cell_face_idx[i];
+    cell_face_count[i] = cell_face_idx[i] - 1;
+  }
+
+  BFT_MALLOC(cell_face_num, cell_face_idx[n_c_cells] - 1, cs_lnum_t);
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_b_faces; f_id++) {
+    cs_lnum_t c_id = c_cell_id[mesh->b_face_cells[f_id]];
+    if (c_id > -1)
+      cell_face_num[cell_face_count[c_id]++] = f_id + 1;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+    cs_lnum_t c_id0 = mesh->i_face_cells[f_id][0];
+    cs_lnum_t c_id1 = mesh->i_face_cells[f_id][1];
+    c_id0 = (c_id0 < n_cells) ? c_cell_id[c_id0] : -1;
+    c_id1 = (c_id1 < n_cells) ? c_cell_id[c_id1] : -1;
+    if (c_id0 != c_id1) {
+      if (c_id0 > -1)
+        cell_face_num[cell_face_count[c_id0]++] = f_id + mesh->n_b_faces + 1;
+      if (c_id1 > -1)
+        cell_face_num[cell_face_count[c_id1]++]
+          = -(f_id + mesh->n_b_faces + 1);
+    }
+  }
+
+  BFT_FREE(cell_face_count);
+
+  /* Build nodal connectivity */
+
+  face_num_shift[0] = 0;
+  face_num_shift[1] = mesh->n_b_faces + face_num_shift[0];
+  face_num_shift[2] = mesh->n_i_faces + face_num_shift[1];
+
+  face_vertices_idx[0] = mesh->b_face_vtx_idx;
+  face_vertices_idx[1] = mesh->i_face_vtx_idx;
+  face_vertices_num[0] = mesh->b_face_vtx_lst;
+  face_vertices_num[1] = mesh->i_face_vtx_lst;
+
+  extr_mesh = fvm_nodal_create(name, 3);
+
+  fvm_nodal_from_desc_add_cells(extr_mesh,
+                                n_c_cells,
+                                2,
+                                face_num_shift,
+                                (const cs_lnum_t **)face_vertices_idx,
+                                (const cs_lnum_t **)face_vertices_num,
+                                cell_face_idx,
+                                cell_face_num,
+                                NULL,
+                                NULL,
+                                &polyhedra_faces);
+
+  fvm_nodal_set_shared_vertices(extr_mesh, mesh->vtx_coord);
+
+  BFT_FREE(polyhedra_faces);
+
+  BFT_FREE(cell_face_idx);
+  BFT_FREE(cell_face_num);
+
+  /* Number coarse cells globally by rank */
+
+  if (cs_glob_n_ranks > 1) {
+    fvm_io_num_t *c_io_num = fvm_io_num_create_from_scan(n_c_cells);
+    c_cell_gnum = fvm_io_num_transfer_global_num(c_io_num);
+    c_io_num = fvm_io_num_destroy(c_io_num);
+  }
+
+  fvm_nodal_order_cells(extr_mesh, c_cell_gnum);
+  fvm_nodal_init_io_num(extr_mesh, c_cell_gnum, 3);
+
+  BFT_FREE(c_cell_gnum);
+
+  /* Sort vertices by increasing global number */
+
+  fvm_nodal_order_vertices(extr_mesh, mesh->global_vtx_num);
+  fvm_nodal_init_io_num(extr_mesh, mesh->global_vtx_num, 0);
+
+  return extr_mesh;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build a vertex to cell connectivity for marked vertices only.
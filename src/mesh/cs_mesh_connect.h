@@ -141,6 +141,34 @@ cs_mesh_connect_faces_to_nodal(const cs_mesh_t  *mesh,
                                cs_lnum_t         i_face_list[],
                                cs_lnum_t         b_face_list[]);
 
+/*----------------------------------------------------------------------------
+ * Build a nodal connectivity structure from agglomerated (coarse) cells.
+ *
+ * Each coarse cell is defined as the union of the main mesh cells sharing
+ * the same coarse cell id, and is bounded by the faces separating it from
+ * other coarse cells, unselected cells, or other ranks, and by boundary
+ * faces. Coarse cells are only local to a given rank.
+ *
+ * The parent numbering of the extracted mesh's cells is relative to the
+ * coarse cells (1 to n_c_cells), not to the main mesh.
+ *
+ * parameters:
+ *   mesh       <-- base mesh
+ *   name       <-- extracted mesh name
+ *   n_c_cells  <-- number of local coarse cells
+ *   c_cell_id  <-- coarse cell id (0 to n_c_cells-1) of each main mesh
+ *                  cell, or -1 for cells not extracted (size: n_cells)
+ *
+ * returns:
+ *   pointer to extracted nodal mesh
+ *----------------------------------------------------------------------------*/
+
+fvm_nodal_t *
+cs_mesh_connect_coarse_cells_to_nodal(const cs_mesh_t  *mesh,
+                                      const char       *name,
+                                      cs_lnum_t         n_c_cells,
+                                      const cs_lnum_t   c_cell_id[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build a vertex to cell connectivity for marked vertices only.
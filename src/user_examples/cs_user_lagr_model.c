@@ -699,6 +699,47 @@ cs_user_lagr_model(void)
     cs_glob_lagr_agglomeration_model->max_stat_weight = 1.035e9;
   }
 
+  /*! [population_control] */
+
+  /* Parcel population control
+   * ========================= */
+
+  /* Every 10 time steps, merge similar parcels in cells containing more
+     than 200 parcels in flow, and split the heaviest parcels in cells
+     containing less than 5 parcels in flow, without going below a
+     statistical weight of 1 (interval = 0: no population control) */
+
+  cs_glob_lagr_population_model->interval = 10;
+  cs_glob_lagr_population_model->n_min_per_cell = 5;
+  cs_glob_lagr_population_model->n_max_per_cell = 200;
+  cs_glob_lagr_population_model->min_stat_weight = 1.;
+
+  /* Maximum relative difference of diameters and velocities of merged
+     parcels */
+
+  cs_glob_lagr_population_model->merge_tolerance = 0.1;
+
+  /*! [population_control] */
+
+  /*! [particle_stream_output] */
+
+  /* Streaming output of particle data
+   * ================================= */
+
+  /* Append particle positions, velocities and statistical weights
+     to postprocessing/particles.trj every 5 time steps, compressing data,
+     without building postprocessing meshes */
+
+  {
+    cs_lagr_attribute_t attrs[] = {CS_LAGR_COORDS,
+                                   CS_LAGR_VELOCITY,
+                                   CS_LAGR_STAT_WEIGHT};
+
+    cs_lagr_trajectory_define("particles", 5, 3, attrs, true);
+  }
+
+  /*! [particle_stream_output] */
+
   /*! [boundary_statistics] */
   /* Boundary statistics
    * =================== */
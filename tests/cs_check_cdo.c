@@ -40,18 +40,24 @@
 #include "cs_cdo_quantities.h"
 #include "cs_cdofb_scaleq.h"
 #include "cs_cdovb_scaleq.h"
+#include "cs_equation_mfree.h"
 #include "cs_equation_param.h"
 #include "cs_evaluate.h"
 #include "cs_hho_builder.h"
 #include "cs_hho_scaleq.h"
 #include "cs_hodge.h"
+#include "cs_hodge_cache.h"
 #include "cs_log.h"
+#include "cs_matrix.h"
 #include "cs_param_cdo.h"
+#include "cs_range_set.h"
 #include "cs_scheme_geometry.h"
 #include "cs_sdm.h"
 #include "cs_source_term.h"
 #include "cs_time_step.h"
 #include "cs_timer.h"
+#include "cs_volume_zone.h"
+#include "cs_xdef_cache.h"
 #include "cs_xdef_cw_eval.h"
 #include "cs_xdef_eval.h"
 
@@ -165,6 +171,30 @@ _linear_xyz(cs_real_t          time,
   }
 }
 
+/* Test function based on analytic definition
+ * Fill array with t+x+y+z and count the number of calls and points
+ */
+static void
+_linear_txyz_count(cs_real_t          time,
+                   cs_lnum_t          n_pts,
+                   const cs_lnum_t   *pt_ids,
+                   const cs_real_t   *xyz,
+                   bool               compact,
+                   void              *input,
+                   cs_real_t          retval[])
+{
+  cs_lnum_t  *counts = (cs_lnum_t *)input;
+
+  counts[0] += 1;
+  counts[1] += n_pts;
+
+  for (cs_lnum_t i = 0; i < n_pts; i++) {
+    const cs_lnum_t  p = (pt_ids != NULL) ? pt_ids[i] : i;
+    const cs_lnum_t  r = compact ? i : p;
+    retval[r] = time + xyz[3*p] + xyz[3*p+1] + xyz[3*p+2];
+  }
+}
+
 /* Test function based on analytic definition
  * Fill array with [x, 2*y, 3*z]
  */
@@ -1020,6 +1050,422 @@ _test_stiffness_vb(FILE               *out,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check the storage of cell-wise local matrices (cs_hodge_cache_t)
+ *          against freshly built Hodge operators for Vertex-based schemes
+ *
+ * \param[in]      out    output file
+ * \param[in]      cm     pointer to a cs_cell_mesh_t structure
+ * \param[in, out] cb     pointer to a cs_cell_builder_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_hodge_cache_vb(FILE                *out,
+                     cs_cell_mesh_t      *cm,
+                     cs_cell_builder_t   *cb)
+{
+  /* Cell -> vertices adjacency restricted to the current cell */
+  cs_adjacency_t  *c2v = cs_adjacency_create(0, -1, 1);
+
+  c2v->idx[1] = cm->n_vc;
+  BFT_MALLOC(c2v->ids, cm->n_vc, cs_lnum_t);
+  for (short int v = 0; v < cm->n_vc; v++)
+    c2v->ids[v] = cm->v_ids[v];
+
+  cs_hodge_param_t  hcost = {.inv_pty = false,
+                             .type = CS_HODGE_TYPE_EPFD,
+                             .algo = CS_HODGE_ALGO_COST,
+                             .coef = 1./3.};
+  cs_hodge_param_t  hwbs = {.inv_pty = false,
+                            .type = CS_HODGE_TYPE_VPCD,
+                            .algo = CS_HODGE_ALGO_WBS,
+                            .coef = 1.0};
+
+  cs_hodge_cache_t  *s_cache = cs_hodge_cache_acquire(hcost, NULL, c2v, 0);
+  cs_hodge_cache_t  *s_cache2 = cs_hodge_cache_acquire(hcost, NULL, c2v, 0);
+  cs_hodge_cache_t  *m_cache = cs_hodge_cache_acquire(hwbs, NULL, c2v, 0);
+
+  fprintf(out, "\nCDO.VB; HODGE CACHE\n");
+  fprintf(out, " Shared cache for similar parameters: %s\n",
+          (s_cache == s_cache2) ? "ok" : "FAILED");
+  fprintf(out, " Distinct cache for other parameters: %s\n",
+          (s_cache != m_cache) ? "ok" : "FAILED");
+
+  cs_sdm_t  *ref = cs_sdm_square_create(cm->n_vc);
+
+  for (int k = 0; k < 2; k++) {
+
+    cs_hodge_cache_t  *cache = (k == 0) ? s_cache : m_cache;
+    cs_hodge_param_t  *hp = (k == 0) ? &hcost : &hwbs;
+    cs_hodge_t  *hodge = cs_hodge_create(connect, NULL, hp, true, true);
+    cs_sdm_t  *m = (k == 0) ? cb->loc : hodge->matrix;
+
+    bool  miss = !cs_hodge_cache_load(cache, cm->c_id, m);
+
+    /* Fresh build of the local operator */
+    if (k == 0)
+      cs_hodge_vb_cost_get_stiffness(cm, hodge, cb);
+    else
+      cs_hodge_vpcd_wbs_get(cm, hodge, cb);
+
+    cs_hodge_cache_store(cache, cm->c_id, m);
+    cs_sdm_square_init(cm->n_vc, ref);
+    cs_sdm_copy(ref, m);
+
+    /* Overwrite the local matrix to check that it is fully reloaded */
+    for (int i = 0; i < cm->n_vc*cm->n_vc; i++)
+      m->val[i] = -1e30;
+
+    bool  hit = cs_hodge_cache_load(cache, cm->c_id, m);
+
+    double  diff = 0.;
+    for (int i = 0; i < cm->n_vc*cm->n_vc; i++)
+      diff = fmax(diff, fabs(m->val[i] - ref->val[i]));
+
+    fprintf(out, " %s: miss before store: %s; hit after store: %s;"
+            " max. diff.: %5.3e %s\n",
+            (k == 0) ? "STIFFNESS.COST" : "HDG.VPCD.WBS",
+            (miss) ? "ok" : "FAILED", (hit) ? "ok" : "FAILED",
+            diff, (diff > 0.) ? "FAILED" : "ok");
+
+    cs_hodge_free(&hodge);
+
+  }
+
+  /* Cached matrices are invalidated (for instance after a mesh change) */
+  cs_hodge_cache_reset_all();
+
+  bool  s_miss = !cs_hodge_cache_load(s_cache, cm->c_id, cb->loc);
+  bool  m_miss = !cs_hodge_cache_load(m_cache, cm->c_id, cb->loc);
+
+  fprintf(out, " Miss after reset: %s\n",
+          (s_miss && m_miss) ? "ok" : "FAILED");
+
+  cs_hodge_cache_release(&s_cache);
+  cs_hodge_cache_release(&s_cache2);
+  cs_hodge_cache_release(&m_cache);
+
+  ref = cs_sdm_free(ref);
+  cs_adjacency_destroy(&c2v);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Test the cache of evaluation points and values of a definition by
+ *          analytic function: recording of the points, batch evaluation and
+ *          replacement of the values related to the oldest time
+ *
+ * \param[in]      out    output file
+ * \param[in]      cm     pointer to a cs_cell_mesh_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_xdef_cache(FILE                 *out,
+                 const cs_cell_mesh_t *cm)
+{
+  /* Cell -> vertices adjacency restricted to the current cell */
+  cs_adjacency_t  *c2v = cs_adjacency_create(0, -1, 1);
+
+  c2v->idx[1] = cm->n_vc;
+  BFT_MALLOC(c2v->ids, cm->n_vc, cs_lnum_t);
+  for (short int v = 0; v < cm->n_vc; v++)
+    c2v->ids[v] = cm->v_ids[v];
+
+  cs_adjacency_t  *c2v_save = connect->c2v;
+  connect->c2v = c2v;
+
+  /* Zone 0 (all cells) has to be defined */
+  cs_mesh_location_initialize();
+  cs_volume_zone_initialize();
+
+  /* Points are requested as with cs_source_term_vcsp_by_analytic: one point
+     by vertex, then the cell center */
+  const int  n_pts = cm->n_vc + 1;
+  cs_real_t  *xyz = NULL, *eval = NULL;
+  BFT_MALLOC(xyz, 3*n_pts, cs_real_t);
+  BFT_MALLOC(eval, n_pts, cs_real_t);
+
+  memcpy(xyz, cm->xv, 3*cm->n_vc*sizeof(cs_real_t));
+  memcpy(xyz + 3*cm->n_vc, cm->xc, 3*sizeof(cs_real_t));
+
+  fprintf(out, "\nCDO.VB; XDEF CACHE\n");
+  fprintf(out, " %-24s %6s %6s %8s %6s %6s %10s\n",
+          "Definition", "t_eval", "t_val", "n_calls", "ref", "status",
+          "max. diff.");
+
+  for (int k = 0; k < 3; k++) {
+
+    const char  *labels[3] = {"steady", "unsteady", "unsteady.time_values"};
+
+    /* Sequence of times of evaluation and related expected numbers of calls
+       to the analytic function (-1: cached values of the first time) */
+    const cs_real_t  t_seq[3][8] = {{0, 0, 1, 2, 0, 0, 0, 0},
+                                    {0, 0, 1, 1, 0, 0, 0, 0},
+                                    {0, 0, 1, 0, 1, 2, 1, 0}};
+    const int  n_calls_ref[3][8] = {{2, 1, 0, 0, 0, 0, 0, 0},
+                                    {2, 2, 2, 2, 2, 0, 0, 0},
+                                    {2, 1, 1, 0, 0, 1, 0, 1}};
+    const int  n_seq[3] = {4, 5, 8};
+
+    cs_lnum_t  counts[2] = {0, 0};
+    cs_xdef_analytic_input_t  anai = {.func = _linear_txyz_count,
+                                      .input = counts};
+    cs_flag_t  state = (k == 0) ? CS_FLAG_STATE_STEADY : 0;
+
+    cs_xdef_t  *def = cs_xdef_volume_create(CS_XDEF_BY_ANALYTIC_FUNCTION,
+                                            1, 0, state, 0, &anai);
+
+    cs_xdef_analytic_input_t  *d_anai = (cs_xdef_analytic_input_t *)def->input;
+
+    d_anai->cache = cs_xdef_cache_create(def, connect, 1, 0, 0, 1);
+    if (k == 2)
+      cs_xdef_cache_set_time_values(d_anai->cache, true);
+
+    for (int i = 0; i < n_seq[k]; i++) {
+
+      const cs_real_t  t_eval = t_seq[k][i];
+      const cs_real_t  t_ref = (k == 0) ? t_seq[k][1] : t_eval;
+      const cs_lnum_t  n_calls_prev = counts[0];
+
+      /* Same cell-wise sequence of calls as a source term */
+      int  shift = 0;
+      cs_xdef_cache_eval_analytic(d_anai, cm->c_id, t_eval, cm->n_vc, xyz,
+                                  &shift, eval);
+      cs_xdef_cache_eval_analytic(d_anai, cm->c_id, t_eval, 1,
+                                  xyz + 3*cm->n_vc, &shift, eval + cm->n_vc);
+
+      /* The first pass only records points. Values are those of the time of
+         evaluation */
+      const cs_real_t  t_val = (i == 0) ? t_eval : t_ref;
+
+      double  diff = 0.;
+      for (int j = 0; j < n_pts; j++)
+        diff = fmax(diff, fabs(eval[j] - (t_val + xyz[3*j] + xyz[3*j+1]
+                                          + xyz[3*j+2])));
+
+      const int  n_calls = counts[0] - n_calls_prev;
+      const bool  ok = (n_calls == n_calls_ref[k][i] && diff < 1e-15);
+
+      fprintf(out, " %-24s %6.2f %6.2f %8d %6d %6s %10.4e\n",
+              labels[k], t_eval, t_val, n_calls, n_calls_ref[k][i],
+              (ok) ? "ok" : "FAILED", diff);
+
+    }
+
+    /* All the points are evaluated at once after the first pass */
+    if (k == 2) {
+      const cs_lnum_t  n_batch_pts = (counts[1] - n_pts)/(counts[0] - 2);
+      fprintf(out, " Number of points by batch evaluation: %d %s\n",
+              (int)n_batch_pts, (n_batch_pts == n_pts) ? "ok" : "FAILED");
+    }
+
+    def = cs_xdef_free(def);
+
+  }
+
+  BFT_FREE(xyz);
+  BFT_FREE(eval);
+
+  cs_volume_zone_finalize();
+  cs_mesh_location_finalize();
+
+  connect->c2v = c2v_save;
+  cs_adjacency_destroy(&c2v);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check the matrix-free operator (cs_equation_mfree_t) against the
+ *          assembled matrix on two copies of the current cell sharing half
+ *          of their vertices. The first cell matrix matches a cached
+ *          stiffness matrix up to its diagonal, the second one is not
+ *          symmetric. The operator is built with and without the cache.
+ *
+ * \param[in]      out    output file
+ * \param[in]      cm     pointer to a cs_cell_mesh_t structure
+ * \param[in, out] cb     pointer to a cs_cell_builder_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_mfree_vb(FILE                *out,
+               cs_cell_mesh_t      *cm,
+               cs_cell_builder_t   *cb)
+{
+  const short int  n = cm->n_vc;
+  const cs_lnum_t  n_x = n + n/2;
+
+  cs_adjacency_t  *c2v = cs_adjacency_create(0, -1, 2);
+
+  c2v->idx[1] = n, c2v->idx[2] = 2*n;
+  BFT_MALLOC(c2v->ids, 2*n, cs_lnum_t);
+  for (short int v = 0; v < n; v++) {
+    c2v->ids[v] = v;
+    c2v->ids[n + v] = v + n/2;
+  }
+
+  /* Cell-wise matrices and reference (dense) assembled matrix */
+  cs_hodge_param_t  hcost = {.inv_pty = false,
+                             .type = CS_HODGE_TYPE_EPFD,
+                             .algo = CS_HODGE_ALGO_COST,
+                             .coef = 1./3.};
+  cs_hodge_t  *hodge = cs_hodge_create(connect, NULL, &hcost, true, true);
+  cs_hodge_vb_cost_get_stiffness(cm, hodge, cb);
+  cs_hodge_free(&hodge);
+
+  cs_hodge_cache_t  *cache = cs_hodge_cache_acquire(hcost, NULL, c2v, 0);
+  cs_sdm_t  *m[2] = {cs_sdm_square_create(n), cs_sdm_square_create(n)};
+
+  cs_real_t  *a = NULL;
+  BFT_MALLOC(a, n_x*n_x, cs_real_t);
+  memset(a, 0, n_x*n_x*sizeof(cs_real_t));
+
+  for (int c = 0; c < 2; c++) {
+
+    cs_hodge_cache_store(cache, c, cb->loc);
+    cs_sdm_square_init(n, m[c]);
+    cs_sdm_copy(m[c], cb->loc);
+
+    for (short int i = 0; i < n; i++)
+      m[c]->val[i*(n+1)] += 1. + 0.1*i;   /* Reaction-like terms */
+    if (c == 1)
+      m[c]->val[1] += 0.2;                /* Advection-like term */
+
+    const cs_lnum_t  *ids = c2v->ids + c2v->idx[c];
+    for (short int i = 0; i < n; i++)
+      for (short int j = 0; j < n; j++)
+        a[ids[i]*n_x + ids[j]] += m[c]->val[i*n + j];
+
+  }
+
+  /* Matrix structure and assembled matrix with the same coefficients */
+  cs_lnum_t  n_edges = 0;
+  cs_lnum_2_t  *edges = NULL;
+  cs_real_t  *da = NULL, *xa = NULL;
+  BFT_MALLOC(edges, n_x*n_x, cs_lnum_2_t);
+  BFT_MALLOC(xa, 2*n_x*n_x, cs_real_t);
+  BFT_MALLOC(da, n_x, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_x; i++) {
+    da[i] = a[i*n_x + i];
+    for (cs_lnum_t j = i+1; j < n_x; j++) {
+      if (fabs(a[i*n_x + j]) > 0 || fabs(a[j*n_x + i]) > 0) {
+        edges[n_edges][0] = i, edges[n_edges][1] = j;
+        xa[2*n_edges] = a[i*n_x + j];
+        xa[2*n_edges + 1] = a[j*n_x + i];
+        n_edges++;
+      }
+    }
+  }
+
+  cs_matrix_structure_t  *ms
+    = cs_matrix_structure_create(CS_MATRIX_MSR, true, n_x, n_x,
+                                 n_edges, (const cs_lnum_2_t *)edges,
+                                 NULL, NULL);
+  cs_matrix_t  *a_mat = cs_matrix_create(ms);
+  cs_matrix_t  *mf_mat = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a_mat, false, NULL, NULL, n_edges,
+                             (const cs_lnum_2_t *)edges, da, xa);
+
+  cs_range_set_t  *rset = cs_range_set_create(NULL, NULL, n_x, false, 0);
+
+  cs_real_t  *x = NULL, *y = NULL, *y_ref = NULL;
+  BFT_MALLOC(x, n_x, cs_real_t);
+  BFT_MALLOC(y, n_x, cs_real_t);
+  BFT_MALLOC(y_ref, n_x, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_x; i++)
+    x[i] = 1. + 0.5*i - 0.05*i*i;
+
+  fprintf(out, "\nCDO.VB; MATRIX-FREE OPERATOR\n");
+
+  /* Assembled product against the dense reference */
+  double  diff = 0., ref = 0.;
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_IGNORE, a_mat, x, y_ref);
+  for (cs_lnum_t i = 0; i < n_x; i++) {
+    double  yi = 0.;
+    for (cs_lnum_t j = 0; j < n_x; j++)
+      yi += a[i*n_x + j]*x[j];
+    diff = fmax(diff, fabs(y_ref[i] - yi));
+    ref = fmax(ref, fabs(yi));
+  }
+
+  fprintf(out, " %-20s max. rel. diff.: %5.3e %s\n", "Assembled (MSR)",
+          diff/ref, (diff < 1e-14*ref) ? "ok" : "FAILED");
+
+  for (int k = 0; k < 2; k++) {
+
+    cs_equation_mfree_t  *mf
+      = cs_equation_mfree_create(c2v, rset, (k == 0) ? cache : NULL);
+
+    cs_equation_mfree_reset(mf);
+    for (int c = 0; c < 2; c++)
+      cs_equation_mfree_add_cw(m[c], c, mf);
+    cs_equation_mfree_set_matrix(mf, mf_mat);
+
+    /* Diagonal, product and product without the diagonal */
+    const cs_real_t  *d = cs_matrix_get_diagonal(mf_mat);
+
+    double  d_diff = 0.;
+    for (cs_lnum_t i = 0; i < n_x; i++)
+      d_diff = fmax(d_diff, fabs(d[i] - da[i]));
+
+    double  p_diff[2] = {0., 0.};
+    for (int e = 0; e < 2; e++) {
+
+      if (e == 0) {
+        cs_matrix_vector_multiply(CS_HALO_ROTATION_IGNORE, a_mat, x, y_ref);
+        cs_matrix_vector_multiply(CS_HALO_ROTATION_IGNORE, mf_mat, x, y);
+      }
+      else {
+        cs_matrix_exdiag_vector_multiply(CS_HALO_ROTATION_IGNORE, a_mat, x,
+                                         y_ref);
+        cs_matrix_exdiag_vector_multiply(CS_HALO_ROTATION_IGNORE, mf_mat, x,
+                                         y);
+      }
+
+      for (cs_lnum_t i = 0; i < n_x; i++)
+        p_diff[e] = fmax(p_diff[e], fabs(y[i] - y_ref[i]));
+
+    }
+
+    const bool  ok = (   d_diff < 1e-14*ref
+                      && p_diff[0] < 1e-14*ref && p_diff[1] < 1e-14*ref);
+
+    fprintf(out, " %-20s max. rel. diff.: diag %5.3e; A.x %5.3e;"
+            " (A-D).x %5.3e %s\n",
+            (k == 0) ? "Mfree (cache)" : "Mfree (no cache)",
+            d_diff/ref, p_diff[0]/ref, p_diff[1]/ref, (ok) ? "ok" : "FAILED");
+
+    cs_equation_mfree_release_matrix(mf);
+    cs_equation_mfree_free(&mf);
+
+  }
+
+  BFT_FREE(x);
+  BFT_FREE(y);
+  BFT_FREE(y_ref);
+  BFT_FREE(a);
+  BFT_FREE(da);
+  BFT_FREE(xa);
+  BFT_FREE(edges);
+
+  cs_range_set_destroy(&rset);
+  cs_matrix_destroy(&mf_mat);
+  cs_matrix_destroy(&a_mat);
+  cs_matrix_structure_destroy(&ms);
+
+  m[0] = cs_sdm_free(m[0]);
+  m[1] = cs_sdm_free(m[1]);
+  cs_hodge_cache_release(&cache);
+  cs_adjacency_destroy(&c2v);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Test CDO vertex-based schemes
@@ -1087,6 +1533,15 @@ _test_cdovb_schemes(FILE                *out,
   _test_hodge_vb(out, cm, hodge->matrix);
   cs_hodge_free(&hodge);
 
+  /* Cell-wise local matrices stored in a cache */
+  _test_hodge_cache_vb(out, cm, cb);
+
+  /* Evaluation points and values of analytic functions stored in a cache */
+  _test_xdef_cache(out, cm);
+
+  /* Matrix-free operator against the assembled matrix */
+  _test_mfree_vb(out, cm, cb);
+
   /* DIFFUSION (Stiffness matrix) */
   /* ============================ */
 
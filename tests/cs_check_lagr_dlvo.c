@@ -0,0 +1,243 @@
+/*============================================================================
+ * Unitary tests for the batched evaluation of DLVO interaction energies
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+
+#include "cs_lagr_dlvo.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Number of sampled distances (the first ones lie in the short-range
+   Van der Waals regime, the last ones in the long-range one) */
+
+#define _N_DIST  1001
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *dlvo = NULL;
+static int  _n_failures = 0;
+
+/* Common physical parameters */
+
+static const cs_real_t  _water_permit = 80.;
+static const cs_real_t  _temp = 293.;
+static const cs_real_t  _lambda_vdw = 1e-7;
+static const cs_real_t  _cstham = 6e-20;
+static const cs_real_t  _d_cut_off = 1.65e-10;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compare batched and scalar interaction energies and log the
+ *         result.
+ *
+ * Differences are relative to the largest absolute value of the profile,
+ * as the energy changes sign along it.
+ *
+ * \param[in]  out      output file
+ * \param[in]  name     name of the test
+ * \param[in]  u_ref    reference (scalar) values
+ * \param[in]  u        batched values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_compare(FILE             *out,
+         const char       *name,
+         const cs_real_t   u_ref[],
+         const cs_real_t   u[])
+{
+  double  max_diff = 0., max_ref = 0.;
+
+  for (int i = 0; i < _N_DIST; i++) {
+    max_diff = CS_MAX(max_diff, CS_ABS(u[i] - u_ref[i]));
+    max_ref = CS_MAX(max_ref, CS_ABS(u_ref[i]));
+  }
+
+  bool  ok = (max_ref > 0 && max_diff <= 1e-11*max_ref);
+
+  fprintf(out, " %s: max. rel. diff. %5.3e %s\n",
+          name, max_diff/max_ref, (ok) ? "ok" : "FAILED");
+  if (!ok)
+    _n_failures += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check the sphere-plane interaction for a set of parameters.
+ *
+ * \param[in]  out      output file
+ * \param[in]  rpart    particle radius
+ * \param[in]  valen    valency of the electrolyte
+ * \param[in]  phi_p    particle zeta potential
+ * \param[in]  phi_s    surface zeta potential
+ * \param[in]  debye    Debye length
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_sphere_plane(FILE       *out,
+                   cs_real_t   rpart,
+                   cs_real_t   valen,
+                   cs_real_t   phi_p,
+                   cs_real_t   phi_s,
+                   cs_real_t   debye)
+{
+  cs_real_t  distp[_N_DIST], u[_N_DIST], u_ref[_N_DIST];
+
+  for (int i = 0; i < _N_DIST; i++) {
+    distp[i] = _d_cut_off + i*debye/30.;
+    u_ref[i]
+      =   cs_lagr_van_der_waals_sphere_plane(distp[i], rpart,
+                                             _lambda_vdw, _cstham)
+        + cs_lagr_edl_sphere_plane(distp[i], rpart, valen, phi_p, phi_s,
+                                   _temp, debye, _water_permit);
+  }
+
+  cs_lagr_dlvo_sphere_plane(_N_DIST, distp, rpart, _lambda_vdw, _cstham,
+                            valen, phi_p, phi_s, _temp, debye, _water_permit,
+                            u);
+
+  char  name[128];
+  snprintf(name, 128, "sphere-plane  r=%5.1e z=%g phi=(%g,%g) debye=%5.1e",
+           rpart, valen, phi_p, phi_s, debye);
+
+  _compare(out, name, u_ref, u);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check the sphere-sphere interaction for a set of parameters.
+ *
+ * \param[in]  out      output file
+ * \param[in]  rpart1   radius of the first particle
+ * \param[in]  rpart2   radius of the second particle
+ * \param[in]  valen    valency of the electrolyte
+ * \param[in]  phi1     zeta potential of the first particle
+ * \param[in]  phi2     zeta potential of the second particle
+ * \param[in]  debye    Debye length
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_sphere_sphere(FILE       *out,
+                    cs_real_t   rpart1,
+                    cs_real_t   rpart2,
+                    cs_real_t   valen,
+                    cs_real_t   phi1,
+                    cs_real_t   phi2,
+                    cs_real_t   debye)
+{
+  cs_real_t  distcc[_N_DIST], u[_N_DIST], u_ref[_N_DIST];
+
+  for (int i = 0; i < _N_DIST; i++) {
+    distcc[i] = _d_cut_off + i*debye/30. + rpart1 + rpart2;
+    u_ref[i]
+      =   cs_lagr_van_der_waals_sphere_sphere(distcc[i], rpart1, rpart2,
+                                              _lambda_vdw, _cstham)
+        + cs_lagr_edl_sphere_sphere(distcc[i], rpart1, rpart2, valen,
+                                    phi1, phi2, _temp, debye, _water_permit);
+  }
+
+  cs_lagr_dlvo_sphere_sphere(_N_DIST, distcc, rpart1, rpart2,
+                             _lambda_vdw, _cstham, valen, phi1, phi2,
+                             _temp, debye, _water_permit, u);
+
+  char  name[128];
+  snprintf(name, 128,
+           "sphere-sphere r=(%5.1e,%5.1e) z=%g phi=(%g,%g) debye=%5.1e",
+           rpart1, rpart2, valen, phi1, phi2, debye);
+
+  _compare(out, name, u_ref, u);
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  dlvo = fopen("LAGR_dlvo_tests.log", "w");
+
+  /* Repulsive and attractive double layers, thin and thick */
+
+  _test_sphere_plane(dlvo, 1e-6, 1., -0.05, -0.04, 1e-8);
+  _test_sphere_plane(dlvo, 5e-6, 2., -0.05, 0.03, 1e-8);
+  _test_sphere_plane(dlvo, 1e-6, 1., -0.02, -0.06, 1e-7);
+
+  /* Identical particles (agglomeration) and particle-asperity pairs */
+
+  _test_sphere_sphere(dlvo, 1e-6, 1e-6, 1., -0.05, -0.05, 1e-8);
+  _test_sphere_sphere(dlvo, 5e-6, 1e-7, 2., -0.05, -0.04, 1e-8);
+  _test_sphere_sphere(dlvo, 1e-6, 2e-7, 1., -0.05, 0.03, 1e-7);
+
+  fclose(dlvo);
+
+  if (_n_failures > 0)
+    printf("\n\n -->> DLVO Tests (%d failure(s),"
+           " see LAGR_dlvo_tests.log)\n", _n_failures);
+  else
+    printf("\n\n -->> DLVO Tests (Done)\n");
+
+  exit((_n_failures > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
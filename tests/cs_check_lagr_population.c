@@ -0,0 +1,299 @@
+/*============================================================================
+ * Unitary tests for the merging and splitting of Lagrangian parcels
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_mesh.h"
+#include "cs_time_step.h"
+
+#include "cs_lagr.h"
+#include "cs_lagr_particle.h"
+#include "cs_lagr_population.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Number of cells and of conserved quantities per cell:
+   number of parcels in flow, statistical weight, mass, momentum (3),
+   volume (sum of w.d^3), number of deposited parcels and their weight */
+
+#define _N_CELLS  4
+#define _N_SUMS   9
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *pop = NULL;
+static int  _n_failures = 0;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the initial particle set.
+ *
+ * Cell 0 contains 8 similar parcels (to be merged) and a deposited one,
+ * cell 1 contains 6 parcels of too different diameters to be merged,
+ * cell 2 contains a single heavy parcel and cell 3 a heavy and a light
+ * parcel (to be split). Cell ids are interleaved so that the set must be
+ * sorted by the population control.
+ *
+ * \return  number of particles
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_define_particles(void)
+{
+  cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
+
+  const cs_lnum_t  n_particles = 18;
+  const cs_lnum_t  cell_id[18] = {0, 1, 3, 0, 1, 0, 2, 0, 1,
+                                  0, 3, 1, 0, 0, 1, 0, 1, 0};
+  const cs_real_t  w3[2] = {8., 1.5};
+
+  cs_lagr_particle_set_resize(n_particles);
+  p_set->n_particles = n_particles;
+
+  memset(p_set->p_buffer, 0, p_set->p_am->extents*n_particles);
+
+  int  n_c[_N_CELLS] = {0, 0, 0, 0};
+
+  for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++) {
+
+    const cs_lnum_t  c_id = cell_id[p_id];
+    const int  i = n_c[c_id];
+    n_c[c_id] += 1;
+
+    cs_real_t  w = 1. + 0.5*i, m = 1e-6*(1. + 0.02*i), d = 1e-3*(1. + 0.01*i);
+    cs_real_t  v[3] = {1. + 0.01*i, 2., -1.};
+
+    if (c_id == 1)
+      d = 1e-3*pow(2., i);
+    else if (c_id == 2)
+      w = 10.;
+    else if (c_id == 3)
+      w = w3[i];
+
+    cs_lagr_particles_set_lnum(p_set, p_id, CS_LAGR_CELL_ID, c_id);
+    cs_lagr_particles_set_real(p_set, p_id, CS_LAGR_STAT_WEIGHT, w);
+    cs_lagr_particles_set_real(p_set, p_id, CS_LAGR_MASS, m);
+    cs_lagr_particles_set_real(p_set, p_id, CS_LAGR_DIAMETER, d);
+    cs_lagr_particles_set_real(p_set, p_id, CS_LAGR_RESIDENCE_TIME, 0.1*i);
+
+    cs_real_t  *p_v = cs_lagr_particles_attr(p_set, p_id, CS_LAGR_VELOCITY);
+    cs_real_t  *p_vs = cs_lagr_particles_attr(p_set, p_id,
+                                              CS_LAGR_VELOCITY_SEEN);
+    for (int k = 0; k < 3; k++) {
+      p_v[k] = v[k];
+      p_vs[k] = 0.5*v[k];
+    }
+
+    /* Last parcel of cell 0 is deposited */
+
+    if (c_id == 0 && i == 8)
+      cs_lagr_particles_set_flag(p_set, p_id, CS_LAGR_PART_DEPOSITED);
+
+  }
+
+  return n_particles;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the conserved quantities of each cell.
+ *
+ * \param[out]  sums   conserved quantities (size: _N_CELLS*_N_SUMS)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cell_sums(cs_real_t  sums[])
+{
+  const cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
+
+  for (int i = 0; i < _N_CELLS*_N_SUMS; i++)
+    sums[i] = 0.;
+
+  for (cs_lnum_t p_id = 0; p_id < p_set->n_particles; p_id++) {
+
+    cs_lnum_t  c_id = cs_lagr_particles_get_lnum(p_set, p_id, CS_LAGR_CELL_ID);
+    cs_real_t  w = cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_STAT_WEIGHT);
+    cs_real_t  *s = sums + _N_SUMS*c_id;
+
+    if (cs_lagr_particles_get_flag(p_set, p_id, CS_LAGR_PART_DEPOSITED)) {
+      s[7] += 1.;
+      s[8] += w;
+      continue;
+    }
+
+    cs_real_t  m = cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_MASS);
+    cs_real_t  d = cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_DIAMETER);
+    const cs_real_t  *v
+      = cs_lagr_particles_attr_const(p_set, p_id, CS_LAGR_VELOCITY);
+
+    s[0] += 1.;
+    s[1] += w;
+    s[2] += w*m;
+    for (int k = 0; k < 3; k++)
+      s[3+k] += w*m*v[k];
+    s[6] += w*d*d*d;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply population control and compare the conserved quantities
+ *         of each cell before and after.
+ *
+ * \param[in]  out        output file
+ * \param[in]  name       name of the test
+ * \param[in]  n_parcels  expected number of parcels in flow per cell
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_control(FILE        *out,
+              const char  *name,
+              const int    n_parcels[])
+{
+  cs_real_t  s0[_N_CELLS*_N_SUMS], s1[_N_CELLS*_N_SUMS];
+
+  _define_particles();
+  _cell_sums(s0);
+
+  cs_lagr_population_control();
+
+  _cell_sums(s1);
+
+  for (int c_id = 0; c_id < _N_CELLS; c_id++) {
+
+    const cs_real_t  *a = s0 + _N_SUMS*c_id, *b = s1 + _N_SUMS*c_id;
+
+    double  max_err = 0.;
+    for (int i = 1; i < 7; i++)
+      max_err = CS_MAX(max_err, CS_ABS(b[i] - a[i]) / CS_ABS(a[i]));
+
+    bool  ok = (   max_err < 1e-12
+                && (int)b[0] == n_parcels[c_id]
+                && b[7] == a[7] && b[8] == a[8]);
+
+    fprintf(out, " %s: cell %d: %d -> %d parcels, max. rel. err. %5.3e %s\n",
+            name, c_id, (int)a[0], (int)b[0], max_err, (ok) ? "ok" : "FAILED");
+    if (!ok)
+      _n_failures += 1;
+
+  }
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  pop = fopen("LAGR_population_tests.log", "w");
+
+  cs_glob_mesh = cs_mesh_create();
+  cs_glob_mesh->n_cells = _N_CELLS;
+
+  cs_lagr_particle_attr_initialize();
+  cs_lagr_particle_set_create();
+
+  cs_lagr_population_model_t  *pm = cs_get_lagr_population_model();
+  cs_time_step_t  *ts = cs_get_glob_time_step();
+
+  pm->n_min_per_cell = 3;
+  pm->n_max_per_cell = 4;
+  pm->min_stat_weight = 1.;
+  pm->merge_tolerance = 0.1;
+
+  /* Merging in cell 0, splitting in cells 2 and 3 */
+
+  const int  n_parcels[_N_CELLS] = {4, 6, 2, 3};
+
+  pm->interval = 1;
+  ts->nt_cur = 1;
+
+  _test_control(pop, "control", n_parcels);
+
+  /* No control outside of the requested interval */
+
+  const int  n_parcels_ref[_N_CELLS] = {8, 6, 1, 2};
+
+  pm->interval = 2;
+  ts->nt_cur = 3;
+
+  _test_control(pop, "interval", n_parcels_ref);
+
+  cs_lagr_particle_finalize();
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+
+  fclose(pop);
+
+  if (_n_failures > 0)
+    printf("\n\n -->> Population Control Tests (%d failure(s),"
+           " see LAGR_population_tests.log)\n", _n_failures);
+  else
+    printf("\n\n -->> Population Control Tests (Done)\n");
+
+  exit((_n_failures > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
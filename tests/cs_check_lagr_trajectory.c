@@ -0,0 +1,424 @@
+/*============================================================================
+ * Unitary tests for the streaming output of particle attributes
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_parall.h"
+#include "cs_time_step.h"
+
+#include "cs_lagr_particle.h"
+#include "cs_lagr_trajectory.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *trj = NULL;
+static int  _n_failures = 0;
+
+/* Output attributes */
+
+static const int  _n_attrs = 2;
+static const cs_lagr_attribute_t  _attrs[2] = {CS_LAGR_COORDS,
+                                               CS_LAGR_VELOCITY};
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Number of particles on a given rank (the second rank has none)
+ *
+ * \param[in]  rank_id   rank id
+ *
+ * \return the local number of particles
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_n_rank_particles(int  rank_id)
+{
+  return (rank_id == 1) ? 0 : 5 + 3*rank_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Reference value of a particle attribute component
+ *
+ * \param[in]  nt       time step number
+ * \param[in]  a_id     attribute id in the output list
+ * \param[in]  g_id     global particle id
+ * \param[in]  k        component
+ *
+ * \return the reference value
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_ref_value(int        nt,
+           int        a_id,
+           cs_gnum_t  g_id,
+           int        k)
+{
+  return 1000.*nt + 100.*a_id + 3*g_id + k + 0.5;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the local particles and write them at the current time step
+ *
+ * \param[in]  nt       time step number
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_write_step(int  nt)
+{
+  cs_time_step_t  *ts = cs_get_glob_time_step();
+  cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
+
+  ts->nt_cur = nt;
+  ts->t_cur = 0.1*nt;
+
+  cs_gnum_t  g_shift = 0;
+  for (int r = 0; r < cs_glob_rank_id; r++)
+    g_shift += _n_rank_particles(r);
+
+  const cs_lnum_t  n_particles = _n_rank_particles(CS_MAX(cs_glob_rank_id, 0));
+
+  cs_lagr_particle_set_resize(n_particles);
+  p_set->n_particles = n_particles;
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    for (int a_id = 0; a_id < _n_attrs; a_id++) {
+      cs_real_t  *val = cs_lagr_particles_attr(p_set, i, _attrs[a_id]);
+      for (int k = 0; k < 3; k++)
+        val[k] = _ref_value(nt, a_id, g_shift + i, k);
+    }
+  }
+
+  cs_lagr_trajectory_write();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Read back the stream and index files and compare with the
+ *         reference values (on the first rank only)
+ *
+ * \param[in]  out       output file
+ * \param[in]  name      base name of the output files
+ * \param[in]  n_ranks   number of ranks
+ * \param[in]  n_recs    number of expected records
+ * \param[in]  nt_recs   time step number of each record
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_check_files(FILE        *out,
+             const char  *name,
+             int          n_ranks,
+             int          n_recs,
+             const int    nt_recs[])
+{
+  char  path[64], s[32];
+  int64_t  h[3];
+  bool  ok = true;
+
+  snprintf(path, 64, "postprocessing/%s.trj", name);
+  FILE  *f = fopen(path, "rb");
+  snprintf(path, 64, "postprocessing/%s.trj.idx", name);
+  FILE  *f_idx = fopen(path, "rb");
+
+  if (f == NULL || f_idx == NULL) {
+    fprintf(out, " %s: missing file(s) FAILED\n", name);
+    _n_failures += 1;
+    return;
+  }
+
+  /* File header */
+
+  if (fread(s, 1, 32, f) != 32 || strcmp(s, "Code_Saturne particle stream"))
+    ok = false;
+  if (fread(h, sizeof(int64_t), 3, f) != 3 || h[1] != _n_attrs || h[2] != 0)
+    ok = false;
+  for (int i = 0; i < _n_attrs; i++) {
+    int64_t  n_comp = 0;
+    if (   fread(s, 1, 32, f) != 32
+        || fread(&n_comp, sizeof(int64_t), 1, f) != 1
+        || strcmp(s, cs_lagr_attribute_name[_attrs[i]]) || n_comp != 3)
+      ok = false;
+  }
+
+  fprintf(out, " %s: header %s\n", name, (ok) ? "ok" : "FAILED");
+  if (!ok)
+    _n_failures += 1;
+
+  /* Records and index entries */
+
+  int64_t  *r_info = NULL;
+  double  *vals = NULL;
+  BFT_MALLOC(r_info, 3*n_ranks, int64_t);
+
+  for (int rec = 0; rec < n_recs; rec++) {
+
+    int64_t  r_header[3], i_entry[3];
+    double  t, t_idx;
+    double  max_diff = 0.;
+
+    ok = true;
+
+    long  rec_offset = ftell(f);
+
+    if (   fread(r_header, sizeof(int64_t), 3, f) != 3
+        || fread(&t, sizeof(double), 1, f) != 1
+        || fread(r_info, sizeof(int64_t), 3*n_ranks, f) != (size_t)(3*n_ranks))
+      ok = false;
+
+    if (   fread(i_entry, sizeof(int64_t), 1, f_idx) != 1
+        || fread(&t_idx, sizeof(double), 1, f_idx) != 1
+        || fread(i_entry + 1, sizeof(int64_t), 2, f_idx) != 2)
+      ok = false;
+
+    cs_gnum_t  n_g_particles = 0;
+    for (int r = 0; r < n_ranks; r++)
+      n_g_particles += _n_rank_particles(r);
+
+    if (   !ok || r_header[0] != nt_recs[rec] || r_header[1] != n_ranks
+        || r_header[2] != (int64_t)n_g_particles
+        || i_entry[0] != nt_recs[rec] || i_entry[1] != rec_offset
+        || i_entry[2] != (int64_t)n_g_particles || t_idx != t)
+      ok = false;
+
+    cs_gnum_t  g_shift = 0;
+
+    for (int r = 0; r < n_ranks && ok; r++) {
+
+      const cs_lnum_t  n_particles = _n_rank_particles(r);
+      const size_t  n_vals = 3*_n_attrs*n_particles;
+
+      if (   r_info[3*r] != n_particles
+          || r_info[3*r+1] != (int64_t)(n_vals*sizeof(double))
+          || r_info[3*r+2] != r_info[3*r+1]) {
+        ok = false;
+        break;
+      }
+
+      BFT_REALLOC(vals, n_vals + 1, double);
+      if (fread(vals, sizeof(double), n_vals, f) != n_vals) {
+        ok = false;
+        break;
+      }
+
+      /* Values of each attribute in turn, interlaced by particle */
+
+      for (int a_id = 0; a_id < _n_attrs; a_id++) {
+        const double  *a_vals = vals + 3*a_id*n_particles;
+        for (cs_lnum_t i = 0; i < n_particles; i++)
+          for (int k = 0; k < 3; k++) {
+            double  d = a_vals[3*i+k] - _ref_value(nt_recs[rec], a_id,
+                                                   g_shift + i, k);
+            max_diff = CS_MAX(max_diff, CS_ABS(d));
+          }
+      }
+
+      g_shift += n_particles;
+
+    }
+
+    if (max_diff > 0)
+      ok = false;
+
+    fprintf(out, " %s: record %d (nt = %d): max. diff. %5.3e %s\n",
+            name, rec, nt_recs[rec], max_diff, (ok) ? "ok" : "FAILED");
+    if (!ok)
+      _n_failures += 1;
+
+  }
+
+  /* No trailing data */
+
+  ok = (fgetc(f) == EOF && fgetc(f_idx) == EOF);
+  fprintf(out, " %s: end of files %s\n", name, (ok) ? "ok" : "FAILED");
+  if (!ok)
+    _n_failures += 1;
+
+  BFT_FREE(vals);
+  BFT_FREE(r_info);
+
+  fclose(f);
+  fclose(f_idx);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Write particle streams with a given access method, then append
+ *         to them as after a restart, and check the resulting files.
+ *
+ * \param[in]  out       output file
+ * \param[in]  name      base name of the output files
+ * \param[in]  method    file access method
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_stream(FILE              *out,
+             const char        *name,
+             cs_file_access_t   method)
+{
+  cs_time_step_t  *ts = cs_get_glob_time_step();
+
+#if defined(HAVE_MPI)
+  cs_file_set_default_access(CS_FILE_MODE_WRITE, method, MPI_INFO_NULL);
+#else
+  cs_file_set_default_access(CS_FILE_MODE_WRITE, method);
+#endif
+
+  /* First run */
+
+  ts->nt_prev = 0;
+
+  cs_lagr_trajectory_define(name, 1, _n_attrs, _attrs, false);
+  _write_step(1);
+  _write_step(2);
+  cs_lagr_trajectory_finalize();
+
+  /* Restarted run: records are appended */
+
+  ts->nt_prev = 2;
+
+  cs_lagr_trajectory_define(name, 1, _n_attrs, _attrs, false);
+  _write_step(3);
+  cs_lagr_trajectory_finalize();
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  if (cs_glob_rank_id < 1) {
+    const int  nt_recs[3] = {1, 2, 3};
+    _check_files(out, name, cs_glob_n_ranks, 3, nt_recs);
+  }
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#if defined(HAVE_MPI)
+  MPI_Init(&argc, &argv);
+
+  int  rank = 0, size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  if (size > 1) {
+    cs_glob_mpi_comm = MPI_COMM_WORLD;
+    cs_glob_rank_id = rank;
+    cs_glob_n_ranks = size;
+  }
+
+  /* Only every other rank is an I/O rank by default: all ranks should
+     nonetheless write their own particles */
+
+  cs_file_set_default_comm(2, 0, cs_glob_mpi_comm);
+#endif
+
+  if (cs_glob_rank_id < 1)
+    trj = fopen("LAGR_trajectory_tests.log", "w");
+
+  cs_lagr_particle_attr_initialize();
+  cs_lagr_particle_set_create();
+
+  _test_stream(trj, "stdio_serial", CS_FILE_STDIO_SERIAL);
+  _test_stream(trj, "stdio_parallel", CS_FILE_STDIO_PARALLEL);
+
+#if defined(HAVE_MPI_IO)
+  cs_file_set_mpi_io_positioning(CS_FILE_MPI_EXPLICIT_OFFSETS);
+  _test_stream(trj, "mpi_collective_eo", CS_FILE_MPI_COLLECTIVE);
+  cs_file_set_mpi_io_positioning(CS_FILE_MPI_INDIVIDUAL_POINTERS);
+  _test_stream(trj, "mpi_collective_ip", CS_FILE_MPI_COLLECTIVE);
+#endif
+
+  cs_lagr_particle_finalize();
+
+#if defined(HAVE_MPI)
+  cs_file_free_defaults();
+#endif
+
+  if (cs_glob_rank_id < 1) {
+
+    fclose(trj);
+
+    if (_n_failures > 0)
+      printf("\n\n -->> Trajectory Tests (%d failure(s),"
+             " see LAGR_trajectory_tests.log)\n", _n_failures);
+    else
+      printf("\n\n -->> Trajectory Tests (Done)\n");
+
+  }
+
+#if defined(HAVE_MPI)
+  cs_parall_max(1, CS_INT_TYPE, &_n_failures);
+  MPI_Finalize();
+#endif
+
+  exit((_n_failures > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,527 @@
+/*============================================================================
+ * Unitary tests for the solvers of saddle-point systems arising from the
+ * CDO-Fb discretization of the Navier-Stokes equations
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_equation_param.h"
+#include "cs_matrix.h"
+#include "cs_navsto_param.h"
+#include "cs_property.h"
+#include "cs_range_set.h"
+#include "cs_sles.h"
+#include "cs_sles_it.h"
+#include "cs_time_step.h"
+
+#include "cs_cdofb_monolithic_sles.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+/* Number of cells in each direction of the cartesian grid used for tests */
+
+#define _N_GRID  6
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *nsls = NULL;
+static int  _n_failures = 0;
+
+/* Cartesian grid of the unit cube (faces are numbered with interior faces
+   first, as in CDO structures) */
+
+static cs_lnum_t  _n_cells = 0;
+static cs_lnum_t  _n_faces = 0;
+static cs_lnum_t  _n_i_faces = 0;
+static cs_lnum_t  *_face_id = NULL;  /* (direction, i, j, k) -> face id */
+
+static cs_cdo_connect_t  _connect;
+static cs_cdo_quantities_t  _quant;
+static cs_real_t  *_face_normal = NULL;  /* interior then boundary faces */
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the position of a face in the (direction, i, j, k) numbering
+ *
+ * \param[in]  d   direction of the face normal
+ * \param[in]  ijk indices of the face (the one along d ranges in [0, n])
+ *
+ * \return the position of the face
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_face_pos(int        d,
+          const int  ijk[3])
+{
+  const int  n = _N_GRID;
+  int  dims[3] = {n, n, n};
+  dims[d] += 1;
+
+  return d*(n+1)*n*n + (ijk[2]*dims[1] + ijk[1])*dims[0] + ijk[0];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the connectivity and the quantities of the cartesian grid
+ *         needed by the solvers of the saddle-point system
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_build_grid(void)
+{
+  const int  n = _N_GRID;
+  const double  h = 1./n;
+
+  _n_cells = n*n*n;
+  _n_faces = 3*(n+1)*n*n;
+  _n_i_faces = 3*(n-1)*n*n;
+
+  /* Face numbering: interior faces then boundary faces */
+
+  BFT_MALLOC(_face_id, _n_faces, cs_lnum_t);
+
+  cs_lnum_t  i_id = 0, b_id = _n_i_faces;
+  for (int d = 0; d < 3; d++) {
+    int  dims[3] = {n, n, n};
+    dims[d] += 1;
+    int  ijk[3];
+    for (ijk[2] = 0; ijk[2] < dims[2]; ijk[2]++) {
+      for (ijk[1] = 0; ijk[1] < dims[1]; ijk[1]++) {
+        for (ijk[0] = 0; ijk[0] < dims[0]; ijk[0]++) {
+          if (ijk[d] == 0 || ijk[d] == n)
+            _face_id[_face_pos(d, ijk)] = b_id++;
+          else
+            _face_id[_face_pos(d, ijk)] = i_id++;
+        }
+      }
+    }
+  }
+
+  /* Cell -> faces connectivity (the normal of a face is oriented along the
+     increasing coordinate) */
+
+  memset(&_connect, 0, sizeof(cs_cdo_connect_t));
+
+  cs_adjacency_t  *c2f = cs_adjacency_create(CS_ADJACENCY_SIGNED, -1,
+                                             _n_cells);
+  BFT_MALLOC(c2f->ids, 6*_n_cells, cs_lnum_t);
+  BFT_MALLOC(c2f->sgn, 6*_n_cells, short int);
+
+  for (int k = 0; k < n; k++) {
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < n; i++) {
+        const cs_lnum_t  c_id = (k*n + j)*n + i;
+        c2f->idx[c_id+1] = 6*(c_id+1);
+        for (int d = 0; d < 3; d++) {
+          for (int s = 0; s < 2; s++) {
+            int  ijk[3] = {i, j, k};
+            ijk[d] += s;
+            const cs_lnum_t  shift = 6*c_id + 2*d + s;
+            c2f->ids[shift] = _face_id[_face_pos(d, ijk)];
+            c2f->sgn[shift] = (s == 0) ? -1 : 1;
+          }
+        }
+      }
+    }
+  }
+
+  _connect.c2f = c2f;
+
+  /* Quantities */
+
+  memset(&_quant, 0, sizeof(cs_cdo_quantities_t));
+
+  _quant.n_cells = _n_cells;
+  _quant.n_faces = _n_faces;
+  _quant.n_i_faces = _n_i_faces;
+  _quant.n_b_faces = _n_faces - _n_i_faces;
+
+  BFT_MALLOC(_quant.cell_vol, _n_cells, cs_real_t);
+  for (cs_lnum_t c_id = 0; c_id < _n_cells; c_id++)
+    _quant.cell_vol[c_id] = h*h*h;
+
+  BFT_MALLOC(_face_normal, 3*_n_faces, cs_real_t);
+  _quant.i_face_normal = _face_normal;
+  _quant.b_face_normal = _face_normal + 3*_n_i_faces;
+
+  for (int d = 0; d < 3; d++) {
+    int  dims[3] = {n, n, n};
+    dims[d] += 1;
+    int  ijk[3];
+    for (ijk[2] = 0; ijk[2] < dims[2]; ijk[2]++) {
+      for (ijk[1] = 0; ijk[1] < dims[1]; ijk[1]++) {
+        for (ijk[0] = 0; ijk[0] < dims[0]; ijk[0]++) {
+          const cs_lnum_t  f_id = _face_id[_face_pos(d, ijk)];
+          cs_real_t  *nf = _face_normal + 3*f_id;
+          for (int l = 0; l < 3; l++)
+            nf[l] = (l == d) ? h*h : 0.;
+        }
+      }
+    }
+  }
+
+  /* Dual edges are oriented as the face normals */
+
+  BFT_MALLOC(_quant.dedge_vector, 3*6*_n_cells, cs_real_t);
+  for (cs_lnum_t c_id = 0; c_id < _n_cells; c_id++) {
+    for (int d = 0; d < 3; d++) {
+      for (int s = 0; s < 2; s++) {
+        cs_real_t  *de = _quant.dedge_vector + 3*(6*c_id + 2*d + s);
+        for (int l = 0; l < 3; l++)
+          de[l] = (l == d) ? 0.5*h : 0.;
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free the cartesian grid structures
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_grid(void)
+{
+  cs_adjacency_destroy(&(_connect.c2f));
+
+  BFT_FREE(_quant.cell_vol);
+  BFT_FREE(_quant.dedge_vector);
+  BFT_FREE(_face_normal);
+
+  BFT_FREE(_face_id);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve a saddle-point system with the block-preconditioned FGMRES
+ *         strategy and a manufactured solution
+ *
+ * The velocity block is a cell-wise assembled vector Laplacian with a weak
+ * enforcement of wall conditions, augmented with the lumped mass term
+ * rho/dt.Mu for an unsteady system. The divergence operator is the one of
+ * CDO-Fb schemes on the cartesian grid.
+ *
+ * \param[in]  out       output file
+ * \param[in]  schur     type of approximation of the Schur complement
+ * \param[in]  dt        time step, or 0 for a steady system
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_block_fgmres(FILE                      *out,
+                   cs_navsto_schur_approx_t   schur,
+                   cs_real_t                  dt)
+{
+  const double  h = 1./_N_GRID;
+  const cs_real_t  nu = 1e-2, rho = 1.;
+  const cs_adjacency_t  *c2f = _connect.c2f;
+  const cs_lnum_t  n_u = 3*_n_faces;
+
+  /* Settings */
+
+  cs_navsto_param_t  *nsp = cs_navsto_param_create(NULL,
+                                                   CS_NAVSTO_MODEL_STOKES,
+                                                   CS_NAVSTO_COUPLING_MONOLITHIC,
+                                                   0,  /* option flag */
+                                                   0); /* post flag */
+
+  cs_navsto_param_set(nsp, CS_NSKEY_SLES_STRATEGY, "block_fgmres");
+  cs_navsto_param_set(nsp, CS_NSKEY_SCHUR_APPROX,
+                      (schur == CS_NAVSTO_SCHUR_DIAG_INVERSE) ?
+                      "diag_inverse" : "mass_scaled");
+  cs_navsto_param_set(nsp, CS_NSKEY_IL_ALGO_RTOL, "1e-10");
+  cs_navsto_param_set(nsp, CS_NSKEY_IL_ALGO_ATOL, "1e-14");
+  cs_navsto_param_set(nsp, CS_NSKEY_MAX_IL_ALGO_ITER, "500");
+
+  cs_property_def_iso_by_value(nsp->lami_viscosity, NULL, nu);
+  cs_property_def_iso_by_value(nsp->mass_density, NULL, rho);
+
+  cs_equation_param_t  *eqp = cs_equation_create_param("momentum",
+                                                       CS_EQUATION_TYPE_NAVSTO,
+                                                       3,
+                                                       CS_PARAM_BC_HMG_DIRICHLET);
+  if (dt > 0) {
+    eqp->flag |= CS_EQUATION_UNSTEADY;
+    cs_get_glob_time_step()->dt[0] = dt;
+  }
+
+  /* Velocity block (per component, couplings between faces of a cell) */
+
+  const cs_lnum_t  n_c_edges = 3*15;
+  const cs_lnum_t  n_edges = n_c_edges*_n_cells;
+  cs_lnum_2_t  *edges = NULL;
+  cs_real_t  *da = NULL, *xa = NULL;
+
+  BFT_MALLOC(edges, n_edges, cs_lnum_2_t);
+  BFT_MALLOC(xa, n_edges, cs_real_t);
+  BFT_MALLOC(da, n_u, cs_real_t);
+
+  const cs_real_t  w = nu*h;
+  const cs_real_t  m_fc = (dt > 0) ? rho/dt * h*h*h/6. : 0.;
+
+  for (cs_lnum_t i = 0; i < n_u; i++)
+    da[i] = 0.;
+
+  cs_lnum_t  e_id = 0;
+  for (cs_lnum_t c_id = 0; c_id < _n_cells; c_id++) {
+    const cs_lnum_t  *f_ids = c2f->ids + c2f->idx[c_id];
+    for (int a = 0; a < 6; a++) {
+      for (int l = 0; l < 3; l++)
+        da[3*f_ids[a] + l] += 5.*w/6. + m_fc;
+      for (int b = a+1; b < 6; b++) {
+        for (int l = 0; l < 3; l++) {
+          edges[e_id][0] = 3*f_ids[a] + l;
+          edges[e_id][1] = 3*f_ids[b] + l;
+          xa[e_id] = -w/6.;
+          e_id++;
+        }
+      }
+    }
+  }
+  assert(e_id == n_edges);
+
+  for (cs_lnum_t f_id = _n_i_faces; f_id < _n_faces; f_id++)
+    for (int l = 0; l < 3; l++)
+      da[3*f_id + l] += 2*w;
+
+  cs_matrix_structure_t  *ms
+    = cs_matrix_structure_create(CS_MATRIX_CSR,
+                                 true,
+                                 n_u,
+                                 n_u,
+                                 n_edges,
+                                 (const cs_lnum_2_t *)edges,
+                                 NULL,
+                                 NULL);
+  cs_matrix_t  *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a,
+                             true,
+                             NULL,
+                             NULL,
+                             n_edges,
+                             (const cs_lnum_2_t *)edges,
+                             da,
+                             xa);
+
+  /* Saddle-point system */
+
+  cs_range_set_t  *rset = cs_range_set_create(NULL, NULL, n_u, false, 0);
+
+  cs_cdofb_monolithic_sles_set_shared(&_connect, &_quant, rset);
+
+  cs_cdofb_monolithic_sles_t  *msles = cs_cdofb_monolithic_sles_create();
+
+  cs_cdofb_monolithic_sles_init(_n_cells, _n_faces, msles);
+
+  msles->n_row_blocks = 1;
+  BFT_MALLOC(msles->block_matrices, 1, cs_matrix_t *);
+  msles->block_matrices[0] = a;
+
+  BFT_MALLOC(msles->div_op, 3*c2f->idx[_n_cells], cs_real_t);
+  for (cs_lnum_t c_id = 0; c_id < _n_cells; c_id++) {
+    for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++) {
+      const int  d = (j - c2f->idx[c_id])/2;
+      for (int l = 0; l < 3; l++)
+        msles->div_op[3*j + l] = (l == d) ? -c2f->sgn[j]*h*h : 0.;
+    }
+  }
+
+  cs_sles_it_define(-1, "navsto_test_u", CS_SLES_PCG, 0, 10000);
+  msles->sles = cs_sles_find(-1, "navsto_test_u");
+
+  /* Manufactured solution and right-hand side */
+
+  cs_real_t  *u_ref = NULL, *p_ref = NULL;
+  BFT_MALLOC(u_ref, n_u, cs_real_t);
+  BFT_MALLOC(p_ref, _n_cells, cs_real_t);
+  BFT_MALLOC(msles->u_f, n_u, cs_real_t);
+  BFT_MALLOC(msles->p_c, _n_cells, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_u; i++) {
+    u_ref[i] = sin(0.37*i) + 0.1*(i%3);
+    msles->u_f[i] = 0.;
+  }
+  for (cs_lnum_t c_id = 0; c_id < _n_cells; c_id++) {
+    p_ref[c_id] = cos(0.21*c_id);
+    msles->p_c[c_id] = 0.;
+  }
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_IGNORE, a, u_ref, msles->b_f);
+
+  for (cs_lnum_t c_id = 0; c_id < _n_cells; c_id++) {
+    msles->b_c[c_id] = 0.;
+    for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++) {
+      const cs_real_t  *_div = msles->div_op + 3*j;
+      cs_real_t  *_b_f = msles->b_f + 3*c2f->ids[j];
+      for (int l = 0; l < 3; l++) {
+        _b_f[l] += _div[l]*p_ref[c_id];
+        msles->b_c[c_id] += _div[l]*u_ref[3*c2f->ids[j] + l];
+      }
+    }
+  }
+
+  /* Solve and compare with the manufactured solution */
+
+  int  n_iter = cs_cdofb_monolithic_block_fgmres_solve(nsp, eqp, msles);
+
+  double  u_err = 0., u_nrm = 0., p_err = 0., p_nrm = 0.;
+  for (cs_lnum_t i = 0; i < n_u; i++) {
+    u_err += (msles->u_f[i] - u_ref[i])*(msles->u_f[i] - u_ref[i]);
+    u_nrm += u_ref[i]*u_ref[i];
+  }
+  for (cs_lnum_t c_id = 0; c_id < _n_cells; c_id++) {
+    p_err += (msles->p_c[c_id] - p_ref[c_id])*(msles->p_c[c_id] - p_ref[c_id]);
+    p_nrm += p_ref[c_id]*p_ref[c_id];
+  }
+  u_err = sqrt(u_err/u_nrm);
+  p_err = sqrt(p_err/p_nrm);
+
+  bool  ok = (n_iter > 0 && u_err < 1e-6 && p_err < 1e-6);
+
+  fprintf(out, "\n Block FGMRES (%s Schur approximation, %s system)\n",
+          (schur == CS_NAVSTO_SCHUR_DIAG_INVERSE) ?
+          "diag_inverse" : "mass_scaled",
+          (dt > 0) ? "unsteady" : "steady");
+  fprintf(out, "  inner iter: %d; rel. error u: % .4e p: % .4e %s\n",
+          n_iter, u_err, p_err, (ok) ? "ok" : "FAILED");
+
+  if (!ok)
+    _n_failures++;
+
+  /* Free memory */
+
+  BFT_FREE(msles->u_f);
+  BFT_FREE(msles->p_c);
+  BFT_FREE(u_ref);
+  BFT_FREE(p_ref);
+
+  cs_cdofb_monolithic_sles_clean(msles);
+  cs_cdofb_monolithic_sles_free(&msles);
+
+  cs_range_set_destroy(&rset);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(edges);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+
+  eqp = cs_equation_free_param(eqp);
+  nsp = cs_navsto_param_free(nsp);
+  cs_property_destroy_all();
+  cs_sles_finalize();
+}
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+  {
+    int t_id;
+#pragma omp parallel private(t_id)
+    {
+      t_id = omp_get_thread_num();
+      if (t_id == 0)
+        cs_glob_n_threads = omp_get_max_threads();
+    }
+  }
+#endif
+
+  nsls = fopen("NAVSTO_SLES_tests.log", "w");
+
+  _build_grid();
+
+  /* ==========================================
+   * TEST on the block-preconditioned FGMRES
+   * ========================================== */
+
+  _test_block_fgmres(nsls, CS_NAVSTO_SCHUR_MASS_SCALED, 0.);
+  _test_block_fgmres(nsls, CS_NAVSTO_SCHUR_DIAG_INVERSE, 0.);
+  _test_block_fgmres(nsls, CS_NAVSTO_SCHUR_MASS_SCALED, 1e-3);
+  _test_block_fgmres(nsls, CS_NAVSTO_SCHUR_DIAG_INVERSE, 1e-3);
+
+  _free_grid();
+
+  fclose(nsls);
+
+  if (_n_failures > 0) {
+    printf("\n\n -->> NAVSTO SLES Tests (%d failure(s),"
+           " see NAVSTO_SLES_tests.log)\n", _n_failures);
+    exit(EXIT_FAILURE);
+  }
+
+  printf("\n\n -->> NAVSTO SLES Tests (Done)\n");
+  exit(EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,599 @@
+/*============================================================================
+ * Unitary tests for checkpoint files
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_io.h"
+#include "cs_mesh.h"
+#include "cs_parall.h"
+#include "cs_restart.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *rst = NULL;
+static int  _n_failures = 0;
+
+/* Local entities of the test location */
+
+static cs_lnum_t  _n_ents = 0;
+static cs_gnum_t  _n_g_ents = 0;
+static cs_gnum_t  *_g_num = NULL;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Log the result of a check (on the first rank only)
+ *
+ * \param[in]  out    output file
+ * \param[in]  ok     result of the check on the local rank
+ * \param[in]  fmt    format of the description, followed by arguments
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_log_check(FILE        *out,
+           bool         ok,
+           const char  *fmt,
+           ...)
+{
+  int  _ok = (ok) ? 1 : 0;
+  cs_parall_min(1, CS_INT_TYPE, &_ok);
+
+  if (cs_glob_rank_id < 1) {
+    va_list  arg_ptr;
+    va_start(arg_ptr, fmt);
+    vfprintf(out, fmt, arg_ptr);
+    va_end(arg_ptr);
+    fprintf(out, ": %s\n", (_ok) ? "ok" : "FAILED");
+  }
+
+  if (!_ok)
+    _n_failures += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the entities of the test location (a different number of
+ *         entities on each rank)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_define_location(void)
+{
+  const int  rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  cs_gnum_t  g_shift = 0;
+  for (int r = 0; r < rank_id; r++)
+    g_shift += 100 + 7*r;
+
+  _n_ents = 100 + 7*rank_id;
+  _n_g_ents = _n_ents;
+  cs_parall_counter(&_n_g_ents, 1);
+
+  BFT_MALLOC(_g_num, _n_ents, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < _n_ents; i++)
+    _g_num[i] = g_shift + i + 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the values of a section
+ *
+ * \param[in]   s_id      section id
+ * \param[in]   version   version of the values
+ * \param[out]  val       values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_set_values(int         s_id,
+            int         version,
+            cs_real_t  *val)
+{
+  for (cs_lnum_t i = 0; i < _n_ents; i++)
+    val[i] = 1e6*s_id + 1e3*version + _g_num[i];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Read the sections of a checkpoint and compare with the expected
+ *         versions of their values
+ *
+ * \param[in]  out       output file
+ * \param[in]  dir       checkpoint directory
+ * \param[in]  versions  expected version of each section (per rank)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_check_checkpoint(FILE        *out,
+                  const char  *dir,
+                  const int    versions[2])
+{
+  const char  *sec_names[2] = {"section_a", "section_b"};
+
+  cs_real_t  *val = NULL, *ref = NULL;
+  BFT_MALLOC(val, _n_ents, cs_real_t);
+  BFT_MALLOC(ref, _n_ents, cs_real_t);
+
+  cs_restart_t  *r = cs_restart_create("main.csc", dir, CS_RESTART_MODE_READ);
+
+  int  loc_id = cs_restart_add_location(r, "test", _n_g_ents, _n_ents,
+                                        _g_num);
+
+  for (int s_id = 0; s_id < 2; s_id++) {
+
+    int  retval = cs_restart_read_section(r, sec_names[s_id], loc_id, 1,
+                                          CS_TYPE_cs_real_t, val);
+
+    _set_values(s_id, versions[s_id], ref);
+
+    bool  ok = (retval == CS_RESTART_SUCCESS);
+    for (cs_lnum_t i = 0; i < _n_ents && ok; i++)
+      if (val[i] != ref[i])
+        ok = false;
+
+    _log_check(out, ok, "  %s/main.csc: %s", dir, sec_names[s_id]);
+
+  }
+
+  cs_restart_destroy(&r);
+
+  BFT_FREE(ref);
+  BFT_FREE(val);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Test incremental checkpoints: unchanged sections reference the
+ *         previous checkpoint file containing their values, and referenced
+ *         files are kept as long as a retained checkpoint needs them.
+ *
+ * \param[in]  out       output file
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_incremental(FILE  *out)
+{
+  const char  *sec_names[2] = {"section_a", "section_b"};
+
+  /* Versions of the values of each section for successive checkpoints.
+     Section B of the last checkpoint is only modified on the last rank. */
+
+  const int  n_checkpoints = 6;
+  const int  versions[6][2] = {{1, 1}, {1, 2}, {3, 2}, {3, 2}, {5, 5}, {5, 6}};
+
+  /* Previous checkpoint files expected to be present after each checkpoint
+     (the current and the previous checkpoint are retained, and files
+     referenced by them, even indirectly, are kept) */
+
+  const bool  present[6][5] = {{0, 0, 0, 0, 0},
+                               {1, 0, 0, 0, 0},
+                               {1, 1, 0, 0, 0},
+                               {1, 1, 1, 0, 0},
+                               {1, 1, 1, 1, 0},
+                               {0, 0, 0, 0, 1}};
+
+  cs_real_t  *val = NULL;
+  BFT_MALLOC(val, _n_ents, cs_real_t);
+
+  cs_restart_set_n_max_checkpoints(2);
+  cs_restart_set_incremental(10);
+
+  if (cs_glob_rank_id < 1)
+    fprintf(out, "\nIncremental checkpoints\n");
+
+  for (int c_id = 0; c_id < n_checkpoints; c_id++) {
+
+    cs_restart_t  *r = cs_restart_create("main.csc", "checkpoint",
+                                         CS_RESTART_MODE_WRITE);
+
+    int  loc_id = cs_restart_add_location(r, "test", _n_g_ents, _n_ents,
+                                          _g_num);
+
+    for (int s_id = 0; s_id < 2; s_id++) {
+      int  version = versions[c_id][s_id];
+      if (version == 6 && cs_glob_rank_id < cs_glob_n_ranks - 1)
+        version = 5;
+      _set_values(s_id, version, val);
+      cs_restart_write_section(r, sec_names[s_id], loc_id, 1,
+                               CS_TYPE_cs_real_t, val);
+    }
+
+    cs_restart_destroy(&r);
+
+    cs_restart_clean_multiwriters_history();
+
+    if (cs_glob_rank_id < 1)
+      fprintf(out, " Checkpoint %d\n", c_id);
+
+    /* Presence of previous checkpoint files */
+
+    for (int f_id = 0; f_id < c_id; f_id++) {
+      char  path[64];
+      snprintf(path, 64, "checkpoint/previous_dump_%04d/main.csc", f_id);
+      int  is_present = 0;
+      if (cs_glob_rank_id < 1)
+        is_present = cs_file_isreg(path);
+      cs_parall_bcast(0, 1, CS_INT_TYPE, &is_present);
+      _log_check(out, (is_present != 0) == present[c_id][f_id],
+                 "  %s %s", path, (present[c_id][f_id]) ? "kept" : "removed");
+    }
+
+    /* All remaining checkpoints are readable */
+
+    int  cur_versions[2] = {versions[c_id][0], versions[c_id][1]};
+    if (cur_versions[1] == 6 && cs_glob_rank_id < cs_glob_n_ranks - 1)
+      cur_versions[1] = 5;
+
+    _check_checkpoint(out, "checkpoint", cur_versions);
+
+    for (int f_id = 0; f_id < c_id; f_id++) {
+      if (present[c_id][f_id]) {
+        char  path[64];
+        snprintf(path, 64, "checkpoint/previous_dump_%04d", f_id);
+        _check_checkpoint(out, path, versions[f_id]);
+      }
+    }
+
+  }
+
+  cs_restart_multiwriters_destroy_all();
+
+  BFT_FREE(val);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the bounds of the block of a rank, for a distribution in
+ *         which block sizes are proportional to (rank_id + 1)^p
+ *
+ * \param[in]   n_g       global number of values
+ * \param[in]   p         exponent of the distribution
+ * \param[out]  g_range   global numbers of the first and past-the-end values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_uneven_block(cs_gnum_t  n_g,
+              int        p,
+              cs_gnum_t  g_range[2])
+{
+  const int  rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  double  w_tot = 0, w_s = 0;
+  for (int r = 0; r < cs_glob_n_ranks; r++) {
+    double  w = pow(r + 1, p);
+    if (r < rank_id)
+      w_s += w;
+    w_tot += w;
+  }
+
+  g_range[0] = 1 + n_g*w_s/w_tot;
+  g_range[1] = 1 + n_g*(w_s + pow(rank_id + 1, p))/w_tot;
+  if (rank_id == cs_glob_n_ranks - 1)
+    g_range[1] = n_g + 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Test compressed sections: sections written by blocks with a given
+ *         distribution are read back by blocks with another distribution,
+ *         and globally.
+ *
+ * \param[in]  out       output file
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_compressed_io(FILE  *out)
+{
+  const char  magic_string[] = "Compressed sections test, R0";
+  const char  file_name[] = "compressed_sections.bin";
+  const cs_gnum_t  n_g = 20000;
+
+  if (cs_glob_rank_id < 1)
+    fprintf(out, "\nCompressed sections\n");
+
+  cs_file_access_t  method;
+
+  /* Write two sections, with blocks growing with the rank id */
+
+  cs_gnum_t  w_range[2];
+  _uneven_block(n_g, 1, w_range);
+
+  cs_lnum_t  n_w = w_range[1] - w_range[0];
+  double  *val = NULL;
+  BFT_MALLOC(val, n_g, double);
+
+#if defined(HAVE_MPI)
+  MPI_Info  hints;
+  cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+  cs_io_t  *outp = cs_io_initialize(file_name,
+                                    magic_string,
+                                    CS_IO_MODE_WRITE,
+                                    method,
+                                    CS_IO_ECHO_NONE,
+                                    hints,
+                                    cs_glob_mpi_comm,
+                                    cs_glob_mpi_comm);
+#else
+  cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+  cs_io_t  *outp = cs_io_initialize(file_name,
+                                    magic_string,
+                                    CS_IO_MODE_WRITE,
+                                    method,
+                                    CS_IO_ECHO_NONE);
+#endif
+
+  cs_io_set_compression(outp, 1);
+
+  const char  *sec_names[2] = {"values_block", "values_global"};
+
+  for (int s_id = 0; s_id < 2; s_id++) {
+    for (cs_lnum_t i = 0; i < n_w; i++)
+      val[i] = 0.5*(w_range[0] + i) + s_id;
+    cs_io_write_block_buffer(sec_names[s_id],
+                             n_g,
+                             w_range[0],
+                             w_range[1],
+                             0, 0, 1,
+                             CS_DOUBLE,
+                             val,
+                             outp);
+  }
+
+  cs_io_finalize(&outp);
+
+  /* Sections are compressed */
+
+  cs_file_off_t  f_size = 0;
+  if (cs_glob_rank_id < 1)
+    f_size = cs_file_size(file_name);
+  int  is_small = (f_size < (cs_file_off_t)(n_g*sizeof(double))) ? 1 : 0;
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &is_small);
+
+  _log_check(out, is_small, "  file size smaller than values");
+
+  /* Read by blocks shrinking with the rank id, then globally */
+
+  cs_gnum_t  r_range[2];
+  _uneven_block(n_g, -1, r_range);
+
+#if defined(HAVE_MPI)
+  cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
+  cs_io_t  *inp = cs_io_initialize(file_name,
+                                   magic_string,
+                                   CS_IO_MODE_READ,
+                                   method,
+                                   CS_IO_ECHO_NONE,
+                                   hints,
+                                   cs_glob_mpi_comm,
+                                   cs_glob_mpi_comm);
+#else
+  cs_file_get_default_access(CS_FILE_MODE_READ, &method);
+  cs_io_t  *inp = cs_io_initialize(file_name,
+                                   magic_string,
+                                   CS_IO_MODE_READ,
+                                   method,
+                                   CS_IO_ECHO_NONE);
+#endif
+
+  for (int s_id = 0; s_id < 2; s_id++) {
+
+    cs_io_sec_header_t  header;
+    cs_io_read_header(inp, &header);
+
+    bool  ok = (strcmp(header.sec_name, sec_names[s_id]) == 0);
+    cs_gnum_t  g_s = 1, g_e = n_g + 1;
+
+    if (ok) {
+      if (s_id == 0) {
+        g_s = r_range[0];
+        g_e = r_range[1];
+        cs_io_read_block(&header, g_s, g_e, val, inp);
+      }
+      else
+        cs_io_read_global(&header, val, inp);
+    }
+
+    for (cs_gnum_t g = g_s; g < g_e && ok; g++) {
+      if (val[g - g_s] != 0.5*g + s_id)
+        ok = false;
+    }
+
+    _log_check(out, ok, "  %s: %s read", sec_names[s_id],
+               (s_id == 0) ? "block" : "global");
+
+  }
+
+  cs_io_finalize(&inp);
+
+  BFT_FREE(val);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Test compressed checkpoints: values written and read by sections
+ *         associated with a location are identical.
+ *
+ * \param[in]  out       output file
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_compressed_checkpoint(FILE  *out)
+{
+  const char  *sec_names[2] = {"section_a", "section_b"};
+  const cs_lnum_t  n_vals = 20*_n_ents;
+
+  cs_real_t  *val = NULL, *ref = NULL;
+  BFT_MALLOC(val, n_vals, cs_real_t);
+  BFT_MALLOC(ref, n_vals, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < _n_ents; i++) {
+    for (int j = 0; j < 20; j++)
+      ref[i*20 + j] = 1e3*j + _g_num[i];
+  }
+
+  if (cs_glob_rank_id < 1)
+    fprintf(out, "\nCompressed checkpoint\n");
+
+  cs_restart_set_compression(1);
+
+  cs_restart_t  *r = cs_restart_create("compressed.csc", "checkpoint",
+                                       CS_RESTART_MODE_WRITE);
+
+  int  loc_id = cs_restart_add_location(r, "test", _n_g_ents, _n_ents,
+                                        _g_num);
+
+  for (int s_id = 0; s_id < 2; s_id++)
+    cs_restart_write_section(r, sec_names[s_id], loc_id, 20,
+                             CS_TYPE_cs_real_t, ref);
+
+  cs_restart_destroy(&r);
+
+  cs_restart_set_compression(0);
+
+  r = cs_restart_create("compressed.csc", "checkpoint", CS_RESTART_MODE_READ);
+
+  loc_id = cs_restart_add_location(r, "test", _n_g_ents, _n_ents, _g_num);
+
+  for (int s_id = 0; s_id < 2; s_id++) {
+
+    int  retval = cs_restart_read_section(r, sec_names[s_id], loc_id, 20,
+                                          CS_TYPE_cs_real_t, val);
+
+    bool  ok = (retval == CS_RESTART_SUCCESS);
+    for (cs_lnum_t i = 0; i < n_vals && ok; i++)
+      if (val[i] != ref[i])
+        ok = false;
+
+    _log_check(out, ok, "  compressed.csc: %s", sec_names[s_id]);
+
+  }
+
+  cs_restart_destroy(&r);
+
+  cs_restart_multiwriters_destroy_all();
+
+  BFT_FREE(ref);
+  BFT_FREE(val);
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#if defined(HAVE_MPI)
+  MPI_Init(&argc, &argv);
+
+  int  rank = 0, size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  if (size > 1) {
+    cs_glob_mpi_comm = MPI_COMM_WORLD;
+    cs_glob_rank_id = rank;
+    cs_glob_n_ranks = size;
+  }
+#endif
+
+  if (cs_glob_rank_id < 1)
+    rst = fopen("RESTART_tests.log", "w");
+
+  cs_glob_mesh = cs_mesh_create();
+
+  _define_location();
+
+  _test_incremental(rst);
+
+  _test_compressed_io(rst);
+  _test_compressed_checkpoint(rst);
+
+  BFT_FREE(_g_num);
+
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+
+  if (cs_glob_rank_id < 1) {
+
+    fclose(rst);
+
+    if (_n_failures > 0)
+      printf("\n\n -->> Restart Tests (%d failure(s),"
+             " see RESTART_tests.log)\n", _n_failures);
+    else
+      printf("\n\n -->> Restart Tests (Done)\n");
+
+  }
+
+#if defined(HAVE_MPI)
+  MPI_Finalize();
+#endif
+
+  exit((_n_failures > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,453 @@
+/*============================================================================
+ * Unitary tests for the built-in sparse LDL^T direct solver
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_matrix.h"
+#include "cs_renumber.h"
+#include "cs_sles_ldlt.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+/* Size of the (n x n) cartesian grid used for tests */
+
+#define _N_GRID  24
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *ldlt = NULL;
+static int  _n_failures = 0;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Build the edges of a 5-point stencil on a n x n cartesian grid
+ *
+ * \param[in]   n        number of cells in each direction
+ * \param[out]  edges    pointer to edges (allocated here)
+ *
+ * \return the number of edges
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_grid_edges(int             n,
+            cs_lnum_2_t   **edges)
+{
+  cs_lnum_t  n_edges = 0;
+  cs_lnum_2_t  *_edges = NULL;
+
+  BFT_MALLOC(_edges, 2*n*(n-1), cs_lnum_2_t);
+
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < n; i++) {
+      if (i < n-1) {
+        _edges[n_edges][0] = j*n + i;
+        _edges[n_edges][1] = j*n + i+1;
+        n_edges++;
+      }
+      if (j < n-1) {
+        _edges[n_edges][0] = j*n + i;
+        _edges[n_edges][1] = (j+1)*n + i;
+        n_edges++;
+      }
+    }
+  }
+
+  *edges = _edges;
+
+  return n_edges;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Count the number of entries of the strict lower part of the
+ *          factor of a symmetric matrix with a given ordering, using its
+ *          elimination tree
+ *
+ * \param[in]  n_elts      number of elements in graph
+ * \param[in]  elt_idx     element -> neighbors index
+ * \param[in]  elt_nbr     element -> neighbors connectivity
+ * \param[in]  new_to_old  new to old element numbering
+ *
+ * \return the number of entries of L
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_factor_size(cs_lnum_t         n_elts,
+             const cs_lnum_t   elt_idx[],
+             const cs_lnum_t   elt_nbr[],
+             const cs_lnum_t   new_to_old[])
+{
+  cs_lnum_t  n_l = 0;
+  cs_lnum_t  *old_to_new = NULL, *parent = NULL, *flag = NULL;
+
+  BFT_MALLOC(old_to_new, n_elts, cs_lnum_t);
+  BFT_MALLOC(parent, n_elts, cs_lnum_t);
+  BFT_MALLOC(flag, n_elts, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    old_to_new[new_to_old[i]] = i;
+
+  for (cs_lnum_t k = 0; k < n_elts; k++) {
+
+    parent[k] = -1;
+    flag[k] = k;
+
+    const cs_lnum_t  o_k = new_to_old[k];
+    for (cs_lnum_t l = elt_idx[o_k]; l < elt_idx[o_k+1]; l++) {
+      cs_lnum_t  i = old_to_new[elt_nbr[l]];
+      if (i > k)
+        continue;
+      for (; flag[i] != k; i = parent[i]) {
+        if (parent[i] == -1)
+          parent[i] = k;
+        n_l++;
+        flag[i] = k;
+      }
+    }
+
+  }
+
+  BFT_FREE(flag);
+  BFT_FREE(parent);
+  BFT_FREE(old_to_new);
+
+  return n_l;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check the fill-reducing ordering of the adjacency graph of a
+ *          cartesian grid: it should be a permutation leading to less fill-in
+ *          than the lexicographic numbering
+ *
+ * \param[in]  out     output file
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_ordering(FILE  *out)
+{
+  const int  n = _N_GRID;
+  const cs_lnum_t  n_elts = n*n;
+
+  cs_lnum_2_t  *edges = NULL;
+  cs_lnum_t  n_edges = _grid_edges(n, &edges);
+
+  cs_lnum_t  *elt_idx = NULL, *elt_nbr = NULL, *new_to_old = NULL;
+  BFT_MALLOC(elt_idx, n_elts + 1, cs_lnum_t);
+  BFT_MALLOC(elt_nbr, 2*n_edges, cs_lnum_t);
+  BFT_MALLOC(new_to_old, n_elts, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_elts + 1; i++)
+    elt_idx[i] = 0;
+  for (cs_lnum_t e = 0; e < n_edges; e++) {
+    elt_idx[edges[e][0] + 1] += 1;
+    elt_idx[edges[e][1] + 1] += 1;
+  }
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    elt_idx[i+1] += elt_idx[i];
+  for (cs_lnum_t e = 0; e < n_edges; e++) {
+    elt_nbr[elt_idx[edges[e][0]]++] = edges[e][1];
+    elt_nbr[elt_idx[edges[e][1]]++] = edges[e][0];
+  }
+  for (cs_lnum_t i = n_elts; i > 0; i--)
+    elt_idx[i] = elt_idx[i-1];
+  elt_idx[0] = 0;
+
+  cs_renumber_fill_reducing_order(n_elts, elt_idx, elt_nbr, new_to_old);
+
+  /* Check that this is a permutation */
+
+  bool  is_perm = true;
+  cs_lnum_t  *count = NULL;
+  BFT_MALLOC(count, n_elts, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    count[i] = 0;
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    if (new_to_old[i] < 0 || new_to_old[i] >= n_elts)
+      is_perm = false;
+    else
+      count[new_to_old[i]] += 1;
+  }
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    if (count[i] != 1)
+      is_perm = false;
+
+  BFT_FREE(count);
+
+  fprintf(out, "\n Fill-reducing ordering (%d x %d grid)\n", n, n);
+  fprintf(out, "  permutation: %s\n", (is_perm) ? "ok" : "FAILED");
+
+  if (!is_perm) {
+    _n_failures++;
+  }
+  else {
+
+    cs_lnum_t  *id = NULL;
+    BFT_MALLOC(id, n_elts, cs_lnum_t);
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      id[i] = i;
+
+    cs_lnum_t  n_l_ref = _factor_size(n_elts, elt_idx, elt_nbr, id);
+    cs_lnum_t  n_l = _factor_size(n_elts, elt_idx, elt_nbr, new_to_old);
+
+    BFT_FREE(id);
+
+    fprintf(out, "  entries of L: %ld (lexicographic numbering: %ld) %s\n",
+            (long)n_l, (long)n_l_ref, (n_l < n_l_ref) ? "ok" : "FAILED");
+
+    if (n_l >= n_l_ref)
+      _n_failures++;
+
+  }
+
+  BFT_FREE(new_to_old);
+  BFT_FREE(elt_nbr);
+  BFT_FREE(elt_idx);
+  BFT_FREE(edges);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Solve a system built on a 5-point stencil of a cartesian grid
+ *          and compare the solution with the reference one
+ *
+ * \param[in]  out       output file
+ * \param[in]  m_type    matrix type
+ * \param[in]  neumann   pure Neumann (singular) system if true
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_solve(FILE              *out,
+            cs_matrix_type_t   m_type,
+            bool               neumann)
+{
+  const int  n = _N_GRID;
+  const cs_lnum_t  n_rows = n*n;
+  const cs_lnum_t  diag_block_size[4] = {1, 1, 1, 1};
+  const cs_lnum_t  extra_diag_block_size[4] = {1, 1, 1, 1};
+
+  cs_lnum_2_t  *edges = NULL;
+  cs_lnum_t  n_edges = _grid_edges(n, &edges);
+
+  cs_real_t  *da = NULL, *xa = NULL, *x_ref = NULL, *x = NULL, *rhs = NULL;
+  BFT_MALLOC(da, n_rows, cs_real_t);
+  BFT_MALLOC(xa, n_edges, cs_real_t);
+  BFT_MALLOC(x_ref, n_rows, cs_real_t);
+  BFT_MALLOC(x, n_rows, cs_real_t);
+  BFT_MALLOC(rhs, n_rows, cs_real_t);
+
+  /* Variable coefficients; rows of a pure Neumann system sum to zero,
+     otherwise the diagonal is increased (Dirichlet-like condition) */
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    da[i] = (neumann) ? 0. : 0.1 + 0.01*(i%7);
+
+  for (cs_lnum_t e = 0; e < n_edges; e++) {
+    xa[e] = -(1. + 0.5*((edges[e][0] + 2*edges[e][1]) % 5));
+    da[edges[e][0]] -= xa[e];
+    da[edges[e][1]] -= xa[e];
+  }
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    x_ref[i] = sin(0.3*i) + 0.01*i;
+
+  cs_matrix_structure_t  *ms
+    = cs_matrix_structure_create(m_type,
+                                 true,
+                                 n_rows,
+                                 n_rows,
+                                 n_edges,
+                                 (const cs_lnum_2_t *)edges,
+                                 NULL,
+                                 NULL);
+  cs_matrix_t  *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a,
+                             true,
+                             diag_block_size,
+                             extra_diag_block_size,
+                             n_edges,
+                             (const cs_lnum_2_t *)edges,
+                             da,
+                             xa);
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_IGNORE, a, x_ref, rhs);
+
+  /* Factorize once, solve twice (the second solve reuses the factor) */
+
+  cs_sles_ldlt_t  *c = cs_sles_ldlt_create(0);
+
+  cs_sles_ldlt_setup(c, "ldlt_test", a, 0);
+
+  double  r_norm = 0.;
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    r_norm += rhs[i]*rhs[i];
+  r_norm = sqrt(r_norm);
+
+  double  err_max = 0., residue = 0.;
+  int  n_iter = 0;
+  cs_sles_convergence_state_t  cvg = CS_SLES_CONVERGED;
+
+  for (int s_id = 0; s_id < 2; s_id++) {
+
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      x[i] = 0.;
+
+    cvg = cs_sles_ldlt_solve(c, "ldlt_test", a, 0, CS_HALO_ROTATION_IGNORE,
+                             1e-12, r_norm, &n_iter, &residue,
+                             rhs, x, 0, NULL);
+
+    /* The solution of a pure Neumann system is defined up to a constant */
+
+    double  shift = 0.;
+    if (neumann) {
+      for (cs_lnum_t i = 0; i < n_rows; i++)
+        shift += x_ref[i] - x[i];
+      shift /= n_rows;
+    }
+
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      err_max = fmax(err_max, fabs(x[i] + shift - x_ref[i]));
+
+  }
+
+  bool  ok = (cvg == CS_SLES_CONVERGED && err_max < 1e-8);
+
+  fprintf(out, "\n Sparse LDL^T solve (%s matrix, %s system)\n",
+          cs_matrix_type_name[m_type], (neumann) ? "Neumann" : "SPD");
+  fprintf(out, "  n_iter: %d; residue/r_norm: % .4e; max. error: % .4e %s\n",
+          n_iter, residue/r_norm, err_max, (ok) ? "ok" : "FAILED");
+
+  if (!ok)
+    _n_failures++;
+
+  cs_sles_ldlt_destroy((void **)&c);
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(rhs);
+  BFT_FREE(x);
+  BFT_FREE(x_ref);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+  BFT_FREE(edges);
+}
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+  {
+    int t_id;
+#pragma omp parallel private(t_id)
+    {
+      t_id = omp_get_thread_num();
+      if (t_id == 0)
+        cs_glob_n_threads = omp_get_max_threads();
+    }
+  }
+#endif
+
+  ldlt = fopen("LDLT_tests.log", "w");
+
+  /* ===================================
+   * TEST on the fill-reducing ordering
+   * =================================== */
+
+  _test_ordering(ldlt);
+
+  /* ==============================
+   * TEST on the LDL^T direct solve
+   * ============================== */
+
+  _test_solve(ldlt, CS_MATRIX_NATIVE, false);
+  _test_solve(ldlt, CS_MATRIX_MSR, false);
+  _test_solve(ldlt, CS_MATRIX_CSR, true);
+  _test_solve(ldlt, CS_MATRIX_MSR, true);
+
+  fclose(ldlt);
+
+  if (_n_failures > 0) {
+    printf("\n\n -->> LDLT Tests (%d failure(s), see LDLT_tests.log)\n",
+           _n_failures);
+    exit(EXIT_FAILURE);
+  }
+
+  printf("\n\n -->> LDLT Tests (Done)\n");
+  exit(EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
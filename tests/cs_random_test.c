@@ -284,6 +284,68 @@ _poisson_test(cs_lnum_t   n,
   }
 }
 
+static void
+_stream_test(cs_lnum_t   n,
+             cs_real_t  *x)
+{
+  int i, k;
+  double u[2], y[9], x1, x2, x4;
+  double t1, t2;
+  cs_random_stream_t s;
+
+  /* Known answer test (Philox4x32-10, zero key and counter:
+     6627e8d5 e169c58d bc57ac4c 9b00dbd8) */
+
+  cs_random_stream_seed(0);
+  cs_random_stream_init(&s, 0, 0);
+  cs_random_stream_uniform(&s, 2, u);
+
+  uint64_t i0 = ((uint64_t)(0x6627e8d5U >> 5) << 26) | (0xe169c58dU >> 6);
+  uint64_t i1 = ((uint64_t)(0xbc57ac4cU >> 5) << 26) | (0x9b00dbd8U >> 6);
+  if (   u[0] != ((double)i0 + 0.5) / 9007199254740992.
+      || u[1] != ((double)i1 + 0.5) / 9007199254740992.)
+    printf("ERROR in counter-based stream known answer test\n");
+  else
+    printf("    counter-based stream known answer test OK\n");
+
+  /* Set of streams must match individual streams */
+
+  cs_lnum_t n_s = n / 9;
+
+  t1 = cs_timer_wtime();
+  cs_random_stream_normal_set(n_s, NULL, 1000, 42, 9, x);
+  t2 = cs_timer_wtime();
+
+  double diff = 0.;
+  for (i = 0; i < n_s; i += 97) {
+    cs_random_stream_init(&s, 1000 + i, 42);
+    cs_random_stream_normal(&s, 9, y);
+    for (k = 0; k < 9; k++)
+      diff += (y[k] - x[i*9 + k])*(y[k] - x[i*9 + k]);
+  }
+  if (diff > 0.)
+    printf("ERROR in counter-based stream set: diff = %e\n", diff);
+  else
+    printf("    counter-based stream set test OK\n");
+
+  x1 = 0.;
+  x2 = 0.;
+  x4 = 0.;
+  for (i = 0; i < n_s*9; ++i) {
+    x1 += x[i];
+    x2 += x[i]*x[i];
+    x4 += x[i]*x[i]*x[i]*x[i];
+  }
+  x1 /= (double) (n_s*9);
+  x2 /= (double) (n_s*9);
+  x4 /= (double) (n_s*9);
+
+  printf("\n    Time/stream normal = %e seconds \n", (t2-t1) / (n_s*9));
+  printf("    Moments: \n");
+  printf("      Compare to (0.0)     (1.0)     (3.0) \n");
+  printf("              %e %e %e\n", x1, x2, x4);
+}
+
 /*---------------------------------------------------------------------------*/
 
 int
@@ -336,5 +398,14 @@ main (int argc, char *argv[])
   printf("Fischer distribution for %d values in %f seconds\n",
          NPTS, wt1 - wt0);
 
+  wt0 = cs_timer_wtime();
+
+  _stream_test(NPTS, a);
+
+  wt1 = cs_timer_wtime();
+
+  printf("Counter-based streams for %d values in %f seconds\n",
+         NPTS, wt1 - wt0);
+
   exit(EXIT_SUCCESS);
 }